@@ -449,6 +449,24 @@ abstract public class GlcdBaseDriver implements GlcdDisplayDriver {
         adapter.drawXBM(x, y, width, height, data);
     }
 
+    @Override
+    public int uploadSprite(byte[] data, int width, int height, int format) {
+        checkRequirements();
+        return adapter.uploadSprite(data, width, height, format);
+    }
+
+    @Override
+    public boolean drawSprite(int handle, int x, int y) {
+        checkRequirements();
+        return adapter.drawSprite(handle, x, y);
+    }
+
+    @Override
+    public boolean evictSprite(int handle) {
+        checkRequirements();
+        return adapter.evictSprite(handle);
+    }
+
     @Override
     public int drawUTF8(String value) {
         checkRequirements();
@@ -467,6 +485,12 @@ abstract public class GlcdBaseDriver implements GlcdDisplayDriver {
         return adapter.getUTF8Width(text);
     }
 
+    @Override
+    public int[] drawTextRuns(String[] texts, int[] params) {
+        checkRequirements();
+        return adapter.drawTextRuns(texts, params);
+    }
+
     @Override
     public void setFont(byte[] data) {
         checkRequirements();
@@ -764,6 +788,174 @@ abstract public class GlcdBaseDriver implements GlcdDisplayDriver {
         return adapter.exportToPBM2();
     }
 
+    @Override
+    public int exportBuffer(int format, ByteBuffer buffer) {
+        checkRequirements();
+        return adapter.exportBuffer(format, buffer);
+    }
+
+    @Override
+    public int getExportSize(int format) {
+        checkRequirements();
+        return adapter.getExportSize(format);
+    }
+
+    @Override
+    public void startRecording(String path, int capacity, int keyframeInterval) {
+        checkRequirements();
+        adapter.startRecording(path, capacity, keyframeInterval);
+    }
+
+    @Override
+    public void stopRecording() {
+        checkRequirements();
+        adapter.stopRecording();
+    }
+
+    @Override
+    public int getStatistics(long[] stats) {
+        checkRequirements();
+        return adapter.getStatistics(stats);
+    }
+
+    @Override
+    public void resetStatistics() {
+        checkRequirements();
+        adapter.resetStatistics();
+    }
+
+    @Override
+    public void startFrameScheduler(int fps, boolean adaptive) {
+        checkRequirements();
+        adapter.startFrameScheduler(fps, adaptive);
+    }
+
+    @Override
+    public void stopFrameScheduler() {
+        checkRequirements();
+        adapter.stopFrameScheduler();
+    }
+
+    @Override
+    public int waitFrame(int timeout) {
+        checkRequirements();
+        return adapter.waitFrame(timeout);
+    }
+
+    @Override
+    public void beginDisplayList() {
+        checkRequirements();
+        adapter.beginDisplayList();
+    }
+
+    @Override
+    public int endDisplayList() {
+        checkRequirements();
+        return adapter.endDisplayList();
+    }
+
+    @Override
+    public int renderDisplayList() {
+        checkRequirements();
+        return adapter.renderDisplayList();
+    }
+
+    @Override
+    public int getEmulatorImage(byte[] image, boolean effects) {
+        checkRequirements();
+        return adapter.getEmulatorImage(image, effects);
+    }
+
+    @Override
+    public int getEmulatorStatistics(long[] stats) {
+        checkRequirements();
+        return adapter.getEmulatorStatistics(stats);
+    }
+
+    @Override
+    public void scrollBuffer(int x, int y, int width, int height, int dx, int dy, boolean fill) {
+        checkRequirements();
+        adapter.scrollBuffer(x, y, width, height, dx, dy, fill);
+    }
+
+    @Override
+    public void startHardwareScroll(int direction, int startPage, int endPage, int interval, int verticalOffset) {
+        checkRequirements();
+        adapter.startHardwareScroll(direction, startPage, endPage, interval, verticalOffset);
+    }
+
+    @Override
+    public void stopHardwareScroll() {
+        checkRequirements();
+        adapter.stopHardwareScroll();
+    }
+
+    @Override
+    public int createLayer(int z, int op) {
+        checkRequirements();
+        return adapter.createLayer(z, op);
+    }
+
+    @Override
+    public boolean removeLayer(int handle) {
+        checkRequirements();
+        return adapter.removeLayer(handle);
+    }
+
+    @Override
+    public void clearLayers() {
+        checkRequirements();
+        adapter.clearLayers();
+    }
+
+    @Override
+    public boolean beginLayer(int handle) {
+        checkRequirements();
+        return adapter.beginLayer(handle);
+    }
+
+    @Override
+    public void endLayer() {
+        checkRequirements();
+        adapter.endLayer();
+    }
+
+    @Override
+    public boolean setLayerVisible(int handle, boolean visible) {
+        checkRequirements();
+        return adapter.setLayerVisible(handle, visible);
+    }
+
+    @Override
+    public boolean setLayerOffset(int handle, int x, int y) {
+        checkRequirements();
+        return adapter.setLayerOffset(handle, x, y);
+    }
+
+    @Override
+    public boolean setLayerZOrder(int handle, int z) {
+        checkRequirements();
+        return adapter.setLayerZOrder(handle, z);
+    }
+
+    @Override
+    public boolean setLayerOp(int handle, int op) {
+        checkRequirements();
+        return adapter.setLayerOp(handle, op);
+    }
+
+    @Override
+    public int[] getDirtyArea() {
+        checkRequirements();
+        return adapter.getDirtyArea();
+    }
+
+    @Override
+    public void blitCanvas(long canvasId, int srcX, int srcY, int width, int height, int x, int y) {
+        checkRequirements();
+        adapter.blitCanvas(canvasId, srcX, srcY, width, height, x, y);
+    }
+
     @Override
     public void sendCommand(String format, byte... args) {
         checkRequirements();
@@ -794,6 +986,12 @@ abstract public class GlcdBaseDriver implements GlcdDisplayDriver {
         adapter.drawPixelsBgra(x, y, width, height, buffer);
     }
 
+    @Override
+    public void setDitherMode(int mode, int threshold) {
+        checkRequirements();
+        adapter.setDitherMode(mode, threshold);
+    }
+
     @Override
     public final long getId() {
         return adapter.getId();
@@ -21,6 +21,7 @@
  */
 package com.ibasco.ucgdisplay.drivers.glcd;
 
+import com.ibasco.ucgdisplay.drivers.glcd.enums.GlcdBufferSize;
 import com.ibasco.ucgdisplay.drivers.glcd.enums.GlcdCommProtocol;
 import com.ibasco.ucgdisplay.drivers.glcd.enums.GlcdSize;
 import com.ibasco.ucgdisplay.drivers.glcd.exceptions.GlcdConfigException;
@@ -126,14 +127,49 @@ public class GlcdConfig {
     }
 
     /**
-     * @return The u8g2 setup procedure that is going to be used by native library
+     * @return The u8g2 setup procedure that is going to be used by native library. The page buffer variant (_1 or _2) is selected if {@link GlcdOption#BUFFER_SIZE} is set.
      */
     public String getSetupProcedure() {
         if (StringUtils.isBlank(setupProcedure))
-            setupProcedure = lookupSetupInfo().getFunction();
+            setupProcedure = toBufferVariant(lookupSetupInfo().getFunction(), getBufferSize());
         return setupProcedure;
     }
 
+    /**
+     * @return The buffer size specified by {@link GlcdOption#BUFFER_SIZE} or {@link GlcdBufferSize#FULL_FRAME_BUFFER} if not set
+     */
+    public GlcdBufferSize getBufferSize() {
+        Object value = options.get(GlcdOption.BUFFER_SIZE.getName());
+        if (value instanceof GlcdBufferSize)
+            return (GlcdBufferSize) value;
+        if (value instanceof Integer) {
+            for (GlcdBufferSize size : GlcdBufferSize.values()) {
+                if (size.toValue().equals(value))
+                    return size;
+            }
+        }
+        return GlcdBufferSize.FULL_FRAME_BUFFER;
+    }
+
+    /**
+     * @return The number of tile rows (8 pixels each) held by the pixel buffer of the selected setup procedure
+     */
+    public int getBufferTileHeight() {
+        int tileHeight = getDisplaySize().getTileHeight();
+        String function = getSetupProcedure();
+        if (function.endsWith("_1"))
+            return Math.min(1, tileHeight);
+        if (function.endsWith("_2"))
+            return Math.min(2, tileHeight);
+        return tileHeight;
+    }
+
+    private static String toBufferVariant(String function, GlcdBufferSize bufferSize) {
+        if (bufferSize == GlcdBufferSize.FULL_FRAME_BUFFER || !function.endsWith("_f"))
+            return function;
+        return function.substring(0, function.length() - 1) + (bufferSize == GlcdBufferSize.PAGE_BUFFER_1 ? "1" : "2");
+    }
+
     /**
      * Finds the suitable u8g2 setup procedure based on the selected display controller and bus interface
      *
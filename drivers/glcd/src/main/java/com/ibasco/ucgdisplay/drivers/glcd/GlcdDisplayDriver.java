@@ -455,6 +455,17 @@ public interface GlcdDisplayDriver extends DisplayDriver {
      */
     void drawPixelsBgra(int x, int y, int width, int height, byte[] buffer);
 
+    /**
+     * <p>Sets the method used to convert the BGRA pixels of {@link #drawPixelsBgra(int, int, int, int, byte[])} to monochrome.
+     * Except for the default mode (U8g2Graphics.DITHER_NONE), the pixels are drawn opaque.</p>
+     *
+     * @param mode
+     *         One of the U8g2Graphics.DITHER_* constants
+     * @param threshold
+     *         The luma threshold (0 - 255) used by the threshold and error diffusion modes
+     */
+    void setDitherMode(int mode, int threshold);
+
     /**
      * <p>Draw a box with round edges, starting at x/y position (upper left edge). The box/frame has width w and height
      * h. Parts of the box can be outside of the display boundaries. Edges have radius r. It is required that w &gt;=
@@ -681,6 +692,50 @@ public interface GlcdDisplayDriver extends DisplayDriver {
      */
     void drawXBM(int x, int y, int width, int height, byte[] data);
 
+    /**
+     * <p>Stores a monochrome image in the native sprite store of the display. Drawing the returned handle with
+     * {@link #drawSprite(int, int, int)} does not transfer the image data again.</p>
+     *
+     * @param data
+     *         The image data
+     * @param width
+     *         Width of the image
+     * @param height
+     *         Height of the image
+     * @param format
+     *         Either U8g2Graphics.SPRITE_FORMAT_XBM or U8g2Graphics.SPRITE_FORMAT_1BPP
+     *
+     * @return The handle of the sprite
+     *
+     * @see GlcdOption#SPRITE_BUDGET
+     */
+    int uploadSprite(byte[] data, int width, int height, int format);
+
+    /**
+     * <p>Draws a sprite stored via {@link #uploadSprite(byte[], int, int, int)}. Position (x,y) is the upper left corner of
+     * the sprite. The sprite is drawn the same way as {@link #drawXBM(int, int, int, int, byte[])}.</p>
+     *
+     * @param handle
+     *         The handle of the sprite
+     * @param x
+     *         The x-coordinate
+     * @param y
+     *         The y-coordinate
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean drawSprite(int handle, int x, int y);
+
+    /**
+     * Releases a sprite from the native sprite store
+     *
+     * @param handle
+     *         The handle of the sprite
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean evictSprite(int handle);
+
     /**
      * <p>Draw a string which is encoded as UTF-8. There are two preconditions for the use of this function:
      * (A) <strike>the C/C++/Arduino compiler must support UTF-8 encoding (this is default for the gnu compiler, which is also
@@ -739,6 +794,22 @@ public interface GlcdDisplayDriver extends DisplayDriver {
      */
     int getUTF8Width(String text);
 
+    /**
+     * <p>Measure and draw multiple text runs in a single native call. Each run is aligned on its anchor point using the
+     * natively computed string width.</p>
+     *
+     * @param texts
+     *         The text of each run
+     * @param params
+     *         Three values per run: x, y and the alignment flags (see U8g2Graphics.TEXT_ALIGN_* and U8g2Graphics.TEXT_MEASURE_ONLY)
+     *
+     * @return Four values per run: the x, y, width and height of the bounding box of the run
+     *
+     * @apiNote This drawing function depends on the current font, font mode, font direction and drawing color.
+     * @see #getUTF8Width(String)
+     */
+    int[] drawTextRuns(String[] texts, int[] params);
+
     /**
      * <p> Define a u8g2 font for the glyph and string drawing functions. Note: u8x8 font can NOT be used. Available
      * fonts are listed here here. The last two characters of the font name define the type and character set for the
@@ -1636,6 +1707,312 @@ public interface GlcdDisplayDriver extends DisplayDriver {
      */
     String exportToPBM2();
 
+    /**
+     * <p>Encodes the current display buffer into a direct buffer without any intermediate copies</p>
+     *
+     * @param format
+     *         One of the U8g2Graphics.EXPORT_FORMAT_* constants (raw, PBM, XBM or PNG)
+     * @param buffer
+     *         A direct buffer large enough to hold the encoded image (see {@link #getExportSize(int)})
+     *
+     * @return The number of bytes written, starting at index 0 of the buffer
+     */
+    int exportBuffer(int format, ByteBuffer buffer);
+
+    /**
+     * @param format
+     *         One of the U8g2Graphics.EXPORT_FORMAT_* constants (raw, PBM, XBM or PNG)
+     *
+     * @return The number of bytes written by {@link #exportBuffer(int, ByteBuffer)} for the current display buffer
+     */
+    int getExportSize(int format);
+
+    /**
+     * <p>Start recording every frame sent to the display into a memory mapped ring file. Frames are stored as compressed
+     * differences with a timestamp. Use U8g2Graphics.getRecordingInfo(String) and U8g2Graphics.readRecording(...) to
+     * replay the file.</p>
+     *
+     * @param path
+     *         The path of the recording file (overwritten)
+     * @param capacity
+     *         The maximum size of the recorded data in bytes. The oldest frames are dropped once it is reached.
+     * @param keyframeInterval
+     *         Store a complete frame every n frames
+     */
+    void startRecording(String path, int capacity, int keyframeInterval);
+
+    /**
+     * Stop the recording started by {@link #startRecording(String, int, int)}
+     */
+    void stopRecording();
+
+    /**
+     * Reads the transport and render counters of the display (frames sent, bytes and transport calls per frame, time
+     * spent in the callbacks and delays, send latency percentiles).
+     *
+     * @param stats
+     *         Receives the values indexed by the U8g2Graphics.STATS_* constants
+     *
+     * @return The number of values written
+     */
+    int getStatistics(long[] stats);
+
+    /**
+     * Resets the counters returned by {@link #getStatistics(long[])}
+     */
+    void resetStatistics();
+
+    /**
+     * <p>Pace the frames of this display with a native timer instead of sleeping between frames. The render loop blocks
+     * in {@link #waitFrame(int)} until the next tick, then draws and sends the frame. In adaptive mode the rate is
+     * lowered when the transport cannot deliver frames at the target rate (measured by {@link #sendBuffer()} and
+     * {@link #renderDisplayList()}) and raised back once it can. Linux only.</p>
+     *
+     * @param fps
+     *         The target frame rate (1 to 1000)
+     * @param adaptive
+     *         Lower the rate when the transport cannot keep up
+     */
+    void startFrameScheduler(int fps, boolean adaptive);
+
+    /**
+     * Stop the frame scheduler started by {@link #startFrameScheduler(int, boolean)}, a blocked {@link #waitFrame(int)} returns -1
+     */
+    void stopFrameScheduler();
+
+    /**
+     * Block until the next tick of the frame scheduler. Ticks missed because the previous frame was late are counted in
+     * the U8g2Graphics.STATS_MISSED_DEADLINES statistic.
+     *
+     * @param timeout
+     *         Maximum time to wait in milliseconds (negative to wait until the next tick)
+     *
+     * @return The number of ticks since the previous call, 0 on timeout or -1 if no scheduler is running
+     */
+    int waitFrame(int timeout);
+
+    /**
+     * <p>Start recording a display list. Until {@link #endDisplayList()} is called, the draw functions are recorded instead of
+     * being drawn. Font, color, bitmap mode and clip window changes are applied immediately and recorded. A previously
+     * recorded list is discarded.</p>
+     *
+     * <p>Use this with a page buffer ({@link GlcdOption#BUFFER_SIZE}) to draw a frame without running a firstPage()/nextPage()
+     * loop in Java. drawBitmap, drawTextRuns, drawPixels, blit, sendBuffer and the page loop functions are not supported
+     * while recording.</p>
+     *
+     * @see #renderDisplayList()
+     */
+    void beginDisplayList();
+
+    /**
+     * Stop recording the display list
+     *
+     * @return The number of recorded operations
+     */
+    int endDisplayList();
+
+    /**
+     * Draws the recorded display list and sends it to the display, one page at a time for page buffer setup procedures.
+     *
+     * @return The number of pages sent to the display
+     */
+    int renderDisplayList();
+
+    /**
+     * Reads the image of the emulated display controller (virtual displays only). The image has the same layout and size as
+     * the display buffer.
+     *
+     * @param image
+     *         Receives the image
+     * @param effects
+     *         If true, the display on/off, inversion, all pixels on and start line settings of the controller are applied
+     *
+     * @return The number of bytes written or -1 if the controller is not emulated
+     */
+    int getEmulatorImage(byte[] image, boolean effects);
+
+    /**
+     * Reads the command statistics and state of the emulated display controller (virtual displays only)
+     *
+     * @param stats
+     *         Receives the values indexed by the U8g2Graphics.EMU_STATS_* constants
+     *
+     * @return The number of values written or -1 if the controller is not emulated
+     */
+    int getEmulatorStatistics(long[] stats);
+
+    /**
+     * Shifts a region of the display buffer by dx, dy pixels. Pixels moved out of the region are discarded and the vacated
+     * pixels are set to the fill value (see U8g2Graphics.scrollBuffer).
+     *
+     * @param x
+     *         X-coordinate of the region
+     * @param y
+     *         Y-coordinate of the region
+     * @param width
+     *         Width of the region
+     * @param height
+     *         Height of the region
+     * @param dx
+     *         Horizontal distance in pixels (positive = right)
+     * @param dy
+     *         Vertical distance in pixels (positive = down)
+     * @param fill
+     *         Value of the vacated pixels
+     */
+    void scrollBuffer(int x, int y, int width, int height, int dx, int dy, boolean fill);
+
+    /**
+     * Activates the continuous scroll of the display controller (SSD1306/SSD1309 only). Stop the scroll before sending the
+     * buffer again.
+     *
+     * @param direction
+     *         One of the U8g2Graphics.SCROLL_* constants
+     * @param startPage
+     *         The first page (8 pixel row) to scroll
+     * @param endPage
+     *         The last page to scroll
+     * @param interval
+     *         The frame interval code of the controller (0 to 7)
+     * @param verticalOffset
+     *         The number of rows scrolled per step (vertical directions only)
+     */
+    void startHardwareScroll(int direction, int startPage, int endPage, int interval, int verticalOffset);
+
+    /**
+     * Deactivates the continuous scroll of the display controller (SSD1306/SSD1309 only)
+     */
+    void stopHardwareScroll();
+
+    /**
+     * <p>Creates an offscreen monochrome layer the size of the display buffer. Static parts of a screen are drawn into a
+     * layer once, only the changing values are drawn into the display buffer for each frame. The visible layers are
+     * composited into the display buffer in ascending z-order when it is sent.</p>
+     *
+     * <p>The buffer holds the composited frame once it has been sent and must be cleared before the next frame is drawn.
+     * Requires a full buffer setup procedure.</p>
+     *
+     * @param z
+     *         The z-order of the layer
+     * @param op
+     *         One of the U8g2Graphics.LAYER_OP_* constants (OR, AND-NOT mask or XOR)
+     *
+     * @return The handle of the layer
+     *
+     * @see GlcdOption#PARTIAL_UPDATE
+     */
+    int createLayer(int z, int op);
+
+    /**
+     * Releases a layer
+     *
+     * @param handle
+     *         The handle of the layer
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean removeLayer(int handle);
+
+    /**
+     * Releases all layers of the display
+     */
+    void clearLayers();
+
+    /**
+     * Redirects all drawing operations to the layer until {@link #endLayer()} is called. The content of the layer is kept.
+     *
+     * @param handle
+     *         The handle of the layer
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean beginLayer(int handle);
+
+    /**
+     * Draws into the display buffer again
+     */
+    void endLayer();
+
+    /**
+     * Shows or hides a layer
+     *
+     * @param handle
+     *         The handle of the layer
+     * @param visible
+     *         {@code true} to composite the layer
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean setLayerVisible(int handle, boolean visible);
+
+    /**
+     * Moves a layer by x, y pixels
+     *
+     * @param handle
+     *         The handle of the layer
+     * @param x
+     *         The horizontal offset
+     * @param y
+     *         The vertical offset
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean setLayerOffset(int handle, int x, int y);
+
+    /**
+     * Changes the z-order of a layer
+     *
+     * @param handle
+     *         The handle of the layer
+     * @param z
+     *         The z-order (lower values are composited first)
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean setLayerZOrder(int handle, int z);
+
+    /**
+     * Changes the blend operation of a layer
+     *
+     * @param handle
+     *         The handle of the layer
+     * @param op
+     *         One of the U8g2Graphics.LAYER_OP_* constants (OR, AND-NOT mask or XOR)
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    boolean setLayerOp(int handle, int op);
+
+    /**
+     * Returns the area of the last composited frame that changed since the frame before it (tiles of 8x8 pixels). The
+     * whole display is returned if the display has no layers.
+     *
+     * @return The area as {x, y, width, height}, the width and height are 0 if nothing changed
+     */
+    int[] getDirtyArea();
+
+    /**
+     * Copies an area of an offscreen canvas (U8g2Graphics.createCanvas) into the buffer of this display, set and unset
+     * pixels are both copied. The frame is rendered once into the canvas and copied to any number of displays, either the
+     * whole canvas (mirroring) or a different part of it for each display (one canvas spanning a grid of displays).
+     *
+     * @param canvasId
+     *         The canvas id
+     * @param srcX
+     *         X-coordinate of the area in the canvas
+     * @param srcY
+     *         Y-coordinate of the area in the canvas
+     * @param width
+     *         Width of the area
+     * @param height
+     *         Height of the area
+     * @param x
+     *         X-coordinate of the area on this display
+     * @param y
+     *         Y-coordinate of the area on this display
+     */
+    void blitCanvas(long canvasId, int srcX, int srcY, int width, int height, int x, int y);
+
     /**
      * <p>Send special commands to the display controller. These commands are specified in the datasheet of the display
      * controller. U8g2 just provides an interface (There is no support on the functionality for these commands).
@@ -152,6 +152,84 @@ public class GlcdOption<T> {
      */
     public static final GlcdOption<Boolean> EXTRA_DEBUG_INFO = createOption("extra_debug_info");
 
+    /**
+     * The memory budget (in bytes) of the native decoded glyph cache used by the text drawing functions. Set to 0 to disable the cache (Default: 65536).
+     */
+    public static final GlcdOption<Integer> GLYPH_CACHE_SIZE = createOption("glyph_cache_size");
+
+    /**
+     * The memory budget (in bytes) of the native sprite store, including the copies converted to the buffer layout of the display (Default: 65536).
+     */
+    public static final GlcdOption<Integer> SPRITE_BUDGET = createOption("sprite_budget");
+
+    /**
+     * Set to 1 to draw rotated displays (R1, R2 and R3) into an unrotated native canvas, rotated as a whole when the buffer is sent.
+     * Drawing is as fast as with R0, each sent frame costs one extra pass over the buffer. Full buffer setup procedures only (Default: 0).
+     */
+    public static final GlcdOption<Integer> ROTATE_AT_SEND = createOption("rotate_at_send");
+
+    /**
+     * Set to 1 to transmit only the tiles that changed since the previous frame while the display has layers (see
+     * {@link GlcdDisplayDriver#createLayer(int, int)}). Nothing is transmitted if the frame did not change. The display
+     * controller must support partial updates (u8g2_UpdateDisplayArea) (Default: 0).
+     */
+    public static final GlcdOption<Integer> PARTIAL_UPDATE = createOption("partial_update");
+
+    /**
+     * The path of the font pack (generated by ucgd-code) holding the fonts that are not embedded in the native library.
+     * The pack is memory mapped on the first lookup of such a font and only the fonts in use are read from it. Applies to
+     * the whole process and must be set by the first display that loads a font from the pack. If empty, the
+     * UCGD_FONT_PACK environment variable and then ucgd-fonts.pack next to the native library are used.
+     */
+    public static final GlcdOption<String> FONT_PACK = createOption("font_pack");
+
+    /**
+     * The number of times a failed SPI/I2C/GPIO write is repeated before the rest of the frame is skipped and the error is
+     * thrown at the end of the call (Default: 0).
+     */
+    public static final GlcdOption<Integer> TRANSPORT_RETRIES = createOption("transport_retries");
+
+    /**
+     * The wait (in microseconds) before the first retry of a failed write, doubled for each following retry up to 100 ms (Default: 100).
+     */
+    public static final GlcdOption<Integer> TRANSPORT_BACKOFF = createOption("transport_backoff");
+
+    /**
+     * Simulated provider only. The fixed cost (in nanoseconds) of each SPI/I2C transaction (Default: 0).
+     */
+    public static final GlcdOption<Integer> SIM_LATENCY = createOption("sim_latency");
+
+    /**
+     * Simulated provider only. The upper bound (in nanoseconds) of the random delay added to each SPI/I2C transaction (Default: 0).
+     */
+    public static final GlcdOption<Integer> SIM_JITTER = createOption("sim_jitter");
+
+    /**
+     * Simulated provider only. The cost (in nanoseconds) of each GPIO write (Default: 0).
+     */
+    public static final GlcdOption<Integer> SIM_GPIO_LATENCY = createOption("sim_gpio_latency");
+
+    /**
+     * Simulated provider only. The path of the file receiving the captured bus traffic, one transaction per line. Nothing is captured if empty.
+     */
+    public static final GlcdOption<String> SIM_CAPTURE = createOption("sim_capture");
+
+    /**
+     * The name of the POSIX shared memory object (e.g. /ucgd-oled) receiving each completed frame. Local processes can map it
+     * and read the frames without going through the JVM (see UcgdFrameShm.h for the layout). Nothing is published if empty.
+     */
+    public static final GlcdOption<String> SHM_NAME = createOption("shm_name");
+
+    /**
+     * The number of frames kept in the shared memory ring, 2 to 64 (Default: 4).
+     */
+    public static final GlcdOption<Integer> SHM_SLOTS = createOption("shm_slots");
+
+    /**
+     * The images published to shared memory: 1 = 1bpp (display buffer layout), 2 = BGRA (virtual displays only), 3 = both (Default: 3).
+     */
+    public static final GlcdOption<Integer> SHM_FORMAT = createOption("shm_format");
+
     private final String name;
 
     /**
@@ -63,7 +63,8 @@ public class U8g2DriverAdapter implements GlcdDriverAdapter {
         if (config.getOption(GlcdOption.ROTATION) != null) {
             rotation = config.getOption(GlcdOption.ROTATION);
         }
-        int size = 8 * config.getDisplay().getDisplaySize().getTileWidth() * config.getDisplay().getDisplaySize().getTileHeight();
+        //page buffer procedures (_1/_2) only hold one or two tile rows, the bgra buffer always covers the whole display
+        int size = 8 * config.getDisplay().getDisplaySize().getTileWidth() * config.getBufferTileHeight();
         buffer = ByteBuffer.allocateDirect(size);
         if (virtual) {
             int bgraSize = config.getDisplay().getDisplaySize().getDisplayWidth() * config.getDisplay().getDisplaySize().getDisplayHeight() * 4;
@@ -220,6 +221,12 @@ public class U8g2DriverAdapter implements GlcdDriverAdapter {
         U8g2Graphics.drawPixelsBgra(_id, x, y, width, height, buffer);
     }
 
+    @Override
+    public void setDitherMode(int mode, int threshold) {
+        checkRequirements();
+        U8g2Graphics.setDitherMode(_id, mode, threshold);
+    }
+
     @Override
     public void drawRoundedBox(int width, int height, int radius) {
         drawRoundedBox(x, y, width, height, radius);
@@ -301,6 +308,24 @@ public class U8g2DriverAdapter implements GlcdDriverAdapter {
         U8g2Graphics.drawXBM(_id, x, y, width, height, data);
     }
 
+    @Override
+    public int uploadSprite(byte[] data, int width, int height, int format) {
+        checkRequirements();
+        return U8g2Graphics.uploadSprite(_id, data, width, height, format);
+    }
+
+    @Override
+    public boolean drawSprite(int handle, int x, int y) {
+        checkRequirements();
+        return U8g2Graphics.drawSprite(_id, handle, x, y);
+    }
+
+    @Override
+    public boolean evictSprite(int handle) {
+        checkRequirements();
+        return U8g2Graphics.evictSprite(_id, handle);
+    }
+
     @Override
     public int drawUTF8(String value) {
         return drawUTF8(x, y, value);
@@ -319,6 +344,12 @@ public class U8g2DriverAdapter implements GlcdDriverAdapter {
         return U8g2Graphics.getUTF8Width(_id, text);
     }
 
+    @Override
+    public int[] drawTextRuns(String[] texts, int[] params) {
+        checkRequirements();
+        return U8g2Graphics.drawTextRuns(_id, texts, params);
+    }
+
     @Override
     public void setFont(byte[] data) {
         checkRequirements();
@@ -617,6 +648,174 @@ public class U8g2DriverAdapter implements GlcdDriverAdapter {
         return U8g2Graphics.exportToPBM2(_id);
     }
 
+    @Override
+    public int exportBuffer(int format, ByteBuffer buffer) {
+        checkRequirements();
+        return U8g2Graphics.exportBuffer(_id, format, buffer);
+    }
+
+    @Override
+    public int getExportSize(int format) {
+        checkRequirements();
+        return U8g2Graphics.getExportSize(_id, format);
+    }
+
+    @Override
+    public void startRecording(String path, int capacity, int keyframeInterval) {
+        checkRequirements();
+        U8g2Graphics.startRecording(_id, path, capacity, keyframeInterval);
+    }
+
+    @Override
+    public void stopRecording() {
+        checkRequirements();
+        U8g2Graphics.stopRecording(_id);
+    }
+
+    @Override
+    public int getStatistics(long[] stats) {
+        checkRequirements();
+        return U8g2Graphics.getStatistics(_id, stats);
+    }
+
+    @Override
+    public void resetStatistics() {
+        checkRequirements();
+        U8g2Graphics.resetStatistics(_id);
+    }
+
+    @Override
+    public void startFrameScheduler(int fps, boolean adaptive) {
+        checkRequirements();
+        U8g2Graphics.startFrameScheduler(_id, fps, adaptive);
+    }
+
+    @Override
+    public void stopFrameScheduler() {
+        checkRequirements();
+        U8g2Graphics.stopFrameScheduler(_id);
+    }
+
+    @Override
+    public int waitFrame(int timeout) {
+        checkRequirements();
+        return U8g2Graphics.waitFrame(_id, timeout);
+    }
+
+    @Override
+    public void beginDisplayList() {
+        checkRequirements();
+        U8g2Graphics.beginDisplayList(_id);
+    }
+
+    @Override
+    public int endDisplayList() {
+        checkRequirements();
+        return U8g2Graphics.endDisplayList(_id);
+    }
+
+    @Override
+    public int renderDisplayList() {
+        checkRequirements();
+        return U8g2Graphics.renderDisplayList(_id);
+    }
+
+    @Override
+    public int getEmulatorImage(byte[] image, boolean effects) {
+        checkRequirements();
+        return U8g2Graphics.getEmulatorImage(_id, image, effects);
+    }
+
+    @Override
+    public int getEmulatorStatistics(long[] stats) {
+        checkRequirements();
+        return U8g2Graphics.getEmulatorStatistics(_id, stats);
+    }
+
+    @Override
+    public void scrollBuffer(int x, int y, int width, int height, int dx, int dy, boolean fill) {
+        checkRequirements();
+        U8g2Graphics.scrollBuffer(_id, x, y, width, height, dx, dy, fill);
+    }
+
+    @Override
+    public void startHardwareScroll(int direction, int startPage, int endPage, int interval, int verticalOffset) {
+        checkRequirements();
+        U8g2Graphics.startHardwareScroll(_id, direction, startPage, endPage, interval, verticalOffset);
+    }
+
+    @Override
+    public void stopHardwareScroll() {
+        checkRequirements();
+        U8g2Graphics.stopHardwareScroll(_id);
+    }
+
+    @Override
+    public int createLayer(int z, int op) {
+        checkRequirements();
+        return U8g2Graphics.createLayer(_id, z, op);
+    }
+
+    @Override
+    public boolean removeLayer(int handle) {
+        checkRequirements();
+        return U8g2Graphics.removeLayer(_id, handle);
+    }
+
+    @Override
+    public void clearLayers() {
+        checkRequirements();
+        U8g2Graphics.clearLayers(_id);
+    }
+
+    @Override
+    public boolean beginLayer(int handle) {
+        checkRequirements();
+        return U8g2Graphics.beginLayer(_id, handle);
+    }
+
+    @Override
+    public void endLayer() {
+        checkRequirements();
+        U8g2Graphics.endLayer(_id);
+    }
+
+    @Override
+    public boolean setLayerVisible(int handle, boolean visible) {
+        checkRequirements();
+        return U8g2Graphics.setLayerVisible(_id, handle, visible);
+    }
+
+    @Override
+    public boolean setLayerOffset(int handle, int x, int y) {
+        checkRequirements();
+        return U8g2Graphics.setLayerOffset(_id, handle, x, y);
+    }
+
+    @Override
+    public boolean setLayerZOrder(int handle, int z) {
+        checkRequirements();
+        return U8g2Graphics.setLayerZOrder(_id, handle, z);
+    }
+
+    @Override
+    public boolean setLayerOp(int handle, int op) {
+        checkRequirements();
+        return U8g2Graphics.setLayerOp(_id, handle, op);
+    }
+
+    @Override
+    public int[] getDirtyArea() {
+        checkRequirements();
+        return U8g2Graphics.getDirtyArea(_id);
+    }
+
+    @Override
+    public void blitCanvas(long canvasId, int srcX, int srcY, int width, int height, int x, int y) {
+        checkRequirements();
+        U8g2Graphics.blitCanvas(_id, canvasId, srcX, srcY, width, height, x, y);
+    }
+
     @Override
     public void sendCommand(String format, byte... args) {
         checkRequirements();
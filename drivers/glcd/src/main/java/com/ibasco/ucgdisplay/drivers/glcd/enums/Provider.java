@@ -58,7 +58,13 @@ public enum Provider implements GlcdOptionValue<String> {
      *
      * @see <a href="https://github.com/vsergeev/c-periphery">C-periphery website</a>
      */
-    SYSTEM("cperiphery");
+    SYSTEM("cperiphery"),
+    /**
+     * <p>Simulated SPI, I2C and GPIO transport, available on all platforms (default provider on non-ARM systems). No device is accessed,
+     * the time taken by each transaction is modelled from {@link com.ibasco.ucgdisplay.drivers.glcd.GlcdOption#BUS_SPEED} and the sim options, and the
+     * traffic can be captured to a file (see {@link com.ibasco.ucgdisplay.drivers.glcd.GlcdOption#SIM_CAPTURE}).</p>
+     */
+    SIMULATED("sim");
 
     private String value;
 
@@ -21,9 +21,11 @@
  */
 package com.ibasco.ucgdisplay.drivers.glcd;
 
+import com.ibasco.ucgdisplay.drivers.glcd.enums.GlcdBufferSize;
 import com.ibasco.ucgdisplay.drivers.glcd.enums.GlcdCommProtocol;
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertNotEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
 import org.junit.jupiter.api.Test;
 
 class GlcdConfigTest {
@@ -79,4 +81,28 @@ class GlcdConfigTest {
 
         assertNotEquals(configOne, configTwo);
     }
+
+    @Test
+    void testFullBufferSetupProcedureByDefault() {
+        GlcdConfig config = new GlcdConfig();
+        config.setDisplay(Glcd.ST7920.D_128x64);
+        config.setBusInterface(GlcdCommProtocol.SPI_SW_4WIRE_ST7920);
+
+        assertEquals(GlcdBufferSize.FULL_FRAME_BUFFER, config.getBufferSize());
+        assertTrue(config.getSetupProcedure().endsWith("_f"));
+        assertEquals(8, config.getBufferTileHeight());
+    }
+
+    @Test
+    void testPageBufferSetupProcedure() {
+        GlcdConfig config = new GlcdConfig();
+        config.setDisplay(Glcd.ST7920.D_128x64);
+        config.setBusInterface(GlcdCommProtocol.SPI_SW_4WIRE_ST7920);
+        //the builder stores the converted value of the enum
+        config.setOption(GlcdOption.BUFFER_SIZE.getName(), GlcdBufferSize.PAGE_BUFFER_2.toValue());
+
+        assertEquals(GlcdBufferSize.PAGE_BUFFER_2, config.getBufferSize());
+        assertTrue(config.getSetupProcedure().endsWith("_2"));
+        assertEquals(2, config.getBufferTileHeight());
+    }
 }
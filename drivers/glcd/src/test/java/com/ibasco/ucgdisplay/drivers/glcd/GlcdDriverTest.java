@@ -37,6 +37,7 @@ import static org.mockito.Mockito.*;
 import org.mockito.junit.jupiter.MockitoExtension;
 
 import java.io.File;
+import java.nio.ByteBuffer;
 
 @ExtendWith(MockitoExtension.class)
 class GlcdDriverTest {
@@ -613,6 +614,200 @@ class GlcdDriverTest {
         assertEquals(5, yCaptor.getValue().intValue());
         assertEquals("☃", text.getValue());
     }
+
+    @Test
+    void drawTextRuns() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        String[] texts = new String[] {"CPU", "☃"};
+        int[] params = new int[] {0, 10, 0, 64, 20, 1};
+        assertDoesNotThrow(() -> driver.drawTextRuns(texts, params));
+
+        ArgumentCaptor<String[]> textsCaptor = ArgumentCaptor.forClass(String[].class);
+        ArgumentCaptor<int[]> paramsCaptor = ArgumentCaptor.forClass(int[].class);
+
+        verify(mockDriverAdapter).drawTextRuns(textsCaptor.capture(), paramsCaptor.capture());
+
+        assertArrayEquals(texts, textsCaptor.getValue());
+        assertArrayEquals(params, paramsCaptor.getValue());
+    }
+
+    @Test
+    void setDitherMode() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        assertDoesNotThrow(() -> driver.setDitherMode(U8g2Graphics.DITHER_FLOYD_STEINBERG, 100));
+        verify(mockDriverAdapter).setDitherMode(U8g2Graphics.DITHER_FLOYD_STEINBERG, 100);
+    }
+
+    @Test
+    void drawSprite() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        byte[] data = new byte[] {0x18, 0x3c, 0x7e, (byte) 0xff};
+        when(mockDriverAdapter.uploadSprite(data, 8, 4, U8g2Graphics.SPRITE_FORMAT_XBM)).thenReturn(1);
+        when(mockDriverAdapter.drawSprite(1, 10, 20)).thenReturn(true);
+
+        int handle = driver.uploadSprite(data, 8, 4, U8g2Graphics.SPRITE_FORMAT_XBM);
+        assertEquals(1, handle);
+        assertTrue(driver.drawSprite(handle, 10, 20));
+        assertFalse(driver.evictSprite(2));
+
+        verify(mockDriverAdapter).drawSprite(1, 10, 20);
+        verify(mockDriverAdapter).evictSprite(2);
+    }
+
+    @Test
+    void exportBuffer() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        ByteBuffer buffer = ByteBuffer.allocateDirect(2048);
+        when(mockDriverAdapter.getExportSize(U8g2Graphics.EXPORT_FORMAT_PNG)).thenReturn(1200);
+        when(mockDriverAdapter.exportBuffer(U8g2Graphics.EXPORT_FORMAT_PNG, buffer)).thenReturn(1200);
+
+        assertEquals(1200, driver.getExportSize(U8g2Graphics.EXPORT_FORMAT_PNG));
+        assertEquals(1200, driver.exportBuffer(U8g2Graphics.EXPORT_FORMAT_PNG, buffer));
+        verify(mockDriverAdapter).exportBuffer(U8g2Graphics.EXPORT_FORMAT_PNG, buffer);
+    }
+
+    @Test
+    void startAndStopRecording() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+
+        driver.startRecording("/tmp/display.rec", 1048576, 128);
+        driver.stopRecording();
+
+        verify(mockDriverAdapter).startRecording("/tmp/display.rec", 1048576, 128);
+        verify(mockDriverAdapter).stopRecording();
+    }
+
+    @Test
+    void getAndResetStatistics() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        long[] stats = new long[U8g2Graphics.STATS_COUNT];
+        when(mockDriverAdapter.getStatistics(stats)).thenReturn(U8g2Graphics.STATS_COUNT);
+
+        assertEquals(U8g2Graphics.STATS_COUNT, driver.getStatistics(stats));
+        driver.resetStatistics();
+
+        verify(mockDriverAdapter).getStatistics(stats);
+        verify(mockDriverAdapter).resetStatistics();
+    }
+
+    @Test
+    void scheduleFrames() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        when(mockDriverAdapter.waitFrame(1000)).thenReturn(1, 3, -1);
+
+        driver.startFrameScheduler(30, true);
+        int frames = 0;
+        while (driver.waitFrame(1000) > 0) {
+            driver.sendBuffer();
+            frames++;
+        }
+        driver.stopFrameScheduler();
+
+        assertEquals(2, frames);
+        verify(mockDriverAdapter).startFrameScheduler(30, true);
+        verify(mockDriverAdapter, times(3)).waitFrame(1000);
+        verify(mockDriverAdapter, times(2)).sendBuffer();
+        verify(mockDriverAdapter).stopFrameScheduler();
+    }
+
+    @Test
+    void recordAndRenderDisplayList() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        when(mockDriverAdapter.endDisplayList()).thenReturn(2);
+        when(mockDriverAdapter.renderDisplayList()).thenReturn(8);
+
+        driver.beginDisplayList();
+        driver.drawBox(0, 0, 10, 10);
+        driver.drawLine(0, 0, 20, 20);
+        assertEquals(2, driver.endDisplayList());
+        assertEquals(8, driver.renderDisplayList());
+
+        verify(mockDriverAdapter).beginDisplayList();
+        verify(mockDriverAdapter).endDisplayList();
+        verify(mockDriverAdapter).renderDisplayList();
+    }
+
+    @Test
+    void readEmulatorImageAndStatistics() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        byte[] image = new byte[1024];
+        long[] stats = new long[U8g2Graphics.EMU_STATS_COUNT];
+        when(mockDriverAdapter.getEmulatorImage(image, true)).thenReturn(1024);
+        when(mockDriverAdapter.getEmulatorStatistics(stats)).thenReturn(U8g2Graphics.EMU_STATS_COUNT);
+
+        assertEquals(1024, driver.getEmulatorImage(image, true));
+        assertEquals(U8g2Graphics.EMU_STATS_COUNT, driver.getEmulatorStatistics(stats));
+
+        verify(mockDriverAdapter).getEmulatorImage(image, true);
+        verify(mockDriverAdapter).getEmulatorStatistics(stats);
+    }
+
+    @Test
+    void scrollBufferAndHardwareScroll() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+
+        driver.scrollBuffer(0, 0, 128, 16, -1, 0, false);
+        driver.startHardwareScroll(U8g2Graphics.SCROLL_LEFT, 0, 7, 7, 0);
+        driver.stopHardwareScroll();
+
+        verify(mockDriverAdapter).scrollBuffer(0, 0, 128, 16, -1, 0, false);
+        verify(mockDriverAdapter).startHardwareScroll(U8g2Graphics.SCROLL_LEFT, 0, 7, 7, 0);
+        verify(mockDriverAdapter).stopHardwareScroll();
+    }
+
+    @Test
+    void createAndCompositeLayers() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        when(mockDriverAdapter.createLayer(-1, U8g2Graphics.LAYER_OP_OR)).thenReturn(1);
+        when(mockDriverAdapter.beginLayer(1)).thenReturn(true);
+        when(mockDriverAdapter.getDirtyArea()).thenReturn(new int[] {0, 0, 16, 8});
+
+        int handle = driver.createLayer(-1, U8g2Graphics.LAYER_OP_OR);
+        assertEquals(1, handle);
+        assertTrue(driver.beginLayer(handle));
+        driver.drawFrame(0, 0, 128, 64);
+        driver.endLayer();
+        driver.setLayerOffset(handle, 2, 3);
+        driver.setLayerVisible(handle, false);
+        driver.setLayerZOrder(handle, 5);
+        driver.setLayerOp(handle, U8g2Graphics.LAYER_OP_XOR);
+        driver.sendBuffer();
+        assertArrayEquals(new int[] {0, 0, 16, 8}, driver.getDirtyArea());
+        driver.removeLayer(handle);
+        driver.clearLayers();
+
+        verify(mockDriverAdapter).createLayer(-1, U8g2Graphics.LAYER_OP_OR);
+        verify(mockDriverAdapter).beginLayer(1);
+        verify(mockDriverAdapter).endLayer();
+        verify(mockDriverAdapter).setLayerOffset(1, 2, 3);
+        verify(mockDriverAdapter).setLayerVisible(1, false);
+        verify(mockDriverAdapter).setLayerZOrder(1, 5);
+        verify(mockDriverAdapter).setLayerOp(1, U8g2Graphics.LAYER_OP_XOR);
+        verify(mockDriverAdapter).getDirtyArea();
+        verify(mockDriverAdapter).removeLayer(1);
+        verify(mockDriverAdapter).clearLayers();
+    }
+
+    @Test
+    void blitCanvas() {
+        updateValidConfig(config);
+        GlcdDriver driver = new GlcdDriver(config, true, mockEventHandler, mockDriverAdapter);
+        driver.blitCanvas(100L, 128, 0, 128, 64, 0, 0);
+        driver.sendBuffer();
+        verify(mockDriverAdapter).blitCanvas(100L, 128, 0, 128, 64, 0, 0);
+        verify(mockDriverAdapter).sendBuffer();
+    }
 /*
     @Test
     void getUTF8Width() {
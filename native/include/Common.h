@@ -4,8 +4,6 @@
 #include <string>
 #include <memory>
 
-std::string exec(const char *cmd);
-
 std::string get_soc_model();
 
 std::string get_soc_hardware();
@@ -142,6 +142,17 @@ void JNI_CopyJIntArray(JNIEnv *env, jintArray arr, int *buffer, int length) {
     env->ReleaseIntArrayElements(arr, body, 0);
 }
 
+std::string JNI_GetString(JNIEnv *env, jstring str) {
+    if (str == nullptr)
+        return std::string();
+    const char *chars = env->GetStringUTFChars(str, nullptr);
+    if (chars == nullptr)
+        return std::string();
+    std::string value(chars);
+    env->ReleaseStringUTFChars(str, chars);
+    return value;
+}
+
 // This function produces a stack backtrace with demangled function & method names.
 // Reference: https://gist.github.com/fmela/591333
 std::string Backtrace(int skip) {
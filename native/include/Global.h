@@ -191,6 +191,15 @@ void JNI_CopyJByteArray(JNIEnv *env, jbyteArray arr, uint8_t *buffer, int length
  */
 void JNI_CopyJIntArray(JNIEnv *env, jintArray arr, int *buffer, int length);
 
+/**
+ * Copy the contents of a jstring (modified UTF-8) and release the JVM copy
+ *
+ * @param env JNIEnv instance
+ * @param str The source jstring (an empty string is returned if null)
+ * @return The string contents
+ */
+std::string JNI_GetString(JNIEnv *env, jstring str);
+
 void InputDevManager_Load(JNIEnv *env);
 
 void InputDevManager_UnLoad(JNIEnv *env);
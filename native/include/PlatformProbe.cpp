@@ -0,0 +1,173 @@
+#include "PlatformProbe.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <mutex>
+#include <dirent.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c-dev.h>
+#endif
+
+const std::map<std::string, std::string> revisions = { // NOLINT(cert-err58-cpp)
+        {"900021", "Raspberry Pi A+ v1.1 512MB"},
+        {"900032", "Raspberry Pi B+ v1.2 512MB"},
+        {"900092", "Raspberry Pi Zero v1.2 512MB"},
+        {"900093", "Raspberry Pi Zero v1.3 512MB"},
+        {"9000c1", "Raspberry Pi Zero W v1.1 512MB"},
+        {"9020e0", "Raspberry Pi 3A+ v1.0 512MB"},
+        {"920092", "Raspberry Pi Zero v1.2 512MB"},
+        {"920093", "Raspberry Pi Zero v1.3 512MB"},
+        {"900061", "Raspberry Pi CM v1.1 512MB"},
+        {"a01040", "Raspberry Pi 2B v1.0 1GB"},
+        {"a01041", "Raspberry Pi 2B v1.1 1GB"},
+        {"a02082", "Raspberry Pi 3B v1.2 1GB"},
+        {"a020a0", "Raspberry Pi CM3 v1.0 1GB"},
+        {"a020d3", "Raspberry Pi 3B+ v1.3 1GB"},
+        {"a02042", "Raspberry Pi 2B (with BCM2837) v1.2 1GB"},
+        {"a21041", "Raspberry Pi 2B v1.1 1GB"},
+        {"a22042", "Raspberry Pi 2B (with BCM2837) v1.2 1GB"},
+        {"a22082", "Raspberry Pi 3B v1.2 1GB"},
+        {"a220a0", "Raspberry Pi CM3 v1.0 1GB"},
+        {"a32082", "Raspberry Pi 3B v1.2 1GB"},
+        {"a52082", "Raspberry Pi 3B v1.2 1GB"},
+        {"a22083", "Raspberry Pi 3B v1.3 1GB"},
+        {"a02100", "Raspberry Pi CM3+ v1.0 1GB"},
+        {"a03111", "Raspberry Pi 4B v1.1 1GB"},
+        {"b03111", "Raspberry Pi 4B v1.1 2GB"},
+        {"c03111", "Raspberry Pi 4B v1.1 4GB"}
+};
+
+static std::string trim(const std::string &str) {
+    auto start = std::find_if_not(str.begin(), str.end(), [](unsigned char c) { return std::isspace(c) || c == '\0'; });
+    auto end = std::find_if_not(str.rbegin(), str.rend(), [](unsigned char c) { return std::isspace(c) || c == '\0'; }).base();
+    return (start < end) ? std::string(start, end) : std::string();
+}
+
+static std::string joinPath(const std::string &root, const std::string &path) {
+    if (root.empty() || root == "/")
+        return "/" + path;
+    return (root.back() == '/') ? root + path : root + "/" + path;
+}
+
+const platform_info_t &PlatformProbe::info() {
+    static platform_info_t cached;
+    static std::once_flag probed;
+    std::call_once(probed, []() {
+        cached = probe(PLATFORM_PROBE_ROOT);
+    });
+    return cached;
+}
+
+platform_info_t PlatformProbe::probe(const std::string &root) {
+    platform_info_t info;
+    parseCpuInfo(readFile(joinPath(root, PLATFORM_PATH_CPUINFO)), info);
+    info.dt_model = trim(readFile(joinPath(root, PLATFORM_PATH_DT_MODEL)));
+
+    //Note: As of the 4.9 kernel, all Pis report BCM2835 as the hardware, so use the revision code and the device tree model instead
+    info.description = lookupRevision(info.revision);
+    info.raspberrypi = !info.description.empty() || info.dt_model.rfind("Raspberry Pi", 0) == 0;
+    if (info.raspberrypi && info.description.empty())
+        info.description = info.dt_model;
+
+    probeSpi(root, info);
+    probeGpio(root, info);
+    probeI2C(root, info);
+    return info;
+}
+
+void PlatformProbe::parseCpuInfo(const std::string &content, platform_info_t &info) {
+    std::istringstream stream(content);
+    std::string line;
+    while (std::getline(stream, line)) {
+        size_t pos = line.find(':');
+        if (pos == std::string::npos)
+            continue;
+        std::string key = trim(line.substr(0, pos));
+        std::string value = trim(line.substr(pos + 1));
+        if (key == "Model") {
+            info.model = value;
+        } else if (key == "Hardware") {
+            info.hardware = value;
+        } else if (key == "Revision") {
+            value.erase(std::remove_if(value.begin(), value.end(), ::isspace), value.end());
+            std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+            info.revision = value;
+        }
+    }
+}
+
+std::string PlatformProbe::lookupRevision(const std::string &revision) {
+    auto it = revisions.find(revision);
+    if (it != revisions.end())
+        return it->second;
+    return std::string();
+}
+
+std::string PlatformProbe::readFile(const std::string &path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        return std::string();
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void PlatformProbe::probeSpi(const std::string &root, platform_info_t &info) {
+    std::string value = trim(readFile(joinPath(root, PLATFORM_PATH_SPIDEV_BUFSIZ)));
+    if (value.empty())
+        return;
+    char *end = nullptr;
+    long bufsiz = std::strtol(value.c_str(), &end, 10);
+    if (end != value.c_str() && bufsiz > 0)
+        info.spidev_bufsiz = bufsiz;
+}
+
+void PlatformProbe::probeGpio(const std::string &root, platform_info_t &info) {
+    std::string devPath = joinPath(root, PLATFORM_PATH_DEV);
+    DIR *dir = opendir(devPath.c_str());
+    if (dir == nullptr)
+        return;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != nullptr) {
+        std::string name = ent->d_name;
+        if (name.rfind("gpiochip", 0) == 0)
+            info.gpio_chips.emplace_back(devPath + "/" + name);
+    }
+    closedir(dir);
+    std::sort(info.gpio_chips.begin(), info.gpio_chips.end());
+}
+
+void PlatformProbe::probeI2C(const std::string &root, platform_info_t &info) {
+    std::string devPath = joinPath(root, PLATFORM_PATH_DEV);
+    DIR *dir = opendir(devPath.c_str());
+    if (dir == nullptr)
+        return;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != nullptr) {
+        std::string name = ent->d_name;
+        if (name.rfind("i2c-", 0) != 0)
+            continue;
+        char *end = nullptr;
+        long adapter = std::strtol(name.c_str() + 4, &end, 10);
+        if (end == name.c_str() + 4 || *end != '\0')
+            continue;
+        unsigned long funcs = 0;
+#if defined(__linux__)
+        int fd = open((devPath + "/" + name).c_str(), O_RDWR | O_CLOEXEC);
+        if (fd >= 0) {
+            if (ioctl(fd, I2C_FUNCS, &funcs) < 0)
+                funcs = 0;
+            close(fd);
+        }
+#endif
+        info.i2c_funcs[static_cast<int>(adapter)] = funcs;
+    }
+    closedir(dir);
+}
@@ -0,0 +1,56 @@
+#ifndef UCGDISPLAY_PLATFORMPROBE_H
+#define UCGDISPLAY_PLATFORMPROBE_H
+
+#include <string>
+#include <vector>
+#include <map>
+
+#define PLATFORM_PROBE_ROOT "/"
+
+#define PLATFORM_PATH_CPUINFO "proc/cpuinfo"
+#define PLATFORM_PATH_DT_MODEL "sys/firmware/devicetree/base/model"
+#define PLATFORM_PATH_SPIDEV_BUFSIZ "sys/module/spidev/parameters/bufsiz"
+#define PLATFORM_PATH_DEV "dev"
+
+/**
+ * Holds the information collected from the running platform. Populated once by PlatformProbe.
+ */
+struct platform_info_t {
+    std::string model;                      // Model from /proc/cpuinfo
+    std::string hardware;                   // Hardware from /proc/cpuinfo
+    std::string revision;                   // Revision from /proc/cpuinfo (lowercase, no whitespace)
+    std::string dt_model;                   // Model string from the device tree (e.g. "Raspberry Pi 3 Model B Rev 1.2")
+    std::string description;                // Human readable board description
+    bool raspberrypi = false;
+    long spidev_bufsiz = -1;                // Maximum spidev transfer size (-1 if spidev is not loaded)
+    std::vector<std::string> gpio_chips;    // Available gpio character devices (e.g. /dev/gpiochip0)
+    std::map<int, unsigned long> i2c_funcs; // I2C adapter number -> I2C_FUNCS bitmask (0 if it could not be queried)
+};
+
+class PlatformProbe {
+public:
+    /**
+     * Returns the cached information of the running platform. The system is only probed on the first call.
+     */
+    static const platform_info_t &info();
+
+    /**
+     * Probe the platform using the specified root directory (e.g. a fixture directory). The result is not cached.
+     */
+    static platform_info_t probe(const std::string &root);
+
+    static void parseCpuInfo(const std::string &content, platform_info_t &info);
+
+    static std::string lookupRevision(const std::string &revision);
+
+private:
+    static std::string readFile(const std::string &path);
+
+    static void probeSpi(const std::string &root, platform_info_t &info);
+
+    static void probeGpio(const std::string &root, platform_info_t &info);
+
+    static void probeI2C(const std::string &root, platform_info_t &info);
+};
+
+#endif //UCGDISPLAY_PLATFORMPROBE_H
@@ -13,8 +13,6 @@ public:
     static std::string get_soc_revision();
     static std::string get_soc_description();
     static bool is_soc_raspberrypi();
-private:
-    static std::string exec(const char *cmd);
 };
 
 #endif //UCGDISPLAY_UTILS_H
\ No newline at end of file
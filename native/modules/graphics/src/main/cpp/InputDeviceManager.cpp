@@ -0,0 +1,136 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <Global.h>
+#include <InputDeviceManager.h>
+#include <UcgdInput.h>
+
+//Created when the library is loaded, the event thread starts with the first opened device
+static std::unique_ptr<UcgdInputManager> g_InputManager;
+
+static auto getInputManager(JNIEnv *env) -> UcgdInputManager * {
+    if (!g_InputManager)
+        JNI_ThrowNativeLibraryException(env, "The input subsystem is not available");
+    return g_InputManager.get();
+}
+
+void InputDevManager_Load(JNIEnv *env) {
+    try {
+        g_InputManager = std::make_unique<UcgdInputManager>();
+    } catch (std::exception &e) {
+        //reported by the first call of the input api
+        g_InputManager.reset();
+    }
+}
+
+void InputDevManager_UnLoad(JNIEnv *env) {
+    if (g_InputManager) {
+        g_InputManager->stop();
+        g_InputManager.reset();
+    }
+}
+
+jint Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_openEvdev(JNIEnv *env, jclass cls, jstring path, jboolean grab) {
+    UcgdInputManager *manager = getInputManager(env);
+    if (manager == nullptr)
+        return -1;
+    if (path == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "openEvdev() : Path cannot be null");
+        return -1;
+    }
+    BEGIN_CATCH
+        return static_cast<jint>(manager->openEvdev(JNI_GetString(env, path), grab));
+    END_CATCH
+    return -1;
+}
+
+jint Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_openButton(JNIEnv *env, jclass cls, jstring chip, jint line, jint debounce, jboolean activeLow) {
+    UcgdInputManager *manager = getInputManager(env);
+    if (manager == nullptr)
+        return -1;
+    if (chip == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "openButton() : Chip cannot be null");
+        return -1;
+    }
+    BEGIN_CATCH
+        return static_cast<jint>(manager->openButton(JNI_GetString(env, chip), line, debounce, activeLow));
+    END_CATCH
+    return -1;
+}
+
+jint Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_openEncoder(JNIEnv *env, jclass cls, jstring chip, jint lineA, jint lineB, jint stepsPerDetent) {
+    UcgdInputManager *manager = getInputManager(env);
+    if (manager == nullptr)
+        return -1;
+    if (chip == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "openEncoder() : Chip cannot be null");
+        return -1;
+    }
+    BEGIN_CATCH
+        return static_cast<jint>(manager->openEncoder(JNI_GetString(env, chip), lineA, lineB, stepsPerDetent));
+    END_CATCH
+    return -1;
+}
+
+jboolean Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_close(JNIEnv *env, jclass cls, jint handle) {
+    UcgdInputManager *manager = getInputManager(env);
+    if (manager == nullptr)
+        return JNI_FALSE;
+    BEGIN_CATCH
+        return manager->close(static_cast<uint32_t>(handle)) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+jint Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_read(JNIEnv *env, jclass cls, jobject buffer, jint timeout) {
+    UcgdInputManager *manager = getInputManager(env);
+    if (manager == nullptr)
+        return -1;
+    if (buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "read() : Buffer cannot be null");
+        return -1;
+    }
+    auto *data = static_cast<ucgd_input_event_t *>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (data == nullptr || capacity < 0) {
+        JNI_ThrowNativeLibraryException(env, "read() : Buffer must be a direct buffer");
+        return -1;
+    }
+    if (capacity < INPUT_EVENT_SIZE) {
+        JNI_ThrowNativeLibraryException(env, "read() : Buffer is too small (Required: at least " + std::to_string(INPUT_EVENT_SIZE) + " bytes)");
+        return -1;
+    }
+    BEGIN_CATCH
+        return static_cast<jint>(manager->read(data, static_cast<size_t>(capacity) / INPUT_EVENT_SIZE, timeout));
+    END_CATCH
+    return -1;
+}
+
+jlong Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_getDroppedCount(JNIEnv *env, jclass cls) {
+    UcgdInputManager *manager = getInputManager(env);
+    if (manager == nullptr)
+        return -1;
+    return static_cast<jlong>(manager->getDropped());
+}
@@ -0,0 +1,94 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_ibasco_ucgdisplay_core_input_InputDeviceManager */
+
+#ifndef _Included_com_ibasco_ucgdisplay_core_input_InputDeviceManager
+#define _Included_com_ibasco_ucgdisplay_core_input_InputDeviceManager
+#ifdef __cplusplus
+extern "C" {
+#endif
+#undef com_ibasco_ucgdisplay_core_input_InputDeviceManager_EVENT_SIZE
+#define com_ibasco_ucgdisplay_core_input_InputDeviceManager_EVENT_SIZE 24L
+#undef com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_KEY
+#define com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_KEY 1L
+#undef com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_REL
+#define com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_REL 2L
+#undef com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_ABS
+#define com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_ABS 3L
+#undef com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_SW
+#define com_ibasco_ucgdisplay_core_input_InputDeviceManager_TYPE_SW 5L
+#undef com_ibasco_ucgdisplay_core_input_InputDeviceManager_CODE_ENCODER
+#define com_ibasco_ucgdisplay_core_input_InputDeviceManager_CODE_ENCODER 7L
+/*
+ * Class:     com_ibasco_ucgdisplay_core_input_InputDeviceManager
+ * Method:    openEvdev
+ * Signature: (Ljava/lang/String;Z)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_openEvdev
+  (JNIEnv *, jclass, jstring, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_input_InputDeviceManager
+ * Method:    openButton
+ * Signature: (Ljava/lang/String;IIZ)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_openButton
+  (JNIEnv *, jclass, jstring, jint, jint, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_input_InputDeviceManager
+ * Method:    openEncoder
+ * Signature: (Ljava/lang/String;III)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_openEncoder
+  (JNIEnv *, jclass, jstring, jint, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_input_InputDeviceManager
+ * Method:    close
+ * Signature: (I)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_close
+  (JNIEnv *, jclass, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_input_InputDeviceManager
+ * Method:    read
+ * Signature: (Ljava/nio/ByteBuffer;I)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_read
+  (JNIEnv *, jclass, jobject, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_input_InputDeviceManager
+ * Method:    getDroppedCount
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_ibasco_ucgdisplay_core_input_InputDeviceManager_getDroppedCount
+  (JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
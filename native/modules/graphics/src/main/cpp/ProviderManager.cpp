@@ -73,9 +73,8 @@ auto ProviderManager::getAllProviders() -> const std::map<std::string, std::shar
     return m_Providers;
 }
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
 auto ProviderManager::getProvider(const std::shared_ptr<ucgd_t> &context) -> std::shared_ptr<UcgdProvider> & {
-    std::string defaultProvider = context->getOptionString(OPT_PROVIDER);
+    std::string defaultProvider = context->settings.default_provider;
     if (defaultProvider.empty() || !isInstalled(defaultProvider)) {
         log.warn("get_default_provider() : Provider not specified or is not install on your system. Falling back to default system provider '{}'", PROVIDER_DEFAULT);
         defaultProvider = PROVIDER_DEFAULT;
@@ -100,7 +99,12 @@ auto ProviderManager::isInstalled(const std::string &providerName) -> bool {
             log.warn("isInstalled() : Missing library name for provider '{}'", p->getName());
             return false;
         }
+#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
         return Utils::isLibraryLoaded(p->getLibraryName());
+#else
+        //only providers compiled into this library are usable off-device
+        return false;
+#endif
     } catch (ProviderNotFoundException& e) {
         return false;
     }
@@ -120,5 +124,3 @@ auto ProviderManager::closeProvider(const std::string &name) -> void {
     m_Providers.erase(name);
 }
 
-#endif
-
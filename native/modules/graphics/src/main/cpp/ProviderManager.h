@@ -24,6 +24,8 @@
 
 #include <memory>
 #include <map>
+#include <stdexcept>
+#include <string>
 
 //Forward declarations
 class UcgdProvider;
@@ -55,7 +57,6 @@ public:
 
     auto getAllProviders() -> const std::map<std::string, std::shared_ptr<UcgdProvider>>&;
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
     auto initializeProvider(const std::string& name, const std::shared_ptr<ucgd_t>& context = nullptr) -> void;
 
     auto closeProvider(const std::string& name) -> void;
@@ -65,7 +66,6 @@ public:
     auto isInstalled(const std::string& providerName) -> bool;
 
     auto isInstalled(std::shared_ptr<UcgdProvider>&) -> bool;
-#endif
 
 private:
     std::map<std::string, std::shared_ptr<UcgdProvider>> m_Providers;
@@ -61,8 +61,6 @@ void ServiceLocator::setDeviceManager(std::unique_ptr<DeviceManager> mDeviceMana
     m_DeviceManager = std::move(mDeviceManager);
 }
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
-
 void ServiceLocator::setProviderManager(std::unique_ptr<ProviderManager> mProviderManager) {
     m_ProviderManager = std::move(mProviderManager);
 }
@@ -73,5 +71,3 @@ auto ServiceLocator::getProviderManager() -> std::unique_ptr<ProviderManager> &
     }
     return m_ProviderManager;
 }
-
-#endif
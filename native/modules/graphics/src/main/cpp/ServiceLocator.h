@@ -28,9 +28,7 @@
 #include <Log.h>
 #include <DeviceManager.h>
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
 #include <ProviderManager.h>
-#endif
 
 class ServiceLocator {
 private:
@@ -50,9 +48,7 @@ private:
 
     std::unique_ptr<DeviceManager> m_DeviceManager;
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
     std::unique_ptr<ProviderManager> m_ProviderManager;
-#endif
 
 public:
     // Return a reference to not allow client code
@@ -67,11 +63,9 @@ public:
 
     void setDeviceManager(std::unique_ptr<DeviceManager> mDeviceManager);
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
     auto getProviderManager() -> std::unique_ptr<ProviderManager> &;
 
     void setProviderManager(std::unique_ptr<ProviderManager> mProviderManager);
-#endif
 
 };
 
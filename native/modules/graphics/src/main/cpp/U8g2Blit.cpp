@@ -0,0 +1,256 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "U8g2Blit.h"
+
+namespace {
+    /**
+     * Read 8 bits (msb first) starting at the specified bit position. Bits outside of the source are read as 0.
+     */
+    inline uint8_t fetch8(const ucgd_bitmap_t &bitmap, long pos) {
+        if (pos <= -8 || bitmap.length == 0)
+            return 0;
+        if (pos < 0)
+            return static_cast<uint8_t>((bitmap.data[0]) >> (-pos));
+        auto index = static_cast<size_t>(pos >> 3);
+        unsigned shift = pos & 7;
+        if (index >= bitmap.length)
+            return 0;
+        auto value = static_cast<uint8_t>(bitmap.data[index] << shift);
+        if (shift != 0 && index + 1 < bitmap.length)
+            value |= static_cast<uint8_t>(bitmap.data[index + 1] >> (8 - shift));
+        return value;
+    }
+
+    inline bool fetchBit(const ucgd_bitmap_t &bitmap, size_t pos) {
+        size_t index = pos >> 3;
+        return index < bitmap.length && (bitmap.data[index] & (0x80U >> (pos & 7))) != 0;
+    }
+
+    inline void apply(uint8_t *dst, uint8_t bits, uint8_t mask, int mode) {
+        switch (mode) {
+            case BLIT_MODE_CLEAR: *dst &= static_cast<uint8_t>(~(bits & mask)); break;
+            case BLIT_MODE_SET: *dst |= static_cast<uint8_t>(bits & mask); break;
+            case BLIT_MODE_XOR: *dst ^= static_cast<uint8_t>(bits & mask); break;
+            default: *dst = static_cast<uint8_t>((*dst & ~mask) | (bits & mask)); break;
+        }
+    }
+
+    /**
+     * Transpose an 8x8 bit matrix (byte i = row i)
+     */
+    inline uint64_t transpose8x8(uint64_t x) {
+        uint64_t t;
+        t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+        x = x ^ t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+        x = x ^ t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+        x = x ^ t ^ (t << 28);
+        return x;
+    }
+
+    inline int layoutOf(u8g2_t *u8g2) {
+        if (u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb)
+            return 1;
+        if (u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb)
+            return 2;
+        return 0;
+    }
+}
+
+auto U8g2Blit::fromDrawColor(u8g2_t *u8g2) -> int {
+    switch (u8g2->draw_color) {
+        case 0: return BLIT_MODE_CLEAR;
+        case 1: return BLIT_MODE_SET;
+        default: return BLIT_MODE_XOR;
+    }
+}
+
+auto U8g2Blit::blit(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, int mode) -> void {
+    blit(u8g2, x, y, bitmap, mode, x, y, x + bitmap.width, y + bitmap.height);
+}
+
+auto U8g2Blit::blit(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, int mode, int x0, int y0, int x1, int y1) -> void {
+    if (bitmap.data == nullptr || bitmap.width <= 0 || bitmap.height <= 0 || u8g2->is_page_clip_window_intersection == 0)
+        return;
+
+    //the user window is the intersection of the clip window and the current page (in user coordinates)
+    clip_t clip{std::max({x, x0, static_cast<int>(u8g2->user_x0)}), std::max({y, y0, static_cast<int>(u8g2->user_y0)}),
+                std::min({x + bitmap.width, x1, static_cast<int>(u8g2->user_x1)}), std::min({y + bitmap.height, y1, static_cast<int>(u8g2->user_y1)})};
+    if (clip.x0 >= clip.x1 || clip.y0 >= clip.y1)
+        return;
+
+    int layout = layoutOf(u8g2);
+    if (layout == 0 || u8g2->tile_buf_ptr == nullptr) {
+        blitFallback(u8g2, x, y, bitmap, clip, mode);
+    } else if (u8g2->cb->draw_l90 != u8g2_draw_l90_r0) {
+        blitRotated(u8g2, x, y, bitmap, clip, mode);
+    } else if (layout == 1) {
+        blitVertical(u8g2, x, y, bitmap, clip, mode);
+    } else {
+        blitHorizontal(u8g2, x, y, bitmap, clip, mode);
+    }
+}
+
+auto U8g2Blit::blitHorizontal(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void {
+    int tileWidth = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+    int currRow = u8g2->pixel_curr_row;
+    int bx0 = std::max(0, clip.x0);
+    int bx1 = std::min(tileWidth * 8, clip.x1);
+    if (bx0 >= bx1)
+        return;
+    int firstByte = bx0 >> 3;
+    int lastByte = (bx1 - 1) >> 3;
+
+    for (int row = clip.y0; row < clip.y1; row++) {
+        uint8_t *dstRow = u8g2->tile_buf_ptr + (row - currRow) * tileWidth;
+        auto srcRow = static_cast<long>((row - y) * bitmap.stride_bits);
+        //source bit position of the first pixel of the first destination byte
+        long base = srcRow + (firstByte * 8 - x);
+
+        //aligned copy: the whole byte range maps to whole source bytes
+        if (mode == BLIT_MODE_COPY && (base & 7) == 0 && (bx0 & 7) == 0 && (bx1 & 7) == 0 && base >= 0 &&
+            static_cast<size_t>((base >> 3) + (lastByte - firstByte) + 1) <= bitmap.length) {
+            std::memcpy(dstRow + firstByte, bitmap.data + (base >> 3), lastByte - firstByte + 1);
+            continue;
+        }
+
+        for (int b = firstByte; b <= lastByte; b++) {
+            int left = std::max(bx0 - b * 8, 0);
+            int right = std::min(bx1 - b * 8, 8);
+            auto mask = static_cast<uint8_t>((0xffU >> left) & (0xffU << (8 - right)));
+            apply(dstRow + b, fetch8(bitmap, base + (b - firstByte) * 8L), mask, mode);
+        }
+    }
+}
+
+auto U8g2Blit::blitVertical(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void {
+    int stride = u8g2_GetU8x8(u8g2)->display_info->tile_width * 8;
+    int currRow = u8g2->pixel_curr_row;
+    int bx0 = std::max(0, clip.x0);
+    int bx1 = std::min(stride, clip.x1);
+    //buffer rows
+    int by0 = clip.y0 - currRow;
+    int by1 = clip.y1 - currRow;
+    if (bx0 >= bx1 || by0 >= by1)
+        return;
+
+    for (int page = by0 >> 3; page <= (by1 - 1) >> 3; page++) {
+        uint8_t rowMask = 0;
+        long rowPos[8];
+        for (int j = 0; j < 8; j++) {
+            int by = page * 8 + j;
+            rowPos[j] = static_cast<long>((by + currRow - y) * static_cast<long>(bitmap.stride_bits)) - x;
+            if (by >= by0 && by < by1)
+                rowMask |= static_cast<uint8_t>(1U << j);
+        }
+        uint8_t *dst = u8g2->tile_buf_ptr + page * stride;
+        //transpose blocks of 8 columns (each source row contributes one byte)
+        for (int col = bx0; col < bx1; col += 8) {
+            uint64_t block = 0;
+            for (int j = 0; j < 8; j++) {
+                if (rowMask & (1U << j))
+                    block |= static_cast<uint64_t>(fetch8(bitmap, rowPos[j] + col)) << (8 * j);
+            }
+            block = transpose8x8(block);
+            int count = std::min(8, bx1 - col);
+            for (int k = 0; k < count; k++)
+                apply(dst + col + k, static_cast<uint8_t>(block >> (8 * (7 - k))), rowMask, mode);
+        }
+    }
+}
+
+auto U8g2Blit::blitRotated(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void {
+    int tileWidth = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+    int bufWidth = tileWidth * 8;
+    int bufHeight = u8g2->tile_buf_height * 8;
+    int currRow = u8g2->pixel_curr_row;
+    int width = u8g2->width;
+    int height = u8g2->height;
+    bool vertical = layoutOf(u8g2) == 1;
+    const u8g2_cb_t *cb = u8g2->cb;
+    if (cb != U8G2_R1 && cb != U8G2_R2 && cb != U8G2_R3 && cb != U8G2_MIRROR) {
+        blitFallback(u8g2, x, y, bitmap, clip, mode);
+        return;
+    }
+
+    for (int uy = clip.y0; uy < clip.y1; uy++) {
+        size_t srcRow = (uy - y) * bitmap.stride_bits;
+        for (int ux = clip.x0; ux < clip.x1; ux++) {
+            bool on = fetchBit(bitmap, srcRow + (ux - x));
+            if (!on && mode != BLIT_MODE_COPY)
+                continue;
+            //same transformations as the u8g2_draw_l90_* callbacks
+            int px, py;
+            if (cb == U8G2_R1) {
+                px = height - uy - 1;
+                py = ux;
+            } else if (cb == U8G2_R2) {
+                px = width - ux - 1;
+                py = height - uy - 1;
+            } else if (cb == U8G2_R3) {
+                px = uy;
+                py = width - ux - 1;
+            } else {
+                px = width - ux - 1;
+                py = uy;
+            }
+            py -= currRow;
+            if (px < 0 || px >= bufWidth || py < 0 || py >= bufHeight)
+                continue;
+            uint8_t *dst;
+            uint8_t mask;
+            if (vertical) {
+                dst = u8g2->tile_buf_ptr + (py >> 3) * bufWidth + px;
+                mask = static_cast<uint8_t>(1U << (py & 7));
+            } else {
+                dst = u8g2->tile_buf_ptr + py * tileWidth + (px >> 3);
+                mask = static_cast<uint8_t>(0x80U >> (px & 7));
+            }
+            apply(dst, on ? 0xff : 0, mask, mode);
+        }
+    }
+}
+
+auto U8g2Blit::blitFallback(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void {
+    uint8_t drawColor = u8g2->draw_color;
+    for (int uy = clip.y0; uy < clip.y1; uy++) {
+        size_t srcRow = (uy - y) * bitmap.stride_bits;
+        for (int ux = clip.x0; ux < clip.x1; ux++) {
+            bool on = fetchBit(bitmap, srcRow + (ux - x));
+            uint8_t color;
+            if (mode == BLIT_MODE_COPY) {
+                color = on ? 1 : 0;
+            } else if (on) {
+                color = static_cast<uint8_t>(mode);
+            } else {
+                continue;
+            }
+            u8g2->draw_color = color;
+            u8g2_DrawPixel(u8g2, static_cast<u8g2_uint_t>(ux), static_cast<u8g2_uint_t>(uy));
+        }
+    }
+    u8g2->draw_color = drawColor;
+}
@@ -0,0 +1,86 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2BLIT_H
+#define UCGD_MOD_GRAPHICS_U8G2BLIT_H
+
+#include <cstdint>
+#include <cstddef>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//Operation applied to the buffer for each set bit of the source (unset bits are left untouched)
+#define BLIT_MODE_CLEAR 0
+#define BLIT_MODE_SET 1
+#define BLIT_MODE_XOR 2
+//The source replaces the destination (set and unset bits are both written)
+#define BLIT_MODE_COPY 3
+
+/**
+ * A 1bpp source image. Pixels are stored row by row, most significant bit first.
+ * Rows start every stride_bits bits (e.g. width for a packed bit stream, or a multiple of 8 for byte aligned rows).
+ */
+struct ucgd_bitmap_t {
+    const uint8_t *data;
+    size_t length;
+    int width;
+    int height;
+    size_t stride_bits;
+};
+
+/**
+ * Writes 1bpp images directly into the u8g2 tile buffer
+ */
+class U8g2Blit {
+public:
+    /**
+     * Draw the bitmap at position x, y (user coordinates). Honours the display rotation, the clip window and the current page.
+     */
+    static auto blit(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, int mode) -> void;
+
+    /**
+     * Draw the part of the bitmap (placed at x, y) that lies inside the rectangle x0, y0 - x1, y1 (exclusive, user coordinates).
+     * Used to crop a bitmap at any pixel position without copying it.
+     */
+    static auto blit(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, int mode, int x0, int y0, int x1, int y1) -> void;
+
+    /**
+     * @return The blit mode matching the current draw color of u8g2 (0 = clear, 1 = set, 2 = xor)
+     */
+    static auto fromDrawColor(u8g2_t *u8g2) -> int;
+
+private:
+    struct clip_t {
+        int x0, y0, x1, y1;
+    };
+
+    static auto blitHorizontal(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void;
+
+    static auto blitVertical(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void;
+
+    static auto blitRotated(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void;
+
+    static auto blitFallback(u8g2_t *u8g2, int x, int y, const ucgd_bitmap_t &bitmap, const clip_t &clip, int mode) -> void;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2BLIT_H
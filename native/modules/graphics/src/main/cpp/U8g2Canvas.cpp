@@ -0,0 +1,80 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include "U8g2Canvas.h"
+
+namespace {
+    //nothing is sent anywhere, the display info is assigned by the canvas
+    uint8_t canvasDisplayCallback(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+        return 1;
+    }
+}
+
+U8g2Canvas::U8g2Canvas(u8g2_t *u8g2, int width, int height) : m_Width(width), m_Height(height) {
+    if (width <= 0 || height <= 0 || width > CANVAS_MAX_SIZE || height > CANVAS_MAX_SIZE)
+        throw std::runtime_error(std::string("Invalid canvas size ") + std::to_string(width) + "x" + std::to_string(height) + " (1 to " + std::to_string(CANVAS_MAX_SIZE) + " pixels)");
+
+    m_Info.tile_width = static_cast<uint8_t>((width + 7) / 8);
+    m_Info.tile_height = static_cast<uint8_t>((height + 7) / 8);
+    m_Info.pixel_width = static_cast<uint16_t>(width);
+    m_Info.pixel_height = static_cast<uint16_t>(height);
+    m_Buffer.assign(static_cast<size_t>(m_Info.tile_width) * m_Info.tile_height * 8, 0);
+
+    u8g2_SetupDisplay(u8g2, canvasDisplayCallback, u8x8_cad_empty, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_GetU8x8(u8g2)->display_info = &m_Info;
+    u8g2_SetupBuffer(u8g2, m_Buffer.data(), m_Info.tile_height, u8g2_ll_hvline_horizontal_right_lsb, U8G2_R0);
+}
+
+auto U8g2Canvas::blit(u8g2_t *display, int srcX, int srcY, int width, int height, int x, int y) const -> void {
+    //clip the source area to the canvas
+    if (srcX < 0) {
+        width += srcX;
+        x -= srcX;
+        srcX = 0;
+    }
+    if (srcY < 0) {
+        height += srcY;
+        y -= srcY;
+        srcY = 0;
+    }
+    width = std::min(width, m_Width - srcX);
+    height = std::min(height, m_Height - srcY);
+    if (width <= 0 || height <= 0)
+        return;
+    //the whole canvas is placed so that srcX, srcY lands on x, y and cropped to the area
+    U8g2Blit::blit(display, x - srcX, y - srcY, getBitmap(), BLIT_MODE_COPY, x, y, x + width, y + height);
+}
+
+auto U8g2Canvas::getBitmap() const -> ucgd_bitmap_t {
+    return ucgd_bitmap_t{m_Buffer.data(), m_Buffer.size(), m_Width, m_Height, static_cast<size_t>(m_Info.tile_width) * 8};
+}
+
+auto U8g2Canvas::getWidth() const -> int {
+    return m_Width;
+}
+
+auto U8g2Canvas::getHeight() const -> int {
+    return m_Height;
+}
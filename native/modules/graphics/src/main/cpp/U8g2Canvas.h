@@ -0,0 +1,79 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2CANVAS_H
+#define UCGD_MOD_GRAPHICS_U8G2CANVAS_H
+
+#include <cstdint>
+#include <vector>
+#include <U8g2Blit.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//Largest canvas side in pixels (u8x8 stores the size in tiles as 8-bit values)
+#define CANVAS_MAX_SIZE 2040
+
+/**
+ * An offscreen u8g2 canvas of arbitrary size that is not bound to a display controller or transport. A frame is rendered
+ * once into the canvas and copied (cropped and offset) into the buffers of any number of displays, e.g. to mirror the same
+ * content on identical panels or to span one large canvas across a grid of displays.
+ *
+ * The canvas uses the horizontal_right_lsb layout, so its buffer is a ucgd_bitmap_t and the copies go through U8g2Blit
+ * (memcpy for byte aligned rows, 8x8 transposes for vertical_top_lsb displays).
+ */
+class U8g2Canvas {
+public:
+    /**
+     * Setup the u8g2 descriptor as a canvas. Throws std::runtime_error if the size is out of range.
+     *
+     * @param u8g2 The descriptor to setup, must outlive the canvas (it references the buffer and display info of the canvas)
+     */
+    U8g2Canvas(u8g2_t *u8g2, int width, int height);
+
+    U8g2Canvas(const U8g2Canvas &) = delete;
+
+    auto operator=(const U8g2Canvas &) -> U8g2Canvas & = delete;
+
+    /**
+     * Copy an area of the canvas into the buffer of a display at position x, y (user coordinates of the display). The area is
+     * clipped to the canvas, the clip window and the current page of the display. Set and unset pixels are both copied.
+     */
+    auto blit(u8g2_t *display, int srcX, int srcY, int width, int height, int x, int y) const -> void;
+
+    /**
+     * @return The canvas buffer (the last rendered frame)
+     */
+    auto getBitmap() const -> ucgd_bitmap_t;
+
+    auto getWidth() const -> int;
+
+    auto getHeight() const -> int;
+
+private:
+    int m_Width;
+    int m_Height;
+    u8x8_display_info_t m_Info{};
+    std::vector<uint8_t> m_Buffer;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2CANVAS_H
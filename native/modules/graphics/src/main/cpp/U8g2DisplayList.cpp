@@ -0,0 +1,291 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "U8g2DisplayList.h"
+#include "U8g2GlyphCache.h"
+#include "U8g2Sprites.h"
+
+#include <cstring>
+#include <stdexcept>
+
+std::atomic<int> U8g2DisplayList::s_Recording{0};
+
+U8g2DisplayList::U8g2DisplayList() = default;
+
+U8g2DisplayList::~U8g2DisplayList() {
+    end();
+}
+
+auto U8g2DisplayList::begin(u8g2_t *u8g2) -> void {
+    clear();
+    m_State = capture(u8g2);
+    if (!m_Recording) {
+        m_Recording = true;
+        s_Recording.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+auto U8g2DisplayList::end() -> void {
+    if (m_Recording) {
+        m_Recording = false;
+        s_Recording.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+auto U8g2DisplayList::isRecording() const -> bool {
+    return m_Recording;
+}
+
+auto U8g2DisplayList::isAnyRecording() -> bool {
+    return s_Recording.load(std::memory_order_relaxed) > 0;
+}
+
+auto U8g2DisplayList::add(uint32_t code, int32_t a0, int32_t a1, int32_t a2, int32_t a3, int32_t a4, int32_t a5) -> void {
+    m_Ops.push_back({code, {a0, a1, a2, a3, a4, a5}, 0, 0});
+}
+
+auto U8g2DisplayList::addData(uint32_t code, const void *data, size_t length, int32_t a0, int32_t a1, int32_t a2, int32_t a3) -> void {
+    if (m_Data.size() + length > UINT32_MAX)
+        throw std::runtime_error("Display list data exceeds the maximum size");
+    auto offset = static_cast<uint32_t>(m_Data.size());
+    auto *bytes = static_cast<const uint8_t *>(data);
+    m_Data.insert(m_Data.end(), bytes, bytes + length);
+    m_Ops.push_back({code, {a0, a1, a2, a3, 0, 0}, offset, static_cast<uint32_t>(length)});
+}
+
+auto U8g2DisplayList::addFont(const uint8_t *font) -> void {
+    m_Ops.push_back({DL_OP_FONT, {}, static_cast<uint32_t>(m_FontRefs.size()), 0});
+    m_FontRefs.push_back(font);
+}
+
+auto U8g2DisplayList::addFontData(const uint8_t *font, size_t length) -> const uint8_t * {
+    for (const auto &copy : m_Fonts) {
+        if (copy.size() == length && std::memcmp(copy.data(), font, length) == 0) {
+            addFont(copy.data());
+            return copy.data();
+        }
+    }
+    m_Fonts.emplace_back(font, font + length);
+    addFont(m_Fonts.back().data());
+    return m_Fonts.back().data();
+}
+
+auto U8g2DisplayList::capture(u8g2_t *u8g2) -> ucgd_dl_state_t {
+    ucgd_dl_state_t state{};
+    state.font = u8g2->font;
+    state.font_calc_vref = u8g2->font_calc_vref;
+    state.font_height_mode = u8g2->font_height_mode;
+    state.font_mode = u8g2->font_decode.is_transparent;
+    state.font_direction = u8g2->font_decode.dir;
+    state.draw_color = u8g2->draw_color;
+    state.bitmap_mode = u8g2->bitmap_transparency;
+    //the window set by the user, user_x0..user_y1 is that window intersected with the current page
+    state.clip_x0 = u8g2->clip_x0;
+    state.clip_y0 = u8g2->clip_y0;
+    state.clip_x1 = u8g2->clip_x1;
+    state.clip_y1 = u8g2->clip_y1;
+    return state;
+}
+
+auto U8g2DisplayList::restore(u8g2_t *u8g2, const ucgd_dl_state_t &state) -> void {
+    if (state.font != nullptr)
+        u8g2_SetFont(u8g2, state.font);
+    //the reference height is only recalculated when a font is assigned
+    switch (state.font_height_mode) {
+        case DL_FONT_REF_HEIGHT_EXTENDED_TEXT:
+            u8g2_SetFontRefHeightExtendedText(u8g2);
+            break;
+        case DL_FONT_REF_HEIGHT_ALL:
+            u8g2_SetFontRefHeightAll(u8g2);
+            break;
+        default:
+            u8g2_SetFontRefHeightText(u8g2);
+            break;
+    }
+    u8g2->font_calc_vref = state.font_calc_vref;
+    u8g2_SetFontMode(u8g2, state.font_mode);
+    u8g2_SetFontDirection(u8g2, state.font_direction);
+    u8g2_SetDrawColor(u8g2, state.draw_color);
+    u8g2_SetBitmapMode(u8g2, state.bitmap_mode);
+    u8g2_SetClipWindow(u8g2, state.clip_x0, state.clip_y0, state.clip_x1, state.clip_y1);
+}
+
+auto U8g2DisplayList::replay(u8g2_t *u8g2, U8g2GlyphCache *glyphs, U8g2Sprites *sprites) const -> void {
+    restore(u8g2, m_State);
+    for (const auto &op : m_Ops)
+        execute(u8g2, glyphs, sprites, op);
+}
+
+auto U8g2DisplayList::render(u8g2_t *u8g2, U8g2GlyphCache *glyphs, U8g2Sprites *sprites, const std::function<void()> &pageDone) const -> int {
+    int pages = 0;
+    u8g2_FirstPage(u8g2);
+    do {
+        replay(u8g2, glyphs, sprites);
+        if (pageDone)
+            pageDone();
+        pages++;
+    } while (u8g2_NextPage(u8g2));
+    return pages;
+}
+
+auto U8g2DisplayList::execute(u8g2_t *u8g2, U8g2GlyphCache *glyphs, U8g2Sprites *sprites, const ucgd_dl_op_t &op) const -> void {
+    const int32_t *a = op.args;
+    auto u = [](int32_t value) { return static_cast<u8g2_uint_t>(value); };
+    switch (op.code) {
+        case DL_OP_BOX:
+            u8g2_DrawBox(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]));
+            break;
+        case DL_OP_FRAME:
+            u8g2_DrawFrame(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]));
+            break;
+        case DL_OP_RBOX:
+            u8g2_DrawRBox(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]), u(a[4]));
+            break;
+        case DL_OP_RFRAME:
+            u8g2_DrawRFrame(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]), u(a[4]));
+            break;
+        case DL_OP_CIRCLE:
+            u8g2_DrawCircle(u8g2, u(a[0]), u(a[1]), u(a[2]), static_cast<uint8_t>(a[3]));
+            break;
+        case DL_OP_DISC:
+            u8g2_DrawDisc(u8g2, u(a[0]), u(a[1]), u(a[2]), static_cast<uint8_t>(a[3]));
+            break;
+        case DL_OP_ELLIPSE:
+            u8g2_DrawEllipse(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]), static_cast<uint8_t>(a[4]));
+            break;
+        case DL_OP_FILLED_ELLIPSE:
+            u8g2_DrawFilledEllipse(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]), static_cast<uint8_t>(a[4]));
+            break;
+        case DL_OP_LINE:
+            u8g2_DrawLine(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]));
+            break;
+        case DL_OP_HLINE:
+            u8g2_DrawHLine(u8g2, u(a[0]), u(a[1]), u(a[2]));
+            break;
+        case DL_OP_VLINE:
+            u8g2_DrawVLine(u8g2, u(a[0]), u(a[1]), u(a[2]));
+            break;
+        case DL_OP_PIXEL:
+            u8g2_DrawPixel(u8g2, u(a[0]), u(a[1]));
+            break;
+        case DL_OP_TRIANGLE:
+            u8g2_DrawTriangle(u8g2, static_cast<int16_t>(a[0]), static_cast<int16_t>(a[1]), static_cast<int16_t>(a[2]), static_cast<int16_t>(a[3]), static_cast<int16_t>(a[4]), static_cast<int16_t>(a[5]));
+            break;
+        case DL_OP_GLYPH:
+            if (glyphs != nullptr)
+                glyphs->drawGlyph(u8g2, u(a[0]), u(a[1]), static_cast<uint16_t>(a[2]));
+            else
+                u8g2_DrawGlyph(u8g2, u(a[0]), u(a[1]), static_cast<uint16_t>(a[2]));
+            break;
+        case DL_OP_STR:
+        case DL_OP_UTF8: {
+            //strings are stored with their terminator
+            auto *str = reinterpret_cast<const char *>(m_Data.data() + op.offset);
+            bool utf8 = op.code == DL_OP_UTF8;
+            if (glyphs != nullptr)
+                glyphs->drawString(u8g2, u(a[0]), u(a[1]), str, utf8);
+            else if (utf8)
+                u8g2_DrawUTF8(u8g2, u(a[0]), u(a[1]), str);
+            else
+                u8g2_DrawStr(u8g2, u(a[0]), u(a[1]), str);
+            break;
+        }
+        case DL_OP_XBM:
+            u8g2_DrawXBM(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]), m_Data.data() + op.offset);
+            break;
+        case DL_OP_SPRITE:
+            if (sprites != nullptr)
+                sprites->draw(u8g2, static_cast<uint32_t>(a[0]), a[1], a[2]);
+            break;
+        case DL_OP_CLEAR:
+            u8g2_ClearBuffer(u8g2);
+            break;
+        case DL_OP_FONT:
+            u8g2_SetFont(u8g2, m_FontRefs[op.offset]);
+            break;
+        case DL_OP_FONT_MODE:
+            u8g2_SetFontMode(u8g2, static_cast<uint8_t>(a[0]));
+            break;
+        case DL_OP_FONT_DIRECTION:
+            u8g2_SetFontDirection(u8g2, static_cast<uint8_t>(a[0]));
+            break;
+        case DL_OP_FONT_POS:
+            switch (a[0]) {
+                case DL_FONT_POS_BOTTOM:
+                    u8g2_SetFontPosBottom(u8g2);
+                    break;
+                case DL_FONT_POS_TOP:
+                    u8g2_SetFontPosTop(u8g2);
+                    break;
+                case DL_FONT_POS_CENTER:
+                    u8g2_SetFontPosCenter(u8g2);
+                    break;
+                default:
+                    u8g2_SetFontPosBaseline(u8g2);
+                    break;
+            }
+            break;
+        case DL_OP_FONT_REF_HEIGHT:
+            switch (a[0]) {
+                case DL_FONT_REF_HEIGHT_EXTENDED_TEXT:
+                    u8g2_SetFontRefHeightExtendedText(u8g2);
+                    break;
+                case DL_FONT_REF_HEIGHT_ALL:
+                    u8g2_SetFontRefHeightAll(u8g2);
+                    break;
+                default:
+                    u8g2_SetFontRefHeightText(u8g2);
+                    break;
+            }
+            break;
+        case DL_OP_DRAW_COLOR:
+            u8g2_SetDrawColor(u8g2, static_cast<uint8_t>(a[0]));
+            break;
+        case DL_OP_BITMAP_MODE:
+            u8g2_SetBitmapMode(u8g2, static_cast<uint8_t>(a[0]));
+            break;
+        case DL_OP_CLIP_WINDOW:
+            u8g2_SetClipWindow(u8g2, u(a[0]), u(a[1]), u(a[2]), u(a[3]));
+            break;
+        case DL_OP_MAX_CLIP_WINDOW:
+            u8g2_SetMaxClipWindow(u8g2);
+            break;
+        default:
+            break;
+    }
+}
+
+auto U8g2DisplayList::clear() -> void {
+    m_Ops.clear();
+    m_Data.clear();
+    m_FontRefs.clear();
+}
+
+auto U8g2DisplayList::getCount() const -> size_t {
+    return m_Ops.size();
+}
+
+auto U8g2DisplayList::getSize() const -> size_t {
+    size_t size = m_Ops.capacity() * sizeof(ucgd_dl_op_t) + m_Data.capacity() + m_FontRefs.capacity() * sizeof(const uint8_t *);
+    for (const auto &font : m_Fonts)
+        size += font.capacity();
+    return size;
+}
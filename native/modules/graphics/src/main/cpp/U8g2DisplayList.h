@@ -0,0 +1,194 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2DISPLAYLIST_H
+#define UCGD_MOD_GRAPHICS_U8G2DISPLAYLIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+class U8g2GlyphCache;
+
+class U8g2Sprites;
+
+//Draw operations
+#define DL_OP_BOX 1
+#define DL_OP_FRAME 2
+#define DL_OP_RBOX 3
+#define DL_OP_RFRAME 4
+#define DL_OP_CIRCLE 5
+#define DL_OP_DISC 6
+#define DL_OP_ELLIPSE 7
+#define DL_OP_FILLED_ELLIPSE 8
+#define DL_OP_LINE 9
+#define DL_OP_HLINE 10
+#define DL_OP_VLINE 11
+#define DL_OP_PIXEL 12
+#define DL_OP_TRIANGLE 13
+#define DL_OP_GLYPH 14
+#define DL_OP_STR 15
+#define DL_OP_UTF8 16
+#define DL_OP_XBM 17
+#define DL_OP_SPRITE 18
+#define DL_OP_CLEAR 19
+//State changes
+#define DL_OP_FONT 32
+#define DL_OP_FONT_MODE 33
+#define DL_OP_FONT_DIRECTION 34
+#define DL_OP_FONT_POS 35
+#define DL_OP_FONT_REF_HEIGHT 36
+#define DL_OP_DRAW_COLOR 37
+#define DL_OP_BITMAP_MODE 38
+#define DL_OP_CLIP_WINDOW 39
+#define DL_OP_MAX_CLIP_WINDOW 40
+
+//Arguments of DL_OP_FONT_POS
+#define DL_FONT_POS_BASELINE 0
+#define DL_FONT_POS_BOTTOM 1
+#define DL_FONT_POS_TOP 2
+#define DL_FONT_POS_CENTER 3
+
+//Arguments of DL_OP_FONT_REF_HEIGHT (same values as u8g2->font_height_mode)
+#define DL_FONT_REF_HEIGHT_TEXT 0
+#define DL_FONT_REF_HEIGHT_EXTENDED_TEXT 1
+#define DL_FONT_REF_HEIGHT_ALL 2
+
+struct ucgd_dl_op_t {
+    uint32_t code;
+    int32_t args[6];
+    //strings and bitmaps are stored in the data block of the list, fonts in the font table (offset = index)
+    uint32_t offset;
+    uint32_t length;
+};
+
+//The u8g2 state at the time the recording started, restored at the beginning of each page
+struct ucgd_dl_state_t {
+    const uint8_t *font;
+    u8g2_font_calc_vref_fnptr font_calc_vref;
+    uint8_t font_height_mode;
+    uint8_t font_mode;
+    uint8_t font_direction;
+    uint8_t draw_color;
+    uint8_t bitmap_mode;
+    u8g2_uint_t clip_x0;
+    u8g2_uint_t clip_y0;
+    u8g2_uint_t clip_x1;
+    u8g2_uint_t clip_y1;
+};
+
+/**
+ * Records the draw operations of a frame once and replays them for every page of a firstPage()/nextPage() loop.
+ *
+ * This allows page buffer setup procedures (_1 and _2) to be used without running the picture loop on the Java side.
+ * The list owns a copy of the strings, bitmaps and font data it references, so the caller may release them once
+ * the operation has been recorded.
+ */
+class U8g2DisplayList {
+public:
+    U8g2DisplayList();
+
+    virtual ~U8g2DisplayList();
+
+    /**
+     * Discard the previous operations and start recording. The current state of the display is captured and
+     * restored before each replay.
+     */
+    auto begin(u8g2_t *u8g2) -> void;
+
+    auto end() -> void;
+
+    [[nodiscard]] auto isRecording() const -> bool;
+
+    auto add(uint32_t code, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0, int32_t a4 = 0, int32_t a5 = 0) -> void;
+
+    /**
+     * Add an operation referencing a block of data (the data is copied)
+     */
+    auto addData(uint32_t code, const void *data, size_t length, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0) -> void;
+
+    /**
+     * Add a font change. Fonts from the font lookup table are referenced directly, they are never released.
+     */
+    auto addFont(const uint8_t *font) -> void;
+
+    /**
+     * Add a font change with a copy of the font data (identical fonts share the same copy). Returns the copy owned by the list.
+     */
+    auto addFontData(const uint8_t *font, size_t length) -> const uint8_t *;
+
+    /**
+     * Restore the recorded state and execute the operations on the current page. The glyph cache and
+     * the sprite store are optional, text is drawn with u8g2 and sprites are skipped if they are not provided.
+     */
+    auto replay(u8g2_t *u8g2, U8g2GlyphCache *glyphs, U8g2Sprites *sprites) const -> void;
+
+    /**
+     * Run the firstPage()/nextPage() loop, replaying the operations for each page. The callback is invoked
+     * after a page has been drawn and before it is sent to the display.
+     *
+     * @return The number of pages rendered
+     */
+    auto render(u8g2_t *u8g2, U8g2GlyphCache *glyphs, U8g2Sprites *sprites, const std::function<void()> &pageDone = nullptr) const -> int;
+
+    /**
+     * Discard the recorded operations. Font copies are kept for the lifetime of the list, they may still be
+     * assigned to the display and are referenced by the glyph cache.
+     */
+    auto clear() -> void;
+
+    [[nodiscard]] auto getCount() const -> size_t;
+
+    /**
+     * @return The number of bytes used by the operations, the data block and the font copies
+     */
+    [[nodiscard]] auto getSize() const -> size_t;
+
+    /**
+     * @return true if at least one display list is recording (checked by the draw functions before looking up their list)
+     */
+    static auto isAnyRecording() -> bool;
+
+private:
+    static auto capture(u8g2_t *u8g2) -> ucgd_dl_state_t;
+
+    static auto restore(u8g2_t *u8g2, const ucgd_dl_state_t &state) -> void;
+
+    auto execute(u8g2_t *u8g2, U8g2GlyphCache *glyphs, U8g2Sprites *sprites, const ucgd_dl_op_t &op) const -> void;
+
+    std::vector<ucgd_dl_op_t> m_Ops;
+    std::vector<uint8_t> m_Data;
+    std::vector<const uint8_t *> m_FontRefs;
+    std::deque<std::vector<uint8_t>> m_Fonts;
+    ucgd_dl_state_t m_State{};
+    bool m_Recording = false;
+
+    static std::atomic<int> s_Recording;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2DISPLAYLIST_H
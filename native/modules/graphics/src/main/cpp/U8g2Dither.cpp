@@ -0,0 +1,287 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include "U8g2Dither.h"
+#include "U8g2Blit.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define UCGD_DITHER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define UCGD_DITHER_NEON
+#endif
+
+namespace {
+    const uint8_t bayer4[4][4] = {
+            {0,  8,  2,  10},
+            {12, 4,  14, 6},
+            {3,  11, 1,  9},
+            {15, 7,  13, 5}
+    };
+
+    const uint8_t bayer2[2][2] = {
+            {0, 2},
+            {3, 1}
+    };
+
+    /**
+     * Threshold (0-255) of the bayer matrix cell. The pixel is set if its luma is greater than the threshold.
+     */
+    inline uint8_t bayerThreshold(int size, int x, int y) {
+        int value;
+        if (size == 4) {
+            value = bayer4[y & 3][x & 3];
+        } else {
+            value = 4 * bayer4[y & 3][x & 3] + bayer2[(y >> 2) & 1][(x >> 2) & 1];
+        }
+        return static_cast<uint8_t>(((2 * value + 1) * 128) / (size * size) - 1);
+    }
+
+#if defined(UCGD_DITHER_SSE2)
+    inline uint8_t reverseBits(uint8_t b) {
+        b = static_cast<uint8_t>((b & 0xf0U) >> 4 | (b & 0x0fU) << 4);
+        b = static_cast<uint8_t>((b & 0xccU) >> 2 | (b & 0x33U) << 2);
+        b = static_cast<uint8_t>((b & 0xaaU) >> 1 | (b & 0x55U) << 1);
+        return b;
+    }
+
+    inline __m128i luma4x2(__m128i v0, __m128i v1) {
+        const __m128i mask = _mm_set1_epi32(0xff);
+        __m128i b = _mm_packs_epi32(_mm_and_si128(v0, mask), _mm_and_si128(v1, mask));
+        __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(v0, 8), mask), _mm_and_si128(_mm_srli_epi32(v1, 8), mask));
+        __m128i r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(v0, 16), mask), _mm_and_si128(_mm_srli_epi32(v1, 16), mask));
+        __m128i a = _mm_packs_epi32(_mm_srli_epi32(v0, 24), _mm_srli_epi32(v1, 24));
+        __m128i y = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)), _mm_mullo_epi16(g, _mm_set1_epi16(150)));
+        y = _mm_add_epi16(y, _mm_mullo_epi16(b, _mm_set1_epi16(29)));
+        y = _mm_srli_epi16(y, 8);
+        y = _mm_srli_epi16(_mm_mullo_epi16(y, _mm_add_epi16(a, _mm_set1_epi16(1))), 8);
+        return y;
+    }
+#elif defined(UCGD_DITHER_NEON)
+    inline uint8x8_t luma8(uint8x8_t b, uint8x8_t g, uint8x8_t r, uint8x8_t a) {
+        uint16x8_t sum = vmull_u8(r, vdup_n_u8(77));
+        sum = vmlal_u8(sum, g, vdup_n_u8(150));
+        sum = vmlal_u8(sum, b, vdup_n_u8(29));
+        uint8x8_t y = vshrn_n_u16(sum, 8);
+        //y * (a + 1) >> 8
+        uint16x8_t scaled = vaddw_u8(vmull_u8(y, a), y);
+        return vshrn_n_u16(scaled, 8);
+    }
+#endif
+}
+
+U8g2Dither::U8g2Dither(int mode, int threshold) : m_Mode(mode), m_Threshold(threshold) {
+}
+
+U8g2Dither::~U8g2Dither() = default;
+
+auto U8g2Dither::setMode(int mode, int threshold) -> void {
+    m_Mode = mode;
+    m_Threshold = std::clamp(threshold, 0, 255);
+}
+
+auto U8g2Dither::getMode() const -> int {
+    return m_Mode;
+}
+
+auto U8g2Dither::getThreshold() const -> int {
+    return m_Threshold;
+}
+
+auto U8g2Dither::lumaScalar(const uint8_t *bgra, uint8_t *output, size_t count) -> void {
+    for (size_t i = 0; i < count; i++, bgra += 4) {
+        unsigned y = (bgra[2] * 77U + bgra[1] * 150U + bgra[0] * 29U) >> 8;
+        output[i] = static_cast<uint8_t>((y * (bgra[3] + 1U)) >> 8);
+    }
+}
+
+auto U8g2Dither::luma(const uint8_t *bgra, uint8_t *output, size_t count) -> void {
+    size_t i = 0;
+#if defined(UCGD_DITHER_SSE2)
+    for (; i + 16 <= count; i += 16) {
+        auto *src = reinterpret_cast<const __m128i *>(bgra + i * 4);
+        __m128i lo = luma4x2(_mm_loadu_si128(src), _mm_loadu_si128(src + 1));
+        __m128i hi = luma4x2(_mm_loadu_si128(src + 2), _mm_loadu_si128(src + 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(UCGD_DITHER_NEON)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t px = vld4q_u8(bgra + i * 4);
+        uint8x8_t lo = luma8(vget_low_u8(px.val[0]), vget_low_u8(px.val[1]), vget_low_u8(px.val[2]), vget_low_u8(px.val[3]));
+        uint8x8_t hi = luma8(vget_high_u8(px.val[0]), vget_high_u8(px.val[1]), vget_high_u8(px.val[2]), vget_high_u8(px.val[3]));
+        vst1q_u8(output + i, vcombine_u8(lo, hi));
+    }
+#endif
+    lumaScalar(bgra + i * 4, output + i, count - i);
+}
+
+auto U8g2Dither::thresholdScalar(const uint8_t *luma, const uint8_t *thresholds, uint8_t *bits, size_t count) -> void {
+    for (size_t i = 0; i < count; i += 8) {
+        uint8_t value = 0;
+        size_t n = std::min<size_t>(8, count - i);
+        for (size_t j = 0; j < n; j++) {
+            if (luma[i + j] > thresholds[i + j])
+                value |= static_cast<uint8_t>(0x80U >> j);
+        }
+        bits[i >> 3] = value;
+    }
+}
+
+auto U8g2Dither::threshold(const uint8_t *luma, const uint8_t *thresholds, uint8_t *bits, size_t count) -> void {
+    size_t i = 0;
+#if defined(UCGD_DITHER_SSE2)
+    for (; i + 16 <= count; i += 16) {
+        __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(luma + i));
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i *>(thresholds + i));
+        //l > t (unsigned) <=> max(l, t) != t
+        __m128i le = _mm_cmpeq_epi8(_mm_max_epu8(l, t), t);
+        auto mask = static_cast<unsigned>(~_mm_movemask_epi8(le)) & 0xffffU;
+        bits[i >> 3] = reverseBits(static_cast<uint8_t>(mask));
+        bits[(i >> 3) + 1] = reverseBits(static_cast<uint8_t>(mask >> 8));
+    }
+#elif defined(UCGD_DITHER_NEON)
+    static const uint8_t weights[16] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+    uint8x16_t w = vld1q_u8(weights);
+    for (; i + 16 <= count; i += 16) {
+        uint8x16_t gt = vcgtq_u8(vld1q_u8(luma + i), vld1q_u8(thresholds + i));
+        uint8x16_t m = vandq_u8(gt, w);
+        uint8x8_t sum = vpadd_u8(vget_low_u8(m), vget_high_u8(m));
+        sum = vpadd_u8(sum, sum);
+        sum = vpadd_u8(sum, sum);
+        bits[i >> 3] = vget_lane_u8(sum, 0);
+        bits[(i >> 3) + 1] = vget_lane_u8(sum, 1);
+    }
+#endif
+    if (i < count)
+        thresholdScalar(luma + i, thresholds + i, bits + (i >> 3), count - i);
+}
+
+auto U8g2Dither::convert(const ucgd_image_t &image, std::vector<uint8_t> &output) -> size_t {
+    if (image.data == nullptr || image.width <= 0 || image.height <= 0)
+        return 0;
+    size_t stride = (static_cast<size_t>(image.width) + 7) / 8;
+    output.assign(stride * image.height, 0);
+    switch (m_Mode) {
+        case DITHER_THRESHOLD:
+        case DITHER_BAYER4:
+        case DITHER_BAYER8:
+            convertOrdered(image, output.data(), stride);
+            break;
+        case DITHER_FLOYD_STEINBERG:
+        case DITHER_ATKINSON:
+            convertDiffusion(image, output.data(), stride);
+            break;
+        default:
+            convertLegacy(image, output.data(), stride);
+            break;
+    }
+    return stride;
+}
+
+auto U8g2Dither::draw(u8g2_t *u8g2, int x, int y, const ucgd_image_t &image) -> void {
+    size_t stride = convert(image, m_Output);
+    if (stride == 0)
+        return;
+    ucgd_bitmap_t bitmap{m_Output.data(), m_Output.size(), image.width, image.height, stride * 8};
+    U8g2Blit::blit(u8g2, x, y, bitmap, (m_Mode == DITHER_NONE) ? U8g2Blit::fromDrawColor(u8g2) : BLIT_MODE_COPY);
+}
+
+auto U8g2Dither::convertLegacy(const ucgd_image_t &image, uint8_t *output, size_t stride) -> void {
+    size_t rowBytes = static_cast<size_t>(image.width) * 4;
+    for (int row = 0; row < image.height; row++) {
+        size_t offset = row * image.stride;
+        if (offset + rowBytes > image.length)
+            break;
+        const uint8_t *src = image.data + offset;
+        uint8_t *dst = output + row * stride;
+        for (int col = 0; col < image.width; col++, src += 4) {
+            if ((src[0] | src[1] | src[2] | src[3]) != 0)
+                dst[col >> 3] |= static_cast<uint8_t>(0x80U >> (col & 7));
+        }
+    }
+}
+
+auto U8g2Dither::convertOrdered(const ucgd_image_t &image, uint8_t *output, size_t stride) -> void {
+    auto width = static_cast<size_t>(image.width);
+    int size = (m_Mode == DITHER_BAYER4) ? 4 : (m_Mode == DITHER_BAYER8) ? 8 : 1;
+    m_Luma.resize(width);
+    m_Thresholds.resize(width * size);
+    for (int ty = 0; ty < size; ty++) {
+        for (size_t tx = 0; tx < width; tx++)
+            m_Thresholds[ty * width + tx] = (size == 1) ? static_cast<uint8_t>(m_Threshold) : bayerThreshold(size, static_cast<int>(tx), ty);
+    }
+
+    size_t rowBytes = width * 4;
+    for (int row = 0; row < image.height; row++) {
+        size_t offset = row * image.stride;
+        if (offset + rowBytes > image.length)
+            break;
+        luma(image.data + offset, m_Luma.data(), width);
+        threshold(m_Luma.data(), m_Thresholds.data() + (row % size) * width, output + row * stride, width);
+    }
+}
+
+auto U8g2Dither::convertDiffusion(const ucgd_image_t &image, uint8_t *output, size_t stride) -> void {
+    auto width = static_cast<size_t>(image.width);
+    //error rows (current, next and the one after), padded by two entries on each side
+    size_t errStride = width + 4;
+    m_Luma.resize(width);
+    m_Errors.assign(errStride * 3, 0);
+    bool atkinson = m_Mode == DITHER_ATKINSON;
+
+    size_t rowBytes = width * 4;
+    for (int row = 0; row < image.height; row++) {
+        size_t offset = row * image.stride;
+        if (offset + rowBytes > image.length)
+            break;
+        int16_t *cur = m_Errors.data() + (row % 3) * errStride + 2;
+        int16_t *nxt = m_Errors.data() + ((row + 1) % 3) * errStride + 2;
+        int16_t *nxt2 = m_Errors.data() + ((row + 2) % 3) * errStride + 2;
+        luma(image.data + offset, m_Luma.data(), width);
+        uint8_t *dst = output + row * stride;
+        for (size_t col = 0; col < width; col++) {
+            int value = m_Luma[col] + cur[col];
+            bool on = value > m_Threshold;
+            int err = value - (on ? 255 : 0);
+            if (on)
+                dst[col >> 3] |= static_cast<uint8_t>(0x80U >> (col & 7));
+            if (atkinson) {
+                auto e = static_cast<int16_t>(err / 8);
+                cur[col + 1] += e;
+                cur[col + 2] += e;
+                nxt[col - 1] += e;
+                nxt[col] += e;
+                nxt[col + 1] += e;
+                nxt2[col] += e;
+            } else {
+                cur[col + 1] += static_cast<int16_t>((err * 7) / 16);
+                nxt[col - 1] += static_cast<int16_t>((err * 3) / 16);
+                nxt[col] += static_cast<int16_t>((err * 5) / 16);
+                nxt[col + 1] += static_cast<int16_t>(err / 16);
+            }
+        }
+        //the current row becomes the row after next
+        std::fill_n(cur - 2, errStride, 0);
+    }
+}
@@ -0,0 +1,112 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2DITHER_H
+#define UCGD_MOD_GRAPHICS_U8G2DITHER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//Any non-zero pixel is set (legacy behaviour of drawPixelsBgra)
+#define DITHER_NONE 0
+//Pixels brighter than the threshold are set
+#define DITHER_THRESHOLD 1
+//Ordered dithering
+#define DITHER_BAYER4 2
+#define DITHER_BAYER8 3
+//Error diffusion
+#define DITHER_FLOYD_STEINBERG 4
+#define DITHER_ATKINSON 5
+
+#define DITHER_DEFAULT_THRESHOLD 127
+
+/**
+ * A 32-bit BGRA source image
+ */
+struct ucgd_image_t {
+    const uint8_t *data;
+    size_t length;
+    int width;
+    int height;
+    //number of bytes between the start of two rows
+    size_t stride;
+};
+
+/**
+ * Converts BGRA images to 1bpp and draws them through U8g2Blit. Scratch buffers are kept between calls.
+ */
+class U8g2Dither {
+public:
+    explicit U8g2Dither(int mode = DITHER_NONE, int threshold = DITHER_DEFAULT_THRESHOLD);
+
+    virtual ~U8g2Dither();
+
+    auto setMode(int mode, int threshold) -> void;
+
+    [[nodiscard]] auto getMode() const -> int;
+
+    [[nodiscard]] auto getThreshold() const -> int;
+
+    /**
+     * Convert the image and draw it at x, y. Legacy mode only sets the non-zero pixels (draw color), the other modes draw an opaque image.
+     */
+    auto draw(u8g2_t *u8g2, int x, int y, const ucgd_image_t &image) -> void;
+
+    /**
+     * Convert the image to a 1bpp bitmap (msb first, byte aligned rows). Returns the number of bytes per row.
+     */
+    auto convert(const ucgd_image_t &image, std::vector<uint8_t> &output) -> size_t;
+
+    /**
+     * Luma (BT.601, scaled by alpha) of each pixel. Uses SSE2 or NEON when available.
+     */
+    static auto luma(const uint8_t *bgra, uint8_t *output, size_t count) -> void;
+
+    static auto lumaScalar(const uint8_t *bgra, uint8_t *output, size_t count) -> void;
+
+    /**
+     * Set the bit (msb first) of every pixel whose luma is greater than its threshold. Uses SSE2 or NEON when available.
+     */
+    static auto threshold(const uint8_t *luma, const uint8_t *thresholds, uint8_t *bits, size_t count) -> void;
+
+    static auto thresholdScalar(const uint8_t *luma, const uint8_t *thresholds, uint8_t *bits, size_t count) -> void;
+
+private:
+    auto convertOrdered(const ucgd_image_t &image, uint8_t *output, size_t stride) -> void;
+
+    auto convertDiffusion(const ucgd_image_t &image, uint8_t *output, size_t stride) -> void;
+
+    static auto convertLegacy(const ucgd_image_t &image, uint8_t *output, size_t stride) -> void;
+
+    int m_Mode;
+    int m_Threshold;
+    std::vector<uint8_t> m_Luma;
+    std::vector<uint8_t> m_Thresholds;
+    std::vector<int16_t> m_Errors;
+    std::vector<uint8_t> m_Output;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2DITHER_H
@@ -0,0 +1,455 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "U8g2Emulator.h"
+
+#include <algorithm>
+#include <cstring>
+
+extern "C" {
+#include <u8x8.h>
+}
+
+#define SETUP_PREFIX "u8g2_Setup_"
+
+auto U8g2Emulator::create(const std::string &setupProcName, int width, int height) -> std::unique_ptr<U8g2Emulator> {
+    if (width <= 0 || height <= 0 || (width % 8) != 0 || (height % 8) != 0)
+        return nullptr;
+    std::string name = setupProcName;
+    if (name.compare(0, strlen(SETUP_PREFIX), SETUP_PREFIX) == 0)
+        name = name.substr(strlen(SETUP_PREFIX));
+    std::string controller = name.substr(0, name.find('_'));
+    bool i2c = name.find("_i2c_") != std::string::npos;
+    int bus = i2c ? EMU_BUS_I2C : EMU_BUS_DC;
+    int pages = std::max(8, height / 8);
+
+    if (controller == "ssd1306" || controller == "ssd1309")
+        return std::unique_ptr<U8g2Emulator>(new U8g2PageEmulator(U8g2PageEmulator::FAMILY_SSD1306, bus, width, height, std::max(128, width), pages));
+    if (controller == "ssd1305")
+        return std::unique_ptr<U8g2Emulator>(new U8g2PageEmulator(U8g2PageEmulator::FAMILY_SSD1306, bus, width, height, std::max(132, width), pages));
+    if (controller == "sh1106")
+        return std::unique_ptr<U8g2Emulator>(new U8g2PageEmulator(U8g2PageEmulator::FAMILY_SH1106, bus, width, height, std::max(132, width), pages));
+    //the i2c variants of the remaining controllers do not use the ssd13xx framing
+    if (i2c)
+        return nullptr;
+    if (controller == "st7565" || controller == "st7567")
+        return std::unique_ptr<U8g2Emulator>(new U8g2PageEmulator(U8g2PageEmulator::FAMILY_ST7565, bus, width, height, std::max(132, width), std::max(9, pages)));
+    if (controller == "uc1701")
+        return std::unique_ptr<U8g2Emulator>(new U8g2PageEmulator(U8g2PageEmulator::FAMILY_UC1701, bus, width, height, std::max(132, width), std::max(9, pages)));
+    if (controller == "st7920" && width <= U8g2St7920Emulator::GDRAM_ROW_BYTES * 8 && height <= U8g2St7920Emulator::GDRAM_ROWS)
+        return std::unique_ptr<U8g2Emulator>(new U8g2St7920Emulator(name.compare(0, 9, "st7920_s_") == 0 ? EMU_BUS_ST7920_SPI : EMU_BUS_DC, width, height));
+    return nullptr;
+}
+
+U8g2Emulator::U8g2Emulator(int bus, int width, int height) : m_Width(width), m_Height(height), m_Bus(bus) {
+}
+
+auto U8g2Emulator::feed(uint8_t msg, uint8_t arg_int, const void *arg_ptr) -> void {
+    switch (msg) {
+        case U8X8_MSG_BYTE_SET_DC:
+            m_Dc = arg_int != 0;
+            break;
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            m_Transfers++;
+            m_ExpectControl = m_Bus == EMU_BUS_I2C;
+            m_HasNibble = false;
+            break;
+        case U8X8_MSG_BYTE_SEND: {
+            auto *bytes = static_cast<const uint8_t *>(arg_ptr);
+            if (bytes == nullptr)
+                break;
+            for (int i = 0; i < arg_int; i++)
+                receive(bytes[i]);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+auto U8g2Emulator::receive(uint8_t value) -> void {
+    switch (m_Bus) {
+        case EMU_BUS_I2C:
+            //control byte: bit 6 selects data, bit 7 (continuation) means a single byte follows before the next control byte
+            if (m_ExpectControl) {
+                m_Dc = (value & 0x40) != 0;
+                m_SingleControl = (value & 0x80) != 0;
+                m_ExpectControl = false;
+                return;
+            }
+            if (m_SingleControl)
+                m_ExpectControl = true;
+            break;
+        case EMU_BUS_ST7920_SPI:
+            //sync byte is 11111 RW RS 0, value bytes always have a zero low nibble
+            if ((value & 0xf8) == 0xf8 && (value & 0x0f) != 0) {
+                m_Dc = (value & 0x02) != 0;
+                m_HasNibble = false;
+                return;
+            }
+            if (!m_HasNibble) {
+                m_HighNibble = value & 0xf0;
+                m_HasNibble = true;
+                return;
+            }
+            value = m_HighNibble | (value >> 4);
+            m_HasNibble = false;
+            break;
+        default:
+            break;
+    }
+    if (m_Dc) {
+        m_Data++;
+        data(value);
+    } else {
+        command(value);
+    }
+}
+
+auto U8g2Emulator::snapshot(int64_t *values, int count) const -> int {
+    int64_t all[EMU_STATS_COUNT];
+    all[EMU_STATS_COMMANDS] = static_cast<int64_t>(m_Commands);
+    all[EMU_STATS_ARGUMENTS] = static_cast<int64_t>(m_Arguments);
+    all[EMU_STATS_DATA_BYTES] = static_cast<int64_t>(m_Data);
+    all[EMU_STATS_TRANSFERS] = static_cast<int64_t>(m_Transfers);
+    all[EMU_STATS_UNKNOWN] = static_cast<int64_t>(m_Unknown);
+    all[EMU_STATS_ADDRESS_SETS] = static_cast<int64_t>(m_AddressSets);
+    all[EMU_STATS_DROPPED] = static_cast<int64_t>(m_Dropped);
+    all[EMU_STATS_DISPLAY_ON] = m_DisplayOn ? 1 : 0;
+    all[EMU_STATS_INVERTED] = m_Inverted ? 1 : 0;
+    all[EMU_STATS_CONTRAST] = m_Contrast;
+    int n = count < EMU_STATS_COUNT ? count : EMU_STATS_COUNT;
+    for (int i = 0; i < n; i++)
+        values[i] = all[i];
+    return n < 0 ? 0 : n;
+}
+
+auto U8g2Emulator::reset() -> void {
+    m_Commands = m_Arguments = m_Data = m_Transfers = m_Unknown = m_AddressSets = m_Dropped = 0;
+}
+
+U8g2PageEmulator::U8g2PageEmulator(int family, int bus, int width, int height, int ramWidth, int ramPages) : U8g2Emulator(bus, width, height),
+                                                                                                             m_Family(family),
+                                                                                                             m_RamWidth(ramWidth),
+                                                                                                             m_RamPages(ramPages),
+                                                                                                             m_Ram(static_cast<size_t>(ramWidth) * ramPages, 0),
+                                                                                                             m_ColumnEnd(ramWidth - 1),
+                                                                                                             m_PageEnd(ramPages - 1) {
+}
+
+auto U8g2PageEmulator::argumentCount(int family, uint8_t cmd) -> int {
+    switch (family) {
+        case FAMILY_SSD1306:
+            switch (cmd) {
+                case 0x20: case 0x81: case 0x82: case 0x8d: case 0xa8: case 0xd3: case 0xd5: case 0xd8: case 0xd9: case 0xda: case 0xdb: case 0xfd:
+                    return 1;
+                case 0x21: case 0x22: case 0xa3:
+                    return 2;
+                case 0x91:
+                    return 4;
+                case 0x29: case 0x2a:
+                    return 5;
+                case 0x26: case 0x27: case 0x2c: case 0x2d:
+                    return 6;
+                default:
+                    return 0;
+            }
+        case FAMILY_SH1106:
+            //u8g2 drives the sh1106 with the ssd1306 startup sequence (charge pump, addressing mode), the arguments are skipped
+            return cmd == 0xad ? 1 : argumentCount(FAMILY_SSD1306, cmd);
+        case FAMILY_ST7565:
+            return (cmd == 0x81 || cmd == 0xf8 || cmd == 0xad) ? 1 : 0;
+        case FAMILY_UC1701:
+            return (cmd == 0x81 || cmd == 0xf8 || cmd == 0xfa) ? 1 : 0;
+        default:
+            return 0;
+    }
+}
+
+auto U8g2PageEmulator::command(uint8_t value) -> void {
+    if (m_ArgsLeft > 0) {
+        m_Arguments++;
+        m_Args[m_ArgCount++] = value;
+        if (--m_ArgsLeft == 0)
+            execute(m_Pending, m_Args);
+        return;
+    }
+    m_Commands++;
+    int count = argumentCount(m_Family, value);
+    if (count == 0) {
+        execute(value, nullptr);
+        return;
+    }
+    m_Pending = value;
+    m_ArgCount = 0;
+    m_ArgsLeft = count;
+}
+
+auto U8g2PageEmulator::execute(uint8_t cmd, const uint8_t *args) -> void {
+    bool ssd1306 = m_Family == FAMILY_SSD1306;
+    bool sh1106 = m_Family == FAMILY_SH1106;
+    bool st7565 = m_Family == FAMILY_ST7565 || m_Family == FAMILY_UC1701;
+    bool known = true;
+
+    if (cmd <= 0x0f) {
+        m_Column = (m_Column & 0xf0) | (cmd & 0x0f);
+        m_AddressSets++;
+    } else if (cmd <= 0x1f) {
+        m_Column = ((cmd & 0x0f) << 4) | (m_Column & 0x0f);
+        m_AddressSets++;
+    } else if (cmd >= 0x40 && cmd <= 0x7f) {
+        m_StartLine = cmd & 0x3f;
+    } else if (cmd >= 0xb0 && cmd <= 0xbf) {
+        m_Page = cmd & (ssd1306 ? 0x07 : 0x0f);
+        m_AddressSets++;
+    } else if (cmd >= 0xc0 && cmd <= 0xcf) {
+        m_ComReverse = (cmd & 0x08) != 0;
+    } else if (st7565 && cmd >= 0x20 && cmd <= 0x2f) {
+        //power control and regulator ratio
+    } else if (sh1106 && cmd >= 0x30 && cmd <= 0x33) {
+        //pump voltage
+    } else {
+        switch (cmd) {
+            case 0x81:
+                m_Contrast = args[0];
+                break;
+            case 0xa0:
+            case 0xa1:
+                m_SegmentRemap = cmd == 0xa1;
+                break;
+            case 0xa4:
+            case 0xa5:
+                m_AllOn = cmd == 0xa5;
+                break;
+            case 0xa6:
+            case 0xa7:
+                m_Inverted = cmd == 0xa7;
+                break;
+            case 0xae:
+            case 0xaf:
+                m_DisplayOn = cmd == 0xaf;
+                break;
+            case 0xe3:
+                break;
+            case 0x20:
+                known = ssd1306 || sh1106;
+                if (ssd1306)
+                    m_AddressMode = (args[0] & 0x03) == 0x03 ? 2 : (args[0] & 0x03);
+                break;
+            case 0x21:
+                known = ssd1306 || sh1106;
+                if (ssd1306) {
+                    m_ColumnStart = std::min<int>(args[0], m_RamWidth - 1);
+                    m_ColumnEnd = std::min<int>(args[1], m_RamWidth - 1);
+                    m_Column = m_ColumnStart;
+                    m_AddressSets++;
+                }
+                break;
+            case 0x22:
+                known = ssd1306 || sh1106;
+                if (ssd1306) {
+                    m_PageStart = std::min<int>(args[0] & 0x07, m_RamPages - 1);
+                    m_PageEnd = std::min<int>(args[1] & 0x07, m_RamPages - 1);
+                    m_Page = m_PageStart;
+                    m_AddressSets++;
+                }
+                break;
+            case 0xe2:
+                //software reset, the ram is kept
+                known = st7565;
+                if (known) {
+                    m_Column = m_Page = m_StartLine = 0;
+                    m_SegmentRemap = m_ComReverse = m_Inverted = m_AllOn = false;
+                }
+                break;
+            case 0xe0:
+            case 0xee:
+                //read-modify-write
+                known = !ssd1306;
+                break;
+            case 0xa2:
+            case 0xac:
+                //lcd bias, static indicator off
+                known = st7565;
+                break;
+            case 0xa3:
+                known = !sh1106;
+                break;
+            case 0x26: case 0x27: case 0x29: case 0x2a: case 0x2c: case 0x2d: case 0x2e: case 0x2f:
+            case 0x82: case 0x8d: case 0x91: case 0xd8: case 0xfd:
+                //scrolling, charge pump and ssd1305/ssd1309 specific settings
+                known = !st7565;
+                break;
+            case 0xa8: case 0xd3: case 0xd5: case 0xd9: case 0xda: case 0xdb:
+                //multiplex ratio, display offset, clock, pre-charge, com pins and vcomh
+                known = !st7565;
+                break;
+            case 0xad:
+                known = sh1106 || m_Family == FAMILY_ST7565;
+                break;
+            case 0xf8:
+                known = st7565;
+                break;
+            case 0xfa:
+                known = m_Family == FAMILY_UC1701;
+                break;
+            default:
+                known = false;
+                break;
+        }
+    }
+    if (!known)
+        m_Unknown++;
+}
+
+auto U8g2PageEmulator::data(uint8_t value) -> void {
+    if (m_Page < m_RamPages && m_Column < m_RamWidth)
+        m_Ram[static_cast<size_t>(m_Page) * m_RamWidth + m_Column] = value;
+    else
+        m_Dropped++;
+
+    if (m_Family == FAMILY_SSD1306 && m_AddressMode == 0) {
+        if (++m_Column > m_ColumnEnd) {
+            m_Column = m_ColumnStart;
+            if (++m_Page > m_PageEnd)
+                m_Page = m_PageStart;
+        }
+    } else if (m_Family == FAMILY_SSD1306 && m_AddressMode == 1) {
+        if (++m_Page > m_PageEnd) {
+            m_Page = m_PageStart;
+            if (++m_Column > m_ColumnEnd)
+                m_Column = m_ColumnStart;
+        }
+    } else if (m_Family == FAMILY_SSD1306) {
+        //page addressing wraps within the page
+        if (++m_Column >= m_RamWidth)
+            m_Column = 0;
+    } else if (m_Column < m_RamWidth) {
+        m_Column++;
+    }
+}
+
+auto U8g2PageEmulator::ramAt(int column, int page) const -> uint8_t {
+    if (column < 0 || column >= m_RamWidth || page < 0 || page >= m_RamPages)
+        return 0;
+    return m_Ram[static_cast<size_t>(page) * m_RamWidth + column];
+}
+
+auto U8g2PageEmulator::ramBit(int column, int row) const -> bool {
+    return (ramAt(column, row / 8) >> (row % 8)) & 1;
+}
+
+auto U8g2PageEmulator::getImage(uint8_t *out, size_t size, int xOffset, bool effects) const -> size_t {
+    if (out == nullptr || size < getImageSize())
+        return 0;
+    int pages = m_Height / 8;
+    for (int page = 0; page < pages; page++) {
+        for (int x = 0; x < m_Width; x++) {
+            int column = x + xOffset;
+            uint8_t value = ramAt(column, page);
+            if (effects) {
+                if (!m_DisplayOn) {
+                    value = 0;
+                } else {
+                    if (m_AllOn) {
+                        value = 0xff;
+                    } else if (m_StartLine != 0) {
+                        //the start line is the ram row shown on the first com line, wrapping over the 64 addressable rows
+                        value = 0;
+                        for (int bit = 0; bit < 8; bit++) {
+                            if (ramBit(column, (page * 8 + bit + m_StartLine) & 0x3f))
+                                value |= 1 << bit;
+                        }
+                    }
+                    if (m_Inverted)
+                        value ^= 0xff;
+                }
+            }
+            out[static_cast<size_t>(page) * m_Width + x] = value;
+        }
+    }
+    return getImageSize();
+}
+
+U8g2St7920Emulator::U8g2St7920Emulator(int bus, int width, int height) : U8g2Emulator(bus, width, height), m_Gdram(GDRAM_ROWS * GDRAM_ROW_BYTES, 0) {
+}
+
+auto U8g2St7920Emulator::command(uint8_t value) -> void {
+    m_Commands++;
+    //function set, RE selects the extended instruction set and G (extended only) enables the graphic display
+    if ((value & 0xe0) == 0x20) {
+        m_Extended = (value & 0x04) != 0;
+        if (m_Extended)
+            m_GraphicOn = (value & 0x02) != 0;
+        m_VerticalSet = false;
+        return;
+    }
+    if (value & 0x80) {
+        m_AddressSets++;
+        if (!m_Extended)
+            return; //ddram address
+        //gdram address, vertical first then horizontal
+        if (!m_VerticalSet) {
+            m_Row = value & 0x3f;
+            m_VerticalSet = true;
+        } else {
+            m_Byte = (value & 0x0f) * 2;
+            m_VerticalSet = false;
+        }
+        return;
+    }
+    if (!m_Extended && (value & 0xf8) == 0x08) {
+        m_DisplayOn = (value & 0x04) != 0;
+        return;
+    }
+    if (value == 0x00)
+        m_Unknown++;
+}
+
+auto U8g2St7920Emulator::data(uint8_t value) -> void {
+    m_VerticalSet = false;
+    if (!m_Extended) {
+        //text (ddram/cgram) writes are not emulated
+        m_Dropped++;
+        return;
+    }
+    m_Gdram[static_cast<size_t>(m_Row) * GDRAM_ROW_BYTES + m_Byte] = value;
+    m_Byte = (m_Byte + 1) % GDRAM_ROW_BYTES;
+}
+
+auto U8g2St7920Emulator::getImage(uint8_t *out, size_t size, int xOffset, bool effects) const -> size_t {
+    if (out == nullptr || size < getImageSize())
+        return 0;
+    int rowBytes = m_Width / 8;
+    bool visible = m_DisplayOn && m_GraphicOn;
+    for (int y = 0; y < m_Height; y++) {
+        int row = y % 32;
+        int offset = (y / 32) * rowBytes;
+        for (int x = 0; x < rowBytes; x++) {
+            int index = x + offset;
+            uint8_t value = index < GDRAM_ROW_BYTES ? m_Gdram[static_cast<size_t>(row) * GDRAM_ROW_BYTES + index] : 0;
+            if (effects && !visible)
+                value = 0;
+            out[static_cast<size_t>(y) * rowBytes + x] = value;
+        }
+    }
+    return getImageSize();
+}
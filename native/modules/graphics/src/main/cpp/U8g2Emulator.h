@@ -0,0 +1,211 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2EMULATOR_H
+#define UCGD_MOD_GRAPHICS_U8G2EMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+//Indices of the values returned by U8g2Emulator::snapshot() (and U8g2Graphics.getEmulatorStatistics)
+#define EMU_STATS_COMMANDS 0
+#define EMU_STATS_ARGUMENTS 1
+#define EMU_STATS_DATA_BYTES 2
+#define EMU_STATS_TRANSFERS 3
+#define EMU_STATS_UNKNOWN 4
+#define EMU_STATS_ADDRESS_SETS 5
+#define EMU_STATS_DROPPED 6
+#define EMU_STATS_DISPLAY_ON 7
+#define EMU_STATS_INVERTED 8
+#define EMU_STATS_CONTRAST 9
+#define EMU_STATS_COUNT 10
+
+//Framing of the command/data stream
+#define EMU_BUS_DC 0         //dc line (4-wire/3-wire spi, 6800, 8080)
+#define EMU_BUS_I2C 1        //control byte at the start of each transfer (ssd13xx i2c)
+#define EMU_BUS_ST7920_SPI 2 //sync byte followed by two bytes per value, high nibble first
+
+/**
+ * Emulates the display controller behind a virtual device. The u8x8 byte stream is decoded back into commands and
+ * data which are applied to a simulated display ram, so the image a real panel would show can be compared against the
+ * u8g2 buffer. Not thread-safe, meant to be used from the thread driving the display.
+ */
+class U8g2Emulator {
+public:
+    //Returns an emulator for the controller of the setup procedure, or nullptr if the controller is not emulated
+    static auto create(const std::string &setupProcName, int width, int height) -> std::unique_ptr<U8g2Emulator>;
+
+    virtual ~U8g2Emulator() = default;
+
+    //Process a message of the u8x8 byte callback
+    auto feed(uint8_t msg, uint8_t arg_int, const void *arg_ptr) -> void;
+
+    /**
+     * Copy the panel image into out, in the buffer layout u8g2 uses for the controller. xOffset is the first visible
+     * ram column (u8x8->x_offset). If effects is true, the display on/off, inversion, all pixels on and start line
+     * settings are applied, otherwise the raw ram contents are returned. Returns the number of bytes written.
+     */
+    virtual auto getImage(uint8_t *out, size_t size, int xOffset, bool effects) const -> size_t = 0;
+
+    [[nodiscard]] auto getImageSize() const -> size_t {
+        return static_cast<size_t>(m_Width / 8) * m_Height;
+    }
+
+    [[nodiscard]] auto getWidth() const -> int {
+        return m_Width;
+    }
+
+    [[nodiscard]] auto getHeight() const -> int {
+        return m_Height;
+    }
+
+    //Fill values with up to count entries (see EMU_STATS_*). Returns the number of entries written.
+    auto snapshot(int64_t *values, int count) const -> int;
+
+    //Reset the counters, the ram and the controller state are left untouched
+    auto reset() -> void;
+
+protected:
+    U8g2Emulator(int bus, int width, int height);
+
+    virtual auto command(uint8_t value) -> void = 0;
+
+    virtual auto data(uint8_t value) -> void = 0;
+
+    int m_Width;
+    int m_Height;
+    uint64_t m_Commands{0};
+    uint64_t m_Arguments{0};
+    uint64_t m_Unknown{0};
+    uint64_t m_AddressSets{0};
+    uint64_t m_Dropped{0};
+    bool m_DisplayOn{false};
+    bool m_Inverted{false};
+    int m_Contrast{-1};
+
+private:
+    auto receive(uint8_t value) -> void;
+
+    int m_Bus;
+    bool m_Dc{false};
+    bool m_ExpectControl{false};
+    bool m_SingleControl{false};
+    bool m_HasNibble{false};
+    uint8_t m_HighNibble{0};
+    uint64_t m_Data{0};
+    uint64_t m_Transfers{0};
+};
+
+/**
+ * Page addressed controllers: SSD1305/SSD1306/SSD1309, SH1106, ST7565/ST7567 and UC1701. Each data byte is a column of
+ * 8 pixels of the current page (vertical, lsb on top), the same layout as the u8g2 buffer.
+ */
+class U8g2PageEmulator : public U8g2Emulator {
+public:
+    static constexpr int FAMILY_SSD1306 = 0;
+    static constexpr int FAMILY_SH1106 = 1;
+    static constexpr int FAMILY_ST7565 = 2;
+    static constexpr int FAMILY_UC1701 = 3;
+
+    U8g2PageEmulator(int family, int bus, int width, int height, int ramWidth, int ramPages);
+
+    auto getImage(uint8_t *out, size_t size, int xOffset, bool effects) const -> size_t override;
+
+    //Raw ram access, column major within each page
+    [[nodiscard]] auto ramAt(int column, int page) const -> uint8_t;
+
+protected:
+    auto command(uint8_t value) -> void override;
+
+    auto data(uint8_t value) -> void override;
+
+private:
+    //Number of argument bytes following the command
+    static auto argumentCount(int family, uint8_t cmd) -> int;
+
+    auto execute(uint8_t cmd, const uint8_t *args) -> void;
+
+    //Bit of the ram at the given column and row (bounds checked)
+    auto ramBit(int column, int row) const -> bool;
+
+    int m_Family;
+    int m_RamWidth;
+    int m_RamPages;
+    std::vector<uint8_t> m_Ram;
+    int m_Column{0};
+    int m_Page{0};
+    //ssd1306 horizontal/vertical addressing mode (0x20), 2 = page addressing
+    int m_AddressMode{2};
+    int m_ColumnStart{0};
+    int m_ColumnEnd;
+    int m_PageStart{0};
+    int m_PageEnd;
+    int m_StartLine{0};
+    bool m_AllOn{false};
+    bool m_SegmentRemap{false};
+    bool m_ComReverse{false};
+    uint8_t m_Pending{0};
+    int m_ArgsLeft{0};
+    int m_ArgCount{0};
+    uint8_t m_Args[8]{};
+};
+
+/**
+ * ST7920 in extended instruction mode. The graphic ram is 64 rows of 32 bytes (16 words, msb on the left) addressed by
+ * a vertical then a horizontal (word) address. Displays with more than 32 rows continue the lower half to the right of
+ * the upper half, as done by u8g2.
+ */
+class U8g2St7920Emulator : public U8g2Emulator {
+public:
+    static constexpr int GDRAM_ROWS = 64;
+    static constexpr int GDRAM_ROW_BYTES = 32;
+
+    U8g2St7920Emulator(int bus, int width, int height);
+
+    auto getImage(uint8_t *out, size_t size, int xOffset, bool effects) const -> size_t override;
+
+    [[nodiscard]] auto isExtended() const -> bool {
+        return m_Extended;
+    }
+
+    [[nodiscard]] auto isGraphicOn() const -> bool {
+        return m_GraphicOn;
+    }
+
+protected:
+    auto command(uint8_t value) -> void override;
+
+    auto data(uint8_t value) -> void override;
+
+private:
+    std::vector<uint8_t> m_Gdram;
+    bool m_Extended{false};
+    bool m_GraphicOn{false};
+    //next 0x80 command in extended mode sets the horizontal address
+    bool m_VerticalSet{false};
+    int m_Row{0};
+    int m_Byte{0};
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2EMULATOR_H
@@ -0,0 +1,302 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "U8g2Export.h"
+
+namespace {
+    const uint8_t pngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    //maximum payload of a stored deflate block
+    const size_t pngStoredBlock = 65535;
+
+    struct crc_table_t {
+        uint32_t values[256]{};
+
+        crc_table_t() {
+            for (uint32_t n = 0; n < 256; n++) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1U) ? (0xedb88320U ^ (c >> 1)) : (c >> 1);
+                values[n] = c;
+            }
+        }
+    };
+
+    uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length) {
+        static const crc_table_t table;
+        crc = ~crc;
+        for (size_t i = 0; i < length; i++)
+            crc = table.values[(crc ^ data[i]) & 0xffU] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    inline uint8_t *put32(uint8_t *p, uint32_t value) {
+        p[0] = static_cast<uint8_t>(value >> 24);
+        p[1] = static_cast<uint8_t>(value >> 16);
+        p[2] = static_cast<uint8_t>(value >> 8);
+        p[3] = static_cast<uint8_t>(value);
+        return p + 4;
+    }
+
+    /**
+     * Writes the length, type, data and crc of a chunk whose data has already been written after the header (at p + 8)
+     */
+    inline uint8_t *closeChunk(uint8_t *p, const char *type, size_t length) {
+        put32(p, static_cast<uint32_t>(length));
+        std::memcpy(p + 4, type, 4);
+        uint8_t *end = p + 8 + length;
+        return put32(end, crc32(0, p + 4, length + 4));
+    }
+
+    inline int bufferWidth(u8g2_t *u8g2) {
+        return u8g2_GetBufferTileWidth(u8g2) * 8;
+    }
+
+    inline int bufferHeight(u8g2_t *u8g2) {
+        return u8g2_GetBufferTileHeight(u8g2) * 8;
+    }
+
+    inline int formatHeader(char *header, size_t size, int format, int width, int height) {
+        if (format == EXPORT_FORMAT_PBM)
+            return std::snprintf(header, size, "P4\n%d %d\n", width, height);
+        return std::snprintf(header, size, "#define xbm_width %d\n#define xbm_height %d\nstatic unsigned char xbm_bits[] = {\n", width, height);
+    }
+
+    inline size_t pngDataSize(size_t rowBytes, int height) {
+        return (rowBytes + 1) * height;
+    }
+
+    inline size_t pngBlockCount(size_t dataSize) {
+        return dataSize == 0 ? 1 : (dataSize + pngStoredBlock - 1) / pngStoredBlock;
+    }
+}
+
+auto U8g2Export::getSize(u8g2_t *u8g2, int format) -> size_t {
+    int width = bufferWidth(u8g2);
+    int height = bufferHeight(u8g2);
+    size_t rowBytes = (static_cast<size_t>(width) + 7) / 8;
+    size_t raw = rowBytes * height;
+    char header[128];
+    switch (format) {
+        case EXPORT_FORMAT_RAW:
+            return raw;
+        case EXPORT_FORMAT_PBM:
+            return formatHeader(header, sizeof(header), format, width, height) + raw;
+        case EXPORT_FORMAT_XBM:
+            //"0xhh" per byte, ", " (or ",\n") between bytes and "\n};\n" at the end
+            return formatHeader(header, sizeof(header), format, width, height) + raw * 4 + (raw > 0 ? (raw - 1) * 2 : 0) + 4;
+        case EXPORT_FORMAT_PNG: {
+            size_t data = pngDataSize(rowBytes, height);
+            //signature, IHDR, IDAT (zlib header, stored blocks, adler32) and IEND
+            return sizeof(pngSignature) + (12 + 13) + (12 + 2 + pngBlockCount(data) * 5 + data + 4) + 12;
+        }
+        default:
+            return 0;
+    }
+}
+
+auto U8g2Export::encode(u8g2_t *u8g2, int format, uint8_t *output, size_t capacity) -> size_t {
+    size_t size = getSize(u8g2, format);
+    if (size == 0 || output == nullptr || capacity < size)
+        return 0;
+    int width = bufferWidth(u8g2);
+    int height = bufferHeight(u8g2);
+    size_t rowBytes = (static_cast<size_t>(width) + 7) / 8;
+
+    switch (format) {
+        case EXPORT_FORMAT_RAW:
+        case EXPORT_FORMAT_PBM: {
+            uint8_t *p = output;
+            if (format == EXPORT_FORMAT_PBM) {
+                char header[128];
+                int length = formatHeader(header, sizeof(header), format, width, height);
+                std::memcpy(p, header, length);
+                p += length;
+            }
+            for (int row = 0; row < height; row++, p += rowBytes)
+                writeRow(u8g2, row, p, false);
+            return p - output;
+        }
+        case EXPORT_FORMAT_XBM:
+            return encodeXbm(u8g2, output);
+        default:
+            return encodePng(u8g2, output);
+    }
+}
+
+auto U8g2Export::writeRow(u8g2_t *u8g2, int row, uint8_t *output, bool lsbFirst) -> void {
+    const uint8_t *buffer = u8g2_GetBufferPtr(u8g2);
+    int tileWidth = u8g2_GetBufferTileWidth(u8g2);
+    if (u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb) {
+        const uint8_t *src = buffer + row * tileWidth;
+        if (!lsbFirst) {
+            std::memcpy(output, src, tileWidth);
+            return;
+        }
+        for (int b = 0; b < tileWidth; b++) {
+            uint8_t v = src[b];
+            v = static_cast<uint8_t>((v & 0xf0U) >> 4 | (v & 0x0fU) << 4);
+            v = static_cast<uint8_t>((v & 0xccU) >> 2 | (v & 0x33U) << 2);
+            v = static_cast<uint8_t>((v & 0xaaU) >> 1 | (v & 0x55U) << 1);
+            output[b] = v;
+        }
+        return;
+    }
+    //vertical_top_lsb: one bit of each column byte of the page
+    const uint8_t *page = buffer + (row >> 3) * tileWidth * 8;
+    unsigned shift = row & 7;
+    for (int b = 0; b < tileWidth; b++) {
+        const uint8_t *col = page + b * 8;
+        uint8_t v = 0;
+        for (int k = 0; k < 8; k++) {
+            unsigned bit = (col[k] >> shift) & 1U;
+            v |= static_cast<uint8_t>(bit << (lsbFirst ? k : 7 - k));
+        }
+        output[b] = v;
+    }
+}
+
+auto U8g2Export::encodeXbm(u8g2_t *u8g2, uint8_t *output) -> size_t {
+    static const char hex[] = "0123456789abcdef";
+    int width = bufferWidth(u8g2);
+    int height = bufferHeight(u8g2);
+    int tileWidth = u8g2_GetBufferTileWidth(u8g2);
+    size_t raw = static_cast<size_t>(tileWidth) * height;
+
+    char header[128];
+    int length = formatHeader(header, sizeof(header), EXPORT_FORMAT_XBM, width, height);
+    std::memcpy(output, header, length);
+    uint8_t *p = output + length;
+
+    std::vector<uint8_t> bits(tileWidth);
+    size_t index = 0;
+    for (int y = 0; y < height; y++) {
+        writeRow(u8g2, y, bits.data(), true);
+        for (int b = 0; b < tileWidth; b++, index++) {
+            uint8_t v = bits[b];
+            *p++ = '0';
+            *p++ = 'x';
+            *p++ = hex[v >> 4];
+            *p++ = hex[v & 0x0fU];
+            if (index + 1 < raw) {
+                *p++ = ',';
+                *p++ = ((index + 1) % 16 == 0) ? '\n' : ' ';
+            }
+        }
+    }
+    std::memcpy(p, "\n};\n", 4);
+    p += 4;
+    return p - output;
+}
+
+auto U8g2Export::encodePng(u8g2_t *u8g2, uint8_t *output) -> size_t {
+    int width = bufferWidth(u8g2);
+    int height = bufferHeight(u8g2);
+    size_t rowBytes = (static_cast<size_t>(width) + 7) / 8;
+    uint8_t *p = output;
+
+    std::memcpy(p, pngSignature, sizeof(pngSignature));
+    p += sizeof(pngSignature);
+
+    //IHDR: 1-bit grayscale, no interlacing
+    uint8_t *ihdr = p;
+    uint8_t *d = put32(put32(ihdr + 8, static_cast<uint32_t>(width)), static_cast<uint32_t>(height));
+    d[0] = 1;
+    d[1] = 0;
+    d[2] = 0;
+    d[3] = 0;
+    d[4] = 0;
+    p = closeChunk(ihdr, "IHDR", 13);
+
+    //IDAT: zlib stream made of stored blocks, each scanline is prefixed with filter type 0
+    uint8_t *idat = p;
+    d = idat + 8;
+    *d++ = 0x78;
+    *d++ = 0x01;
+    size_t dataSize = pngDataSize(rowBytes, height);
+    size_t blocks = pngBlockCount(dataSize);
+    uint32_t a = 1, b = 0;
+    std::vector<uint8_t> scanline(rowBytes);
+    size_t remaining = dataSize;
+    int row = 0;
+    //position inside the current scanline (0 = filter byte)
+    size_t column = 0;
+    for (size_t block = 0; block < blocks; block++) {
+        auto length = static_cast<uint16_t>(std::min(remaining, pngStoredBlock));
+        remaining -= length;
+        *d++ = (block + 1 == blocks) ? 1 : 0;
+        *d++ = static_cast<uint8_t>(length);
+        *d++ = static_cast<uint8_t>(length >> 8);
+        *d++ = static_cast<uint8_t>(~length);
+        *d++ = static_cast<uint8_t>(~length >> 8);
+        uint8_t *start = d;
+        size_t left = length;
+        while (left > 0) {
+            if (column == 0) {
+                *d++ = 0;
+                left--;
+                column = 1;
+                continue;
+            }
+            //whole scanlines are written in place
+            if (column == 1 && left >= rowBytes) {
+                writeRow(u8g2, row, d, false);
+                for (size_t i = 0; i < rowBytes; i++)
+                    d[i] = static_cast<uint8_t>(~d[i]);
+                d += rowBytes;
+                left -= rowBytes;
+                column = 0;
+                row++;
+                continue;
+            }
+            //part of a scanline that spans two blocks
+            writeRow(u8g2, row, scanline.data(), false);
+            size_t count = std::min(left, rowBytes - (column - 1));
+            for (size_t i = 0; i < count; i++)
+                *d++ = static_cast<uint8_t>(~scanline[column - 1 + i]);
+            left -= count;
+            column += count;
+            if (column == rowBytes + 1) {
+                column = 0;
+                row++;
+            }
+        }
+        //adler32 of the uncompressed data (5552 bytes can be summed without overflow)
+        for (uint8_t *q = start; q < d;) {
+            size_t n = std::min<size_t>(5552, static_cast<size_t>(d - q));
+            for (size_t i = 0; i < n; i++, q++) {
+                a += *q;
+                b += a;
+            }
+            a %= 65521U;
+            b %= 65521U;
+        }
+    }
+    d = put32(d, (b << 16) | a);
+    p = closeChunk(idat, "IDAT", d - (idat + 8));
+
+    p = closeChunk(p, "IEND", 0);
+    return p - output;
+}
@@ -0,0 +1,67 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2EXPORT_H
+#define UCGD_MOD_GRAPHICS_U8G2EXPORT_H
+
+#include <cstdint>
+#include <cstddef>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//1bpp rows, most significant bit first, rows padded to a byte (1 = pixel set)
+#define EXPORT_FORMAT_RAW 0
+//Binary portable bitmap (P4, 1 = pixel set = black)
+#define EXPORT_FORMAT_PBM 1
+//XBM source text (rows padded to a byte, least significant bit first)
+#define EXPORT_FORMAT_XBM 2
+//1-bit grayscale PNG with uncompressed (stored) deflate blocks (pixel set = black, same as PBM)
+#define EXPORT_FORMAT_PNG 3
+
+/**
+ * Encodes the contents of the u8g2 buffer into a caller supplied memory region. The image has the size of the buffer
+ * (tile width * 8 by tile height * 8) and is not rotated, same as the u8g2_WriteBuffer* functions.
+ */
+class U8g2Export {
+public:
+    /**
+     * @return The number of bytes written by encode() for the current buffer, or 0 if the format is invalid
+     */
+    static auto getSize(u8g2_t *u8g2, int format) -> size_t;
+
+    /**
+     * Encode the buffer into output
+     *
+     * @return The number of bytes written, or 0 if the format is invalid or the output is smaller than getSize()
+     */
+    static auto encode(u8g2_t *u8g2, int format, uint8_t *output, size_t capacity) -> size_t;
+
+private:
+    static auto writeRow(u8g2_t *u8g2, int row, uint8_t *output, bool lsbFirst) -> void;
+
+    static auto encodeXbm(u8g2_t *u8g2, uint8_t *output) -> size_t;
+
+    static auto encodePng(u8g2_t *u8g2, uint8_t *output) -> size_t;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2EXPORT_H
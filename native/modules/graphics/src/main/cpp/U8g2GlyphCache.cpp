@@ -0,0 +1,453 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include "U8g2GlyphCache.h"
+
+namespace {
+    /**
+     * Reads the bit-packed glyph data (same encoding as the u8g2 font decoder)
+     */
+    struct glyph_reader_t {
+        const uint8_t *ptr;
+        uint8_t bit_pos;
+
+        uint8_t getUnsigned(uint8_t cnt) {
+            uint8_t val = *ptr;
+            val >>= bit_pos;
+            uint8_t end = bit_pos + cnt;
+            if (end >= 8) {
+                uint8_t s = 8 - bit_pos;
+                ptr++;
+                val |= static_cast<uint8_t>(*ptr << s);
+                end -= 8;
+            }
+            val &= (1U << cnt) - 1;
+            bit_pos = end;
+            return val;
+        }
+
+        int8_t getSigned(uint8_t cnt) {
+            auto v = static_cast<int8_t>(getUnsigned(cnt));
+            v = static_cast<int8_t>(v - (1 << (cnt - 1)));
+            return v;
+        }
+    };
+
+    /**
+     * Rotates the vector (a, b) according to the font direction
+     */
+    inline void rotateVector(uint8_t dir, int a, int b, int &x, int &y) {
+        switch (dir) {
+            case 0: x = a; y = b; break;
+            case 1: x = -b; y = a; break;
+            case 2: x = -a; y = -b; break;
+            default: x = b; y = -a; break;
+        }
+    }
+
+    inline int floorDiv8(int value) {
+        return (value >= 0) ? (value >> 3) : -((7 - value) >> 3);
+    }
+
+    inline void applyColor(uint8_t *dst, uint8_t mask, uint8_t color) {
+        if (mask == 0)
+            return;
+        switch (color) {
+            case 0: *dst &= static_cast<uint8_t>(~mask); break;
+            case 1: *dst |= mask; break;
+            default: *dst ^= mask; break;
+        }
+    }
+}
+
+U8g2GlyphCache::U8g2GlyphCache(size_t budget) : m_Budget(budget) {
+}
+
+U8g2GlyphCache::~U8g2GlyphCache() = default;
+
+auto U8g2GlyphCache::getLayout(u8g2_t *u8g2) -> int {
+    if (u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb)
+        return GLYPH_LAYOUT_VERTICAL;
+    if (u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb)
+        return GLYPH_LAYOUT_HORIZONTAL;
+    return GLYPH_LAYOUT_UNSUPPORTED;
+}
+
+auto U8g2GlyphCache::isSupported(u8g2_t *u8g2) -> bool {
+    //rotated displays are transformed by u8g2 per line, let u8g2 handle these (the canvas of U8g2Rotator is unrotated)
+    return u8g2->font != nullptr && u8g2->cb->draw_l90 == u8g2_draw_l90_r0 && u8g2->tile_buf_ptr != nullptr && getLayout(u8g2) != GLYPH_LAYOUT_UNSUPPORTED;
+}
+
+auto U8g2GlyphCache::lookup(u8g2_t *u8g2, uint16_t encoding) -> const ucgd_glyph_t & {
+    int layout = getLayout(u8g2);
+    glyph_key_t key{u8g2->font, encoding, u8g2->font_decode.dir, static_cast<uint8_t>(layout)};
+
+    auto it = m_Index.find(key);
+    if (it != m_Index.end()) {
+        m_Hits++;
+        //move to the front of the LRU list
+        if (it->second != m_Entries.begin())
+            m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+        return it->second->second;
+    }
+
+    m_Misses++;
+    m_Entries.emplace_front(key, ucgd_glyph_t());
+    ucgd_glyph_t &glyph = m_Entries.front().second;
+    decode(u8g2, encoding, layout, glyph);
+    m_Index[key] = m_Entries.begin();
+    m_Size += glyph.footprint();
+    evict();
+    return glyph;
+}
+
+auto U8g2GlyphCache::drawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding) -> u8g2_uint_t {
+    if (m_Budget == 0 || !isSupported(u8g2))
+        return u8g2_DrawGlyph(u8g2, x, y, encoding);
+
+    //adjust the reference position (see u8g2_DrawGlyph)
+    auto vref = static_cast<int16_t>(u8g2->font_calc_vref(u8g2));
+    int px = static_cast<int16_t>(x);
+    int py = static_cast<int16_t>(y);
+    switch (u8g2->font_decode.dir) {
+        case 0: py += vref; break;
+        case 1: px -= vref; break;
+        case 2: py -= vref; break;
+        default: px += vref; break;
+    }
+
+    const ucgd_glyph_t &glyph = lookup(u8g2, encoding);
+    if (!glyph.present)
+        return 0;
+    if (!glyph.data.empty())
+        render(u8g2, glyph, getLayout(u8g2), px, py);
+    return static_cast<u8g2_uint_t>(glyph.delta);
+}
+
+auto U8g2GlyphCache::drawString(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str, bool utf8) -> u8g2_uint_t {
+    if (m_Budget == 0 || !isSupported(u8g2))
+        return utf8 ? u8g2_DrawUTF8(u8g2, x, y, str) : u8g2_DrawStr(u8g2, x, y, str);
+
+    u8g2_uint_t sum = 0;
+    uint16_t encoding = 0;
+    uint8_t remaining = 0;
+    for (auto *s = reinterpret_cast<const uint8_t *>(str); *s != 0 && *s != '\n'; s++) {
+        uint8_t b = *s;
+        if (utf8) {
+            //same decoding rules as u8x8_utf8_next()
+            if (remaining == 0) {
+                if (b >= 0xfc) { remaining = 5; b &= 1; }
+                else if (b >= 0xf8) { remaining = 4; b &= 3; }
+                else if (b >= 0xf0) { remaining = 3; b &= 7; }
+                else if (b >= 0xe0) { remaining = 2; b &= 15; }
+                else if (b >= 0xc0) { remaining = 1; b &= 0x1f; }
+                encoding = b;
+                if (remaining != 0)
+                    continue;
+            } else {
+                remaining--;
+                encoding <<= 6;
+                encoding |= (b & 0x3f);
+                if (remaining != 0)
+                    continue;
+            }
+        } else {
+            encoding = b;
+        }
+
+        u8g2_uint_t delta = drawGlyph(u8g2, x, y, encoding);
+        switch (u8g2->font_decode.dir) {
+            case 0: x += delta; break;
+            case 1: y += delta; break;
+            case 2: x -= delta; break;
+            default: y -= delta; break;
+        }
+        sum += delta;
+    }
+    return sum;
+}
+
+auto U8g2GlyphCache::drawGlyphs(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const uint16_t *encodings, size_t count) -> u8g2_uint_t {
+    u8g2_uint_t sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t encoding = encodings[i];
+        //0xfffe and 0xffff are reserved by the u8g2 string decoders
+        if (encoding >= 0xfffe)
+            continue;
+        u8g2_uint_t delta = drawGlyph(u8g2, x, y, encoding);
+        switch (u8g2->font_decode.dir) {
+            case 0: x += delta; break;
+            case 1: y += delta; break;
+            case 2: x -= delta; break;
+            default: y -= delta; break;
+        }
+        sum += delta;
+    }
+    return sum;
+}
+
+auto U8g2GlyphCache::getMetrics(u8g2_t *u8g2, uint16_t encoding, int &width, int &x, int &delta) -> bool {
+    if (m_Budget > 0) {
+        const ucgd_glyph_t &glyph = lookup(u8g2, encoding);
+        if (!glyph.present)
+            return false;
+        width = static_cast<uint8_t>(glyph.glyph_width);
+        x = glyph.glyph_x;
+        delta = glyph.delta;
+        return true;
+    }
+    const uint8_t *data = u8g2_font_get_glyph_data(u8g2, encoding);
+    if (data == nullptr)
+        return false;
+    const u8g2_font_info_t &info = u8g2->font_info;
+    glyph_reader_t reader{data, 0};
+    width = reader.getUnsigned(info.bits_per_char_width);
+    reader.getUnsigned(info.bits_per_char_height);
+    x = reader.getSigned(info.bits_per_char_x);
+    reader.getSigned(info.bits_per_char_y);
+    delta = reader.getSigned(info.bits_per_delta_x);
+    return true;
+}
+
+auto U8g2GlyphCache::decode(u8g2_t *u8g2, uint16_t encoding, int layout, ucgd_glyph_t &glyph) -> void {
+    const uint8_t *data = u8g2_font_get_glyph_data(u8g2, encoding);
+    if (data == nullptr) {
+        glyph.present = false;
+        return;
+    }
+    glyph.present = true;
+
+    const u8g2_font_info_t &info = u8g2->font_info;
+    glyph_reader_t reader{data, 0};
+    glyph.glyph_width = static_cast<int8_t>(reader.getUnsigned(info.bits_per_char_width));
+    glyph.glyph_height = static_cast<int8_t>(reader.getUnsigned(info.bits_per_char_height));
+    glyph.glyph_x = reader.getSigned(info.bits_per_char_x);
+    glyph.glyph_y = reader.getSigned(info.bits_per_char_y);
+    glyph.delta = reader.getSigned(info.bits_per_delta_x);
+
+    int w = static_cast<uint8_t>(glyph.glyph_width);
+    int h = static_cast<uint8_t>(glyph.glyph_height);
+    if (w == 0 || h == 0)
+        return;
+
+    //decode the run-length encoded pixels (see u8g2_font_decode_glyph)
+    std::vector<uint8_t> pixels(w * h, 0);
+    int lx = 0, ly = 0;
+    auto run = [&](unsigned len, bool foreground) {
+        unsigned cnt = len;
+        for (;;) {
+            unsigned rem = w - lx;
+            unsigned current = std::min(rem, cnt);
+            if (foreground && ly < h)
+                std::fill_n(pixels.begin() + (ly * w + lx), current, 1);
+            if (cnt < rem)
+                break;
+            cnt -= rem;
+            lx = 0;
+            ly++;
+        }
+        lx += static_cast<int>(cnt);
+    };
+    for (;;) {
+        uint8_t a = reader.getUnsigned(info.bits_per_0);
+        uint8_t b = reader.getUnsigned(info.bits_per_1);
+        do {
+            run(a, false);
+            run(b, true);
+        } while (reader.getUnsigned(1) != 0);
+        if (ly >= h)
+            break;
+    }
+
+    //orient the mask for the font direction
+    uint8_t dir = u8g2->font_decode.dir;
+    int tx, ty;
+    rotateVector(dir, glyph.glyph_x, -(h + glyph.glyph_y), tx, ty);
+    int x0, y0, x1, y1;
+    rotateVector(dir, 0, 0, x0, y0);
+    rotateVector(dir, w - 1, h - 1, x1, y1);
+    glyph.mask_x = static_cast<int16_t>(tx + std::min(x0, x1));
+    glyph.mask_y = static_cast<int16_t>(ty + std::min(y0, y1));
+    glyph.mask_width = static_cast<uint16_t>((dir & 1) ? h : w);
+    glyph.mask_height = static_cast<uint16_t>((dir & 1) ? w : h);
+
+    int mw = glyph.mask_width;
+    int mh = glyph.mask_height;
+    if (layout == GLYPH_LAYOUT_VERTICAL) {
+        glyph.data.assign(((mh + 7) / 8) * mw, 0);
+    } else {
+        glyph.data.assign(((mw + 7) / 8) * mh, 0);
+    }
+    glyph.data.shrink_to_fit();
+
+    for (int row = 0; row < h; row++) {
+        for (int col = 0; col < w; col++) {
+            if (!pixels[row * w + col])
+                continue;
+            int vx, vy;
+            rotateVector(dir, col, row, vx, vy);
+            int sx = tx + vx - glyph.mask_x;
+            int sy = ty + vy - glyph.mask_y;
+            if (layout == GLYPH_LAYOUT_VERTICAL) {
+                glyph.data[(sy >> 3) * mw + sx] |= static_cast<uint8_t>(1U << (sy & 7));
+            } else {
+                glyph.data[sy * ((mw + 7) / 8) + (sx >> 3)] |= static_cast<uint8_t>(0x80U >> (sx & 7));
+            }
+        }
+    }
+}
+
+auto U8g2GlyphCache::render(u8g2_t *u8g2, const ucgd_glyph_t &glyph, int layout, int x, int y) -> void {
+    if (u8g2->is_page_clip_window_intersection == 0)
+        return;
+
+    uint8_t *buffer = u8g2->tile_buf_ptr;
+    int tileWidth = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+    int bufHeight = u8g2->tile_buf_height * 8;
+    int currRow = u8g2->pixel_curr_row;
+
+    //visible window in buffer coordinates
+    int cx0 = std::max<int>(0, u8g2->user_x0);
+    int cx1 = std::min<int>(tileWidth * 8, u8g2->user_x1);
+    int cy0 = std::max<int>(0, u8g2->user_y0 - currRow);
+    int cy1 = std::min<int>(bufHeight, u8g2->user_y1 - currRow);
+
+    int gx = x + glyph.mask_x;
+    int gy = y + glyph.mask_y - currRow;
+    int mw = glyph.mask_width;
+    int mh = glyph.mask_height;
+    if (gx >= cx1 || gy >= cy1 || gx + mw <= cx0 || gy + mh <= cy0)
+        return;
+
+    uint8_t fgColor = u8g2->draw_color;
+    uint8_t bgColor = fgColor == 0 ? 1 : 0;
+    bool solid = u8g2->font_decode.is_transparent == 0;
+
+    if (layout == GLYPH_LAYOUT_VERTICAL) {
+        int stride = tileWidth * 8;
+        int pages = u8g2->tile_buf_height;
+        int c0 = std::max(0, cx0 - gx);
+        int c1 = std::min(mw, cx1 - gx);
+        for (int band = 0; band * 8 < mh; band++) {
+            int top = gy + band * 8;
+            uint8_t rowMask = 0;
+            for (int j = 0; j < 8; j++) {
+                if (band * 8 + j < mh && top + j >= cy0 && top + j < cy1)
+                    rowMask |= static_cast<uint8_t>(1U << j);
+            }
+            if (rowMask == 0)
+                continue;
+            int page = floorDiv8(top);
+            int shift = top - page * 8;
+            bool lower = page >= 0 && page < pages;
+            bool upper = shift != 0 && page + 1 >= 0 && page + 1 < pages;
+            const uint8_t *src = glyph.data.data() + band * mw;
+            for (int c = c0; c < c1; c++) {
+                uint8_t fg = src[c] & rowMask;
+                uint8_t bg = solid ? static_cast<uint8_t>(~src[c] & rowMask) : 0;
+                uint8_t *dst = buffer + page * stride + gx + c;
+                if (lower) {
+                    applyColor(dst, static_cast<uint8_t>(bg << shift), bgColor);
+                    applyColor(dst, static_cast<uint8_t>(fg << shift), fgColor);
+                }
+                if (upper) {
+                    applyColor(dst + stride, static_cast<uint8_t>(bg >> (8 - shift)), bgColor);
+                    applyColor(dst + stride, static_cast<uint8_t>(fg >> (8 - shift)), fgColor);
+                }
+            }
+        }
+    } else {
+        int maskStride = (mw + 7) / 8;
+        int r0 = std::max(0, cy0 - gy);
+        int r1 = std::min(mh, cy1 - gy);
+        for (int k = 0; k < maskStride; k++) {
+            int left = gx + k * 8;
+            uint8_t colMask = 0;
+            for (int i = 0; i < 8; i++) {
+                if (k * 8 + i < mw && left + i >= cx0 && left + i < cx1)
+                    colMask |= static_cast<uint8_t>(0x80U >> i);
+            }
+            if (colMask == 0)
+                continue;
+            int col = floorDiv8(left);
+            int shift = left - col * 8;
+            bool first = col >= 0 && col < tileWidth;
+            bool second = shift != 0 && col + 1 >= 0 && col + 1 < tileWidth;
+            for (int r = r0; r < r1; r++) {
+                uint8_t bits = glyph.data[r * maskStride + k];
+                uint8_t fg = bits & colMask;
+                uint8_t bg = solid ? static_cast<uint8_t>(~bits & colMask) : 0;
+                uint8_t *dst = buffer + (gy + r) * tileWidth + col;
+                if (first) {
+                    applyColor(dst, static_cast<uint8_t>(bg >> shift), bgColor);
+                    applyColor(dst, static_cast<uint8_t>(fg >> shift), fgColor);
+                }
+                if (second) {
+                    applyColor(dst + 1, static_cast<uint8_t>(bg << (8 - shift)), bgColor);
+                    applyColor(dst + 1, static_cast<uint8_t>(fg << (8 - shift)), fgColor);
+                }
+            }
+        }
+    }
+}
+
+auto U8g2GlyphCache::evict() -> void {
+    //always keep the most recently used entry
+    while (m_Size > m_Budget && m_Entries.size() > 1) {
+        glyph_entry_t &last = m_Entries.back();
+        m_Size -= last.second.footprint();
+        m_Index.erase(last.first);
+        m_Entries.pop_back();
+    }
+}
+
+auto U8g2GlyphCache::clear() -> void {
+    m_Index.clear();
+    m_Entries.clear();
+    m_Size = 0;
+}
+
+auto U8g2GlyphCache::setBudget(size_t budget) -> void {
+    m_Budget = budget;
+    if (m_Budget == 0) {
+        clear();
+    } else {
+        evict();
+    }
+}
+
+auto U8g2GlyphCache::getBudget() const -> size_t {
+    return m_Budget;
+}
+
+auto U8g2GlyphCache::getSize() const -> size_t {
+    return m_Size;
+}
+
+auto U8g2GlyphCache::getHits() const -> uint64_t {
+    return m_Hits;
+}
+
+auto U8g2GlyphCache::getMisses() const -> uint64_t {
+    return m_Misses;
+}
@@ -0,0 +1,162 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2GLYPHCACHE_H
+#define UCGD_MOD_GRAPHICS_U8G2GLYPHCACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <vector>
+#include <unordered_map>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+#define GLYPH_CACHE_DEFAULT_BUDGET (64 * 1024)
+
+#define GLYPH_LAYOUT_UNSUPPORTED 0
+#define GLYPH_LAYOUT_VERTICAL 1
+#define GLYPH_LAYOUT_HORIZONTAL 2
+
+/**
+ * A pre-decoded glyph. The mask is stored in the tile layout of the target buffer and is already oriented for the font direction.
+ */
+struct ucgd_glyph_t {
+    //true if the glyph exists in the font
+    bool present{};
+    //raw glyph metrics (as stored in the font)
+    int8_t glyph_width{};
+    int8_t glyph_height{};
+    int8_t glyph_x{};
+    int8_t glyph_y{};
+    int8_t delta{};
+    //position of the mask relative to the reference point of the glyph
+    int16_t mask_x{};
+    int16_t mask_y{};
+    //size of the mask in screen orientation
+    uint16_t mask_width{};
+    uint16_t mask_height{};
+    //vertical layout: [band][column] (lsb on top), horizontal layout: [row][byte] (msb on the left)
+    std::vector<uint8_t> data;
+
+    [[nodiscard]] size_t footprint() const {
+        return sizeof(ucgd_glyph_t) + data.capacity();
+    }
+};
+
+/**
+ * Per-display cache of decoded glyph masks, keyed by font, encoding and font direction.
+ * Entries are evicted in least-recently-used order once the memory budget is exceeded.
+ */
+class U8g2GlyphCache {
+public:
+    explicit U8g2GlyphCache(size_t budget = GLYPH_CACHE_DEFAULT_BUDGET);
+
+    virtual ~U8g2GlyphCache();
+
+    /**
+     * @return The tile layout of the u8g2 buffer or GLYPH_LAYOUT_UNSUPPORTED if the cache can not render directly to it
+     */
+    static auto getLayout(u8g2_t *u8g2) -> int;
+
+    /**
+     * @return true if the glyphs can be rendered directly into the buffer with the current u8g2 state
+     */
+    static auto isSupported(u8g2_t *u8g2) -> bool;
+
+    /**
+     * Retrieve the decoded glyph for the currently assigned font and direction (decoded on a cache miss)
+     */
+    auto lookup(u8g2_t *u8g2, uint16_t encoding) -> const ucgd_glyph_t &;
+
+    /**
+     * Equivalent of u8g2_DrawGlyph(). Falls back to u8g2 if direct rendering is not supported.
+     */
+    auto drawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding) -> u8g2_uint_t;
+
+    /**
+     * Equivalent of u8g2_DrawStr() (utf8 = false) or u8g2_DrawUTF8() (utf8 = true)
+     */
+    auto drawString(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str, bool utf8) -> u8g2_uint_t;
+
+    /**
+     * Draw a sequence of glyph encodings (e.g. UTF-16 code units). Returns the total advance of the drawn glyphs.
+     */
+    auto drawGlyphs(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const uint16_t *encodings, size_t count) -> u8g2_uint_t;
+
+    /**
+     * Retrieve the metrics of a glyph without rendering it. Only the glyph header is decoded if the cache is disabled.
+     *
+     * @return false if the glyph does not exist in the current font
+     */
+    auto getMetrics(u8g2_t *u8g2, uint16_t encoding, int &width, int &x, int &delta) -> bool;
+
+    auto clear() -> void;
+
+    auto setBudget(size_t budget) -> void;
+
+    [[nodiscard]] auto getBudget() const -> size_t;
+
+    [[nodiscard]] auto getSize() const -> size_t;
+
+    [[nodiscard]] auto getHits() const -> uint64_t;
+
+    [[nodiscard]] auto getMisses() const -> uint64_t;
+
+private:
+    struct glyph_key_t {
+        const uint8_t *font;
+        uint16_t encoding;
+        uint8_t dir;
+        uint8_t layout;
+
+        bool operator==(const glyph_key_t &other) const {
+            return font == other.font && encoding == other.encoding && dir == other.dir && layout == other.layout;
+        }
+    };
+
+    struct glyph_key_hash_t {
+        size_t operator()(const glyph_key_t &key) const {
+            auto h = reinterpret_cast<uintptr_t>(key.font);
+            h ^= (static_cast<uintptr_t>(key.encoding) << 4) ^ (static_cast<uintptr_t>(key.dir) << 2) ^ key.layout;
+            return std::hash<uintptr_t>()(h);
+        }
+    };
+
+    typedef std::pair<glyph_key_t, ucgd_glyph_t> glyph_entry_t;
+
+    auto decode(u8g2_t *u8g2, uint16_t encoding, int layout, ucgd_glyph_t &glyph) -> void;
+
+    auto render(u8g2_t *u8g2, const ucgd_glyph_t &glyph, int layout, int x, int y) -> void;
+
+    auto evict() -> void;
+
+    size_t m_Budget;
+    size_t m_Size = 0;
+    uint64_t m_Hits = 0;
+    uint64_t m_Misses = 0;
+    std::list<glyph_entry_t> m_Entries;
+    std::unordered_map<glyph_key_t, std::list<glyph_entry_t>::iterator, glyph_key_hash_t> m_Index;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2GLYPHCACHE_H
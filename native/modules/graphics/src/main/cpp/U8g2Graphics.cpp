@@ -21,25 +21,40 @@
  */
 #include <map>
 #include <sstream>
+#include <fstream>
 #include <iostream>
 #include <cstring>
 #include <iomanip>
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 #include <UcgdConfig.h>
 #include <Global.h>
 #include <Common.h>
+#include <PlatformProbe.h>
 
 #include <U8g2Graphics.h>
 #include <U8g2Hal.h>
 #include <U8g2Utils.h>
+#include <U8g2Blit.h>
+#include <U8g2Export.h>
+#include <U8g2Recorder.h>
+#include <U8g2DisplayList.h>
+#include <U8g2Scroll.h>
+#include <U8g2Rotator.h>
+#include <U8g2Layers.h>
+#include <U8g2Canvas.h>
+#include <UcgdFrameScheduler.h>
+#include <UcgdTrace.h>
 #include <ServiceLocator.h>
 #include <DeviceManager.h>
 #include <exception>
+#include <ProviderManager.h>
+#include <UcgdSimProvider.h>
 
 #if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
 
-#include <ProviderManager.h>
 #include <UcgdCperipheryProvider.h>
 #include <UcgdPigpioProvider.h>
 #include <UcgdPigpiodProvider.h>
@@ -51,7 +66,13 @@
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 
-std::stringstream outputBuffer;
+//Trace markers of the JNI entry points, the events are named after the java method
+#define JNI_TRACE_PREFIX "Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_"
+#define JNI_TRACE() UCGD_TRACE_SCOPE("jni", __func__ + sizeof(JNI_TRACE_PREFIX) - 1)
+#define JNI_TRACE_ID(id) UCGD_TRACE_SCOPE_ARG("jni", __func__ + sizeof(JNI_TRACE_PREFIX) - 1, "id", id)
+
+//u8g2_WriteBuffer* callbacks do not take a user pointer, keep one buffer per thread
+thread_local std::stringstream outputBuffer;
 
 void clearOutputBuffer() {
     outputBuffer.str(std::string());
@@ -122,83 +143,122 @@ bool checkValidity(JNIEnv *env, jlong id) {
     return true;
 }
 
-void updateKeyValueStore(JNIEnv *env, const std::string &key, jobject &value, option_map_t &map) {
-    jclass clsString = env->FindClass(CLS_STRING);
-    jclass clsObj = env->GetObjectClass(value);
-    jclass clsInteger = env->FindClass(CLS_INTEGER);
-    jclass clsBoolean = env->FindClass(CLS_BOOLEAN);
-    jclass clsNativeUtils = env->FindClass(CLS_NativeUtils);
-    jmethodID midToInteger = env->GetStaticMethodID(clsNativeUtils, "toInteger", "(Ljava/lang/Object;)I");
-    jmethodID midToString = env->GetMethodID(clsString, "toString", "()Ljava/lang/String;");
-    jmethodID midToBoolean = env->GetMethodID(clsBoolean, "booleanValue", "()Z");
-
-    if (clsObj == nullptr) {
-        map.insert(std::make_pair(key, nullptr));
-    }
-    else if (env->IsInstanceOf(value, clsString)) {
-        auto strValue = (jstring) env->CallObjectMethod(value, midToString);
-        map.insert(std::make_pair(key, std::string(env->GetStringUTFChars(strValue, 0))));
-    }
-    else if (env->IsInstanceOf(value, clsInteger)) {
-        jint intValue = env->CallStaticIntMethod(clsNativeUtils, midToInteger, value);
-        map.insert(std::make_pair(key, intValue));
-    }
-    else if (env->IsInstanceOf(value, clsBoolean)) {
-        bool boolValue = (bool) env->CallBooleanMethod(value, midToBoolean);
-        map.insert(std::make_pair(key, boolValue));
-    }
-    else {
-        throw std::runtime_error(std::string("Unsupported value type for key: \"") + key + std::string("\""));
-    }
+std::shared_ptr<ucgd_t> &getContext(jlong id) {
+    return ServiceLocator::getInstance().getDeviceManager()->getDevice(static_cast<uintptr_t>(id));
 }
 
-void processOptions(JNIEnv *env, jobject options, option_map_t &map, std::unique_ptr<Log> &log) {
-    jclass clsMap = env->GetObjectClass(options);
-    jmethodID midEntrySet = env->GetMethodID(clsMap, "entrySet", "()Ljava/util/Set;");
-
-    jclass clsEntrySet = env->FindClass(CLS_SET);
-    jmethodID midIterator = env->GetMethodID(clsEntrySet, "iterator", "()Ljava/util/Iterator;");
-
-    jclass clsIterator = env->FindClass(CLS_ITERATOR);
-    jmethodID midHasNext = env->GetMethodID(clsIterator, "hasNext", "()Z");
-    jmethodID midNext = env->GetMethodID(clsIterator, "next", "()Ljava/lang/Object;");
-
-    jclass clsEntry = env->FindClass(CLS_MAP_ENTRY);
-    jmethodID midGetKey = env->GetMethodID(clsEntry, "getKey", "()Ljava/lang/Object;");
-    jmethodID midGetValue = env->GetMethodID(clsEntry, "getValue", "()Ljava/lang/Object;");
-
-    jclass clsString = env->FindClass(CLS_STRING);
-    jmethodID midToString = env->GetMethodID(clsString, "toString", "()Ljava/lang/String;");
+/**
+ * @return The display list of the device if it is being recorded (draw calls are appended to it instead of being rendered), otherwise null
+ */
+U8g2DisplayList *getRecordingList(jlong id) {
+    if (!U8g2DisplayList::isAnyRecording())
+        return nullptr;
+    U8g2DisplayList *list = getContext(id)->display_list.get();
+    return (list != nullptr && list->isRecording()) ? list : nullptr;
+}
 
-    jobject objEntrySet = env->CallObjectMethod(options, midEntrySet);
-    jobject objIterator = env->CallObjectMethod(objEntrySet, midIterator);
+void checkNotRecording(jlong id, const std::string &function) {
+    if (getRecordingList(id) != nullptr)
+        throw std::runtime_error(function + " : Not supported while a display list is being recorded");
+}
 
-    bool hasNext = (bool) env->CallBooleanMethod(objIterator, midHasNext);
+/**
+ * @return The rotator of the device if the display is drawn into its unrotated canvas (rotate_at_send), otherwise null
+ */
+U8g2Rotator *getActiveRotator(jlong id) {
+    U8g2Rotator *rotator = getContext(id)->rotator.get();
+    return (rotator != nullptr && rotator->isActive()) ? rotator : nullptr;
+}
 
-    log->debug("processOptions() : Extracting all available options from the map");
+/**
+ * @return The layers of the device if at least one layer has been created, otherwise null
+ */
+U8g2Layers *getActiveLayers(jlong id) {
+    U8g2Layers *layers = getContext(id)->layers.get();
+    return (layers != nullptr && layers->getCount() > 0) ? layers : nullptr;
+}
 
-    int ctr = 1;
-    while (hasNext) {
-        jobject objEntry = env->CallObjectMethod(objIterator, midNext);
+void checkNotDrawingLayer(jlong id, const std::string &function) {
+    U8g2Layers *layers = getContext(id)->layers.get();
+    if (layers != nullptr && layers->isDrawing())
+        throw std::runtime_error(function + " : Not supported while a layer is being drawn (call endLayer() first)");
+}
 
-        //Get key and value
-        jobject objKey = env->CallObjectMethod(objEntry, midGetKey);
-        jobject objValue = env->CallObjectMethod(objEntry, midGetValue);
+//The display no longer shows the last composited frame, the next frame is completely dirty
+void invalidateLayers(jlong id) {
+    if (U8g2Layers *layers = getContext(id)->layers.get())
+        layers->invalidate();
+}
 
-        //convert key and value to strings
-        auto jstrKey = (jstring) env->CallObjectMethod(objKey, midToString);
-        auto jstrValue = (jstring) env->CallObjectMethod(objValue, midToString);
+/**
+ * Composite the layers of the device into the buffer
+ *
+ * @return The layers of the device or null if it has none
+ */
+U8g2Layers *compositeLayers(jlong id) {
+    U8g2Layers *layers = getActiveLayers(id);
+    if (layers != nullptr) {
+        UCGD_TRACE_SCOPE_ARG("pipeline", "composite", "id", id);
+        layers->composite(toU8g2(id));
+    }
+    return layers;
+}
 
-        const char *strKey = env->GetStringUTFChars(jstrKey, 0);
-        const char *strValue = env->GetStringUTFChars(jstrValue, 0);
+/**
+ * Send a full buffer frame: composite the layers, rotate the canvas (rotate_at_send) and send the complete buffer or
+ * only the tiles that changed since the previous frame (partial_update)
+ */
+void sendFrame(jlong id) {
+    const std::shared_ptr<ucgd_t> &context = getContext(id);
+    u8g2_t *u8g2 = context->u8g2.get();
+    U8g2Rotator *rotator = getActiveRotator(id);
+    U8g2Layers *layers = compositeLayers(id);
+    UCGD_TRACE_SCOPE_ARG("pipeline", "u8g2_SendBuffer", "id", id);
+    if (layers != nullptr && context->flag_partial_update) {
+        const ucgd_tile_area_t &dirty = layers->getDirtyArea();
+        if (dirty.width == 0 || dirty.height == 0)
+            return;
+        if (rotator != nullptr)
+            rotator->updateDisplayArea(u8g2, dirty.x, dirty.y, dirty.width, dirty.height);
+        else
+            u8g2_UpdateDisplayArea(u8g2, dirty.x, dirty.y, dirty.width, dirty.height);
+        u8x8_RefreshDisplay(u8g2_GetU8x8(u8g2));
+    } else if (rotator != nullptr) {
+        rotator->sendBuffer(u8g2);
+    } else {
+        u8g2_SendBuffer(u8g2);
+    }
+}
 
-        log->debug("processOptions() : {}) Key = {}, Value = {}", ctr++, std::string(strKey), std::string(strValue));
+/**
+ * Throw the transport error recorded by the u8x8 callbacks while u8g2 was sending, once at the end of the jni call
+ */
+void checkTransport(jlong id) {
+    U8g2Util_RaiseTransportError(getContext(id));
+}
 
-        updateKeyValueStore(env, std::string(strKey), objValue, map);
-        hasNext = (bool) env->CallBooleanMethod(objIterator, midHasNext);
+/**
+ * Close the counters of a sent frame and feed its send time to the frame scheduler (adaptive pacing)
+ */
+void endFrame(const std::shared_ptr<ucgd_t> &context, const ucgd_stats_mark_t &mark) {
+    uint64_t elapsed = context->stats.endFrame(mark);
+    std::shared_ptr<UcgdFrameScheduler> scheduler = std::atomic_load(&context->scheduler);
+    if (scheduler) {
+        scheduler->frameSent(elapsed);
+        context->stats.setFrameInterval(scheduler->getInterval());
     }
+}
 
-    log->debug("processOptions() : Processed a total of {} option entries", map.size());
+/**
+ * Copy the options encoded by NativeUtils.encodeOptions out of the java array in one call and decode them
+ */
+ucgd_settings_t decodeOptions(JNIEnv *env, jbyteArray options, std::unique_ptr<Log> &log) {
+    jsize length = env->GetArrayLength(options);
+    std::vector<uint8_t> data(static_cast<size_t>(length));
+    env->GetByteArrayRegion(options, 0, length, reinterpret_cast<jbyte *>(data.data()));
+    ucgd_settings_t settings = UcgdSettings_Decode(data.data(), data.size());
+    log->debug("decodeOptions() : Decoded {} option(s) from {} bytes", static_cast<int>(__builtin_popcountll(settings.provided)), static_cast<int>(length));
+    return settings;
 }
 
 uint8_t alphaBlend(uint8_t src, uint8_t dst) {
@@ -210,7 +270,7 @@ uint8_t alphaBlend(uint8_t src, uint8_t dst) {
     return (src * (src / 255)) + (dst * (1 - (src / 255)));
 }
 
-void copyToBgraBufferHorizontal(int width, const std::shared_ptr<ucgd_t> &context) {
+void copyToBgraBufferHorizontal(int width, long offset, long size, const std::shared_ptr<ucgd_t> &context) {
     Log &log = ServiceLocator::getInstance().getLogger();
     uint8_t *u8g2Buffer = context->buffer;
     uint8_t *bgraBuffer = context->bufferBgra;
@@ -228,11 +288,13 @@ void copyToBgraBufferHorizontal(int width, const std::shared_ptr<ucgd_t> &contex
     unsigned int sRed = ((secondary >> 8) & 0xff);
     unsigned int sAlpha = (secondary & 0xff);
 
-    int bpos = 0;
-    for (int i = 0; i < context->bufferSize; i++) {
+    long bpos = offset;
+    for (int i = 0; i < size; i++) {
         uint8_t data = *(u8g2Buffer + i);
         //read from msb to lsb
         for (int pos = 7; pos >= 0; pos--) {
+            if (bpos + 3 >= context->bufferBgraSize)
+                return;
             if (data & (1 << pos)) {
                 //primary color (Set bit)
                 bgraBuffer[bpos] = alphaBlend(pBlue, bgraBuffer[bpos]);   //blue
@@ -252,7 +314,7 @@ void copyToBgraBufferHorizontal(int width, const std::shared_ptr<ucgd_t> &contex
     }
 }
 
-void copyToBgraBufferVertical(int width, const std::shared_ptr<ucgd_t> &context) {
+void copyToBgraBufferVertical(int width, long offset, long size, const std::shared_ptr<ucgd_t> &context) {
     const std::unique_ptr<DeviceManager> &devMgr = ServiceLocator::getInstance().getDeviceManager();
     Log &log = ServiceLocator::getInstance().getLogger();
 
@@ -274,14 +336,15 @@ void copyToBgraBufferVertical(int width, const std::shared_ptr<ucgd_t> &context)
     unsigned int sRed = ((secondary >> 8) & 0xff);
     unsigned int sAlpha = (secondary & 0xff);
 
-    int bitpos = 0, x = 0, y = 0, page = 0, pos = 0, mark = 0, bpos = 0;
+    int bitpos = 0, x = 0, y = 0, page = 0, pos = 0, mark = 0;
+    long bpos = offset;
     //note: 1 page = width (bytes), e.g. for a 128x64 display, we have 128 bytes per page.
     //total number of pages can be calulated by dividing the display height with 8. (ex: 128x64 display have 8 pages in total)
     while (true) {
         if (x > (width - 1)) {
             //are we at the last bit?
             if (bitpos++ >= 7) {
-                if (pos >= context->bufferSize)
+                if (pos >= size)
                     break;
                 page++;
                 bitpos = 0;
@@ -294,6 +357,8 @@ void copyToBgraBufferVertical(int width, const std::shared_ptr<ucgd_t> &context)
             x = 0;
         }
 
+        if (bpos + 3 >= context->bufferBgraSize)
+            break;
         uint8_t data = u8g2Buffer[pos++];
         y = (page * 8) + bitpos;
         unsigned int bit = (data & (1 << bitpos)) != 0 ? 1 : 0;
@@ -340,15 +405,42 @@ void updateBgraBuffer(jlong id) {
     if (u8g2Buffer == nullptr || bgraBuffer == nullptr || context->bufferSize <= 0 || context->bufferBgraSize <= 0)
         return;
 
-    int width = context->u8g2->pixel_buf_width;
-    int height = context->u8g2->pixel_buf_height;
+    u8g2_t *u8g2 = context->u8g2.get();
+    int width = u8g2->pixel_buf_width;
+    int height = u8g2->pixel_buf_height;
 
+    //page buffer setup procedures (_1/_2) only hold the rows of the current page, the bgra buffer covers the whole display
+    long offset = static_cast<long>(u8g2->tile_curr_row) * 8 * width * 4;
+    long size = std::min(context->bufferSize, static_cast<long>(u8g2_GetBufferTileWidth(u8g2)) * u8g2->tile_buf_height * 8);
+
+    UCGD_TRACE_SCOPE_ARG("pipeline", "bgra", "id", id);
+    uint64_t start = U8g2Stats::now();
     //u8g2_ll_hvline_vertical_top_lsb
     //u8g2_ll_hvline_horizontal_right_lsb
-    if (context->u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb)
-        copyToBgraBufferVertical(width, context);
+    if (u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb)
+        copyToBgraBufferVertical(width, offset, size, context);
     else
-        copyToBgraBufferHorizontal(width, context);
+        copyToBgraBufferHorizontal(width, offset, size, context);
+    context->stats.addBgraConversion(U8g2Stats::now() - start);
+}
+
+void publishPage(jlong id) {
+    const std::shared_ptr<ucgd_t> &context = getContext(id);
+    if (!context->publisher)
+        return;
+    u8g2_t *u8g2 = context->u8g2.get();
+    UCGD_TRACE_SCOPE_ARG("pipeline", "publish", "id", id);
+    //the canvas of a rotated display can have more tile rows than the display buffer
+    U8g2Rotator *rotator = getActiveRotator(id);
+    int tileRows = rotator != nullptr ? rotator->getTileHeight() : u8g2->tile_buf_height;
+    //the dirty area of the composited frame, mapped to the display buffer if it was drawn into the canvas
+    if (U8g2Layers *layers = getActiveLayers(id)) {
+        ucgd_tile_area_t dirty = layers->getDirtyArea();
+        if (rotator != nullptr && !rotator->mapArea(dirty.x, dirty.y, dirty.width, dirty.height))
+            dirty = {0, 0, 0, 0};
+        context->publisher->setDirtyArea(dirty.x, dirty.y, dirty.width, dirty.height);
+    }
+    context->publisher->writePage(u8g2->tile_curr_row, tileRows, context->buffer, context->flag_virtual ? context->bufferBgra : nullptr);
 }
 
 void clearBgraBuffer(jlong id) {
@@ -381,14 +473,24 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved) {
     //Initialize HAL
     U8g2Hal_Init();
 
+    //Probe and cache the platform capabilities
+    PlatformProbe::info();
+
+    //Initialize the input subsystem (the event thread starts with the first opened device)
+    InputDevManager_Load(env);
+
     return JNI_VERSION;
 }
 
 JNIEXPORT void JNI_OnUnload(JavaVM *vm, void *reserved) {
+    JNIEnv *env;
+    vm->GetEnv(reinterpret_cast<void **>(&env), JNI_VERSION);
+    InputDevManager_UnLoad(env);
     JNI_Unload(vm);
 }
 
-jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclass cls, jstring setupProc, jint commInt, jint commType, jint rotation, jintArray pin_config, jobject buffer, jobject bufferBgra, jobject options, jboolean virtualMode, jobject logger, jstring version) {
+jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclass cls, jstring setupProc, jint commInt, jint commType, jint rotation, jintArray pin_config, jobject buffer, jobject bufferBgra, jbyteArray options, jboolean virtualMode, jobject logger, jstring version) {
+    JNI_TRACE();
     jobject globalLogger;
     JNI_MakeGlobal(env, logger, globalLogger);
 
@@ -406,7 +508,7 @@ jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclas
 
     std::string sVersion;
     if (version != nullptr) {
-        sVersion = std::string(env->GetStringUTFChars(version, nullptr));
+        sVersion = JNI_GetString(env, version);
     }
 
     log->debug("=========================================================================================================");
@@ -422,9 +524,12 @@ jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclas
     log->debug("Native Library - Version {}", sVersion.c_str());
     log->debug("=========================================================================================================");
 
+    const platform_info_t &platform = PlatformProbe::info();
+    log->debug("setup() : Platform = {}, spidev bufsiz = {}, gpio chips = {}, i2c adapters = {}", platform.description.empty() ? platform.hardware : platform.description, static_cast<int>(platform.spidev_bufsiz), static_cast<int>(platform.gpio_chips.size()), static_cast<int>(platform.i2c_funcs.size()));
+
     std::string setup_proc_name;
     if (setupProc != nullptr) {
-        setup_proc_name = std::string(env->GetStringUTFChars(setupProc, nullptr));
+        setup_proc_name = JNI_GetString(env, setupProc);
     }
     else {
         JNI_ThrowNativeLibraryException(env, "Setup procedure name cannot be null");
@@ -462,9 +567,14 @@ jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclas
         return -1;
     }
 
-    //6. Iterate all available properties in options map and store it into a temporary std::map
-    option_map_t mapOptions;
-    processOptions(env, options, mapOptions, log);
+    //6. Decode the options into typed settings
+    ucgd_settings_t settings;
+    try {
+        settings = decodeOptions(env, options, log);
+    } catch (std::exception &e) {
+        JNI_ThrowNativeLibraryException(env, std::string("Invalid options: ") + e.what());
+        return -1;
+    }
 
     //4. Verify that the rotation number is within the allowed range
     if (rotation < 0 || rotation > 4) {
@@ -487,16 +597,19 @@ jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclas
         //Initialize Device Manager
         locator.setDeviceManager(std::make_unique<DeviceManager>());
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
-        if (mapOptions[OPT_EXTRA_DEBUG_INFO].has_value()) {
-            g_ShowExtraDebugInfo = std::any_cast<bool>(mapOptions[OPT_EXTRA_DEBUG_INFO]);
-        }
         //Initialize Providers
         locator.setProviderManager(std::make_unique<ProviderManager>());
         auto &pMan = locator.getProviderManager();
 
-        std::string pigAddr = mapOptions[OPT_PIGPIO_ADDR].has_value() ? std::any_cast<std::string>(mapOptions[OPT_PIGPIO_ADDR]) : "";
-        std::string pigPort = mapOptions[OPT_PIGPIO_PORT].has_value() ? std::any_cast<std::string>(mapOptions[OPT_PIGPIO_PORT]) : "";
+        //The simulated provider is available on all platforms
+        if (!pMan->isRegistered(PROVIDER_SIM))
+            pMan->registerProvider(std::make_shared<UcgdSimProvider>());
+
+#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
+        g_ShowExtraDebugInfo = settings.extra_debug_info;
+
+        std::string pigAddr = settings.pigpio_addr;
+        std::string pigPort = settings.has(OPTION_PIGPIO_PORT) ? std::to_string(settings.pigpio_port) : "";
 
         //Register supported providers
         if (!pMan->isRegistered(PROVIDER_CPERIPHERY))
@@ -514,7 +627,7 @@ jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclas
     try {
         locator.getLogger().debug("setup() : Converting direct buffer to native buffer");
         auto *pixelBuffer = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
-        std::shared_ptr<ucgd_t> &context = U8g2Util_SetupAndInitDisplay(setup_proc_name, commInt, commType, _rotation, *pinMap, mapOptions, pixelBuffer, virtualMode);
+        std::shared_ptr<ucgd_t> &context = U8g2Util_SetupAndInitDisplay(setup_proc_name, commInt, commType, _rotation, *pinMap, settings, pixelBuffer, virtualMode);
         context->buffer = pixelBuffer;
         context->bufferSize = env->GetDirectBufferCapacity(buffer);
         locator.getLogger().debug("setup() : Pixel buffer initialized with size {}", context->bufferSize);
@@ -533,9 +646,14 @@ jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(JNIEnv *env, jclas
 
 //long id, int x, int y, int width, int height
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawBox(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_BOX, x, y, width, height);
+            return;
+        }
         u8g2_DrawBox(toU8g2(id), static_cast <u8g2_uint_t>(x), static_cast <u8g2_uint_t>(y),
                      static_cast <u8g2_uint_t>(width), static_cast <u8g2_uint_t>(height));
     END_CATCH
@@ -543,26 +661,43 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawBox(JNIEnv *env, jcla
 
 //long id, int x, int y, int count, int height, byte[] bitmap
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawBitmap(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint count, jint height, jbyteArray bitmap) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     if (bitmap == nullptr) {
         JNI_ThrowNativeLibraryException(env, "Bitmap data cannot be null");
         return;
     }
+    if (count < 0 || height < 0) {
+        JNI_ThrowNativeLibraryException(env, "drawBitmap() : Invalid bitmap dimensions");
+        return;
+    }
+    //u8g2 reads 'count' bytes per row
+    if (env->GetArrayLength(bitmap) < count * height) {
+        JNI_ThrowNativeLibraryException(env, "drawBitmap() : The bitmap data is smaller than the specified dimensions");
+        return;
+    }
     BEGIN_CATCH
-        jsize len = env->GetArrayLength(bitmap);
-        uint8_t tmp[len];
-        JNI_CopyJByteArray(env, bitmap, tmp, len);
+        checkNotRecording(id, "drawBitmap()");
+        auto *data = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(bitmap, nullptr));
+        if (data == nullptr)
+            throw std::runtime_error("drawBitmap() : Unable to access the bitmap data");
         u8g2_DrawBitmap(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
-                        static_cast<u8g2_uint_t>(count), static_cast<u8g2_uint_t>(height), tmp);
+                        static_cast<u8g2_uint_t>(count), static_cast<u8g2_uint_t>(height), data);
+        env->ReleasePrimitiveArrayCritical(bitmap, data, JNI_ABORT);
     END_CATCH
 }
 
 //long id, int x, int y, int radius, int options
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawCircle(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint radius, jint options) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_CIRCLE, x, y, radius, options);
+            return;
+        }
         u8g2_DrawCircle(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                         static_cast<u8g2_uint_t>(radius), static_cast<uint8_t>(options));
     END_CATCH
@@ -570,9 +705,14 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawCircle(JNIEnv *env, j
 
 //long id, int x, int y, int radius, int options
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawDisc(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint radius, jint options) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_DISC, x, y, radius, options);
+            return;
+        }
         u8g2_DrawDisc(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                       static_cast<u8g2_uint_t>(radius), static_cast<uint8_t>(options));
     END_CATCH
@@ -580,27 +720,42 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawDisc(JNIEnv *env, jcl
 
 //long id, int x, int y, int rx, int ry, int options
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawEllipse(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint rx, jint ry, jint options) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_ELLIPSE, x, y, rx, ry, options);
+            return;
+        }
         u8g2_DrawEllipse(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), static_cast<u8g2_uint_t>(rx), static_cast<u8g2_uint_t>(ry), static_cast<uint8_t>(options));
     END_CATCH
 }
 
 //long id, int x, int y, int rx, int ry, int options
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawFilledEllipse(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint rx, jint ry, jint options) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_FILLED_ELLIPSE, x, y, rx, ry, options);
+            return;
+        }
         u8g2_DrawFilledEllipse(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), static_cast<u8g2_uint_t>(rx), static_cast<u8g2_uint_t>(ry), static_cast<uint8_t>(options));
     END_CATCH
 }
 
 //long id, int x, int y, int width, int height
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawFrame(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_FRAME, x, y, width, height);
+            return;
+        }
         u8g2_DrawFrame(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                        static_cast<u8g2_uint_t>(width), static_cast<u8g2_uint_t>(height));
     END_CATCH
@@ -608,28 +763,43 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawFrame(JNIEnv *env, jc
 
 //long id, int x, int y, short encoding
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawGlyph(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jshort encoding) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
-        u8g2_DrawGlyph(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
-                       static_cast<uint16_t>(encoding));
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_GLYPH, x, y, static_cast<uint16_t>(encoding));
+            return;
+        }
+        getContext(id)->glyph_cache->drawGlyph(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
+                                               static_cast<uint16_t>(encoding));
     END_CATCH
 }
 
 //long id, int x, int y, int width
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawHLine(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_HLINE, x, y, width);
+            return;
+        }
         u8g2_DrawHLine(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                        static_cast<u8g2_uint_t>(width));
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawVLine(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_VLINE, x, y, width);
+            return;
+        }
         u8g2_DrawVLine(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                        static_cast<u8g2_uint_t>(width));
     END_CATCH
@@ -637,9 +807,14 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawVLine(JNIEnv *env, jc
 
 //long id, int x, int y, int x1, int y1
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawLine(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint x1, jint y1) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_LINE, x, y, x1, y1);
+            return;
+        }
         u8g2_DrawLine(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                       static_cast<u8g2_uint_t>(x1), static_cast<u8g2_uint_t>(y1));
     END_CATCH
@@ -647,18 +822,28 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawLine(JNIEnv *env, jcl
 
 //long id, int x, int y
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixel(JNIEnv *env, jclass cls, jlong id, jint x, jint y) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_PIXEL, x, y);
+            return;
+        }
         u8g2_DrawPixel(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y));
     END_CATCH
 }
 
 //long id, int x, int y, int width, int height, int radius
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawRoundedBox(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jint radius) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_RBOX, x, y, width, height, radius);
+            return;
+        }
         u8g2_DrawRBox(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                       static_cast<u8g2_uint_t>(width), static_cast<u8g2_uint_t>(height),
                       static_cast<u8g2_uint_t>(radius));
@@ -667,9 +852,14 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawRoundedBox(JNIEnv *en
 
 //long id, int x, int y, int width, int height, int radius
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawRoundedFrame(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jint radius) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_RFRAME, x, y, width, height, radius);
+            return;
+        }
         u8g2_DrawRFrame(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y),
                         static_cast<u8g2_uint_t>(width), static_cast<u8g2_uint_t>(height),
                         static_cast<u8g2_uint_t>(radius));
@@ -678,6 +868,7 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawRoundedFrame(JNIEnv *
 
 //long id, int x, int y, String value
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawString(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jstring value) {
+    JNI_TRACE_ID(id);
     if (value == nullptr) {
         JNI_ThrowNativeLibraryException(env, "drawString() : Value is null");
         return;
@@ -689,45 +880,87 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawString(JNIEnv *env, j
         return;
     }
     BEGIN_CATCH
-        const char *c = env->GetStringUTFChars(value, nullptr);
-        u8g2_DrawStr(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), c);
+        //copied, recording and drawing may throw
+        std::string str = JNI_GetString(env, value);
+        if (auto *list = getRecordingList(id))
+            list->addData(DL_OP_STR, str.c_str(), str.size() + 1, x, y);
+        else
+            getContext(id)->glyph_cache->drawString(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), str.c_str(), false);
     END_CATCH
 }
 
 //long id, int x0, int y0, int x1, int y1, int x2, int y2
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawTriangle(JNIEnv *env, jclass cls, jlong id, jint x0, jint y0, jint x1, jint y1, jint x2, jint y2) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_TRIANGLE, x0, y0, x1, y1, x2, y2);
+            return;
+        }
         u8g2_DrawTriangle(toU8g2(id), static_cast<int16_t>(x0), static_cast<int16_t>(y0), static_cast<int16_t>(x1), static_cast<int16_t>(y1), static_cast<int16_t>(x2), static_cast<int16_t>(y2));
     END_CATCH
 }
 
 //long id, int x, int y, int width, int height, byte[] data
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawXBM(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jbyteArray data) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
+    if (data == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "drawXBM() : Bitmap data cannot be null");
+        return;
+    }
+    if (width < 0 || height < 0) {
+        JNI_ThrowNativeLibraryException(env, "drawXBM() : Invalid bitmap dimensions");
+        return;
+    }
+    jsize size = ((width + 7) / 8) * height;
+    if (env->GetArrayLength(data) < size) {
+        JNI_ThrowNativeLibraryException(env, "drawXBM() : The bitmap data is smaller than the specified dimensions");
+        return;
+    }
     BEGIN_CATCH
-        jsize len = env->GetArrayLength(data);
-        uint8_t tmp[len];
-        JNI_CopyJByteArray(env, data, tmp, len);
-        u8g2_DrawXBM(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), static_cast<u8g2_uint_t>(width), static_cast<u8g2_uint_t>(height), tmp);
+        if (auto *list = getRecordingList(id)) {
+            std::vector<uint8_t> copy(size);
+            env->GetByteArrayRegion(data, 0, size, reinterpret_cast<jbyte *>(copy.data()));
+            list->addData(DL_OP_XBM, copy.data(), copy.size(), x, y, width, height);
+            return;
+        }
+        auto *bits = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(data, nullptr));
+        if (bits == nullptr)
+            throw std::runtime_error("drawXBM() : Unable to access the bitmap data");
+        u8g2_DrawXBM(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), static_cast<u8g2_uint_t>(width), static_cast<u8g2_uint_t>(height), bits);
+        env->ReleasePrimitiveArrayCritical(data, bits, JNI_ABORT);
     END_CATCH
 }
 
 //long id, int x, int y, String value
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawUTF8(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jstring value) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
+    if (value == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "Text cannot be null");
+        return -1;
+    }
     BEGIN_CATCH
-        const char *c = env->GetStringUTFChars(value, nullptr);
-        int retval = u8g2_DrawUTF8(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), c);
+        //copied, recording and drawing may throw
+        std::string str = JNI_GetString(env, value);
+        if (auto *list = getRecordingList(id)) {
+            //nothing is drawn yet, report the width of the string instead
+            list->addData(DL_OP_UTF8, str.c_str(), str.size() + 1, x, y);
+            return u8g2_GetUTF8Width(toU8g2(id), str.c_str());
+        }
+        return getContext(id)->glyph_cache->drawString(toU8g2(id), static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), str.c_str(), true);
     END_CATCH
     return -1;
 }
 
 //long id, String text
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getUTF8Width(JNIEnv *env, jclass cls, jlong id, jstring text) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     if (text == nullptr) {
@@ -736,13 +969,133 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getUTF8Width(JNIEnv *env,
     }
     BEGIN_CATCH
         const char *c = env->GetStringUTFChars(text, nullptr);
-        return u8g2_GetUTF8Width(toU8g2(id), c);
+        int width = u8g2_GetUTF8Width(toU8g2(id), c);
+        env->ReleaseStringUTFChars(text, c);
+        return width;
     END_CATCH
     return -1;
 }
 
+jintArray toExtentArray(JNIEnv *env, const std::vector<jint> &extents) {
+    jintArray result = env->NewIntArray(static_cast<jsize>(extents.size()));
+    if (result != nullptr && !extents.empty())
+        env->SetIntArrayRegion(result, 0, static_cast<jsize>(extents.size()), extents.data());
+    return result;
+}
+
+void storeExtent(std::vector<jint> &extents, jsize index, const ucgd_text_extent_t &extent) {
+    jint *dst = extents.data() + (index * TEXT_RUN_EXTENT_SIZE);
+    dst[0] = extent.x;
+    dst[1] = extent.y;
+    dst[2] = extent.width;
+    dst[3] = extent.height;
+}
+
+//long id, String[] texts, int[] params
+jintArray Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawTextRuns(JNIEnv *env, jclass cls, jlong id, jobjectArray texts, jintArray params) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return nullptr;
+    if (texts == nullptr || params == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "drawTextRuns() : Text runs and parameters cannot be null");
+        return nullptr;
+    }
+    if (!getFontFlag(env, id)) {
+        JNI_ThrowNativeLibraryException(env, "A font needs to be assigned prior to calling this method");
+        return nullptr;
+    }
+    jsize count = env->GetArrayLength(texts);
+    if (env->GetArrayLength(params) < count * TEXT_RUN_PARAM_SIZE) {
+        JNI_ThrowNativeLibraryException(env, "drawTextRuns() : Expected " + std::to_string(TEXT_RUN_PARAM_SIZE) + " parameters (x, y, flags) per text run");
+        return nullptr;
+    }
+    BEGIN_CATCH
+        checkNotRecording(id, "drawTextRuns()");
+        std::shared_ptr<ucgd_t> &context = getContext(id);
+        u8g2_t *u8g2 = toU8g2(id);
+        std::vector<jint> param(count * TEXT_RUN_PARAM_SIZE);
+        std::vector<jint> extents(count * TEXT_RUN_EXTENT_SIZE, 0);
+        if (count > 0)
+            env->GetIntArrayRegion(params, 0, count * TEXT_RUN_PARAM_SIZE, param.data());
+        for (jsize i = 0; i < count; i++) {
+            auto text = (jstring) env->GetObjectArrayElement(texts, i);
+            if (text == nullptr)
+                continue;
+            jsize length = env->GetStringLength(text);
+            //no JNI calls are allowed until the critical section is released
+            const jchar *chars = env->GetStringCritical(text, nullptr);
+            if (chars == nullptr) {
+                env->DeleteLocalRef(text);
+                throw std::runtime_error("drawTextRuns() : Unable to access the characters of text run " + std::to_string(i));
+            }
+            ucgd_text_extent_t extent{};
+            try {
+                const jint *p = param.data() + (i * TEXT_RUN_PARAM_SIZE);
+                extent = context->text_runs->layout(u8g2, *context->glyph_cache, reinterpret_cast<const uint16_t *>(chars), length, p[0], p[1], p[2]);
+            } catch (...) {
+                env->ReleaseStringCritical(text, chars);
+                env->DeleteLocalRef(text);
+                throw;
+            }
+            env->ReleaseStringCritical(text, chars);
+            env->DeleteLocalRef(text);
+            storeExtent(extents, i, extent);
+        }
+        return toExtentArray(env, extents);
+    END_CATCH
+    return nullptr;
+}
+
+//long id, ByteBuffer runs, int count
+jintArray Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawTextRunsDirect(JNIEnv *env, jclass cls, jlong id, jobject runs, jint count) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return nullptr;
+    if (runs == nullptr || count < 0) {
+        JNI_ThrowNativeLibraryException(env, "drawTextRunsDirect() : Invalid text run buffer or count");
+        return nullptr;
+    }
+    if (!getFontFlag(env, id)) {
+        JNI_ThrowNativeLibraryException(env, "A font needs to be assigned prior to calling this method");
+        return nullptr;
+    }
+    auto *data = static_cast<uint8_t *>(env->GetDirectBufferAddress(runs));
+    jlong capacity = env->GetDirectBufferCapacity(runs);
+    if (data == nullptr || capacity < 0) {
+        JNI_ThrowNativeLibraryException(env, "drawTextRunsDirect() : Text runs must be stored in a direct buffer");
+        return nullptr;
+    }
+    BEGIN_CATCH
+        checkNotRecording(id, "drawTextRunsDirect()");
+        std::shared_ptr<ucgd_t> &context = getContext(id);
+        u8g2_t *u8g2 = toU8g2(id);
+        std::vector<jint> extents(count * TEXT_RUN_EXTENT_SIZE, 0);
+        auto size = static_cast<size_t>(capacity);
+        size_t offset = 0;
+        for (jint i = 0; i < count; i++) {
+            //header: x, y, flags, length (int32, native byte order) followed by the UTF-16 code units, padded to 4 bytes
+            if (offset + TEXT_RUN_HEADER_SIZE > size)
+                throw std::runtime_error("drawTextRunsDirect() : Buffer underflow while reading the header of text run " + std::to_string(i));
+            int32_t header[4];
+            std::memcpy(header, data + offset, sizeof(header));
+            if (header[3] < 0)
+                throw std::runtime_error("drawTextRunsDirect() : Invalid length for text run " + std::to_string(i));
+            auto length = static_cast<size_t>(header[3]);
+            size_t textSize = (length * sizeof(uint16_t) + 3) & ~static_cast<size_t>(3);
+            if (offset + TEXT_RUN_HEADER_SIZE + length * sizeof(uint16_t) > size)
+                throw std::runtime_error("drawTextRunsDirect() : Buffer underflow while reading the characters of text run " + std::to_string(i));
+            auto *chars = reinterpret_cast<const uint16_t *>(data + offset + TEXT_RUN_HEADER_SIZE);
+            storeExtent(extents, i, context->text_runs->layout(u8g2, *context->glyph_cache, chars, length, header[0], header[1], header[2]));
+            offset += TEXT_RUN_HEADER_SIZE + textSize;
+        }
+        return toExtentArray(env, extents);
+    END_CATCH
+    return nullptr;
+}
+
 //long id, byte[] data
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFont__J_3B(JNIEnv *env, jclass cls, jlong id, jbyteArray data) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     if (data == nullptr) {
@@ -758,12 +1111,16 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFont__J_3B(JNIEnv *env
         }
         uint8_t tmp[len];
         JNI_CopyJByteArray(env, data, tmp, len);
-        u8g2_SetFont(toU8g2(id), tmp);
+        if (auto *list = getRecordingList(id))
+            u8g2_SetFont(toU8g2(id), list->addFontData(tmp, len));
+        else
+            u8g2_SetFont(toU8g2(id), tmp);
         setFontFlag(env, id, true);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFont__JLjava_lang_String_2(JNIEnv *env, jclass cls, jlong id, jstring fontName) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     if (fontName == nullptr) {
@@ -771,141 +1128,198 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFont__JLjava_lang_Stri
         return;
     }
     BEGIN_CATCH
-        std::string font = std::string(env->GetStringUTFChars(fontName, nullptr));
+        std::string font = JNI_GetString(env, fontName);
         uint8_t *fontData = U8g2hal_GetFontByName(font);
         if (fontData == nullptr) {
             JNI_ThrowNativeLibraryException(env, std::string("Unable to retrieve font data for: ") + font);
             return;
         }
         u8g2_SetFont(toU8g2(id), fontData);
+        if (auto *list = getRecordingList(id))
+            list->addFont(fontData);
         setFontFlag(env, id, true);
     END_CATCH
 }
 
 //long id, int mode
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontMode(JNIEnv *env, jclass cls, jlong id, jint mode) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontMode(toU8g2(id), static_cast<uint8_t>(mode));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_MODE, mode);
     END_CATCH
 }
 
 //long id, int direction
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontDirection(JNIEnv *env, jclass cls, jlong id, jint mode) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontDirection(toU8g2(id), static_cast<uint8_t>(mode));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_DIRECTION, mode);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontPosBaseline(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontPosBaseline(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_POS, DL_FONT_POS_BASELINE);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontPosBottom(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontPosBottom(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_POS, DL_FONT_POS_BOTTOM);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontPosTop(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontPosTop(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_POS, DL_FONT_POS_TOP);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontPosCenter(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontPosCenter(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_POS, DL_FONT_POS_CENTER);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontRefHeightAll(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontRefHeightAll(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_REF_HEIGHT, DL_FONT_REF_HEIGHT_ALL);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontRefHeightExtendedText(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontRefHeightExtendedText(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_REF_HEIGHT, DL_FONT_REF_HEIGHT_EXTENDED_TEXT);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFontRefHeightText(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFontRefHeightText(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_FONT_REF_HEIGHT, DL_FONT_REF_HEIGHT_TEXT);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFlipMode(JNIEnv *env, jclass cls, jlong id, jboolean enable) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetFlipMode(toU8g2(id), enable);
+        checkTransport(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setPowerSave(JNIEnv *env, jclass cls, jlong id, jboolean enable) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetPowerSave(toU8g2(id), enable);
+        checkTransport(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setDrawColor(JNIEnv *env, jclass cls, jlong id, jint color) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetDrawColor(toU8g2(id), static_cast<uint8_t>(color));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_DRAW_COLOR, color);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_initDisplay(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_InitDisplay(toU8g2(id));
+        invalidateLayers(id);
+        checkTransport(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_firstPage(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        checkNotRecording(id, "firstPage()");
         u8g2_FirstPage(toU8g2(id));
     END_CATCH
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_nextPage(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
-        return u8g2_NextPage(toU8g2(id));
+        checkNotRecording(id, "nextPage()");
+        checkNotDrawingLayer(id, "nextPage()");
+        //rotated at send time or composited layers: full buffer only, the single page is sent as one frame
+        if (getActiveRotator(id) != nullptr || getActiveLayers(id) != nullptr) {
+            sendFrame(id);
+            updateBgraBuffer(id);
+            publishPage(id);
+            checkTransport(id);
+            return 0;
+        }
+        updateBgraBuffer(id);
+        publishPage(id);
+        uint8_t more = u8g2_NextPage(toU8g2(id));
+        checkTransport(id);
+        return more;
     END_CATCH
     return -1;
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getAscent(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -915,6 +1329,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getAscent(JNIEnv *env, jc
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getDescent(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -924,6 +1339,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getDescent(JNIEnv *env, j
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getMaxCharWidth(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -933,6 +1349,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getMaxCharWidth(JNIEnv *e
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getMaxCharHeight(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -942,18 +1359,40 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getMaxCharHeight(JNIEnv *
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_sendBuffer(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
-        u8g2_SendBuffer(toU8g2(id));
+        checkNotRecording(id, "sendBuffer()");
+        checkNotDrawingLayer(id, "sendBuffer()");
+        u8g2_t *u8g2 = toU8g2(id);
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        ucgd_stats_mark_t mark = context->stats.beginFrame();
+        sendFrame(id);
+        endFrame(context, mark);
+        checkTransport(id);
         updateBgraBuffer(id);
+        publishPage(id);
+        if (context->recorder) {
+            UCGD_TRACE_SCOPE_ARG("pipeline", "record", "id", id);
+            //record the display buffer (the rotated frame if the display is drawn into a canvas)
+            if (U8g2Rotator *rotator = getActiveRotator(id))
+                context->recorder->record(rotator->getBuffer(), rotator->getBufferSize());
+            else
+                context->recorder->record(u8g2_GetBufferPtr(u8g2), u8g2_GetBufferTileWidth(u8g2) * u8g2->tile_buf_height * 8);
+        }
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearBuffer(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_CLEAR);
+            return;
+        }
         u8g2_ClearBuffer(toU8g2(id));
         clearBgraBuffer(id);
         //updateBgraBuffer(id);
@@ -961,26 +1400,38 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearBuffer(JNIEnv *env,
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearDisplay(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        checkNotDrawingLayer(id, "clearDisplay()");
         u8g2_ClearDisplay(toU8g2(id));
+        invalidateLayers(id);
+        checkTransport(id);
+        //the cleared canvas was sent as is (blank), bring the display buffer in sync
+        if (U8g2Rotator *rotator = getActiveRotator(id))
+            rotator->rotate();
         updateBgraBuffer(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_begin(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
+        checkNotDrawingLayer(id, "begin()");
         u8g2_t *u8g2 = toU8g2(id);
         u8g2_InitDisplay(u8g2);
         u8g2_ClearDisplay(u8g2);
         u8g2_SetPowerSave(u8g2, 0);
+        invalidateLayers(id);
+        checkTransport(id);
     END_CATCH
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getHeight(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -990,6 +1441,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getHeight(JNIEnv *env, jc
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getWidth(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -999,6 +1451,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getWidth(JNIEnv *env, jcl
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clear(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
@@ -1007,10 +1460,12 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clear(JNIEnv *env, jclass
         //home (not implemented here)
         u8g2_ClearDisplay(u8g2);
         u8g2_ClearBuffer(u8g2);
+        checkTransport(id);
     END_CATCH
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setAutoPageClear(JNIEnv *env, jclass cls, jlong id, jint clear) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -1020,33 +1475,45 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setAutoPageClear(JNIEnv *
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setBitmapMode(JNIEnv *env, jclass cls, jlong id, jint mode) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetBitmapMode(toU8g2(id), static_cast<uint8_t>(mode));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_BITMAP_MODE, mode);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setContrast(JNIEnv *env, jclass cls, jlong id, jint value) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetContrast(toU8g2(id), value);
+        checkTransport(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setDisplayRotation(JNIEnv *env, jclass cls, jlong id, jint rotation) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_cb_t *_rotation = U8g2Util_ToRotation(rotation);
         if (_rotation == nullptr)
             return;
-        u8g2_SetDisplayRotation(toU8g2(id), _rotation);
+        checkNotDrawingLayer(id, "setDisplayRotation()");
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        if (context->rotator)
+            context->rotator->setRotation(toU8g2(id), _rotation);
+        else
+            u8g2_SetDisplayRotation(toU8g2(id), _rotation);
     END_CATCH
 }
 
 jbyteArray Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBuffer(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return nullptr;
 
@@ -1065,6 +1532,7 @@ jbyteArray Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBuffer(JNIEnv *e
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBufferTileWidth(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -1074,6 +1542,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBufferTileWidth(JNIEnv
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBufferTileHeight(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -1083,6 +1552,7 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBufferTileHeight(JNIEn
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setBufferCurrTileRow(JNIEnv *env, jclass cls, jlong id, jint row) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
@@ -1091,6 +1561,7 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setBufferCurrTileRow(JNIE
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBufferCurrTileRow(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
@@ -1100,48 +1571,74 @@ jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBufferCurrTileRow(JNIE
 }
 
 jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getStrWidth(JNIEnv *env, jclass cls, jlong id, jstring text) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return -1;
     BEGIN_CATCH
         const char *c = env->GetStringUTFChars(text, nullptr);
-        return u8g2_GetStrWidth(toU8g2(id), c);
+        int width = u8g2_GetStrWidth(toU8g2(id), c);
+        env->ReleaseStringUTFChars(text, c);
+        return width;
     END_CATCH
     return -1;
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setClipWindow(JNIEnv *env, jclass cls, jlong id, jint x0, jint y0, jint x1, jint y1) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetClipWindow(toU8g2(id), x0, y0, x1, y1);
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_CLIP_WINDOW, x0, y0, x1, y1);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setMaxClipWindow(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
         u8g2_SetMaxClipWindow(toU8g2(id));
+        if (auto *list = getRecordingList(id))
+            list->add(DL_OP_MAX_CLIP_WINDOW);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_updateDisplay__J(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
-        u8g2_UpdateDisplay(toU8g2(id));
+        checkNotDrawingLayer(id, "updateDisplay()");
+        compositeLayers(id);
+        if (U8g2Rotator *rotator = getActiveRotator(id))
+            rotator->sendBuffer(toU8g2(id));
+        else
+            u8g2_UpdateDisplay(toU8g2(id));
+        checkTransport(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_updateDisplay__JIIII(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
-        u8g2_UpdateDisplayArea(toU8g2(id), x, y, width, height);
+        checkNotDrawingLayer(id, "updateDisplay()");
+        //only the area is sent, the rest of the composited frame is not on the display
+        if (compositeLayers(id) != nullptr)
+            invalidateLayers(id);
+        if (U8g2Rotator *rotator = getActiveRotator(id))
+            rotator->updateDisplayArea(toU8g2(id), x, y, width, height);
+        else
+            u8g2_UpdateDisplayArea(toU8g2(id), x, y, width, height);
+        checkTransport(id);
     END_CATCH
 }
 
 jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToXBM(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return nullptr;
     BEGIN_CATCH
@@ -1159,6 +1656,7 @@ jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToXBM(JNIEnv *en
 }
 
 jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToPBM(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return nullptr;
     BEGIN_CATCH
@@ -1174,6 +1672,7 @@ jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToPBM(JNIEnv *en
 }
 
 jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToXBM2(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return nullptr;
     BEGIN_CATCH
@@ -1189,6 +1688,7 @@ jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToXBM2(JNIEnv *e
 }
 
 jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToPBM2(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return nullptr;
     BEGIN_CATCH
@@ -1204,18 +1704,21 @@ jstring Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportToPBM2(JNIEnv *e
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_sendCommand(JNIEnv *env, jclass cls, jlong id, jstring fmt, jbyteArray args) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
-        const char *c = env->GetStringUTFChars(fmt, nullptr);
+        std::string c = JNI_GetString(env, fmt);
         jsize len = env->GetArrayLength(args);
         uint8_t tmp[len];
         JNI_CopyJByteArray(env, args, tmp, len);
-        u8g2_SendF(toU8g2(id), c, tmp);
+        u8g2_SendF(toU8g2(id), c.c_str(), tmp);
+        checkTransport(id);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setPrimaryColor(JNIEnv *env, jclass cls, jlong id, jint color) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
@@ -1225,6 +1728,7 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setPrimaryColor(JNIEnv *e
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setSecondaryColor(JNIEnv *env, jclass cls, jlong id, jint color) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
     BEGIN_CATCH
@@ -1234,85 +1738,836 @@ void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setSecondaryColor(JNIEnv
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixels(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jbyteArray buffer) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
+    if (buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "drawPixels() : Pixel buffer cannot be null");
+        return;
+    }
     BEGIN_CATCH
+        checkNotRecording(id, "drawPixels()");
         jsize bufferSize = env->GetArrayLength(buffer);
-        uint8_t tmp[bufferSize];
-        JNI_CopyJByteArray(env, buffer, tmp, bufferSize);
         u8g2_t *u8g2 = toU8g2(id);
-        int destX = x, destY = y;
-        int maxX = x + width;
-        int maxY = y + height;
-        int displayWidth = u8g2_GetBufferTileWidth(u8g2) * 8;
-        int displayHeight = u8g2_GetBufferTileHeight(u8g2) * 8;
-
-        //u8g2_ClearBuffer(u8g2);
-        for (int idx = 0; idx < bufferSize; idx++) {
-            uint8_t data = tmp[idx];
-            //start with the most significant bit
-            for (int pos = 7; pos >= 0; pos++) {
-                if (destX >= maxX) {
-                    destX = x;
-                    destY++;
-                }
-                //check bounds
-                if (destX >= maxX || destY >= maxY || destX >= displayWidth || destY >= displayHeight || destX < 0 || destY < 0) {
-                    destX++;
-                    continue;
-                }
-                //if bit is set, draw
-                if (((1 << pos) & data) != 0)
-                    u8g2_DrawPixel(u8g2, destX, destY);
-                destX++;
-            }
-        }
+        //the pixels are a continuous bit stream (msb first), each row is exactly 'width' bits long
+        auto *data = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(buffer, nullptr));
+        if (data == nullptr)
+            throw std::runtime_error("drawPixels() : Unable to access the pixel buffer");
+        ucgd_bitmap_t bitmap{data, static_cast<size_t>(bufferSize), width, height, static_cast<size_t>(std::max(0, width))};
+        U8g2Blit::blit(u8g2, x, y, bitmap, U8g2Blit::fromDrawColor(u8g2));
+        env->ReleasePrimitiveArrayCritical(buffer, data, JNI_ABORT);
     END_CATCH
 }
 
 void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixelsBgra(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jbyteArray buffer) {
+    JNI_TRACE_ID(id);
     if (!checkValidity(env, id))
         return;
+    if (buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "drawPixelsBgra() : Pixel buffer cannot be null");
+        return;
+    }
+    if (width <= 0 || height <= 0)
+        return;
     BEGIN_CATCH
+        checkNotRecording(id, "drawPixelsBgra()");
         jsize jBufferSize = env->GetArrayLength(buffer);
-        jbyte *jBuffer = env->GetByteArrayElements(buffer, nullptr);
+        std::shared_ptr<ucgd_t> &context = getContext(id);
+
+        //convert the pixels to 1bpp using the dither mode of the device, then blit
+        auto *jBuffer = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(buffer, nullptr));
+        if (jBuffer == nullptr)
+            throw std::runtime_error("drawPixelsBgra() : Unable to access the pixel buffer");
+        ucgd_image_t image{jBuffer, static_cast<size_t>(jBufferSize), width, height, static_cast<size_t>(width) * 4};
+        try {
+            //the scratch buffers of the ditherer may grow
+            context->dither->draw(context->u8g2.get(), x, y, image);
+        } catch (...) {
+            env->ReleasePrimitiveArrayCritical(buffer, jBuffer, JNI_ABORT);
+            throw;
+        }
+        env->ReleasePrimitiveArrayCritical(buffer, jBuffer, JNI_ABORT);
+    END_CATCH
+}
+
+//long id, int x, int y, int width, int height, ByteBuffer buffer, int mode
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_blit(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jobject buffer, jint mode) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "blit() : Pixel buffer cannot be null");
+        return;
+    }
+    if (mode < BLIT_MODE_CLEAR || mode > BLIT_MODE_COPY) {
+        JNI_ThrowNativeLibraryException(env, "blit() : Invalid blit mode (" + std::to_string(mode) + ")");
+        return;
+    }
+    auto *data = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (data == nullptr || capacity < 0) {
+        JNI_ThrowNativeLibraryException(env, "blit() : Pixels must be stored in a direct buffer");
+        return;
+    }
+    if (width <= 0 || height <= 0)
+        return;
+    size_t stride = (static_cast<size_t>(width) + 7) / 8;
+    if (static_cast<size_t>(capacity) < stride * height) {
+        JNI_ThrowNativeLibraryException(env, "blit() : Pixel buffer is too small (Required: " + std::to_string(stride * height) + " bytes)");
+        return;
+    }
+    BEGIN_CATCH
+        checkNotRecording(id, "blit()");
+        ucgd_bitmap_t bitmap{data, static_cast<size_t>(capacity), width, height, stride * 8};
+        U8g2Blit::blit(toU8g2(id), x, y, bitmap, mode);
+    END_CATCH
+}
+
+//long id, int x, int y, int width, int height, ByteBuffer buffer, int stride
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixelsBgraDirect(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jobject buffer, jint stride) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "drawPixelsBgraDirect() : Pixel buffer cannot be null");
+        return;
+    }
+    auto *data = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (data == nullptr || capacity < 0) {
+        JNI_ThrowNativeLibraryException(env, "drawPixelsBgraDirect() : Pixels must be stored in a direct buffer");
+        return;
+    }
+    if (width <= 0 || height <= 0)
+        return;
+    size_t rowBytes = (stride > 0) ? static_cast<size_t>(stride) : static_cast<size_t>(width) * 4;
+    if (rowBytes < static_cast<size_t>(width) * 4) {
+        JNI_ThrowNativeLibraryException(env, "drawPixelsBgraDirect() : Stride must be at least width * 4 bytes");
+        return;
+    }
+    size_t required = rowBytes * (height - 1) + static_cast<size_t>(width) * 4;
+    if (static_cast<size_t>(capacity) < required) {
+        JNI_ThrowNativeLibraryException(env, "drawPixelsBgraDirect() : Pixel buffer is too small (Required: " + std::to_string(required) + " bytes)");
+        return;
+    }
+    BEGIN_CATCH
+        checkNotRecording(id, "drawPixelsBgraDirect()");
+        std::shared_ptr<ucgd_t> &context = getContext(id);
+        ucgd_image_t image{data, static_cast<size_t>(capacity), width, height, rowBytes};
+        context->dither->draw(context->u8g2.get(), x, y, image);
+    END_CATCH
+}
+
+//long id, int mode, int threshold
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setDitherMode(JNIEnv *env, jclass cls, jlong id, jint mode, jint threshold) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (mode < DITHER_NONE || mode > DITHER_ATKINSON) {
+        JNI_ThrowNativeLibraryException(env, "setDitherMode() : Invalid dither mode (" + std::to_string(mode) + ")");
+        return;
+    }
+    if (threshold < 0 || threshold > 255) {
+        JNI_ThrowNativeLibraryException(env, "setDitherMode() : Threshold must be between 0 and 255");
+        return;
+    }
+    BEGIN_CATCH
+        getContext(id)->dither->setMode(mode, threshold);
+    END_CATCH
+}
+
+//long id, byte[] data, int width, int height, int format
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_uploadSprite(JNIEnv *env, jclass cls, jlong id, jbyteArray data, jint width, jint height, jint format) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return 0;
+    if (data == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "uploadSprite() : Sprite data cannot be null");
+        return 0;
+    }
+    if (width <= 0 || height <= 0) {
+        JNI_ThrowNativeLibraryException(env, "uploadSprite() : Invalid sprite dimensions");
+        return 0;
+    }
+    if (format != SPRITE_FORMAT_XBM && format != SPRITE_FORMAT_1BPP) {
+        JNI_ThrowNativeLibraryException(env, "uploadSprite() : Invalid sprite format (" + std::to_string(format) + ")");
+        return 0;
+    }
+    size_t required = ((static_cast<size_t>(width) + 7) / 8) * height;
+    jsize len = env->GetArrayLength(data);
+    if (static_cast<size_t>(len) < required) {
+        JNI_ThrowNativeLibraryException(env, "uploadSprite() : Sprite data is too small (Required: " + std::to_string(required) + " bytes)");
+        return 0;
+    }
+    BEGIN_CATCH
+        //the store keeps its own copy of the bits, no need to pin the java array
+        std::vector<uint8_t> bytes(required);
+        env->GetByteArrayRegion(data, 0, static_cast<jsize>(required), reinterpret_cast<jbyte *>(bytes.data()));
+        uint32_t handle = getContext(id)->sprites->upload(bytes.data(), bytes.size(), width, height, format);
+        if (handle == 0)
+            throw std::runtime_error("uploadSprite() : Sprite does not fit within the sprite budget (evict unused sprites or increase the budget)");
+        return static_cast<jint>(handle);
+    END_CATCH
+    return 0;
+}
+
+//long id, int handle, int x, int y
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawSprite(JNIEnv *env, jclass cls, jlong id, jint handle, jint x, jint y) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        if (auto *list = getRecordingList(id)) {
+            list->add(DL_OP_SPRITE, handle, x, y);
+            return getContext(id)->sprites->contains(static_cast<uint32_t>(handle)) ? JNI_TRUE : JNI_FALSE;
+        }
+        return getContext(id)->sprites->draw(toU8g2(id), static_cast<uint32_t>(handle), x, y) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+//long id, int handle
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_evictSprite(JNIEnv *env, jclass cls, jlong id, jint handle) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        return getContext(id)->sprites->evict(static_cast<uint32_t>(handle)) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+//long id
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearSprites(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        getContext(id)->sprites->clear();
+    END_CATCH
+}
+
+//long id, int format
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getExportSize(JNIEnv *env, jclass cls, jlong id, jint format) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    if (format < EXPORT_FORMAT_RAW || format > EXPORT_FORMAT_PNG) {
+        JNI_ThrowNativeLibraryException(env, "getExportSize() : Invalid export format (" + std::to_string(format) + ")");
+        return -1;
+    }
+    BEGIN_CATCH
+        return static_cast<jint>(U8g2Export::getSize(toU8g2(id), format));
+    END_CATCH
+    return -1;
+}
 
+//long id, int format, ByteBuffer buffer
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportBuffer(JNIEnv *env, jclass cls, jlong id, jint format, jobject buffer) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    if (format < EXPORT_FORMAT_RAW || format > EXPORT_FORMAT_PNG) {
+        JNI_ThrowNativeLibraryException(env, "exportBuffer() : Invalid export format (" + std::to_string(format) + ")");
+        return -1;
+    }
+    if (buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "exportBuffer() : Output buffer cannot be null");
+        return -1;
+    }
+    auto *data = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (data == nullptr || capacity < 0) {
+        JNI_ThrowNativeLibraryException(env, "exportBuffer() : Output must be a direct buffer");
+        return -1;
+    }
+    BEGIN_CATCH
         u8g2_t *u8g2 = toU8g2(id);
-        int displayWidth = u8g2_GetBufferTileWidth(u8g2) * 8;
-        int displayHeight = u8g2_GetBufferTileHeight(u8g2) * 8;
-        //u8g2_ClearBuffer(u8g2);
-
-        //iterate the source image
-        int destX = x, destY = y;
-        int maxX = x + width;
-        int maxY = y + height;
-
-        for (int pos = 0; pos < jBufferSize; pos += 4) {
-            if (destX >= maxX) {
-                destY++;
-                destX = x;
-            }
+        size_t required = U8g2Export::getSize(u8g2, format);
+        if (static_cast<size_t>(capacity) < required) {
+            JNI_ThrowNativeLibraryException(env, "exportBuffer() : Output buffer is too small (Required: " + std::to_string(required) + " bytes)");
+            return -1;
+        }
+        return static_cast<jint>(U8g2Export::encode(u8g2, format, data, static_cast<size_t>(capacity)));
+    END_CATCH
+    return -1;
+}
 
-            //check bounds
-            if (destX >= maxX || destY >= maxY || destX >= displayWidth || destY >= displayHeight || destX < 0 || destY < 0) {
-                destX++;
-                continue;
-            }
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_startRecording(JNIEnv *env, jclass cls, jlong id, jstring path, jint capacity, jint keyframeInterval) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (path == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "startRecording() : Path cannot be null");
+        return;
+    }
+    if (capacity <= 0 || keyframeInterval <= 0) {
+        JNI_ThrowNativeLibraryException(env, "startRecording() : Capacity and keyframe interval must be greater than zero");
+        return;
+    }
+    BEGIN_CATCH
+        u8g2_t *u8g2 = toU8g2(id);
+        const char *c = env->GetStringUTFChars(path, nullptr);
+        std::string file(c);
+        env->ReleaseStringUTFChars(path, c);
+        int layout = u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb ? RECORDER_LAYOUT_HORIZONTAL : RECORDER_LAYOUT_VERTICAL;
+        //the display buffer is recorded, with rotate_at_send u8g2 draws into a canvas of tileWidth rows (R1/R3)
+        U8g2Rotator *rotator = getActiveRotator(id);
+        int tileHeight = (rotator != nullptr) ? rotator->getTileHeight() : u8g2->tile_buf_height;
+        auto recorder = std::make_unique<U8g2Recorder>();
+        recorder->open(file, static_cast<size_t>(capacity), u8g2_GetBufferTileWidth(u8g2) * 8, tileHeight * 8, layout, keyframeInterval);
+        getContext(id)->recorder = std::move(recorder);
+    END_CATCH
+}
 
-            auto blue = static_cast<uint8_t>(jBuffer[pos + 0]);
-            auto green = static_cast<uint8_t>(jBuffer[pos + 1]);
-            auto red = static_cast<uint8_t>(jBuffer[pos + 2]);
-            auto alpha = static_cast<uint8_t>(jBuffer[pos + 3]);
-            int color = (blue << 24) | (green << 16) | (red << 8) | (alpha);
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_stopRecording(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        getContext(id)->recorder.reset();
+    END_CATCH
+}
 
-            if (color != 0) {
-                //std::cout << "[" << std::to_string(destX - x)  << "] Drawing: X = " << std::to_string(destX) << ", Y = " << std::to_string(destY) << " = " << std::to_string(color) << std::endl;
-                u8g2_DrawPixel(u8g2, destX, destY);
-            }
-            destX++;
+jintArray Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getRecordingInfo(JNIEnv *env, jclass cls, jstring path) {
+    JNI_TRACE();
+    if (path == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "getRecordingInfo() : Path cannot be null");
+        return nullptr;
+    }
+    BEGIN_CATCH
+        const char *c = env->GetStringUTFChars(path, nullptr);
+        std::string file(c);
+        env->ReleaseStringUTFChars(path, c);
+        U8g2Replay replay;
+        replay.open(file);
+        const ucgd_rec_header_t &header = replay.getHeader();
+        jint info[] = {header.width, header.height, static_cast<jint>(header.layout), static_cast<jint>(header.frame_size), static_cast<jint>(replay.getFrameCount())};
+        jintArray result = env->NewIntArray(5);
+        env->SetIntArrayRegion(result, 0, 5, info);
+        return result;
+    END_CATCH
+    return nullptr;
+}
+
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_readRecording(JNIEnv *env, jclass cls, jstring path, jint index, jint count, jobject buffer, jlongArray timestamps) {
+    JNI_TRACE();
+    if (path == nullptr || buffer == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "readRecording() : Path and output buffer cannot be null");
+        return -1;
+    }
+    if (index < 0 || count < 0) {
+        JNI_ThrowNativeLibraryException(env, "readRecording() : Index and count cannot be negative");
+        return -1;
+    }
+    auto *data = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (data == nullptr || capacity < 0) {
+        JNI_ThrowNativeLibraryException(env, "readRecording() : Output must be a direct buffer");
+        return -1;
+    }
+    if (timestamps != nullptr && env->GetArrayLength(timestamps) < count) {
+        JNI_ThrowNativeLibraryException(env, "readRecording() : Timestamp array is smaller than the frame count");
+        return -1;
+    }
+    BEGIN_CATCH
+        const char *c = env->GetStringUTFChars(path, nullptr);
+        std::string file(c);
+        env->ReleaseStringUTFChars(path, c);
+        U8g2Replay replay;
+        replay.open(file);
+        size_t frameSize = replay.getHeader().frame_size;
+        if (static_cast<size_t>(capacity) < frameSize * count) {
+            JNI_ThrowNativeLibraryException(env, "readRecording() : Output buffer is too small (Required: " + std::to_string(frameSize * count) + " bytes)");
+            return -1;
+        }
+        std::vector<jlong> times(count);
+        jint read = 0;
+        for (; read < count; read++) {
+            uint64_t timestamp = 0;
+            if (!replay.readFrame(static_cast<size_t>(index) + read, data + frameSize * read, &timestamp))
+                break;
+            times[read] = static_cast<jlong>(timestamp);
         }
-        env->ReleaseByteArrayElements(buffer, jBuffer, 0);
+        if (timestamps != nullptr && read > 0)
+            env->SetLongArrayRegion(timestamps, 0, read, times.data());
+        return read;
     END_CATCH
+    return -1;
+}
+
+//long id, long[] stats
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getStatistics(JNIEnv *env, jclass cls, jlong id, jlongArray stats) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    if (stats == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "getStatistics() : Output array cannot be null");
+        return -1;
+    }
+    BEGIN_CATCH
+        jlong values[STATS_COUNT];
+        int count = getContext(id)->stats.snapshot(reinterpret_cast<int64_t *>(values), env->GetArrayLength(stats));
+        env->SetLongArrayRegion(stats, 0, count, values);
+        return count;
+    END_CATCH
+    return -1;
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_resetStatistics(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        getContext(id)->stats.reset();
+    END_CATCH
+}
+
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getEmulatorImage(JNIEnv *env, jclass cls, jlong id, jbyteArray image, jboolean effects) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    if (image == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "getEmulatorImage() : Output array cannot be null");
+        return -1;
+    }
+    BEGIN_CATCH
+        auto &context = getContext(id);
+        if (!context->emulator)
+            return -1;
+        size_t size = context->emulator->getImageSize();
+        if (static_cast<size_t>(env->GetArrayLength(image)) < size) {
+            JNI_ThrowNativeLibraryException(env, "getEmulatorImage() : Output array is too small (required: " + std::to_string(size) + " bytes)");
+            return -1;
+        }
+        std::vector<uint8_t> pixels(size);
+        context->emulator->getImage(pixels.data(), pixels.size(), context->u8g2->u8x8.x_offset, effects);
+        env->SetByteArrayRegion(image, 0, static_cast<jsize>(size), reinterpret_cast<const jbyte *>(pixels.data()));
+        return static_cast<jint>(size);
+    END_CATCH
+    return -1;
+}
+
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getEmulatorStatistics(JNIEnv *env, jclass cls, jlong id, jlongArray stats) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    if (stats == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "getEmulatorStatistics() : Output array cannot be null");
+        return -1;
+    }
+    BEGIN_CATCH
+        auto &context = getContext(id);
+        if (!context->emulator)
+            return -1;
+        jlong values[EMU_STATS_COUNT];
+        int count = context->emulator->snapshot(reinterpret_cast<int64_t *>(values), env->GetArrayLength(stats));
+        env->SetLongArrayRegion(stats, 0, count, values);
+        return count;
+    END_CATCH
+    return -1;
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setTraceEnabled(JNIEnv *env, jclass cls, jboolean enabled) {
+#ifdef UCGD_TRACE
+    UcgdTrace::setEnabled(enabled);
+#else
+    if (enabled)
+        JNI_ThrowNativeLibraryException(env, "setTraceEnabled() : Trace support is not available (library built without UCGD_TRACE)");
+#endif
+}
+
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportTrace(JNIEnv *env, jclass cls, jstring path, jboolean clear) {
+    if (path == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "exportTrace() : Path cannot be null");
+        return -1;
+    }
+#ifdef UCGD_TRACE
+    BEGIN_CATCH
+        const char *c = env->GetStringUTFChars(path, nullptr);
+        std::string file(c);
+        env->ReleaseStringUTFChars(path, c);
+        std::ofstream out(file, std::ios::out | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("exportTrace() : Unable to create file '" + file + "'");
+        auto count = static_cast<jint>(UcgdTrace::exportJson(out));
+        out.close();
+        if (!out)
+            throw std::runtime_error("exportTrace() : Unable to write file '" + file + "'");
+        if (clear)
+            UcgdTrace::clear();
+        return count;
+    END_CATCH
+#else
+    JNI_ThrowNativeLibraryException(env, "exportTrace() : Trace support is not available (library built without UCGD_TRACE)");
+#endif
+    return -1;
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_beginDisplayList(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        if (!context->display_list)
+            context->display_list = std::make_unique<U8g2DisplayList>();
+        context->display_list->begin(toU8g2(id));
+    END_CATCH
+}
+
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_endDisplayList(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        if (!context->display_list || !context->display_list->isRecording())
+            throw std::runtime_error("endDisplayList() : No display list is being recorded");
+        context->display_list->end();
+        return static_cast<jint>(context->display_list->getCount());
+    END_CATCH
+    return -1;
+}
+
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_renderDisplayList(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        if (!context->display_list)
+            throw std::runtime_error("renderDisplayList() : No display list has been recorded");
+        if (context->display_list->isRecording())
+            throw std::runtime_error("renderDisplayList() : The display list is still being recorded");
+        checkNotDrawingLayer(id, "renderDisplayList()");
+        u8g2_t *u8g2 = toU8g2(id);
+        int pages;
+        ucgd_stats_mark_t mark = context->stats.beginFrame();
+        if (getActiveRotator(id) != nullptr || getActiveLayers(id) != nullptr) {
+            //full buffer drawn into the canvas or composited with layers: replay once and send
+            UCGD_TRACE_SCOPE_ARG("pipeline", "renderDisplayList", "id", id);
+            if (u8g2->is_auto_page_clear)
+                u8g2_ClearBuffer(u8g2);
+            context->display_list->replay(u8g2, context->glyph_cache.get(), context->sprites.get());
+            sendFrame(id);
+            updateBgraBuffer(id);
+            publishPage(id);
+            pages = 1;
+        } else {
+            UCGD_TRACE_SCOPE_ARG("pipeline", "renderDisplayList", "id", id);
+            pages = context->display_list->render(u8g2, context->glyph_cache.get(), context->sprites.get(), [id]() {
+                updateBgraBuffer(id);
+                publishPage(id);
+            });
+        }
+        endFrame(context, mark);
+        checkTransport(id);
+        return pages;
+    END_CATCH
+    return -1;
+}
+
+//long id, int x, int y, int width, int height, int dx, int dy, boolean fill
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_scrollBuffer(JNIEnv *env, jclass cls, jlong id, jint x, jint y, jint width, jint height, jint dx, jint dy, jboolean fill) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        checkNotRecording(id, "scrollBuffer()");
+        if (!U8g2Scroll::scroll(toU8g2(id), x, y, width, height, dx, dy, fill))
+            throw std::runtime_error("scrollBuffer() : The buffer layout or the rotation of the display is not supported");
+    END_CATCH
+}
+
+//long id, int direction, int startPage, int endPage, int interval, int verticalOffset
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_startHardwareScroll(JNIEnv *env, jclass cls, jlong id, jint direction, jint startPage, jint endPage, jint interval, jint verticalOffset) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (direction < SCROLL_RIGHT || direction > SCROLL_VERTICAL_LEFT) {
+        JNI_ThrowNativeLibraryException(env, "startHardwareScroll() : Invalid scroll direction (" + std::to_string(direction) + ")");
+        return;
+    }
+    if (interval < 0 || interval > 7) {
+        JNI_ThrowNativeLibraryException(env, "startHardwareScroll() : Invalid frame interval (" + std::to_string(interval) + ", expected 0 to 7)");
+        return;
+    }
+    if (verticalOffset < 0 || verticalOffset > 63) {
+        JNI_ThrowNativeLibraryException(env, "startHardwareScroll() : Invalid vertical offset (" + std::to_string(verticalOffset) + ", expected 0 to 63)");
+        return;
+    }
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        if (!U8g2Scroll::hasHardwareScroll(context->setup_proc_name))
+            throw std::runtime_error("startHardwareScroll() : The controller does not support hardware scrolling (" + context->setup_proc_name + ")");
+        u8g2_t *u8g2 = toU8g2(id);
+        int pages = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+        if (startPage < 0 || endPage >= pages || startPage > endPage)
+            throw std::runtime_error("startHardwareScroll() : Invalid page range (" + std::to_string(startPage) + " to " + std::to_string(endPage) + ")");
+        U8g2Scroll::startHardwareScroll(u8g2, direction, startPage, endPage, interval, verticalOffset);
+        checkTransport(id);
+    END_CATCH
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_stopHardwareScroll(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        if (!U8g2Scroll::hasHardwareScroll(context->setup_proc_name))
+            throw std::runtime_error("stopHardwareScroll() : The controller does not support hardware scrolling (" + context->setup_proc_name + ")");
+        U8g2Scroll::stopHardwareScroll(toU8g2(id));
+        checkTransport(id);
+    END_CATCH
+}
+
+/**
+ * @return The layers of the device, created on first use
+ */
+U8g2Layers *getLayers(jlong id, const std::string &function) {
+    const std::shared_ptr<ucgd_t> &context = getContext(id);
+    if (!context->layers) {
+        if (!U8g2Layers::isSupported(toU8g2(id)))
+            throw std::runtime_error(function + " : Layers require a full buffer setup procedure (_f) with a vertical or horizontal buffer layout");
+        context->layers = std::make_unique<U8g2Layers>();
+    }
+    return context->layers.get();
+}
+
+//long id, int z, int op
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_createLayer(JNIEnv *env, jclass cls, jlong id, jint z, jint op) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return 0;
+    if (op < LAYER_OP_OR || op > LAYER_OP_XOR) {
+        JNI_ThrowNativeLibraryException(env, "createLayer() : Invalid blend operation (" + std::to_string(op) + ")");
+        return 0;
+    }
+    BEGIN_CATCH
+        checkNotRecording(id, "createLayer()");
+        return static_cast<jint>(getLayers(id, "createLayer()")->create(toU8g2(id), z, op));
+    END_CATCH
+    return 0;
+}
+
+//long id, int handle
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_removeLayer(JNIEnv *env, jclass cls, jlong id, jint handle) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        U8g2Layers *layers = getContext(id)->layers.get();
+        return (layers != nullptr && layers->remove(toU8g2(id), static_cast<uint32_t>(handle))) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearLayers(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        if (U8g2Layers *layers = getContext(id)->layers.get())
+            layers->clear(toU8g2(id));
+    END_CATCH
+}
+
+//long id, int handle
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_beginLayer(JNIEnv *env, jclass cls, jlong id, jint handle) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        checkNotRecording(id, "beginLayer()");
+        U8g2Layers *layers = getContext(id)->layers.get();
+        return (layers != nullptr && layers->begin(toU8g2(id), static_cast<uint32_t>(handle))) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_endLayer(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        if (U8g2Layers *layers = getContext(id)->layers.get())
+            layers->end(toU8g2(id));
+    END_CATCH
+}
+
+//long id, int handle, boolean visible
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerVisible(JNIEnv *env, jclass cls, jlong id, jint handle, jboolean visible) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        U8g2Layers *layers = getContext(id)->layers.get();
+        return (layers != nullptr && layers->setVisible(static_cast<uint32_t>(handle), visible)) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+//long id, int handle, int x, int y
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerOffset(JNIEnv *env, jclass cls, jlong id, jint handle, jint x, jint y) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        U8g2Layers *layers = getContext(id)->layers.get();
+        return (layers != nullptr && layers->setOffset(static_cast<uint32_t>(handle), x, y)) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+//long id, int handle, int z
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerZOrder(JNIEnv *env, jclass cls, jlong id, jint handle, jint z) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    BEGIN_CATCH
+        U8g2Layers *layers = getContext(id)->layers.get();
+        return (layers != nullptr && layers->setZOrder(static_cast<uint32_t>(handle), z)) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+//long id, int handle, int op
+jboolean Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerOp(JNIEnv *env, jclass cls, jlong id, jint handle, jint op) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return JNI_FALSE;
+    if (op < LAYER_OP_OR || op > LAYER_OP_XOR) {
+        JNI_ThrowNativeLibraryException(env, "setLayerOp() : Invalid blend operation (" + std::to_string(op) + ")");
+        return JNI_FALSE;
+    }
+    BEGIN_CATCH
+        U8g2Layers *layers = getContext(id)->layers.get();
+        return (layers != nullptr && layers->setOp(static_cast<uint32_t>(handle), op)) ? JNI_TRUE : JNI_FALSE;
+    END_CATCH
+    return JNI_FALSE;
+}
+
+jintArray Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getDirtyArea(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return nullptr;
+    BEGIN_CATCH
+        u8g2_t *u8g2 = toU8g2(id);
+        //without layers the changes are not tracked, the whole frame is dirty
+        ucgd_tile_area_t dirty = {0, 0, u8g2_GetBufferTileWidth(u8g2), u8g2_GetU8x8(u8g2)->display_info->tile_height};
+        if (U8g2Layers *layers = getActiveLayers(id)) {
+            dirty = layers->getDirtyArea();
+            U8g2Rotator *rotator = getActiveRotator(id);
+            if (rotator != nullptr && !rotator->mapArea(dirty.x, dirty.y, dirty.width, dirty.height))
+                dirty = {0, 0, 0, 0};
+        }
+        jint values[] = {dirty.x, dirty.y, dirty.width, dirty.height};
+        jintArray result = env->NewIntArray(4);
+        env->SetIntArrayRegion(result, 0, 4, values);
+        return result;
+    END_CATCH
+    return nullptr;
+}
+
+//int width, int height
+jlong Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_createCanvas(JNIEnv *env, jclass cls, jint width, jint height) {
+    JNI_TRACE();
+    if (width <= 0 || height <= 0 || width > CANVAS_MAX_SIZE || height > CANVAS_MAX_SIZE) {
+        JNI_ThrowNativeLibraryException(env, "createCanvas() : Invalid canvas size (" + std::to_string(width) + "x" + std::to_string(height) + ")");
+        return -1;
+    }
+    BEGIN_CATCH
+        return static_cast<jlong>(U8g2Util_SetupCanvas(width, height)->address());
+    END_CATCH
+    return -1;
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_destroyCanvas(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (getContext(id)->canvas == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "destroyCanvas() : Device " + std::to_string(id) + " is not a canvas");
+        return;
+    }
+    BEGIN_CATCH
+        ServiceLocator::getInstance().getDeviceManager()->deleteDevice(static_cast<uintptr_t>(id));
+    END_CATCH
+}
+
+//long id, long canvasId, int srcX, int srcY, int width, int height, int x, int y
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_blitCanvas(JNIEnv *env, jclass cls, jlong id, jlong canvasId, jint srcX, jint srcY, jint width, jint height, jint x, jint y) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id) || !checkValidity(env, canvasId))
+        return;
+    const U8g2Canvas *canvas = getContext(canvasId)->canvas.get();
+    if (canvas == nullptr) {
+        JNI_ThrowNativeLibraryException(env, "blitCanvas() : Device " + std::to_string(canvasId) + " is not a canvas");
+        return;
+    }
+    if (id == canvasId) {
+        JNI_ThrowNativeLibraryException(env, "blitCanvas() : A canvas can not be copied into itself");
+        return;
+    }
+    BEGIN_CATCH
+        checkNotRecording(id, "blitCanvas()");
+        canvas->blit(toU8g2(id), srcX, srcY, width, height, x, y);
+    END_CATCH
+}
+
+//long id, int fps, boolean adaptive
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_startFrameScheduler(JNIEnv *env, jclass cls, jlong id, jint fps, jboolean adaptive) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    if (getContext(id)->canvas != nullptr) {
+        JNI_ThrowNativeLibraryException(env, "startFrameScheduler() : Device " + std::to_string(id) + " is a canvas, its frames are not sent");
+        return;
+    }
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        auto scheduler = std::make_shared<UcgdFrameScheduler>(fps, adaptive);
+        std::shared_ptr<UcgdFrameScheduler> previous = std::atomic_exchange(&context->scheduler, scheduler);
+        if (previous)
+            previous->stop();
+        context->stats.setFrameInterval(scheduler->getInterval());
+    END_CATCH
+}
+
+void Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_stopFrameScheduler(JNIEnv *env, jclass cls, jlong id) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return;
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        std::shared_ptr<UcgdFrameScheduler> previous = std::atomic_exchange(&context->scheduler, std::shared_ptr<UcgdFrameScheduler>());
+        if (previous)
+            previous->stop();
+        context->stats.setFrameInterval(0);
+    END_CATCH
+}
+
+//long id, int timeout
+jint Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_waitFrame(JNIEnv *env, jclass cls, jlong id, jint timeout) {
+    JNI_TRACE_ID(id);
+    if (!checkValidity(env, id))
+        return -1;
+    BEGIN_CATCH
+        const std::shared_ptr<ucgd_t> &context = getContext(id);
+        //keep the scheduler alive while blocked, stopFrameScheduler() releases the wait
+        std::shared_ptr<UcgdFrameScheduler> scheduler = std::atomic_load(&context->scheduler);
+        if (!scheduler)
+            return SCHEDULER_STOPPED;
+        int ticks = scheduler->wait(timeout);
+        if (ticks == SCHEDULER_TIMEOUT && g_SignalStatus)
+            throw SignalInterruptedException(g_SignalStatus, "waitFrame() : Interrupted while waiting for the next frame");
+        if (ticks > 1)
+            context->stats.addMissedDeadlines(static_cast<uint64_t>(ticks - 1));
+        return ticks;
+    END_CATCH
+    return -1;
 }
 
 #pragma clang diagnostic pop
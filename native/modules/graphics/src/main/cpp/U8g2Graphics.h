@@ -73,10 +73,10 @@ extern "C" {
 /*
  * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
  * Method:    setup
- * Signature: (Ljava/lang/String;III[ILjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/util/Map;ZLorg/slf4j/Logger;Ljava/lang/String;)J
+ * Signature: (Ljava/lang/String;III[ILjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;[BZLorg/slf4j/Logger;Ljava/lang/String;)J
  */
 JNIEXPORT jlong JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup
-  (JNIEnv *, jclass, jstring, jint, jint, jint, jintArray, jobject, jobject, jobject, jboolean, jobject, jstring);
+  (JNIEnv *, jclass, jstring, jint, jint, jint, jintArray, jobject, jobject, jbyteArray, jboolean, jobject, jstring);
 
 /*
  * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
@@ -638,6 +638,350 @@ JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPix
 JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixelsBgra
   (JNIEnv *, jclass, jlong, jint, jint, jint, jint, jbyteArray);
 
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    drawTextRuns
+ * Signature: (J[Ljava/lang/String;[I)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawTextRuns
+  (JNIEnv *, jclass, jlong, jobjectArray, jintArray);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    drawTextRunsDirect
+ * Signature: (JLjava/nio/ByteBuffer;I)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawTextRunsDirect
+  (JNIEnv *, jclass, jlong, jobject, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    blit
+ * Signature: (JIIIILjava/nio/ByteBuffer;I)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_blit
+  (JNIEnv *, jclass, jlong, jint, jint, jint, jint, jobject, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    drawPixelsBgraDirect
+ * Signature: (JIIIILjava/nio/ByteBuffer;I)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixelsBgraDirect
+  (JNIEnv *, jclass, jlong, jint, jint, jint, jint, jobject, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    setDitherMode
+ * Signature: (JII)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setDitherMode
+  (JNIEnv *, jclass, jlong, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    uploadSprite
+ * Signature: (J[BIII)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_uploadSprite
+  (JNIEnv *, jclass, jlong, jbyteArray, jint, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    drawSprite
+ * Signature: (JIII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawSprite
+  (JNIEnv *, jclass, jlong, jint, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    evictSprite
+ * Signature: (JI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_evictSprite
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    clearSprites
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearSprites
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    getExportSize
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getExportSize
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    exportBuffer
+ * Signature: (JILjava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportBuffer
+  (JNIEnv *, jclass, jlong, jint, jobject);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    startRecording
+ * Signature: (JLjava/lang/String;II)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_startRecording
+  (JNIEnv *, jclass, jlong, jstring, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    stopRecording
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_stopRecording
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    getRecordingInfo
+ * Signature: (Ljava/lang/String;)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getRecordingInfo
+  (JNIEnv *, jclass, jstring);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    readRecording
+ * Signature: (Ljava/lang/String;IILjava/nio/ByteBuffer;[J)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_readRecording
+  (JNIEnv *, jclass, jstring, jint, jint, jobject, jlongArray);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    getStatistics
+ * Signature: (J[J)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getStatistics
+  (JNIEnv *, jclass, jlong, jlongArray);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    resetStatistics
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_resetStatistics
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    setTraceEnabled
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setTraceEnabled
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    exportTrace
+ * Signature: (Ljava/lang/String;Z)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_exportTrace
+  (JNIEnv *, jclass, jstring, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    beginDisplayList
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_beginDisplayList
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    endDisplayList
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_endDisplayList
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    renderDisplayList
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_renderDisplayList
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    getEmulatorImage
+ * Signature: (J[BZ)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getEmulatorImage
+  (JNIEnv *, jclass, jlong, jbyteArray, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    getEmulatorStatistics
+ * Signature: (J[J)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getEmulatorStatistics
+  (JNIEnv *, jclass, jlong, jlongArray);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    scrollBuffer
+ * Signature: (JIIIIIIZ)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_scrollBuffer
+  (JNIEnv *, jclass, jlong, jint, jint, jint, jint, jint, jint, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    startHardwareScroll
+ * Signature: (JIIIII)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_startHardwareScroll
+  (JNIEnv *, jclass, jlong, jint, jint, jint, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    stopHardwareScroll
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_stopHardwareScroll
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    createLayer
+ * Signature: (JII)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_createLayer
+  (JNIEnv *, jclass, jlong, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    removeLayer
+ * Signature: (JI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_removeLayer
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    clearLayers
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearLayers
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    beginLayer
+ * Signature: (JI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_beginLayer
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    endLayer
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_endLayer
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    setLayerVisible
+ * Signature: (JIZ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerVisible
+  (JNIEnv *, jclass, jlong, jint, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    setLayerOffset
+ * Signature: (JIII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerOffset
+  (JNIEnv *, jclass, jlong, jint, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    setLayerZOrder
+ * Signature: (JII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerZOrder
+  (JNIEnv *, jclass, jlong, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    setLayerOp
+ * Signature: (JII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setLayerOp
+  (JNIEnv *, jclass, jlong, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    getDirtyArea
+ * Signature: (J)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getDirtyArea
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    createCanvas
+ * Signature: (II)J
+ */
+JNIEXPORT jlong JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_createCanvas
+  (JNIEnv *, jclass, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    destroyCanvas
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_destroyCanvas
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    blitCanvas
+ * Signature: (JJIIIIII)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_blitCanvas
+  (JNIEnv *, jclass, jlong, jlong, jint, jint, jint, jint, jint, jint);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    startFrameScheduler
+ * Signature: (JIZ)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_startFrameScheduler
+  (JNIEnv *, jclass, jlong, jint, jboolean);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    stopFrameScheduler
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_stopFrameScheduler
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics
+ * Method:    waitFrame
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_waitFrame
+  (JNIEnv *, jclass, jlong, jint);
+
 #ifdef __cplusplus
 }
 #endif
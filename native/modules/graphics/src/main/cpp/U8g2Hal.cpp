@@ -26,19 +26,38 @@
 #include <UcgdConfig.h>
 #include <U8g2Hal.h>
 #include <Common.h>
-
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
-
+#include <UcgdTrace.h>
 #include <ProviderManager.h>
 #include <UcgdSpiPeripheral.h>
 #include <UcgdI2CPeripheral.h>
 #include <UcgdGpioPeripheral.h>
 #include <system_error>
+#include <cstdlib>
+#include <mutex>
+#include <UcgdFontPack.h>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
 
+#ifdef UCGD_SETUP_PLUGINS
+#include <set>
+#include <UcgdSetupPlugin.h>
 #endif
 
 static u8g2_setup_func_map_t u8g2_setup_functions; //NOLINT
 static u8g2_lookup_font_map_t u8g2_font_map; //NOLINT
+static std::mutex font_pack_mutex; //NOLINT
+static std::string font_pack_path; //NOLINT
+static std::unique_ptr<UcgdFontPack> font_pack; //NOLINT
+static bool font_pack_opened = false;
+
+#ifdef UCGD_SETUP_PLUGINS
+static std::mutex setup_plugin_mutex; //NOLINT
+static u8g2_setup_index_map_t u8g2_setup_index; //NOLINT
+//controllers whose plugin has been opened (or failed to open)
+static std::set<std::string> setup_plugins_opened; //NOLINT
+#endif
 
 void initializeGpio(const std::shared_ptr<ucgd_t> &info, const std::shared_ptr<UcgdGpioPeripheral> &gpio);
 
@@ -52,9 +71,63 @@ bool tryGetAndInitProvider(const std::shared_ptr<ucgd_t> &context, const std::st
 void U8g2Hal_Init() {
     //Initialize lookup tables
     U8g2hal_InitSetupFunctions(u8g2_setup_functions);
+#ifdef UCGD_SETUP_PLUGINS
+    U8g2hal_InitSetupIndex(u8g2_setup_index);
+#endif
     U8g2hal_InitFonts(u8g2_font_map);
 }
 
+/**
+ * @return The directory of the library (with a trailing separator) or an empty string if it can not be determined
+ */
+static std::string getLibraryDir() {
+#if !defined(_WIN32)
+    Dl_info info{};
+    if (dladdr(reinterpret_cast<void *>(&U8g2Hal_Init), &info) != 0 && info.dli_fname != nullptr) {
+        std::string library(info.dli_fname);
+        size_t separator = library.find_last_of('/');
+        if (separator != std::string::npos)
+            return library.substr(0, separator + 1);
+    }
+#endif
+    return "";
+}
+
+#ifdef UCGD_SETUP_PLUGINS
+/**
+ * Open the plugin of a controller and add its setup procedures to the lookup table. The plugin is only opened once, it
+ * stays loaded for the life of the process since the u8g2 instances keep pointers to its drivers.
+ *
+ * @param controller The controller name
+ * @return true if the plugin was opened by this call
+ */
+static bool openSetupPlugin(const std::string &controller) {
+    if (!setup_plugins_opened.insert(controller).second)
+        return false;
+    const char *env = std::getenv(SETUP_PLUGIN_DIR_ENV);
+    std::string dir = (env != nullptr && *env != '\0') ? std::string(env) + "/" : getLibraryDir();
+    std::string path = dir + SETUP_PLUGIN_PREFIX + controller + SETUP_PLUGIN_SUFFIX;
+
+    void *handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        ServiceLocator::getInstance().getLogger().warn("U8g2Hal_GetSetupProc() : Unable to open controller plugin ({})", dlerror());
+        return false;
+    }
+    auto func = reinterpret_cast<ucgd_setup_plugin_func_t>(dlsym(handle, SETUP_PLUGIN_SYMBOL));
+    const ucgd_setup_plugin_t *plugin = (func != nullptr) ? func() : nullptr;
+    if (plugin == nullptr || plugin->abi != SETUP_PLUGIN_ABI) {
+        ServiceLocator::getInstance().getLogger().warn("U8g2Hal_GetSetupProc() : '{}' is not a compatible controller plugin", path);
+        dlclose(handle);
+        return false;
+    }
+    size_t count = 0;
+    for (auto entry = plugin->entries; entry->name != nullptr; entry++, count++)
+        u8g2_setup_functions[entry->name] = entry->proc;
+    ServiceLocator::getInstance().getLogger().debug("U8g2Hal_GetSetupProc() : Opened controller plugin '{}' ({} setup procedures)", path, count);
+    return true;
+}
+#endif
+
 /**
  * Returns the u8g2 setup callback function based on the provided name
  *
@@ -62,47 +135,134 @@ void U8g2Hal_Init() {
  * @return The setup callback function
  */
 u8g2_setup_func_t &U8g2Hal_GetSetupProc(const std::string &function_name) {
-    if (u8g2_setup_functions.empty())
-        throw SetupProcNotFoundException(std::string("U8g2hal_GetSetupProc : Could not find setup procedure '") + function_name + std::string("'"));
+#ifdef UCGD_SETUP_PLUGINS
+    //the table grows when a plugin is opened, its entries are never removed
+    std::lock_guard<std::mutex> lock(setup_plugin_mutex);
+#endif
     auto it = u8g2_setup_functions.find(function_name);
     if (it != u8g2_setup_functions.end()) {
         return it->second;
     }
+#ifdef UCGD_SETUP_PLUGINS
+    auto controller = u8g2_setup_index.find(function_name);
+    if (controller != u8g2_setup_index.end() && openSetupPlugin(controller->second)) {
+        it = u8g2_setup_functions.find(function_name);
+        if (it != u8g2_setup_functions.end())
+            return it->second;
+    }
+#endif
     throw SetupProcNotFoundException(std::string("U8g2hal_GetSetupProc : Could not find setup procedure '") + function_name + std::string("'"));
 }
 
 /**
- * Retrieve the font data based on the provided argument
+ * Resolve the location of the font pack: the configured path, the environment variable or the file next to the library
+ */
+static std::string resolveFontPackPath() {
+    if (!font_pack_path.empty())
+        return font_pack_path;
+    const char *env = std::getenv(FONT_PACK_ENV);
+    if (env != nullptr && *env != '\0')
+        return env;
+    return getLibraryDir() + FONT_PACK_FILE;
+}
+
+/**
+ * Set the font pack used for fonts that are not embedded in the library. Only honoured before the pack is first opened.
+ *
+ * @param path The path of the font pack
+ */
+void U8g2Hal_SetFontPack(const std::string &path) {
+    std::lock_guard<std::mutex> lock(font_pack_mutex);
+    if (font_pack_opened) {
+        if (path != font_pack_path)
+            ServiceLocator::getInstance().getLogger().warn("U8g2Hal_SetFontPack() : Font pack is already open, ignoring '{}'", path);
+        return;
+    }
+    font_pack_path = path;
+}
+
+/**
+ * Retrieve the font data based on the provided argument. The embedded fonts are searched first, then the font pack
+ * which is mapped on the first lookup that misses the embedded fonts.
+ *
  * @param font_name The u8g2 font name
  * @return Buffer containing the actual font data
  */
 uint8_t *U8g2hal_GetFontByName(const std::string &font_name) {
-    if (u8g2_font_map.empty())
-        return nullptr;
     auto it = u8g2_font_map.find(font_name);
     if (it != u8g2_font_map.end()) {
         return const_cast<uint8_t *>(it->second);
     }
-    return nullptr;
+    std::lock_guard<std::mutex> lock(font_pack_mutex);
+    if (!font_pack_opened) {
+        //the pack stays mapped for the life of the process, the u8g2 instances keep pointers into it
+        font_pack_opened = true;
+        font_pack_path = resolveFontPackPath();
+        try {
+            font_pack = std::make_unique<UcgdFontPack>(font_pack_path);
+            ServiceLocator::getInstance().getLogger().debug("U8g2hal_GetFontByName() : Mapped font pack '{}' ({} fonts)", font_pack_path, font_pack->getCount());
+        } catch (std::runtime_error &e) {
+            ServiceLocator::getInstance().getLogger().warn("U8g2hal_GetFontByName() : {}", e.what());
+        }
+    }
+    if (font_pack == nullptr)
+        return nullptr;
+    return const_cast<uint8_t *>(font_pack->find(font_name));
 }
 
 #if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
+#define hal_usleep(usec) usleep(usec)
+#else
+//Controller delays are only honoured on the device, the simulated provider models the bus timing instead
+#define hal_usleep(usec) ((void) (usec))
+#endif
 
 /**
- * 4-wire SPI Hardware Callback Routine (ARM)
+ * Default provider of the device, records a transport error if it is no longer available
  */
-uint8_t cb_byte_spi_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+static std::shared_ptr<UcgdProvider> findProvider(const std::shared_ptr<ucgd_t> &info) noexcept {
+    std::shared_ptr<UcgdProvider> provider = info->getProvider().lock();
+    if (!provider)
+        info->transport.fail(TRANSPORT_ERR_PROVIDER, "Provider no longer available");
+    return provider;
+}
+
+/**
+ * Runs the init message of a callback, errors are recorded so nothing is thrown through the u8x8 frames
+ */
+template<typename F>
+static uint8_t initTransport(const std::shared_ptr<ucgd_t> &info, const char *name, F &&init) noexcept {
+    try {
+        init();
+        return 1;
+    } catch (std::exception &e) {
+        info->transport.fail(TRANSPORT_ERR_INIT, "%s : %s", name, e.what());
+    } catch (...) {
+        info->transport.fail(TRANSPORT_ERR_INIT, "%s : Unknown error", name);
+    }
+    return 0;
+}
 
-    const std::shared_ptr<UcgdSpiPeripheral>& spi = info->getDefaultProvider()->getSpiProvider();
+/**
+ * 4-wire SPI Hardware Callback Routine
+ */
+uint8_t cb_byte_spi_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    if (msg == U8X8_MSG_BYTE_INIT) {
+        return initTransport(info, "spi.open", [&info]() {
+            info->getDefaultProvider()->getSpiProvider()->open(info);
+        });
+    }
+    std::shared_ptr<UcgdProvider> provider = findProvider(info);
+    if (!provider)
+        return 0;
+    const std::shared_ptr<UcgdSpiPeripheral> &spi = provider->getSpiProvider();
 
     switch (msg) {
-        case U8X8_MSG_BYTE_INIT: {
-            spi->open(info);
-            break;
-        }
         case U8X8_MSG_BYTE_SEND: {
+            UCGD_TRACE_SCOPE_ARG("hal", "spi_send", "bytes", arg_int);
             auto *buf = (uint8_t *) arg_ptr;
-            spi->write(info, buf, arg_int);
+            if (!info->transport.run([&]() { return spi->write(info, buf, arg_int); }))
+                return 0;
             break;
         }
         case U8X8_MSG_BYTE_START_TRANSFER: {
@@ -125,20 +285,25 @@ uint8_t cb_byte_spi_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_
 }
 
 /**
- * I2C Hardware Callback Routine (ARM)
+ * I2C Hardware Callback Routine
  */
 uint8_t cb_byte_i2c_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
-    uint8_t *data;
-    const std::shared_ptr<UcgdI2CPeripheral> &i2c = info->getDefaultProvider()->getI2CProvider();
+    if (msg == U8X8_MSG_BYTE_INIT) {
+        return initTransport(info, "i2c.open", [&info]() {
+            info->getDefaultProvider()->getI2CProvider()->open(info);
+        });
+    }
+    std::shared_ptr<UcgdProvider> provider = findProvider(info);
+    if (!provider)
+        return 0;
+    const std::shared_ptr<UcgdI2CPeripheral> &i2c = provider->getI2CProvider();
 
     switch (msg) {
-        case U8X8_MSG_BYTE_INIT: {
-            i2c->open(info);
-            break;
-        }
         case U8X8_MSG_BYTE_SEND: {
-            data = (uint8_t *) arg_ptr;
-            i2c->write(info, u8x8_GetI2CAddress(u8x8), (uint8_t *) arg_ptr, arg_int);
+            UCGD_TRACE_SCOPE_ARG("hal", "i2c_send", "bytes", arg_int);
+            auto *data = (uint8_t *) arg_ptr;
+            if (!info->transport.run([&]() { return i2c->write(info, u8x8_GetI2CAddress(u8x8), data, arg_int); }))
+                return 0;
             break;
         }
         case U8X8_MSG_BYTE_START_TRANSFER: {
@@ -154,98 +319,114 @@ uint8_t cb_byte_i2c_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_
 }
 
 /**
- * GPIO and Delay Procedure Routine (ARM)
+ * Write a pin with the retry policy of the device
+ */
+static inline void writePin(const std::shared_ptr<ucgd_t> &info, const std::shared_ptr<UcgdGpioPeripheral> &gpio, int pin, uint8_t value) {
+    info->transport.run([&]() { return gpio->write(info, pin, value); });
+}
+
+/**
+ * GPIO and Delay Procedure Routine
 */
 uint8_t cb_gpio_delay(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, U8X8_UNUSED void *arg_ptr) {
-    std::shared_ptr<UcgdGpioPeripheral>& gpio = info->getDefaultProvider()->getGpioProvider();
+    if (msg == U8X8_MSG_GPIO_AND_DELAY_INIT) {
+        return initTransport(info, "gpio.init", [&info]() {
+            initializeGpio(info, info->getDefaultProvider()->getGpioProvider());
+        });
+    }
+    std::shared_ptr<UcgdProvider> provider = findProvider(info);
+    if (!provider)
+        return 0;
+    const std::shared_ptr<UcgdGpioPeripheral> &gpio = provider->getGpioProvider();
 
     switch (msg) {
-        case U8X8_MSG_GPIO_AND_DELAY_INIT: {
-            initializeGpio(info, gpio);
-            break;
-        }
         case U8X8_MSG_DELAY_NANO: {                     // delay arg_int * 1 nano second
-            usleep(arg_int == 0 ? 0 : 1);
+            UCGD_TRACE_SCOPE_ARG("hal", "delay_nano", "arg", arg_int);
+            hal_usleep(arg_int == 0 ? 0 : 1);
             break;
         }
         case U8X8_MSG_DELAY_100NANO: {                  // delay arg_int * 100 nano seconds
-            usleep(arg_int == 0 ? 0 : 1);
+            UCGD_TRACE_SCOPE_ARG("hal", "delay_100nano", "arg", arg_int);
+            hal_usleep(arg_int == 0 ? 0 : 1);
             break;
         }
         case U8X8_MSG_DELAY_10MICRO: {                  // delay arg_int * 10 micro seconds
-            usleep(arg_int * 10);
+            UCGD_TRACE_SCOPE_ARG("hal", "delay_10micro", "arg", arg_int);
+            hal_usleep(arg_int * 10);
             break;
         }
         case U8X8_MSG_DELAY_MILLI: {                    // delay arg_int * 1 milli second
-            usleep(arg_int * 1000);
+            UCGD_TRACE_SCOPE_ARG("hal", "delay_milli", "arg", arg_int);
+            hal_usleep(arg_int * 1000);
             break;
         }
         case U8X8_MSG_DELAY_I2C: {                      // arg_int is the I2C speed in 100KHz, e.g. 4 = 400 KHz
-            usleep(arg_int);                            // arg_int=1: delay by 5us, arg_int = 4: delay by 1.25us
+            UCGD_TRACE_SCOPE_ARG("hal", "delay_i2c", "arg", arg_int);
+            hal_usleep(arg_int);                        // arg_int=1: delay by 5us, arg_int = 4: delay by 1.25us
             break;
         }
         case U8X8_MSG_GPIO_D0: {                        // D0 or SPI clock pin: Output level in arg_int (U8X8_MSG_GPIO_SPI_CLOCK)
-            gpio->write(info->pin_map.d0, arg_int);
+            writePin(info, gpio, info->pin_map.d0, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D1: {                        // D1 or SPI data pin: Output level in arg_int (U8X8_MSG_GPIO_SPI_DATA)
-            gpio->write(info->pin_map.d1, arg_int);
+            writePin(info, gpio, info->pin_map.d1, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D2: {                        // D2 pin: Output level in arg_int
-            gpio->write(info->pin_map.d2, arg_int);
+            writePin(info, gpio, info->pin_map.d2, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D3: {                        // D3 pin: Output level in arg_int
-            gpio->write(info->pin_map.d3, arg_int);
+            writePin(info, gpio, info->pin_map.d3, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D4: {                        // D4 pin: Output level in arg_int
-            gpio->write(info->pin_map.d4, arg_int);
+            writePin(info, gpio, info->pin_map.d4, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D5: {                        // D5 pin: Output level in arg_int
-            gpio->write(info->pin_map.d5, arg_int);
+            writePin(info, gpio, info->pin_map.d5, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D6: {                        // D6 pin: Output level in arg_int
-            gpio->write(info->pin_map.d6, arg_int);
+            writePin(info, gpio, info->pin_map.d6, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D7: {                        // D7 pin: Output level in arg_int
-            gpio->write(info->pin_map.d7, arg_int);
+            writePin(info, gpio, info->pin_map.d7, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_E: {                         // E/WR pin: Output level in arg_int
-            gpio->write(info->pin_map.en, arg_int);
+            writePin(info, gpio, info->pin_map.en, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_CS: {                        // CS (chip select) pin: Output level in arg_int
-            gpio->write(info->pin_map.cs, arg_int);
+            writePin(info, gpio, info->pin_map.cs, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_DC: {                        // DC (data/cmd, A0, register select) pin: Output level in arg_int
-            gpio->write(info->pin_map.dc, arg_int);
+            writePin(info, gpio, info->pin_map.dc, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_RESET: {                     // Reset pin: Output level in arg_int
-            gpio->write(info->pin_map.reset, arg_int);
+            writePin(info, gpio, info->pin_map.reset, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_CS1: {                       // CS1 (chip select) pin: Output level in arg_int
-            gpio->write(info->pin_map.cs1, arg_int);
+            writePin(info, gpio, info->pin_map.cs1, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_CS2: {                       // CS2 (chip select) pin: Output level in arg_int
-            gpio->write(info->pin_map.cs2, arg_int);
+            writePin(info, gpio, info->pin_map.cs2, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_I2C_CLOCK: {                 // arg_int=0: Output low at I2C clock pin
-            gpio->write(info->pin_map.scl, arg_int);
+            writePin(info, gpio, info->pin_map.scl, arg_int);
             break;                                      // arg_int=1: Input dir with pullup high for I2C clock pin
         }
         case U8X8_MSG_GPIO_I2C_DATA: {                  // arg_int=0: Output low at I2C data pin
-            gpio->write(info->pin_map.sda, arg_int);
+            writePin(info, gpio, info->pin_map.sda, arg_int);
             break;                                      // arg_int=1: Input dir with pullup high for I2C data pin
         }
         default: {
@@ -312,7 +493,8 @@ void initializeGpio(const std::shared_ptr<ucgd_t> &info, const std::shared_ptr<U
             try {
                 //Check which hardware peripheral device we need to configure
                 if (comm_int == COMINT_3WSPI || comm_int == COMINT_4WSPI || comm_int == COMINT_ST7920SPI) {
-                    int spi_bus_number = info->getOptionInt(OPT_SPI_BUS);
+                    info->settings.require(OPTION_SPI_BUS);
+                    int spi_bus_number = info->settings.spi_bus_number;
                     if (spi_bus_number == SPI_PERIPHERAL_MAIN) {
                         pigpioGpio->init(info, SPI_RPI_PIN_MAIN_MISO, UcgdGpioPeripheral::GpioMode::MODE_ALT0); //MISO
                         pigpioGpio->init(info, SPI_RPI_PIN_MAIN_MOSI, UcgdGpioPeripheral::GpioMode::MODE_ALT0); //MOSI
@@ -425,125 +607,6 @@ bool tryGetAndInitProvider(const std::shared_ptr<ucgd_t> &context, const std::st
     return true;
 }
 
-#else
-
-/**
- * SPI Callback Routine (virtual mode)
- */
-uint8_t cb_byte_spi_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
-    return cb_byte_4wire_sw_spi(info, u8x8, msg, arg_int, arg_ptr);
-}
-
-/**
- * HW I2C Wrapper. Uses software bit-bang implementation (virtual mode)
- */
-uint8_t cb_byte_i2c_hw(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
-    return cb_byte_sw_i2c(info, u8x8, msg, arg_int, arg_ptr);
-}
-
-/**
- * GPIO and Delay Routine (virtual mode)
- */
-uint8_t cb_gpio_delay(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, U8X8_UNUSED void *arg_ptr) {
-    switch (msg) {
-        case U8X8_MSG_GPIO_AND_DELAY_INIT: { // called once during init phase of u8g2/u8x8, can be used to setup pins
-            //cout << "U8X8_MSG_GPIO_AND_DELAY_INIT" << endl;
-            break;
-        }
-        case U8X8_MSG_DELAY_NANO: { // delay arg_int * 1 nano second
-            //cout << "U8X8_MSG_DELAY_NANO" << endl;
-            break;
-        }
-        case U8X8_MSG_DELAY_100NANO: {       // delay arg_int * 100 nano seconds
-            //cout << "U8X8_MSG_DELAY_100NANO" << endl;
-            break;
-        }
-        case U8X8_MSG_DELAY_10MICRO: {       // delay arg_int * 10 micro seconds
-            //cout << "U8X8_MSG_DELAY_10MICRO" << endl;
-            break;
-        }
-        case U8X8_MSG_DELAY_MILLI: {           // delay arg_int * 1 milli second
-            //cout << "U8X8_MSG_DELAY_MILLI" << endl;
-            break;
-        }
-        case U8X8_MSG_DELAY_I2C: {                                  // arg_int is the I2C speed in 100KHz, e.g. 4 = 400 KHz
-            //cout << "U8X8_MSG_DELAY_I2C" << endl;          // arg_int=1: delay by 5us, arg_int = 4: delay by 1.25us
-            break;
-        }
-        case U8X8_MSG_GPIO_D0: {                // D0 or SPI clock pin: Output level in arg_int (U8X8_MSG_GPIO_SPI_CLOCK)
-            //cout << "U8X8_MSG_GPIO_D0" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D1: {                // D1 or SPI data pin: Output level in arg_int (U8X8_MSG_GPIO_SPI_DATA)
-            //cout << "\t- [Bit]: " << to_string(arg_int) << flush << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D2: {                // D2 pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_D2" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D3: {                // D3 pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_D3" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D4: {                // D4 pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_D4" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D5: {                // D5 pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_D5" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D6: {                // D6 pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_D6" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_D7: {                // D7 pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_D7" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_E: {               // E/WR pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_E" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_CS: {                // CS (chip select) pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_CS" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_DC: {                // DC (data/cmd, A0, register select) pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_DC" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_RESET: {            // Reset pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_RESET" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_CS1: {                // CS1 (chip select) pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_CS1" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_CS2: {                // CS2 (chip select) pin: Output level in arg_int
-            //cout << "U8X8_MSG_GPIO_CS2" << endl;
-            break;
-        }
-        case U8X8_MSG_GPIO_I2C_CLOCK: {        // arg_int=0: Output low at I2C clock pin
-            //cout << "U8X8_MSG_GPIO_I2C_CLOCK" << endl;
-            break;                            // arg_int=1: Input dir with pullup high for I2C clock pin
-        }
-        case U8X8_MSG_GPIO_I2C_DATA: {           // arg_int=0: Output low at I2C data pin
-            //cout << "U8X8_MSG_GPIO_I2C_DATA" << endl;
-            break;                            // arg_int=1: Input dir with pullup high for I2C data pin
-        }
-        default: {
-            //u8x8_SetGPIOResult(u8x8, 1);            // default return value
-            break;
-        }
-    }
-
-    return 1;
-}
-
-#endif
 
 /*
  * ============================================================================================================
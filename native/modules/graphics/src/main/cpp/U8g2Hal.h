@@ -110,6 +110,11 @@ void U8g2Hal_Init();
  */
 void U8g2hal_InitSetupFunctions(u8g2_setup_func_map_t &setup_map);
 
+/**
+ * Initialize the index of setup procedures to controller plugins (UCGD_SETUP_PLUGINS)
+ */
+void U8g2hal_InitSetupIndex(u8g2_setup_index_map_t &index_map);
+
 /**
  * Initialize u8g2 font lookup table
  */
@@ -121,6 +126,7 @@ void U8g2hal_InitFonts(u8g2_lookup_font_map_t &font_map);
  * @param function_name The u8g2 setup procedure name
  * @return The function callback if found, otherwise null if not found
  * @throws SetupProcNotFoundException if procedure is not found
+ * @note With UCGD_SETUP_PLUGINS, the plugin of the controller is opened on the first lookup of one of its procedures
  */
 u8g2_setup_func_t& U8g2Hal_GetSetupProc(const std::string &function_name);
 
@@ -131,6 +137,12 @@ u8g2_setup_func_t& U8g2Hal_GetSetupProc(const std::string &function_name);
  */
 uint8_t *U8g2hal_GetFontByName(const std::string &font_name);
 
+/**
+ * Set the path of the font pack holding the fonts that are not embedded in the library
+ * @param path The path of the font pack file
+ */
+void U8g2Hal_SetFontPack(const std::string &path);
+
 #if !((defined(__arm__) || defined(__aarch64__)) && defined(__linux__))
 
 //Note: The following i2c_* code snippets was copied from the U8G2 source. Credits to olikarus for this.
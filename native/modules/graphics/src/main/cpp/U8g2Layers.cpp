@@ -0,0 +1,388 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <algorithm>
+#include <cstring>
+#include "U8g2Layers.h"
+
+namespace {
+    constexpr uint64_t LANES = 0x0101010101010101ULL;
+
+    //shift each of the 8 byte lanes of the word, bits do not cross lanes
+    inline uint64_t laneShl(uint64_t v, int r) {
+        return (v << r) & (LANES * ((0xffU << r) & 0xffU));
+    }
+
+    inline uint64_t laneShr(uint64_t v, int r) {
+        return (v >> r) & (LANES * (0xffU >> r));
+    }
+
+    inline uint64_t load64(const uint8_t *p) {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    //the 8 bytes as one msb first bit stream (byte 0 in the most significant byte)
+    inline uint64_t loadBE64(const uint8_t *p) {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; i++)
+            v = (v << 8) | p[i];
+        return v;
+    }
+
+    inline void storeBE64(uint8_t *p, uint64_t v) {
+        for (int i = 7; i >= 0; i--) {
+            p[i] = static_cast<uint8_t>(v);
+            v >>= 8;
+        }
+    }
+
+    inline int floorDiv8(int v) {
+        return (v >= 0) ? v / 8 : -((7 - v) / 8);
+    }
+
+    template<int OP, typename T>
+    inline T apply(T dst, T src) {
+        if (OP == LAYER_OP_OR)
+            return dst | src;
+        if (OP == LAYER_OP_MASK)
+            return dst & ~src;
+        return dst ^ src;
+    }
+
+    /**
+     * vertical_top_lsb: a page is one byte per column (bit 0 = top row). A vertical offset shifts the bits of each byte
+     * and carries the bits of the page above, a horizontal offset moves whole bytes.
+     */
+    template<int OP>
+    void blendVertical(uint8_t *buffer, const uint8_t *layer, int tileWidth, int tileHeight, int dx, int dy) {
+        const int width = tileWidth * 8;
+        const int q = floorDiv8(dy);
+        const int s = dy - q * 8;
+        const int c0 = std::max(0, dx), c1 = std::min(width, width + dx);
+        if (c0 >= c1)
+            return;
+        for (int page = 0; page < tileHeight; page++) {
+            //bits of page a move down by s, the bits of the page above it carry into the top
+            int a = page - q, b = a - 1;
+            const uint8_t *source = (a >= 0 && a < tileHeight) ? layer + static_cast<size_t>(a) * width : nullptr;
+            const uint8_t *above = (s != 0 && b >= 0 && b < tileHeight) ? layer + static_cast<size_t>(b) * width : nullptr;
+            if (source == nullptr && above == nullptr)
+                continue;
+            uint8_t *dst = buffer + static_cast<size_t>(page) * width;
+            int c = c0;
+            for (; c + 8 <= c1; c += 8) {
+                uint64_t v = 0;
+                if (source != nullptr)
+                    v = laneShl(load64(source + c - dx), s);
+                if (above != nullptr)
+                    v |= laneShr(load64(above + c - dx), 8 - s);
+                uint64_t d = load64(dst + c);
+                d = apply<OP>(d, v);
+                memcpy(dst + c, &d, sizeof(d));
+            }
+            for (; c < c1; c++) {
+                unsigned v = 0;
+                if (source != nullptr)
+                    v = (source[c - dx] << s) & 0xffU;
+                if (above != nullptr)
+                    v |= above[c - dx] >> (8 - s);
+                dst[c] = static_cast<uint8_t>(apply<OP>(static_cast<unsigned>(dst[c]), v));
+            }
+        }
+    }
+
+    /**
+     * horizontal_right_lsb: a row is one byte per 8 columns (msb = leftmost pixel). A horizontal offset shifts the row
+     * as one bit stream (64 bits at a time from a zero padded copy of the row), a vertical offset moves whole rows.
+     */
+    template<int OP>
+    void blendHorizontal(uint8_t *buffer, const uint8_t *layer, int tileWidth, int tileHeight, int dx, int dy) {
+        const int rowBytes = tileWidth;
+        const int rows = tileHeight * 8;
+        const int k = floorDiv8(dx);
+        const int s = dx - k * 8;
+        const int j0 = std::max(0, k), j1 = std::min(rowBytes, rowBytes + k + (s != 0 ? 1 : 0));
+        const int r0 = std::max(0, dy), r1 = std::min(rows, rows + dy);
+        if (j0 >= j1 || r0 >= r1)
+            return;
+        std::vector<uint8_t> line(static_cast<size_t>(rowBytes) + 16, 0);
+        uint8_t *data = line.data() + 8;
+        for (int r = r0; r < r1; r++) {
+            memcpy(data, layer + static_cast<size_t>(r - dy) * rowBytes, rowBytes);
+            uint8_t *dst = buffer + static_cast<size_t>(r) * rowBytes;
+            int j = j0;
+            for (; j + 8 <= j1; j += 8) {
+                const uint8_t *p = data + j - k;
+                uint64_t v = loadBE64(p);
+                if (s != 0)
+                    v = (v >> s) | (static_cast<uint64_t>(p[-1]) << (64 - s));
+                storeBE64(dst + j, apply<OP>(loadBE64(dst + j), v));
+            }
+            for (; j < j1; j++) {
+                const uint8_t *p = data + j - k;
+                unsigned v = p[0] >> s;
+                if (s != 0)
+                    v |= (p[-1] << (8 - s)) & 0xffU;
+                dst[j] = static_cast<uint8_t>(apply<OP>(static_cast<unsigned>(dst[j]), v));
+            }
+        }
+    }
+
+    template<int OP>
+    void blendLayout(uint8_t *buffer, const uint8_t *layer, int tileWidth, int tileHeight, bool vertical, int dx, int dy) {
+        if (vertical)
+            blendVertical<OP>(buffer, layer, tileWidth, tileHeight, dx, dy);
+        else
+            blendHorizontal<OP>(buffer, layer, tileWidth, tileHeight, dx, dy);
+    }
+}
+
+auto U8g2Layers::isSupported(u8g2_t *u8g2) -> bool {
+    if (u8g2->tile_buf_ptr == nullptr)
+        return false;
+    if (u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb && u8g2->ll_hvline != u8g2_ll_hvline_horizontal_right_lsb)
+        return false;
+    //the canvas of a rotated display (U8g2Rotator) can have more tile rows than the display
+    return u8g2->tile_buf_height >= u8g2_GetU8x8(u8g2)->display_info->tile_height;
+}
+
+auto U8g2Layers::create(u8g2_t *u8g2, int z, int op) -> uint32_t {
+    fit(u8g2);
+    uint32_t handle = m_NextHandle++;
+    layer_t &layer = m_Layers[handle];
+    layer.z = z;
+    layer.op = op;
+    layer.visible = true;
+    layer.x = 0;
+    layer.y = 0;
+    layer.pixels.assign(static_cast<size_t>(m_TileWidth) * m_TileHeight * 8, 0);
+    return handle;
+}
+
+auto U8g2Layers::remove(u8g2_t *u8g2, uint32_t handle) -> bool {
+    auto it = m_Layers.find(handle);
+    if (it == m_Layers.end())
+        return false;
+    if (m_Drawing == handle)
+        end(u8g2);
+    m_Layers.erase(it);
+    if (m_Layers.empty())
+        invalidate();
+    return true;
+}
+
+auto U8g2Layers::clear(u8g2_t *u8g2) -> void {
+    end(u8g2);
+    m_Layers.clear();
+    invalidate();
+}
+
+auto U8g2Layers::begin(u8g2_t *u8g2, uint32_t handle) -> bool {
+    if (m_Layers.find(handle) == m_Layers.end())
+        return false;
+    end(u8g2);
+    fit(u8g2);
+    m_Saved = u8g2->tile_buf_ptr;
+    u8g2->tile_buf_ptr = m_Layers[handle].pixels.data();
+    m_Drawing = handle;
+    return true;
+}
+
+auto U8g2Layers::end(u8g2_t *u8g2) -> void {
+    if (m_Drawing == 0)
+        return;
+    u8g2->tile_buf_ptr = m_Saved;
+    m_Saved = nullptr;
+    m_Drawing = 0;
+}
+
+auto U8g2Layers::isDrawing() const -> bool {
+    return m_Drawing != 0;
+}
+
+auto U8g2Layers::setVisible(uint32_t handle, bool visible) -> bool {
+    auto it = m_Layers.find(handle);
+    if (it == m_Layers.end())
+        return false;
+    it->second.visible = visible;
+    return true;
+}
+
+auto U8g2Layers::setOffset(uint32_t handle, int x, int y) -> bool {
+    auto it = m_Layers.find(handle);
+    if (it == m_Layers.end())
+        return false;
+    it->second.x = x;
+    it->second.y = y;
+    return true;
+}
+
+auto U8g2Layers::setZOrder(uint32_t handle, int z) -> bool {
+    auto it = m_Layers.find(handle);
+    if (it == m_Layers.end())
+        return false;
+    it->second.z = z;
+    return true;
+}
+
+auto U8g2Layers::setOp(uint32_t handle, int op) -> bool {
+    auto it = m_Layers.find(handle);
+    if (it == m_Layers.end())
+        return false;
+    it->second.op = op;
+    return true;
+}
+
+auto U8g2Layers::contains(uint32_t handle) const -> bool {
+    return m_Layers.find(handle) != m_Layers.end();
+}
+
+auto U8g2Layers::getCount() const -> size_t {
+    return m_Layers.size();
+}
+
+auto U8g2Layers::composite(u8g2_t *u8g2) -> void {
+    end(u8g2);
+    fit(u8g2);
+    uint8_t *buffer = u8g2->tile_buf_ptr;
+    bool vertical = u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb;
+
+    std::vector<const layer_t *> order;
+    order.reserve(m_Layers.size());
+    for (const auto &entry : m_Layers) {
+        if (entry.second.visible)
+            order.push_back(&entry.second);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const layer_t *a, const layer_t *b) {
+        return a->z < b->z;
+    });
+
+    //map the offset to buffer coordinates (same transformations as the u8g2_draw_l90_* callbacks)
+    const u8g2_cb_t *cb = u8g2->cb;
+    for (const layer_t *layer : order) {
+        int bx = layer->x, by = layer->y;
+        if (cb->draw_l90 == u8g2_draw_l90_r0) {
+            //unrotated (or the canvas of U8g2Rotator)
+        } else if (cb == U8G2_R1) {
+            bx = -layer->y;
+            by = layer->x;
+        } else if (cb == U8G2_R2) {
+            bx = -layer->x;
+            by = -layer->y;
+        } else if (cb == U8G2_R3) {
+            bx = layer->y;
+            by = -layer->x;
+        } else if (cb == U8G2_MIRROR) {
+            bx = -layer->x;
+        }
+        blend(buffer, layer->pixels.data(), m_TileWidth, m_TileHeight, vertical, layer->op, bx, by);
+    }
+
+    size_t size = static_cast<size_t>(m_TileWidth) * m_TileHeight * 8;
+    if (m_Previous.size() != size) {
+        m_Dirty = {0, 0, m_TileWidth, m_TileHeight};
+        m_Previous.assign(buffer, buffer + size);
+    } else {
+        m_Dirty = diff(m_Previous.data(), buffer, m_TileWidth, m_TileHeight, vertical);
+        if (m_Dirty.width > 0)
+            memcpy(m_Previous.data(), buffer, size);
+    }
+}
+
+auto U8g2Layers::getDirtyArea() const -> const ucgd_tile_area_t & {
+    return m_Dirty;
+}
+
+auto U8g2Layers::invalidate() -> void {
+    m_Previous.clear();
+}
+
+auto U8g2Layers::fit(u8g2_t *u8g2) -> void {
+    int tileWidth = u8g2_GetBufferTileWidth(u8g2);
+    int tileHeight = u8g2->tile_buf_height;
+    if (tileWidth == m_TileWidth && tileHeight == m_TileHeight)
+        return;
+    m_TileWidth = tileWidth;
+    m_TileHeight = tileHeight;
+    for (auto &entry : m_Layers)
+        entry.second.pixels.assign(static_cast<size_t>(tileWidth) * tileHeight * 8, 0);
+    invalidate();
+}
+
+auto U8g2Layers::blend(uint8_t *buffer, const uint8_t *layer, int tileWidth, int tileHeight, bool vertical, int op, int dx, int dy) -> void {
+    switch (op) {
+        case LAYER_OP_MASK:
+            blendLayout<LAYER_OP_MASK>(buffer, layer, tileWidth, tileHeight, vertical, dx, dy);
+            break;
+        case LAYER_OP_XOR:
+            blendLayout<LAYER_OP_XOR>(buffer, layer, tileWidth, tileHeight, vertical, dx, dy);
+            break;
+        default:
+            blendLayout<LAYER_OP_OR>(buffer, layer, tileWidth, tileHeight, vertical, dx, dy);
+            break;
+    }
+}
+
+auto U8g2Layers::diff(const uint8_t *a, const uint8_t *b, int tileWidth, int tileHeight, bool vertical) -> ucgd_tile_area_t {
+    int x0 = tileWidth, y0 = tileHeight, x1 = -1, y1 = -1;
+    if (vertical) {
+        //one 64-bit word per tile (8 columns of a page)
+        for (int ty = 0; ty < tileHeight; ty++) {
+            const uint8_t *pa = a + static_cast<size_t>(ty) * tileWidth * 8;
+            const uint8_t *pb = b + static_cast<size_t>(ty) * tileWidth * 8;
+            for (int tx = 0; tx < tileWidth; tx++) {
+                if (load64(pa + tx * 8) != load64(pb + tx * 8)) {
+                    x0 = std::min(x0, tx);
+                    x1 = std::max(x1, tx);
+                    y0 = std::min(y0, ty);
+                    y1 = ty;
+                }
+            }
+        }
+    } else {
+        //one byte per tile and row, compare the rows 64 bits at a time and narrow down to the first and last byte
+        for (int row = 0; row < tileHeight * 8; row++) {
+            const uint8_t *pa = a + static_cast<size_t>(row) * tileWidth;
+            const uint8_t *pb = b + static_cast<size_t>(row) * tileWidth;
+            int first = 0;
+            while (first + 8 <= tileWidth && load64(pa + first) == load64(pb + first))
+                first += 8;
+            while (first < tileWidth && pa[first] == pb[first])
+                first++;
+            if (first == tileWidth)
+                continue;
+            int last = tileWidth;
+            while (last - 8 > first && load64(pa + last - 8) == load64(pb + last - 8))
+                last -= 8;
+            while (pa[last - 1] == pb[last - 1])
+                last--;
+            x0 = std::min(x0, first);
+            x1 = std::max(x1, last - 1);
+            y0 = std::min(y0, row / 8);
+            y1 = row / 8;
+        }
+    }
+    if (x1 < 0)
+        return {0, 0, 0, 0};
+    return {x0, y0, x1 - x0 + 1, y1 - y0 + 1};
+}
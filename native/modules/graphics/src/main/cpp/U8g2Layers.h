@@ -0,0 +1,173 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2LAYERS_H
+#define UCGD_MOD_GRAPHICS_U8G2LAYERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//Blend operations of a layer
+#define LAYER_OP_OR 0   //set the pixels of the layer
+#define LAYER_OP_MASK 1 //clear the pixels of the layer (AND-NOT)
+#define LAYER_OP_XOR 2  //invert the pixels of the layer
+
+//Area in tiles (8x8 pixels) of the buffer, a width or height of 0 is an empty area
+struct ucgd_tile_area_t {
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+/**
+ * Per-display offscreen 1bpp layers composited into the buffer of the display before it is sent.
+ *
+ * A layer has the size and the tile layout of the buffer and keeps its content until it is drawn again, so static
+ * parts of a screen (frames, labels, icons) are drawn once and only the buffer of the display (the dynamic layer) is
+ * redrawn for each frame. The visible layers are blended into the buffer in ascending z-order (layers with the same z
+ * in creation order) with 64-bit word operations. The buffer of the display is the bottom of the stack and holds the
+ * composited frame once composite() returns, it has to be cleared before the next frame is drawn.
+ *
+ * The composited frame is compared to the previous one, the area that changed is available to whatever consumes the
+ * frame (partial updates, frame publishing). Only full buffer setup procedures (_f) are supported.
+ */
+class U8g2Layers {
+public:
+    /**
+     * @return true if the buffer of the display can hold layers (full buffer, vertical or horizontal tile layout)
+     */
+    static auto isSupported(u8g2_t *u8g2) -> bool;
+
+    /**
+     * Create an empty, visible layer the size of the buffer of the display
+     *
+     * @return The handle of the layer
+     */
+    auto create(u8g2_t *u8g2, int z, int op) -> uint32_t;
+
+    /**
+     * Release the layer (drawing is ended first if the layer is being drawn)
+     *
+     * @return false if the handle is unknown
+     */
+    auto remove(u8g2_t *u8g2, uint32_t handle) -> bool;
+
+    /**
+     * Release all layers
+     */
+    auto clear(u8g2_t *u8g2) -> void;
+
+    /**
+     * Redirect the drawing operations of u8g2 to the layer until end() is called. The content of the layer is kept,
+     * use u8g2_ClearBuffer to start over.
+     *
+     * @return false if the handle is unknown
+     */
+    auto begin(u8g2_t *u8g2, uint32_t handle) -> bool;
+
+    /**
+     * Draw into the buffer of the display again
+     */
+    auto end(u8g2_t *u8g2) -> void;
+
+    /**
+     * @return true if a layer is being drawn
+     */
+    [[nodiscard]] auto isDrawing() const -> bool;
+
+    auto setVisible(uint32_t handle, bool visible) -> bool;
+
+    /**
+     * Move the layer, the offset is in pixels of the display (the rotation of the display is applied)
+     */
+    auto setOffset(uint32_t handle, int x, int y) -> bool;
+
+    auto setZOrder(uint32_t handle, int z) -> bool;
+
+    auto setOp(uint32_t handle, int op) -> bool;
+
+    [[nodiscard]] auto contains(uint32_t handle) const -> bool;
+
+    [[nodiscard]] auto getCount() const -> size_t;
+
+    /**
+     * Blend the visible layers into the buffer of the display and update the dirty area
+     */
+    auto composite(u8g2_t *u8g2) -> void;
+
+    /**
+     * @return The area of the buffer that changed between the last two composited frames (the whole buffer after the
+     * first composite or invalidate())
+     */
+    [[nodiscard]] auto getDirtyArea() const -> const ucgd_tile_area_t &;
+
+    /**
+     * Forget the previous frame, the next composite marks the whole buffer as dirty (e.g. the display was cleared)
+     */
+    auto invalidate() -> void;
+
+    /**
+     * Blend a layer into a buffer of the same size.
+     *
+     * @param vertical true for the vertical_top_lsb layout, false for horizontal_right_lsb
+     * @param dx Horizontal offset of the layer in pixels of the buffer
+     * @param dy Vertical offset of the layer in pixels of the buffer
+     */
+    static auto blend(uint8_t *buffer, const uint8_t *layer, int tileWidth, int tileHeight, bool vertical, int op, int dx, int dy) -> void;
+
+    /**
+     * @return The bounding area of the tiles that differ between the two buffers
+     */
+    static auto diff(const uint8_t *a, const uint8_t *b, int tileWidth, int tileHeight, bool vertical) -> ucgd_tile_area_t;
+
+private:
+    struct layer_t {
+        int z;
+        int op;
+        bool visible;
+        int x;
+        int y;
+        std::vector<uint8_t> pixels;
+    };
+
+    //Resize the layers if the buffer of the display changed (rotation), their content is lost
+    auto fit(u8g2_t *u8g2) -> void;
+
+    //ordered by handle (creation order)
+    std::map<uint32_t, layer_t> m_Layers;
+    uint32_t m_NextHandle = 1;
+    //handle of the layer being drawn and the buffer it replaced
+    uint32_t m_Drawing = 0;
+    uint8_t *m_Saved = nullptr;
+    int m_TileWidth = 0;
+    int m_TileHeight = 0;
+    std::vector<uint8_t> m_Previous;
+    ucgd_tile_area_t m_Dirty{};
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2LAYERS_H
@@ -0,0 +1,671 @@
+//
+// THIS IS AN AUTO-GENERATED CODE!! DO NOT MODIFY (Last updated: Sun, 18 Oct 2026 19:26:41 +0000)
+//
+#include "U8g2Hal.h"
+
+void U8g2hal_InitSetupIndex(u8g2_setup_index_map_t &index_map) {
+    index_map.clear();
+    index_map["u8g2_Setup_a2printer_384x240_1"] = "a2printer";
+    index_map["u8g2_Setup_a2printer_384x240_2"] = "a2printer";
+    index_map["u8g2_Setup_a2printer_384x240_f"] = "a2printer";
+    index_map["u8g2_Setup_hx1230_96x68_1"] = "hx1230";
+    index_map["u8g2_Setup_hx1230_96x68_2"] = "hx1230";
+    index_map["u8g2_Setup_hx1230_96x68_f"] = "hx1230";
+    index_map["u8g2_Setup_il3820_296x128_1"] = "il3820";
+    index_map["u8g2_Setup_il3820_296x128_2"] = "il3820";
+    index_map["u8g2_Setup_il3820_296x128_f"] = "il3820";
+    index_map["u8g2_Setup_il3820_v2_296x128_1"] = "il3820";
+    index_map["u8g2_Setup_il3820_v2_296x128_2"] = "il3820";
+    index_map["u8g2_Setup_il3820_v2_296x128_f"] = "il3820";
+    index_map["u8g2_Setup_ist3020_erc19264_1"] = "ist3020";
+    index_map["u8g2_Setup_ist3020_erc19264_2"] = "ist3020";
+    index_map["u8g2_Setup_ist3020_erc19264_f"] = "ist3020";
+    index_map["u8g2_Setup_ist7920_128x128_1"] = "ist7920";
+    index_map["u8g2_Setup_ist7920_128x128_2"] = "ist7920";
+    index_map["u8g2_Setup_ist7920_128x128_f"] = "ist7920";
+    index_map["u8g2_Setup_ks0108_128x64_1"] = "ks0108";
+    index_map["u8g2_Setup_ks0108_128x64_2"] = "ks0108";
+    index_map["u8g2_Setup_ks0108_128x64_f"] = "ks0108";
+    index_map["u8g2_Setup_ks0108_erm19264_1"] = "ks0108";
+    index_map["u8g2_Setup_ks0108_erm19264_2"] = "ks0108";
+    index_map["u8g2_Setup_ks0108_erm19264_f"] = "ks0108";
+    index_map["u8g2_Setup_lc7981_160x160_1"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_160x160_2"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_160x160_f"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_160x80_1"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_160x80_2"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_160x80_f"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_240x128_1"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_240x128_2"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_240x128_f"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_240x64_1"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_240x64_2"] = "lc7981";
+    index_map["u8g2_Setup_lc7981_240x64_f"] = "lc7981";
+    index_map["u8g2_Setup_ld7032_60x32_1"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_60x32_2"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_60x32_alt_1"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_60x32_alt_2"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_60x32_alt_f"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_60x32_f"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_i2c_60x32_1"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_i2c_60x32_2"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_i2c_60x32_alt_1"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_i2c_60x32_alt_2"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_i2c_60x32_alt_f"] = "ld7032";
+    index_map["u8g2_Setup_ld7032_i2c_60x32_f"] = "ld7032";
+    index_map["u8g2_Setup_ls013b7dh03_128x128_1"] = "ls013b7dh03";
+    index_map["u8g2_Setup_ls013b7dh03_128x128_2"] = "ls013b7dh03";
+    index_map["u8g2_Setup_ls013b7dh03_128x128_f"] = "ls013b7dh03";
+    index_map["u8g2_Setup_ls013b7dh05_144x168_1"] = "ls013b7dh05";
+    index_map["u8g2_Setup_ls013b7dh05_144x168_2"] = "ls013b7dh05";
+    index_map["u8g2_Setup_ls013b7dh05_144x168_f"] = "ls013b7dh05";
+    index_map["u8g2_Setup_ls027b7dh01_400x240_1"] = "ls027b7dh01";
+    index_map["u8g2_Setup_ls027b7dh01_400x240_2"] = "ls027b7dh01";
+    index_map["u8g2_Setup_ls027b7dh01_400x240_f"] = "ls027b7dh01";
+    index_map["u8g2_Setup_ls027b7dh01_m0_400x240_1"] = "ls027b7dh01";
+    index_map["u8g2_Setup_ls027b7dh01_m0_400x240_2"] = "ls027b7dh01";
+    index_map["u8g2_Setup_ls027b7dh01_m0_400x240_f"] = "ls027b7dh01";
+    index_map["u8g2_Setup_max7219_32x8_1"] = "max7219";
+    index_map["u8g2_Setup_max7219_32x8_2"] = "max7219";
+    index_map["u8g2_Setup_max7219_32x8_f"] = "max7219";
+    index_map["u8g2_Setup_max7219_64x8_1"] = "max7219";
+    index_map["u8g2_Setup_max7219_64x8_2"] = "max7219";
+    index_map["u8g2_Setup_max7219_64x8_f"] = "max7219";
+    index_map["u8g2_Setup_max7219_8x8_1"] = "max7219";
+    index_map["u8g2_Setup_max7219_8x8_2"] = "max7219";
+    index_map["u8g2_Setup_max7219_8x8_f"] = "max7219";
+    index_map["u8g2_Setup_nt7534_tg12864r_1"] = "nt7534";
+    index_map["u8g2_Setup_nt7534_tg12864r_2"] = "nt7534";
+    index_map["u8g2_Setup_nt7534_tg12864r_f"] = "nt7534";
+    index_map["u8g2_Setup_pcd8544_84x48_1"] = "pcd8544";
+    index_map["u8g2_Setup_pcd8544_84x48_2"] = "pcd8544";
+    index_map["u8g2_Setup_pcd8544_84x48_f"] = "pcd8544";
+    index_map["u8g2_Setup_pcf8812_96x65_1"] = "pcf8812";
+    index_map["u8g2_Setup_pcf8812_96x65_2"] = "pcf8812";
+    index_map["u8g2_Setup_pcf8812_96x65_f"] = "pcf8812";
+    index_map["u8g2_Setup_ra8835_320x240_1"] = "ra8835";
+    index_map["u8g2_Setup_ra8835_320x240_2"] = "ra8835";
+    index_map["u8g2_Setup_ra8835_320x240_f"] = "ra8835";
+    index_map["u8g2_Setup_ra8835_nhd_240x128_1"] = "ra8835";
+    index_map["u8g2_Setup_ra8835_nhd_240x128_2"] = "ra8835";
+    index_map["u8g2_Setup_ra8835_nhd_240x128_f"] = "ra8835";
+    index_map["u8g2_Setup_s1d15e06_160100_1"] = "s1d15e06";
+    index_map["u8g2_Setup_s1d15e06_160100_2"] = "s1d15e06";
+    index_map["u8g2_Setup_s1d15e06_160100_f"] = "s1d15e06";
+    index_map["u8g2_Setup_sbn1661_122x32_1"] = "sbn1661";
+    index_map["u8g2_Setup_sbn1661_122x32_2"] = "sbn1661";
+    index_map["u8g2_Setup_sbn1661_122x32_f"] = "sbn1661";
+    index_map["u8g2_Setup_sed1330_240x128_1"] = "sed1330";
+    index_map["u8g2_Setup_sed1330_240x128_2"] = "sed1330";
+    index_map["u8g2_Setup_sed1330_240x128_f"] = "sed1330";
+    index_map["u8g2_Setup_sed1520_122x32_1"] = "sed1520";
+    index_map["u8g2_Setup_sed1520_122x32_2"] = "sed1520";
+    index_map["u8g2_Setup_sed1520_122x32_f"] = "sed1520";
+    index_map["u8g2_Setup_sh1106_128x32_visionox_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x32_visionox_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x32_visionox_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_noname_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_noname_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_noname_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_vcomh0_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_vcomh0_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_vcomh0_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_winstar_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_winstar_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_128x64_winstar_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_64x32_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_64x32_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_64x32_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_72x40_wise_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_72x40_wise_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_72x40_wise_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x32_visionox_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x32_visionox_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x32_visionox_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_noname_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_noname_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_noname_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_vcomh0_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_vcomh0_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_vcomh0_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_winstar_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_winstar_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_128x64_winstar_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_64x32_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_64x32_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_64x32_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_72x40_wise_1"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_72x40_wise_2"] = "sh1106";
+    index_map["u8g2_Setup_sh1106_i2c_72x40_wise_f"] = "sh1106";
+    index_map["u8g2_Setup_sh1107_128x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_128x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_128x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_64x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_64x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_64x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_128x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_128x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_128x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_64x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_64x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_64x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_pimoroni_128x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_pimoroni_128x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_pimoroni_128x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_seeed_128x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_seeed_128x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_seeed_128x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_seeed_96x96_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_seeed_96x96_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_i2c_seeed_96x96_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_pimoroni_128x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_pimoroni_128x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_pimoroni_128x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_seeed_128x128_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_seeed_128x128_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_seeed_128x128_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_seeed_96x96_1"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_seeed_96x96_2"] = "sh1107";
+    index_map["u8g2_Setup_sh1107_seeed_96x96_f"] = "sh1107";
+    index_map["u8g2_Setup_sh1108_160x160_1"] = "sh1108";
+    index_map["u8g2_Setup_sh1108_160x160_2"] = "sh1108";
+    index_map["u8g2_Setup_sh1108_160x160_f"] = "sh1108";
+    index_map["u8g2_Setup_sh1108_i2c_160x160_1"] = "sh1108";
+    index_map["u8g2_Setup_sh1108_i2c_160x160_2"] = "sh1108";
+    index_map["u8g2_Setup_sh1108_i2c_160x160_f"] = "sh1108";
+    index_map["u8g2_Setup_sh1122_256x64_1"] = "sh1122";
+    index_map["u8g2_Setup_sh1122_256x64_2"] = "sh1122";
+    index_map["u8g2_Setup_sh1122_256x64_f"] = "sh1122";
+    index_map["u8g2_Setup_sh1122_i2c_256x64_1"] = "sh1122";
+    index_map["u8g2_Setup_sh1122_i2c_256x64_2"] = "sh1122";
+    index_map["u8g2_Setup_sh1122_i2c_256x64_f"] = "sh1122";
+    index_map["u8g2_Setup_ssd0323_i2c_os128064_1"] = "ssd0323";
+    index_map["u8g2_Setup_ssd0323_i2c_os128064_2"] = "ssd0323";
+    index_map["u8g2_Setup_ssd0323_i2c_os128064_f"] = "ssd0323";
+    index_map["u8g2_Setup_ssd0323_os128064_1"] = "ssd0323";
+    index_map["u8g2_Setup_ssd0323_os128064_2"] = "ssd0323";
+    index_map["u8g2_Setup_ssd0323_os128064_f"] = "ssd0323";
+    index_map["u8g2_Setup_ssd1305_128x32_adafruit_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x32_adafruit_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x32_adafruit_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x32_noname_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x32_noname_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x32_noname_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x64_adafruit_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x64_adafruit_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x64_adafruit_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x64_raystar_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x64_raystar_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_128x64_raystar_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x32_adafruit_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x32_adafruit_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x32_adafruit_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x32_noname_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x32_noname_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x32_noname_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x64_adafruit_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x64_adafruit_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x64_adafruit_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x64_raystar_1"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x64_raystar_2"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1305_i2c_128x64_raystar_f"] = "ssd1305";
+    index_map["u8g2_Setup_ssd1306_128x32_univision_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x32_univision_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x32_univision_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x32_winstar_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x32_winstar_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x32_winstar_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_alt0_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_alt0_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_alt0_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_noname_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_noname_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_noname_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_vcomh0_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_vcomh0_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_128x64_vcomh0_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_2040x16_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_2040x16_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_2040x16_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_48x64_winstar_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_48x64_winstar_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_48x64_winstar_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x32_1f_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x32_1f_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x32_1f_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x32_noname_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x32_noname_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x32_noname_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x48_er_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x48_er_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_64x48_er_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_72x40_er_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_72x40_er_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_72x40_er_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_96x16_er_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_96x16_er_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_96x16_er_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x32_univision_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x32_univision_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x32_univision_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x32_winstar_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x32_winstar_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x32_winstar_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_alt0_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_alt0_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_alt0_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_noname_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_noname_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_noname_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_vcomh0_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_vcomh0_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_128x64_vcomh0_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_48x64_winstar_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_48x64_winstar_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_48x64_winstar_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x32_1f_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x32_1f_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x32_1f_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x32_noname_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x32_noname_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x32_noname_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x48_er_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x48_er_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_64x48_er_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_72x40_er_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_72x40_er_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_72x40_er_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_96x16_er_1"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_96x16_er_2"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1306_i2c_96x16_er_f"] = "ssd1306";
+    index_map["u8g2_Setup_ssd1309_128x64_noname0_1"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_128x64_noname0_2"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_128x64_noname0_f"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_128x64_noname2_1"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_128x64_noname2_2"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_128x64_noname2_f"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_i2c_128x64_noname0_1"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_i2c_128x64_noname0_2"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_i2c_128x64_noname0_f"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_i2c_128x64_noname2_1"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_i2c_128x64_noname2_2"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1309_i2c_128x64_noname2_f"] = "ssd1309";
+    index_map["u8g2_Setup_ssd1316_128x32_1"] = "ssd1316";
+    index_map["u8g2_Setup_ssd1316_128x32_2"] = "ssd1316";
+    index_map["u8g2_Setup_ssd1316_128x32_f"] = "ssd1316";
+    index_map["u8g2_Setup_ssd1316_i2c_128x32_1"] = "ssd1316";
+    index_map["u8g2_Setup_ssd1316_i2c_128x32_2"] = "ssd1316";
+    index_map["u8g2_Setup_ssd1316_i2c_128x32_f"] = "ssd1316";
+    index_map["u8g2_Setup_ssd1317_96x96_1"] = "ssd1317";
+    index_map["u8g2_Setup_ssd1317_96x96_2"] = "ssd1317";
+    index_map["u8g2_Setup_ssd1317_96x96_f"] = "ssd1317";
+    index_map["u8g2_Setup_ssd1317_i2c_96x96_1"] = "ssd1317";
+    index_map["u8g2_Setup_ssd1317_i2c_96x96_2"] = "ssd1317";
+    index_map["u8g2_Setup_ssd1317_i2c_96x96_f"] = "ssd1317";
+    index_map["u8g2_Setup_ssd1318_128x96_1"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_128x96_2"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_128x96_f"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_128x96_xcp_1"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_128x96_xcp_2"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_128x96_xcp_f"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_i2c_128x96_1"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_i2c_128x96_2"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_i2c_128x96_f"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_i2c_128x96_xcp_1"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_i2c_128x96_xcp_2"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1318_i2c_128x96_xcp_f"] = "ssd1318";
+    index_map["u8g2_Setup_ssd1320_160x132_1"] = "ssd1320";
+    index_map["u8g2_Setup_ssd1320_160x132_2"] = "ssd1320";
+    index_map["u8g2_Setup_ssd1320_160x132_f"] = "ssd1320";
+    index_map["u8g2_Setup_ssd1320_160x32_1"] = "ssd1320";
+    index_map["u8g2_Setup_ssd1320_160x32_2"] = "ssd1320";
+    index_map["u8g2_Setup_ssd1320_160x32_f"] = "ssd1320";
+    index_map["u8g2_Setup_ssd1322_nhd_128x64_1"] = "ssd1322";
+    index_map["u8g2_Setup_ssd1322_nhd_128x64_2"] = "ssd1322";
+    index_map["u8g2_Setup_ssd1322_nhd_128x64_f"] = "ssd1322";
+    index_map["u8g2_Setup_ssd1322_nhd_256x64_1"] = "ssd1322";
+    index_map["u8g2_Setup_ssd1322_nhd_256x64_2"] = "ssd1322";
+    index_map["u8g2_Setup_ssd1322_nhd_256x64_f"] = "ssd1322";
+    index_map["u8g2_Setup_ssd1325_i2c_nhd_128x64_1"] = "ssd1325";
+    index_map["u8g2_Setup_ssd1325_i2c_nhd_128x64_2"] = "ssd1325";
+    index_map["u8g2_Setup_ssd1325_i2c_nhd_128x64_f"] = "ssd1325";
+    index_map["u8g2_Setup_ssd1325_nhd_128x64_1"] = "ssd1325";
+    index_map["u8g2_Setup_ssd1325_nhd_128x64_2"] = "ssd1325";
+    index_map["u8g2_Setup_ssd1325_nhd_128x64_f"] = "ssd1325";
+    index_map["u8g2_Setup_ssd1326_er_256x32_1"] = "ssd1326";
+    index_map["u8g2_Setup_ssd1326_er_256x32_2"] = "ssd1326";
+    index_map["u8g2_Setup_ssd1326_er_256x32_f"] = "ssd1326";
+    index_map["u8g2_Setup_ssd1326_i2c_er_256x32_1"] = "ssd1326";
+    index_map["u8g2_Setup_ssd1326_i2c_er_256x32_2"] = "ssd1326";
+    index_map["u8g2_Setup_ssd1326_i2c_er_256x32_f"] = "ssd1326";
+    index_map["u8g2_Setup_ssd1327_ea_w128128_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ea_w128128_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ea_w128128_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ea_w128128_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ea_w128128_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ea_w128128_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_midas_128x128_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_midas_128x128_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_midas_128x128_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_seeed_96x96_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_seeed_96x96_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_seeed_96x96_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_visionox_128x96_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_visionox_128x96_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_visionox_128x96_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ws_128x128_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ws_128x128_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ws_128x128_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ws_96x64_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ws_96x64_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_i2c_ws_96x64_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_midas_128x128_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_midas_128x128_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_midas_128x128_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_seeed_96x96_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_seeed_96x96_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_seeed_96x96_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_visionox_128x96_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_visionox_128x96_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_visionox_128x96_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ws_128x128_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ws_128x128_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ws_128x128_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ws_96x64_1"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ws_96x64_2"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1327_ws_96x64_f"] = "ssd1327";
+    index_map["u8g2_Setup_ssd1329_128x96_noname_1"] = "ssd1329";
+    index_map["u8g2_Setup_ssd1329_128x96_noname_2"] = "ssd1329";
+    index_map["u8g2_Setup_ssd1329_128x96_noname_f"] = "ssd1329";
+    index_map["u8g2_Setup_ssd1606_172x72_1"] = "ssd1606";
+    index_map["u8g2_Setup_ssd1606_172x72_2"] = "ssd1606";
+    index_map["u8g2_Setup_ssd1606_172x72_f"] = "ssd1606";
+    index_map["u8g2_Setup_ssd1607_200x200_1"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_200x200_2"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_200x200_f"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_gd_200x200_1"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_gd_200x200_2"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_gd_200x200_f"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_ws_200x200_1"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_ws_200x200_2"] = "ssd1607";
+    index_map["u8g2_Setup_ssd1607_ws_200x200_f"] = "ssd1607";
+    index_map["u8g2_Setup_st7511_avd_320x240_1"] = "st7511";
+    index_map["u8g2_Setup_st7511_avd_320x240_2"] = "st7511";
+    index_map["u8g2_Setup_st7511_avd_320x240_f"] = "st7511";
+    index_map["u8g2_Setup_st75256_i2c_jlx172104_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx172104_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx172104_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx19296_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx19296_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx19296_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx240160_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx240160_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx240160_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256128_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256128_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256128_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160_alt_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160_alt_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160_alt_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160m_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160m_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx256160m_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx25664_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx25664_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_jlx25664_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_wo256x128_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_wo256x128_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_i2c_wo256x128_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx172104_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx172104_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx172104_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx19296_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx19296_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx19296_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx240160_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx240160_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx240160_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256128_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256128_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256128_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160_alt_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160_alt_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160_alt_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160m_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160m_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx256160m_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx25664_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx25664_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_jlx25664_f"] = "st75256";
+    index_map["u8g2_Setup_st75256_wo256x128_1"] = "st75256";
+    index_map["u8g2_Setup_st75256_wo256x128_2"] = "st75256";
+    index_map["u8g2_Setup_st75256_wo256x128_f"] = "st75256";
+    index_map["u8g2_Setup_st7528_erc16064_1"] = "st7528";
+    index_map["u8g2_Setup_st7528_erc16064_2"] = "st7528";
+    index_map["u8g2_Setup_st7528_erc16064_f"] = "st7528";
+    index_map["u8g2_Setup_st7528_i2c_erc16064_1"] = "st7528";
+    index_map["u8g2_Setup_st7528_i2c_erc16064_2"] = "st7528";
+    index_map["u8g2_Setup_st7528_i2c_erc16064_f"] = "st7528";
+    index_map["u8g2_Setup_st7528_i2c_nhd_c160100_1"] = "st7528";
+    index_map["u8g2_Setup_st7528_i2c_nhd_c160100_2"] = "st7528";
+    index_map["u8g2_Setup_st7528_i2c_nhd_c160100_f"] = "st7528";
+    index_map["u8g2_Setup_st7528_nhd_c160100_1"] = "st7528";
+    index_map["u8g2_Setup_st7528_nhd_c160100_2"] = "st7528";
+    index_map["u8g2_Setup_st7528_nhd_c160100_f"] = "st7528";
+    index_map["u8g2_Setup_st75320_i2c_jlx320240_1"] = "st75320";
+    index_map["u8g2_Setup_st75320_i2c_jlx320240_2"] = "st75320";
+    index_map["u8g2_Setup_st75320_i2c_jlx320240_f"] = "st75320";
+    index_map["u8g2_Setup_st75320_jlx320240_1"] = "st75320";
+    index_map["u8g2_Setup_st75320_jlx320240_2"] = "st75320";
+    index_map["u8g2_Setup_st75320_jlx320240_f"] = "st75320";
+    index_map["u8g2_Setup_st7565_64128n_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_64128n_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_64128n_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_ea_dogm128_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_ea_dogm128_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_ea_dogm128_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_ea_dogm132_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_ea_dogm132_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_ea_dogm132_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_erc12864_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_erc12864_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_erc12864_alt_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_erc12864_alt_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_erc12864_alt_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_erc12864_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_jlx12864_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_jlx12864_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_jlx12864_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_ks0713_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_ks0713_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_ks0713_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_lm6059_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_lm6059_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_lm6059_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_lm6063_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_lm6063_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_lm6063_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_lx12864_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_lx12864_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_lx12864_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_nhd_c12832_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_nhd_c12832_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_nhd_c12832_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_nhd_c12864_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_nhd_c12864_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_nhd_c12864_f"] = "st7565";
+    index_map["u8g2_Setup_st7565_zolen_128x64_1"] = "st7565";
+    index_map["u8g2_Setup_st7565_zolen_128x64_2"] = "st7565";
+    index_map["u8g2_Setup_st7565_zolen_128x64_f"] = "st7565";
+    index_map["u8g2_Setup_st7567_64x32_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_64x32_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_64x32_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_enh_dg128064_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_enh_dg128064_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_enh_dg128064_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_enh_dg128064i_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_enh_dg128064i_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_enh_dg128064i_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_hem6432_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_hem6432_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_hem6432_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_i2c_64x32_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_i2c_64x32_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_i2c_64x32_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_i2c_hem6432_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_i2c_hem6432_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_i2c_hem6432_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_jlx12864_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_jlx12864_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_jlx12864_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_os12864_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_os12864_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_os12864_f"] = "st7567";
+    index_map["u8g2_Setup_st7567_pi_132x64_1"] = "st7567";
+    index_map["u8g2_Setup_st7567_pi_132x64_2"] = "st7567";
+    index_map["u8g2_Setup_st7567_pi_132x64_f"] = "st7567";
+    index_map["u8g2_Setup_st7571_128x128_1"] = "st7571";
+    index_map["u8g2_Setup_st7571_128x128_2"] = "st7571";
+    index_map["u8g2_Setup_st7571_128x128_f"] = "st7571";
+    index_map["u8g2_Setup_st7571_i2c_128x128_1"] = "st7571";
+    index_map["u8g2_Setup_st7571_i2c_128x128_2"] = "st7571";
+    index_map["u8g2_Setup_st7571_i2c_128x128_f"] = "st7571";
+    index_map["u8g2_Setup_st7586s_erc240160_1"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_erc240160_2"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_erc240160_f"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_s028hn118a_1"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_s028hn118a_2"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_s028hn118a_f"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_ymc240160_1"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_ymc240160_2"] = "st7586s";
+    index_map["u8g2_Setup_st7586s_ymc240160_f"] = "st7586s";
+    index_map["u8g2_Setup_st7588_i2c_jlx12864_1"] = "st7588";
+    index_map["u8g2_Setup_st7588_i2c_jlx12864_2"] = "st7588";
+    index_map["u8g2_Setup_st7588_i2c_jlx12864_f"] = "st7588";
+    index_map["u8g2_Setup_st7588_jlx12864_1"] = "st7588";
+    index_map["u8g2_Setup_st7588_jlx12864_2"] = "st7588";
+    index_map["u8g2_Setup_st7588_jlx12864_f"] = "st7588";
+    index_map["u8g2_Setup_st7920_128x64_1"] = "st7920";
+    index_map["u8g2_Setup_st7920_128x64_2"] = "st7920";
+    index_map["u8g2_Setup_st7920_128x64_f"] = "st7920";
+    index_map["u8g2_Setup_st7920_192x32_1"] = "st7920";
+    index_map["u8g2_Setup_st7920_192x32_2"] = "st7920";
+    index_map["u8g2_Setup_st7920_192x32_f"] = "st7920";
+    index_map["u8g2_Setup_st7920_p_128x64_1"] = "st7920";
+    index_map["u8g2_Setup_st7920_p_128x64_2"] = "st7920";
+    index_map["u8g2_Setup_st7920_p_128x64_f"] = "st7920";
+    index_map["u8g2_Setup_st7920_p_192x32_1"] = "st7920";
+    index_map["u8g2_Setup_st7920_p_192x32_2"] = "st7920";
+    index_map["u8g2_Setup_st7920_p_192x32_f"] = "st7920";
+    index_map["u8g2_Setup_st7920_s_128x64_1"] = "st7920";
+    index_map["u8g2_Setup_st7920_s_128x64_2"] = "st7920";
+    index_map["u8g2_Setup_st7920_s_128x64_f"] = "st7920";
+    index_map["u8g2_Setup_st7920_s_192x32_1"] = "st7920";
+    index_map["u8g2_Setup_st7920_s_192x32_2"] = "st7920";
+    index_map["u8g2_Setup_st7920_s_192x32_f"] = "st7920";
+    index_map["u8g2_Setup_t6963_128x64_1"] = "t6963";
+    index_map["u8g2_Setup_t6963_128x64_2"] = "t6963";
+    index_map["u8g2_Setup_t6963_128x64_alt_1"] = "t6963";
+    index_map["u8g2_Setup_t6963_128x64_alt_2"] = "t6963";
+    index_map["u8g2_Setup_t6963_128x64_alt_f"] = "t6963";
+    index_map["u8g2_Setup_t6963_128x64_f"] = "t6963";
+    index_map["u8g2_Setup_t6963_160x80_1"] = "t6963";
+    index_map["u8g2_Setup_t6963_160x80_2"] = "t6963";
+    index_map["u8g2_Setup_t6963_160x80_f"] = "t6963";
+    index_map["u8g2_Setup_t6963_240x128_1"] = "t6963";
+    index_map["u8g2_Setup_t6963_240x128_2"] = "t6963";
+    index_map["u8g2_Setup_t6963_240x128_f"] = "t6963";
+    index_map["u8g2_Setup_t6963_240x64_1"] = "t6963";
+    index_map["u8g2_Setup_t6963_240x64_2"] = "t6963";
+    index_map["u8g2_Setup_t6963_240x64_f"] = "t6963";
+    index_map["u8g2_Setup_t6963_256x64_1"] = "t6963";
+    index_map["u8g2_Setup_t6963_256x64_2"] = "t6963";
+    index_map["u8g2_Setup_t6963_256x64_f"] = "t6963";
+    index_map["u8g2_Setup_uc1601_128x32_1"] = "uc1601";
+    index_map["u8g2_Setup_uc1601_128x32_2"] = "uc1601";
+    index_map["u8g2_Setup_uc1601_128x32_f"] = "uc1601";
+    index_map["u8g2_Setup_uc1601_i2c_128x32_1"] = "uc1601";
+    index_map["u8g2_Setup_uc1601_i2c_128x32_2"] = "uc1601";
+    index_map["u8g2_Setup_uc1601_i2c_128x32_f"] = "uc1601";
+    index_map["u8g2_Setup_uc1604_i2c_jlx19264_1"] = "uc1604";
+    index_map["u8g2_Setup_uc1604_i2c_jlx19264_2"] = "uc1604";
+    index_map["u8g2_Setup_uc1604_i2c_jlx19264_f"] = "uc1604";
+    index_map["u8g2_Setup_uc1604_jlx19264_1"] = "uc1604";
+    index_map["u8g2_Setup_uc1604_jlx19264_2"] = "uc1604";
+    index_map["u8g2_Setup_uc1604_jlx19264_f"] = "uc1604";
+    index_map["u8g2_Setup_uc1608_240x128_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_240x128_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_240x128_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_dem240064_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_dem240064_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_dem240064_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_erc240120_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_erc240120_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_erc240120_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_erc24064_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_erc24064_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_erc24064_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_240x128_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_240x128_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_240x128_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_dem240064_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_dem240064_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_dem240064_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_erc240120_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_erc240120_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_erc240120_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_erc24064_1"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_erc24064_2"] = "uc1608";
+    index_map["u8g2_Setup_uc1608_i2c_erc24064_f"] = "uc1608";
+    index_map["u8g2_Setup_uc1610_ea_dogxl160_1"] = "uc1610";
+    index_map["u8g2_Setup_uc1610_ea_dogxl160_2"] = "uc1610";
+    index_map["u8g2_Setup_uc1610_ea_dogxl160_f"] = "uc1610";
+    index_map["u8g2_Setup_uc1610_i2c_ea_dogxl160_1"] = "uc1610";
+    index_map["u8g2_Setup_uc1610_i2c_ea_dogxl160_2"] = "uc1610";
+    index_map["u8g2_Setup_uc1610_i2c_ea_dogxl160_f"] = "uc1610";
+    index_map["u8g2_Setup_uc1611_cg160160_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_cg160160_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_cg160160_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ea_dogm240_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ea_dogm240_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ea_dogm240_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ea_dogxl240_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ea_dogxl240_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ea_dogxl240_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ew50850_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ew50850_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ew50850_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_cg160160_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_cg160160_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_cg160160_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ea_dogm240_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ea_dogm240_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ea_dogm240_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ea_dogxl240_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ea_dogxl240_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ea_dogxl240_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ew50850_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ew50850_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ew50850_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ids4073_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ids4073_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_i2c_ids4073_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ids4073_1"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ids4073_2"] = "uc1611";
+    index_map["u8g2_Setup_uc1611_ids4073_f"] = "uc1611";
+    index_map["u8g2_Setup_uc1638_160x128_1"] = "uc1638";
+    index_map["u8g2_Setup_uc1638_160x128_2"] = "uc1638";
+    index_map["u8g2_Setup_uc1638_160x128_f"] = "uc1638";
+    index_map["u8g2_Setup_uc1701_ea_dogs102_1"] = "uc1701";
+    index_map["u8g2_Setup_uc1701_ea_dogs102_2"] = "uc1701";
+    index_map["u8g2_Setup_uc1701_ea_dogs102_f"] = "uc1701";
+    index_map["u8g2_Setup_uc1701_mini12864_1"] = "uc1701";
+    index_map["u8g2_Setup_uc1701_mini12864_2"] = "uc1701";
+    index_map["u8g2_Setup_uc1701_mini12864_f"] = "uc1701";
+}
\ No newline at end of file
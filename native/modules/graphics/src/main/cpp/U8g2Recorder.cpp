@@ -0,0 +1,346 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "U8g2Recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    inline uint64_t align8(uint64_t value) {
+        return (value + 7) & ~static_cast<uint64_t>(7);
+    }
+
+    inline uint64_t load64(const uint8_t *p) {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint64_t recordLength(const ucgd_rec_frame_t *record) {
+        return align8(sizeof(ucgd_rec_frame_t) + record->size);
+    }
+
+    //Returns the offset of the record at offset, following the wrap marker (or the implicit wrap if there is no room for a record header)
+    inline uint64_t normalize(const uint8_t *data, uint64_t capacity, uint64_t offset) {
+        if (capacity - offset < sizeof(ucgd_rec_frame_t))
+            return 0;
+        auto record = reinterpret_cast<const ucgd_rec_frame_t *>(data + offset);
+        return (record->flags & RECORDER_FLAG_WRAP) ? 0 : offset;
+    }
+
+    std::string lastError(const std::string &message, const std::string &path) {
+        return message + " '" + path + "' (" + strerror(errno) + ")";
+    }
+}
+
+U8g2Recorder::~U8g2Recorder() {
+    close();
+}
+
+auto U8g2Recorder::open(const std::string &path, size_t capacity, int width, int height, int layout, int keyframeInterval) -> void {
+    close();
+    if (width <= 0 || height <= 0 || (width % 8) != 0 || (height % 8) != 0)
+        throw std::runtime_error("Invalid recorder frame dimensions");
+    size_t frameSize = static_cast<size_t>(width) * height / 8;
+    capacity &= ~static_cast<size_t>(7);
+    if (capacity < 4 * align8(sizeof(ucgd_rec_frame_t) + getMaxEncodedSize(frameSize)))
+        throw std::runtime_error("Recorder capacity is too small for the frame size (" + std::to_string(frameSize) + " bytes)");
+
+    m_Fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_Fd < 0)
+        throw std::runtime_error(lastError("Unable to create recording", path));
+    m_MapSize = RECORDER_DATA_OFFSET + capacity;
+    if (ftruncate(m_Fd, static_cast<off_t>(m_MapSize)) != 0) {
+        std::string error = lastError("Unable to resize recording", path);
+        close();
+        throw std::runtime_error(error);
+    }
+    void *map = mmap(nullptr, m_MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_Fd, 0);
+    if (map == MAP_FAILED) {
+        std::string error = lastError("Unable to map recording", path);
+        close();
+        throw std::runtime_error(error);
+    }
+    m_Map = static_cast<uint8_t *>(map);
+    m_Header = reinterpret_cast<ucgd_rec_header_t *>(m_Map);
+    m_Data = m_Map + RECORDER_DATA_OFFSET;
+
+    memset(m_Header, 0, sizeof(ucgd_rec_header_t));
+    memcpy(m_Header->magic, RECORDER_MAGIC, sizeof(RECORDER_MAGIC));
+    m_Header->version = RECORDER_VERSION;
+    m_Header->frame_size = static_cast<uint32_t>(frameSize);
+    m_Header->width = static_cast<uint16_t>(width);
+    m_Header->height = static_cast<uint16_t>(height);
+    m_Header->layout = static_cast<uint32_t>(layout);
+    m_Header->keyframe_interval = static_cast<uint32_t>(std::max(keyframeInterval, 1));
+    m_Header->capacity = capacity;
+
+    m_Previous.assign(frameSize, 0);
+    m_Empty.assign(frameSize, 0);
+    m_SinceKeyframe = 0;
+}
+
+auto U8g2Recorder::close() -> void {
+    if (m_Map != nullptr) {
+        msync(m_Map, m_MapSize, MS_SYNC);
+        munmap(m_Map, m_MapSize);
+    }
+    if (m_Fd >= 0)
+        ::close(m_Fd);
+    m_Fd = -1;
+    m_Map = nullptr;
+    m_MapSize = 0;
+    m_Header = nullptr;
+    m_Data = nullptr;
+}
+
+auto U8g2Recorder::isOpen() const -> bool {
+    return m_Map != nullptr;
+}
+
+auto U8g2Recorder::record(const uint8_t *frame, size_t size) -> void {
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+    record(frame, size, static_cast<uint64_t>(now.count()));
+}
+
+auto U8g2Recorder::record(const uint8_t *frame, size_t size, uint64_t timestamp) -> void {
+    if (m_Map == nullptr || frame == nullptr)
+        return;
+    if (size != m_Header->frame_size)
+        throw std::runtime_error("U8g2Recorder::record() : Frame size (" + std::to_string(size) + " bytes) does not match the recording (" + std::to_string(m_Header->frame_size) + " bytes)");
+    reserve(align8(sizeof(ucgd_rec_frame_t) + getMaxEncodedSize(size)));
+
+    bool keyframe = m_Header->frame_count == 0 || m_SinceKeyframe >= m_Header->keyframe_interval;
+    auto record = recordAt(m_Header->head);
+    auto payload = reinterpret_cast<uint8_t *>(record + 1);
+    record->size = static_cast<uint32_t>(encode(frame, keyframe ? m_Empty.data() : m_Previous.data(), size, payload));
+    record->flags = keyframe ? RECORDER_FLAG_KEYFRAME : 0;
+    record->timestamp = timestamp;
+    memcpy(m_Previous.data(), frame, size);
+
+    //publish the record only after it has been written
+    m_Header->head += recordLength(record);
+    m_Header->frame_count++;
+    m_SinceKeyframe = keyframe ? 1 : m_SinceKeyframe + 1;
+}
+
+auto U8g2Recorder::getFrameCount() const -> uint64_t {
+    return m_Header != nullptr ? m_Header->frame_count : 0;
+}
+
+auto U8g2Recorder::reserve(size_t length) -> void {
+    ucgd_rec_header_t &header = *m_Header;
+    if (header.head + length > header.capacity) {
+        //drop the records between head and the end of the data region, then continue at the start
+        while (header.frame_count > 0 && header.tail >= header.head)
+            evict();
+        if (header.capacity - header.head >= sizeof(ucgd_rec_frame_t)) {
+            auto marker = recordAt(header.head);
+            marker->size = 0;
+            marker->flags = RECORDER_FLAG_WRAP;
+            marker->timestamp = 0;
+        }
+        header.head = 0;
+    }
+    while (header.frame_count > 0 && header.tail >= header.head && header.tail < header.head + length)
+        evict();
+    if (header.frame_count == 0)
+        header.tail = header.head;
+}
+
+auto U8g2Recorder::evict() -> void {
+    ucgd_rec_header_t &header = *m_Header;
+    //drop the oldest keyframe together with its deltas, replay always starts at a keyframe
+    do {
+        header.tail += recordLength(recordAt(header.tail));
+        header.tail = normalize(m_Data, header.capacity, header.tail);
+        header.frame_count--;
+        header.first_frame++;
+    } while (header.frame_count > 0 && !(recordAt(header.tail)->flags & RECORDER_FLAG_KEYFRAME));
+}
+
+auto U8g2Recorder::recordAt(uint64_t offset) const -> ucgd_rec_frame_t * {
+    return reinterpret_cast<ucgd_rec_frame_t *>(m_Data + offset);
+}
+
+auto U8g2Recorder::getMaxEncodedSize(size_t frameSize) -> size_t {
+    //one token per 128 literal bytes, plus the single byte zero runs that may follow a full literal run
+    return frameSize + frameSize / 64 + 8;
+}
+
+/*
+ * Tokens:
+ *  0x00 - 0x7f : (token + 1) literal bytes follow, xor them into the frame
+ *  0x80 - 0xff : skip (token - 0x7f) unchanged bytes
+ */
+auto U8g2Recorder::encode(const uint8_t *current, const uint8_t *reference, size_t size, uint8_t *output) -> size_t {
+    uint8_t *out = output;
+    size_t i = 0;
+    while (i < size) {
+        //unchanged bytes, compared a word at a time
+        size_t start = i;
+        while (i + 8 <= size && load64(current + i) == load64(reference + i))
+            i += 8;
+        while (i < size && current[i] == reference[i])
+            i++;
+        for (size_t run = i - start; run > 0;) {
+            size_t n = std::min<size_t>(run, 128);
+            *out++ = static_cast<uint8_t>(0x7f + n);
+            run -= n;
+        }
+        if (i >= size)
+            break;
+        //changed bytes, a single unchanged byte is cheaper to keep in the literal run
+        start = i;
+        uint8_t *token = out++;
+        while (i < size && i - start < 128) {
+            if (current[i] == reference[i] && (i + 1 >= size || current[i + 1] == reference[i + 1]))
+                break;
+            *out++ = current[i] ^ reference[i];
+            i++;
+        }
+        *token = static_cast<uint8_t>(i - start - 1);
+    }
+    return static_cast<size_t>(out - output);
+}
+
+auto U8g2Recorder::decode(const uint8_t *input, size_t length, uint8_t *frame, size_t size) -> bool {
+    size_t pos = 0;
+    const uint8_t *end = input + length;
+    while (input < end) {
+        uint8_t token = *input++;
+        if (token & 0x80) {
+            pos += token - 0x7f;
+            if (pos > size)
+                return false;
+            continue;
+        }
+        size_t n = token + 1u;
+        if (pos + n > size || static_cast<size_t>(end - input) < n)
+            return false;
+        for (size_t i = 0; i < n; i++)
+            frame[pos + i] ^= input[i];
+        input += n;
+        pos += n;
+    }
+    return true;
+}
+
+U8g2Replay::~U8g2Replay() {
+    close();
+}
+
+auto U8g2Replay::open(const std::string &path) -> void {
+    close();
+    m_Fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_Fd < 0)
+        throw std::runtime_error(lastError("Unable to open recording", path));
+    struct stat st{};
+    if (fstat(m_Fd, &st) != 0 || static_cast<size_t>(st.st_size) < RECORDER_DATA_OFFSET) {
+        close();
+        throw std::runtime_error("Not a valid recording '" + path + "'");
+    }
+    m_MapSize = static_cast<size_t>(st.st_size);
+    void *map = mmap(nullptr, m_MapSize, PROT_READ, MAP_SHARED, m_Fd, 0);
+    if (map == MAP_FAILED) {
+        std::string error = lastError("Unable to map recording", path);
+        close();
+        throw std::runtime_error(error);
+    }
+    m_Map = static_cast<const uint8_t *>(map);
+
+    //work on a snapshot of the header, the file may still be recorded to
+    memcpy(&m_Header, m_Map, sizeof(m_Header));
+    if (memcmp(m_Header.magic, RECORDER_MAGIC, sizeof(RECORDER_MAGIC)) != 0 || m_Header.version != RECORDER_VERSION ||
+        m_Header.frame_size == 0 || m_Header.capacity > m_MapSize - RECORDER_DATA_OFFSET || m_Header.tail >= m_Header.capacity) {
+        close();
+        throw std::runtime_error("Not a valid recording '" + path + "'");
+    }
+
+    const uint8_t *data = m_Map + RECORDER_DATA_OFFSET;
+    uint64_t offset = m_Header.tail;
+    m_Frames.reserve(m_Header.frame_count);
+    for (uint64_t i = 0; i < m_Header.frame_count; i++) {
+        offset = normalize(data, m_Header.capacity, offset);
+        auto record = reinterpret_cast<const ucgd_rec_frame_t *>(data + offset);
+        if (offset + sizeof(ucgd_rec_frame_t) + record->size > m_Header.capacity)
+            break;
+        m_Frames.push_back(record);
+        offset += recordLength(record);
+    }
+    m_Current.assign(m_Header.frame_size, 0);
+    m_CurrentIndex = -1;
+}
+
+auto U8g2Replay::close() -> void {
+    if (m_Map != nullptr)
+        munmap(const_cast<uint8_t *>(m_Map), m_MapSize);
+    if (m_Fd >= 0)
+        ::close(m_Fd);
+    m_Fd = -1;
+    m_Map = nullptr;
+    m_MapSize = 0;
+    m_Frames.clear();
+    m_CurrentIndex = -1;
+}
+
+auto U8g2Replay::getHeader() const -> const ucgd_rec_header_t & {
+    return m_Header;
+}
+
+auto U8g2Replay::getFrameCount() const -> size_t {
+    return m_Frames.size();
+}
+
+auto U8g2Replay::readFrame(size_t index, uint8_t *output, uint64_t *timestamp) -> bool {
+    if (index >= m_Frames.size() || output == nullptr)
+        return false;
+    if (m_CurrentIndex != static_cast<long>(index)) {
+        long keyframe = static_cast<long>(index);
+        while (keyframe >= 0 && !(m_Frames[keyframe]->flags & RECORDER_FLAG_KEYFRAME))
+            keyframe--;
+        if (keyframe < 0)
+            return false;
+        //continue from the current frame if it is between the keyframe and the requested frame
+        long start = (m_CurrentIndex >= keyframe && m_CurrentIndex < static_cast<long>(index)) ? m_CurrentIndex + 1 : keyframe;
+        m_CurrentIndex = -1;
+        for (long i = start; i <= static_cast<long>(index); i++) {
+            auto record = m_Frames[i];
+            if (record->flags & RECORDER_FLAG_KEYFRAME)
+                std::fill(m_Current.begin(), m_Current.end(), 0);
+            if (!U8g2Recorder::decode(reinterpret_cast<const uint8_t *>(record + 1), record->size, m_Current.data(), m_Current.size()))
+                return false;
+        }
+        m_CurrentIndex = static_cast<long>(index);
+    }
+    memcpy(output, m_Current.data(), m_Current.size());
+    if (timestamp != nullptr)
+        *timestamp = m_Frames[index]->timestamp;
+    return true;
+}
@@ -0,0 +1,194 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2RECORDER_H
+#define UCGD_MOD_GRAPHICS_U8G2RECORDER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define RECORDER_DEFAULT_CAPACITY (4 * 1024 * 1024)
+#define RECORDER_DEFAULT_KEYFRAME_INTERVAL 256
+
+//The recording holds the raw u8g2 tile buffer, vertical_top_lsb layout ([page][column], lsb on top)
+#define RECORDER_LAYOUT_VERTICAL 0
+//The recording holds the raw u8g2 tile buffer, horizontal_right_lsb layout ([row][byte], msb on the left)
+#define RECORDER_LAYOUT_HORIZONTAL 1
+
+#define RECORDER_FLAG_KEYFRAME 0x1
+//The rest of the data region is unused, the next record starts at offset 0
+#define RECORDER_FLAG_WRAP 0x2
+
+//File header (the data region starts at RECORDER_DATA_OFFSET)
+struct ucgd_rec_header_t {
+    char magic[8];
+    uint32_t version;
+    uint32_t frame_size;
+    uint16_t width;
+    uint16_t height;
+    uint32_t layout;
+    uint32_t keyframe_interval;
+    uint32_t reserved;
+    //size of the data region
+    uint64_t capacity;
+    //offset of the next record
+    uint64_t head;
+    //offset of the oldest record (always a keyframe)
+    uint64_t tail;
+    //number of frames between tail and head
+    uint64_t frame_count;
+    //sequence number of the frame at tail
+    uint64_t first_frame;
+};
+
+//Record header, followed by the encoded frame and padded to 8 bytes
+struct ucgd_rec_frame_t {
+    uint32_t size;
+    uint32_t flags;
+    //wall clock time in nanoseconds since the epoch
+    uint64_t timestamp;
+};
+
+#define RECORDER_MAGIC "UCGDREC"
+#define RECORDER_VERSION 1
+#define RECORDER_DATA_OFFSET 4096
+
+/**
+ * Appends the frames sent to the display to a memory mapped ring file.
+ *
+ * Each frame is stored as the xor of the previous frame, run length encoded (runs of unchanged bytes cost one byte
+ * per 128 bytes). Every keyframe_interval frames the full frame is stored instead (encoded against an empty frame)
+ * so the recording can still be replayed after the oldest frames have been overwritten. When the ring is full, the
+ * oldest keyframe and all of its deltas are dropped together.
+ */
+class U8g2Recorder {
+public:
+    U8g2Recorder() = default;
+
+    U8g2Recorder(const U8g2Recorder &) = delete;
+
+    U8g2Recorder &operator=(const U8g2Recorder &) = delete;
+
+    virtual ~U8g2Recorder();
+
+    /**
+     * Create (or truncate) the recording file and map it.
+     *
+     * @param capacity Size of the data region in bytes, the file is RECORDER_DATA_OFFSET bytes larger
+     * @throws std::runtime_error if the file cannot be created or the capacity cannot hold a few frames
+     */
+    auto open(const std::string &path, size_t capacity, int width, int height, int layout, int keyframeInterval = RECORDER_DEFAULT_KEYFRAME_INTERVAL) -> void;
+
+    //Flush and unmap the file
+    auto close() -> void;
+
+    [[nodiscard]] auto isOpen() const -> bool;
+
+    /**
+     * Append a frame. Ignored if the recorder is not open.
+     *
+     * @throws std::runtime_error if the size differs from the frame size of the recording
+     */
+    auto record(const uint8_t *frame, size_t size) -> void;
+
+    /**
+     * Append a frame with an explicit timestamp (in nanoseconds)
+     */
+    auto record(const uint8_t *frame, size_t size, uint64_t timestamp) -> void;
+
+    [[nodiscard]] auto getFrameCount() const -> uint64_t;
+
+    //Worst case size of an encoded frame
+    static auto getMaxEncodedSize(size_t frameSize) -> size_t;
+
+    //Run length encode current xor reference into output. Returns the number of bytes written.
+    static auto encode(const uint8_t *current, const uint8_t *reference, size_t size, uint8_t *output) -> size_t;
+
+    //Apply an encoded delta to frame (xor). Returns false if the encoded data is malformed.
+    static auto decode(const uint8_t *input, size_t length, uint8_t *frame, size_t size) -> bool;
+
+private:
+    auto reserve(size_t length) -> void;
+
+    auto evict() -> void;
+
+    auto recordAt(uint64_t offset) const -> ucgd_rec_frame_t *;
+
+    int m_Fd = -1;
+    uint8_t *m_Map = nullptr;
+    size_t m_MapSize = 0;
+    ucgd_rec_header_t *m_Header = nullptr;
+    uint8_t *m_Data = nullptr;
+    uint32_t m_SinceKeyframe = 0;
+    std::vector<uint8_t> m_Previous;
+    std::vector<uint8_t> m_Empty;
+};
+
+/**
+ * Read-only view of a recording. Frames are numbered from 0 (the oldest retained frame).
+ */
+class U8g2Replay {
+public:
+    U8g2Replay() = default;
+
+    U8g2Replay(const U8g2Replay &) = delete;
+
+    U8g2Replay &operator=(const U8g2Replay &) = delete;
+
+    virtual ~U8g2Replay();
+
+    /**
+     * Map the recording and index its frames
+     *
+     * @throws std::runtime_error if the file cannot be opened or is not a valid recording
+     */
+    auto open(const std::string &path) -> void;
+
+    auto close() -> void;
+
+    [[nodiscard]] auto getHeader() const -> const ucgd_rec_header_t &;
+
+    [[nodiscard]] auto getFrameCount() const -> size_t;
+
+    /**
+     * Rebuild a frame. Reading frames in increasing order only decodes one delta per frame, otherwise decoding starts
+     * from the closest keyframe.
+     *
+     * @param output Receives header.frame_size bytes
+     * @param timestamp Receives the timestamp of the frame (optional)
+     * @return false if the index is out of range or the record is malformed
+     */
+    auto readFrame(size_t index, uint8_t *output, uint64_t *timestamp = nullptr) -> bool;
+
+private:
+    int m_Fd = -1;
+    const uint8_t *m_Map = nullptr;
+    size_t m_MapSize = 0;
+    ucgd_rec_header_t m_Header{};
+    std::vector<const ucgd_rec_frame_t *> m_Frames;
+    std::vector<uint8_t> m_Current;
+    //index of the frame held by m_Current, or -1
+    long m_CurrentIndex = -1;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2RECORDER_H
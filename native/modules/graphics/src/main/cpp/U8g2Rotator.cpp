@@ -0,0 +1,275 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include "U8g2Rotator.h"
+
+namespace {
+    /**
+     * Transpose an 8x8 bit matrix (bit j of byte i becomes bit i of byte j)
+     */
+    inline uint64_t transpose8x8(uint64_t x) {
+        uint64_t t;
+        t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+        x = x ^ t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+        x = x ^ t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+        x = x ^ t ^ (t << 28);
+        return x;
+    }
+
+    //reverse the order of the bytes (rows of the matrix)
+    inline uint64_t reverseBytes(uint64_t x) {
+        return __builtin_bswap64(x);
+    }
+
+    //reverse the bits of each byte (columns of the matrix)
+    inline uint64_t reverseBits(uint64_t x) {
+        x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+        x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+        x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        return x;
+    }
+
+    //byte i of the word is p[i * step]
+    inline uint64_t load(const uint8_t *p, size_t step) {
+        uint64_t x = 0;
+        for (int i = 0; i < 8; i++)
+            x |= static_cast<uint64_t>(p[i * step]) << (8 * i);
+        return x;
+    }
+
+    inline void store(uint8_t *p, size_t step, uint64_t x) {
+        for (int i = 0; i < 8; i++)
+            p[i * step] = static_cast<uint8_t>(x >> (8 * i));
+    }
+
+    inline uint8_t reverse8(uint8_t b) {
+        return static_cast<uint8_t>(reverseBits(b));
+    }
+
+    /**
+     * Same as u8g2_update_dimension_r0, except that the canvas is as wide as the display is high (and as high as the display is wide).
+     * The canvas keeps the stride of the display buffer, so pixel_buf_width remains the width of the buffer.
+     */
+    void updateDimensionCanvas(u8g2_t *u8g2) {
+        const u8x8_display_info_t *info = u8g2_GetU8x8(u8g2)->display_info;
+        u8g2->pixel_buf_width = info->tile_width * 8;
+        u8g2->pixel_buf_height = u8g2->tile_buf_height * 8;
+        u8g2->pixel_curr_row = u8g2->tile_curr_row * 8;
+        u8g2->buf_y0 = u8g2->pixel_curr_row;
+        u8g2->buf_y1 = u8g2->buf_y0 + u8g2->pixel_buf_height;
+        u8g2->width = info->pixel_height;
+        u8g2->height = info->pixel_width;
+    }
+
+    const u8g2_cb_t canvasCallbacks = {updateDimensionCanvas, u8g2_update_page_win_r0, u8g2_draw_l90_r0};
+
+    /**
+     * Points u8g2 to the display buffer for the lifetime of the scope (the byte callback may throw while sending)
+     */
+    class DisplayBufferScope {
+    public:
+        DisplayBufferScope(u8g2_t *u8g2, uint8_t *buffer, uint8_t tileHeight) : m_U8g2(u8g2), m_Canvas(u8g2->tile_buf_ptr), m_CanvasTileHeight(u8g2->tile_buf_height) {
+            u8g2->tile_buf_ptr = buffer;
+            u8g2->tile_buf_height = tileHeight;
+        }
+
+        ~DisplayBufferScope() {
+            m_U8g2->tile_buf_ptr = m_Canvas;
+            m_U8g2->tile_buf_height = m_CanvasTileHeight;
+        }
+
+    private:
+        u8g2_t *m_U8g2;
+        uint8_t *m_Canvas;
+        uint8_t m_CanvasTileHeight;
+    };
+}
+
+U8g2Rotator::U8g2Rotator(u8g2_t *u8g2) : m_Buffer(u8g2->tile_buf_ptr), m_TileBufHeight(u8g2->tile_buf_height),
+                                         m_TileWidth(u8g2_GetU8x8(u8g2)->display_info->tile_width),
+                                         m_TileHeight(u8g2_GetU8x8(u8g2)->display_info->tile_height),
+                                         m_Vertical(u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb) {
+}
+
+auto U8g2Rotator::setRotation(u8g2_t *u8g2, const u8g2_cb_t *rotation) -> void {
+    int turns = 0;
+    if (rotation == U8G2_R1)
+        turns = 1;
+    else if (rotation == U8G2_R2)
+        turns = 2;
+    else if (rotation == U8G2_R3)
+        turns = 3;
+
+    bool layout = u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb || u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb;
+    bool fullBuffer = m_Buffer != nullptr && m_TileBufHeight >= m_TileHeight;
+    if (turns == 0 || !layout || !fullBuffer || (turns != 2 && m_TileHeight > m_TileWidth)) {
+        m_Turns = 0;
+        m_Canvas.clear();
+        m_Canvas.shrink_to_fit();
+        u8g2->tile_buf_ptr = m_Buffer;
+        u8g2->tile_buf_height = m_TileBufHeight;
+        u8g2_SetDisplayRotation(u8g2, rotation);
+        return;
+    }
+
+    //quarter turns draw into a portrait canvas (tileWidth pages/rows of the display stride), a half turn into a canvas of the display size
+    int tileRows = (turns == 2) ? m_TileHeight : m_TileWidth;
+    m_Turns = turns;
+    m_Canvas.assign(static_cast<size_t>(tileRows) * m_TileWidth * 8, 0);
+    u8g2->tile_buf_ptr = m_Canvas.data();
+    u8g2->tile_buf_height = static_cast<uint8_t>(tileRows);
+    u8g2_SetDisplayRotation(u8g2, (turns == 2) ? U8G2_R0 : &canvasCallbacks);
+}
+
+auto U8g2Rotator::isActive() const -> bool {
+    return m_Turns != 0;
+}
+
+auto U8g2Rotator::rotate() -> void {
+    if (m_Turns != 0)
+        rotate(m_Canvas.data(), m_Buffer, m_TileWidth, m_TileHeight, m_Vertical, m_Turns);
+}
+
+auto U8g2Rotator::sendBuffer(u8g2_t *u8g2) -> void {
+    if (m_Turns == 0) {
+        u8g2_SendBuffer(u8g2);
+        return;
+    }
+    rotate();
+    DisplayBufferScope scope(u8g2, m_Buffer, m_TileBufHeight);
+    u8g2_SendBuffer(u8g2);
+}
+
+auto U8g2Rotator::mapArea(int &tx, int &ty, int &tw, int &th) const -> bool {
+    //clip to the canvas, then map the tile area to the display
+    int canvasWidth = (m_Turns % 2 == 0) ? m_TileWidth : m_TileHeight;
+    int canvasHeight = (m_Turns % 2 == 0) ? m_TileHeight : m_TileWidth;
+    int x0 = std::max(tx, 0), y0 = std::max(ty, 0);
+    int x1 = std::min(tx + tw, canvasWidth), y1 = std::min(ty + th, canvasHeight);
+    if (x0 >= x1 || y0 >= y1)
+        return false;
+    switch (m_Turns) {
+        case 0:
+            tx = x0;
+            ty = y0;
+            break;
+        case 1:
+            tx = m_TileWidth - y1;
+            ty = x0;
+            break;
+        case 2:
+            tx = m_TileWidth - x1;
+            ty = m_TileHeight - y1;
+            break;
+        default:
+            tx = y0;
+            ty = m_TileHeight - x1;
+            break;
+    }
+    tw = (m_Turns % 2 == 0) ? x1 - x0 : y1 - y0;
+    th = (m_Turns % 2 == 0) ? y1 - y0 : x1 - x0;
+    return true;
+}
+
+auto U8g2Rotator::updateDisplayArea(u8g2_t *u8g2, int tx, int ty, int tw, int th) -> void {
+    if (m_Turns == 0) {
+        u8g2_UpdateDisplayArea(u8g2, tx, ty, tw, th);
+        return;
+    }
+    if (!mapArea(tx, ty, tw, th))
+        return;
+    rotate();
+    DisplayBufferScope scope(u8g2, m_Buffer, m_TileBufHeight);
+    u8g2_UpdateDisplayArea(u8g2, static_cast<uint8_t>(tx), static_cast<uint8_t>(ty), static_cast<uint8_t>(tw), static_cast<uint8_t>(th));
+}
+
+auto U8g2Rotator::getBuffer() const -> uint8_t * {
+    return m_Buffer;
+}
+
+auto U8g2Rotator::getBufferSize() const -> size_t {
+    return static_cast<size_t>(m_TileWidth) * m_TileBufHeight * 8;
+}
+
+auto U8g2Rotator::getTileHeight() const -> int {
+    return m_TileBufHeight;
+}
+
+auto U8g2Rotator::rotate(const uint8_t *canvas, uint8_t *buffer, int tileWidth, int tileHeight, bool vertical, int turns) -> void {
+    const size_t width = static_cast<size_t>(tileWidth) * 8;
+    const size_t height = static_cast<size_t>(tileHeight) * 8;
+
+    if (vertical) {
+        //pages of 'width' column bytes, bit 0 = top row. Each 8x8 block of the display comes from one block of the canvas.
+        for (int page = 0; page < tileHeight; page++) {
+            uint8_t *dst = buffer + page * width;
+            for (int q = 0; q < tileWidth; q++) {
+                uint64_t block;
+                switch (turns) {
+                    case 1:
+                        //display column 8q + k is canvas row width - 1 - 8q - k
+                        block = load(canvas + (tileWidth - 1 - q) * width + page * 8, 1);
+                        block = reverseBytes(transpose8x8(block));
+                        break;
+                    case 2:
+                        block = load(canvas + (tileHeight - 1 - page) * width + (width - 8 - q * 8), 1);
+                        block = reverseBytes(reverseBits(block));
+                        break;
+                    default:
+                        //display row 8p + j is canvas column height - 1 - 8p - j
+                        block = load(canvas + q * width + (height - 8 - page * 8), 1);
+                        block = reverseBits(transpose8x8(block));
+                        break;
+                }
+                store(dst + q * 8, 1, block);
+            }
+        }
+        return;
+    }
+
+    //rows of tileWidth bytes, msb = leftmost pixel
+    if (turns == 2) {
+        for (size_t row = 0; row < height; row++) {
+            const uint8_t *src = canvas + (height - 1 - row) * tileWidth;
+            uint8_t *dst = buffer + row * tileWidth;
+            for (int b = 0; b < tileWidth; b++)
+                dst[b] = reverse8(src[tileWidth - 1 - b]);
+        }
+        return;
+    }
+    for (int r = 0; r < tileHeight; r++) {
+        for (int q = 0; q < tileWidth; q++) {
+            uint64_t block;
+            if (turns == 1) {
+                block = load(canvas + (width - 8 - q * 8) * tileWidth + r, tileWidth);
+                block = reverseBytes(transpose8x8(block));
+            } else {
+                block = load(canvas + (q * 8) * tileWidth + (tileHeight - 1 - r), tileWidth);
+                block = reverseBits(transpose8x8(block));
+            }
+            store(buffer + (r * 8) * tileWidth + q, tileWidth, block);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2ROTATOR_H
+#define UCGD_MOD_GRAPHICS_U8G2ROTATOR_H
+
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+/**
+ * Renders rotated displays (R1, R2 and R3) into an unrotated canvas and rotates the whole canvas into the display buffer
+ * when it is sent. u8g2 does not transform the coordinates of each primitive and the fast paths for unrotated buffers
+ * (glyph cache, sprites, blitter) stay available. The rotation is done with 8x8 bit matrix transposes on 64-bit words.
+ *
+ * Only full buffer setup procedures (_f) are supported. For R1/R3 the canvas uses the stride of the display buffer, so the
+ * display must not be taller than wide. Everything else is left to the rotation of u8g2.
+ */
+class U8g2Rotator {
+public:
+    /**
+     * @param u8g2 The display, the display buffer must already be assigned
+     */
+    explicit U8g2Rotator(u8g2_t *u8g2);
+
+    /**
+     * Apply a rotation to the display. Falls back to the rotation of u8g2 if the rotation can not be done at send time.
+     */
+    auto setRotation(u8g2_t *u8g2, const u8g2_cb_t *rotation) -> void;
+
+    /**
+     * @return true if the display is drawn into the canvas
+     */
+    auto isActive() const -> bool;
+
+    /**
+     * Rotate the canvas into the display buffer
+     */
+    auto rotate() -> void;
+
+    /**
+     * Rotate the canvas and send the display buffer (u8g2_SendBuffer)
+     */
+    auto sendBuffer(u8g2_t *u8g2) -> void;
+
+    /**
+     * Rotate the canvas and send an area of the display buffer (u8g2_UpdateDisplayArea). The area is specified in tiles of the canvas.
+     */
+    auto updateDisplayArea(u8g2_t *u8g2, int tx, int ty, int tw, int th) -> void;
+
+    /**
+     * Map an area in tiles of the canvas to tiles of the display buffer (clipped to the canvas).
+     *
+     * @return false if the area is outside of the canvas
+     */
+    auto mapArea(int &tx, int &ty, int &tw, int &th) const -> bool;
+
+    /**
+     * @return The display buffer (holds the last rotated frame)
+     */
+    auto getBuffer() const -> uint8_t *;
+
+    /**
+     * @return The size of the display buffer in bytes
+     */
+    auto getBufferSize() const -> size_t;
+
+    /**
+     * @return The number of tile rows of the display buffer
+     */
+    auto getTileHeight() const -> int;
+
+    /**
+     * Rotate an unrotated canvas into a display buffer.
+     *
+     * @param canvas The canvas, same stride as the buffer (tileWidth * 8 bytes per page or tileWidth bytes per row)
+     * @param buffer The display buffer
+     * @param vertical true for the vertical_top_lsb layout, false for horizontal_right_lsb
+     * @param turns Number of clockwise quarter turns (1 = R1, 2 = R2, 3 = R3)
+     */
+    static auto rotate(const uint8_t *canvas, uint8_t *buffer, int tileWidth, int tileHeight, bool vertical, int turns) -> void;
+
+private:
+    uint8_t *m_Buffer;
+    uint8_t m_TileBufHeight;
+    int m_TileWidth;
+    int m_TileHeight;
+    bool m_Vertical;
+    int m_Turns = 0;
+    std::vector<uint8_t> m_Canvas;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2ROTATOR_H
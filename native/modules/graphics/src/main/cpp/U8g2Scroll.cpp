@@ -0,0 +1,367 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "U8g2Scroll.h"
+
+namespace {
+    constexpr uint64_t LANES = 0x0101010101010101ULL;
+
+    /**
+     * Mask of the bits in a page (bit 0 = top row) that belong to the rows [y0, y1)
+     */
+    inline uint8_t pageMask(int page, int y0, int y1) {
+        int lo = std::max(y0 - page * 8, 0);
+        int hi = std::min(y1 - page * 8, 8);
+        if (lo >= hi)
+            return 0;
+        return static_cast<uint8_t>(((1U << hi) - 1) & ~((1U << lo) - 1));
+    }
+
+    /**
+     * Mask of the bits in a row byte (msb = leftmost pixel) that belong to the columns [x0, x1)
+     */
+    inline uint8_t byteMask(int byte, int x0, int x1) {
+        int left = std::max(x0 - byte * 8, 0);
+        int right = std::min(x1 - byte * 8, 8);
+        if (left >= right)
+            return 0;
+        return static_cast<uint8_t>((0xffU >> left) & (0xffU << (8 - right)));
+    }
+
+    inline void merge(uint8_t *dst, uint8_t value, uint8_t mask) {
+        *dst = static_cast<uint8_t>((*dst & ~mask) | (value & mask));
+    }
+
+    //shift each of the 8 byte lanes of the word, bits do not cross lanes
+    inline uint64_t laneShl(uint64_t v, int r) {
+        return (v << r) & (LANES * ((0xffU << r) & 0xffU));
+    }
+
+    inline uint64_t laneShr(uint64_t v, int r) {
+        return (v >> r) & (LANES * (0xffU >> r));
+    }
+
+    inline uint64_t loadBE64(const uint8_t *p) {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; i++)
+            v = (v << 8) | p[i];
+        return v;
+    }
+}
+
+auto U8g2Scroll::scroll(u8g2_t *u8g2, int x, int y, int width, int height, int dx, int dy, bool fill) -> bool {
+    int layout;
+    if (u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb)
+        layout = SCROLL_LAYOUT_VERTICAL;
+    else if (u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb)
+        layout = SCROLL_LAYOUT_HORIZONTAL;
+    else
+        return false;
+    if (u8g2->tile_buf_ptr == nullptr)
+        return false;
+    if (width <= 0 || height <= 0 || (dx == 0 && dy == 0))
+        return true;
+
+    //clip the region to the display, then map the region and the direction to buffer coordinates (same transformations
+    //as the u8g2_draw_l90_* callbacks, the canvas of U8g2Rotator is unrotated)
+    const u8g2_cb_t *cb = u8g2->cb;
+    int uw = u8g2->width, uh = u8g2->height;
+    int ux1 = std::min(x + width, uw), uy1 = std::min(y + height, uh);
+    x = std::max(x, 0);
+    y = std::max(y, 0);
+    if (x >= ux1 || y >= uy1)
+        return true;
+    width = ux1 - x;
+    height = uy1 - y;
+    int bx, by, bw = width, bh = height, bdx = dx, bdy = dy;
+    if (cb->draw_l90 == u8g2_draw_l90_r0) {
+        bx = x;
+        by = y;
+    } else if (cb == U8G2_R1) {
+        bx = uh - (y + height);
+        by = x;
+        bw = height;
+        bh = width;
+        bdx = -dy;
+        bdy = dx;
+    } else if (cb == U8G2_R2) {
+        bx = uw - (x + width);
+        by = uh - (y + height);
+        bdx = -dx;
+        bdy = -dy;
+    } else if (cb == U8G2_R3) {
+        bx = y;
+        by = uw - (x + width);
+        bw = height;
+        bh = width;
+        bdx = dy;
+        bdy = -dx;
+    } else if (cb == U8G2_MIRROR) {
+        bx = uw - (x + width);
+        by = y;
+        bdx = -dx;
+    } else {
+        return false;
+    }
+
+    int tileWidth = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+    int tileHeight = u8g2->tile_buf_height;
+    by -= u8g2->pixel_curr_row;
+    int x0 = std::max(bx, 0), y0 = std::max(by, 0);
+    int x1 = std::min(bx + bw, tileWidth * 8), y1 = std::min(by + bh, tileHeight * 8);
+    shift(u8g2->tile_buf_ptr, tileWidth, tileHeight, layout, x0, y0, x1, y1, bdx, bdy, fill);
+    return true;
+}
+
+auto U8g2Scroll::shift(uint8_t *buffer, int tileWidth, int tileHeight, int layout, int x0, int y0, int x1, int y1, int dx, int dy, bool fill) -> void {
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    if (std::abs(dx) >= x1 - x0 || std::abs(dy) >= y1 - y0) {
+        fillRegion(buffer, tileWidth, layout, x0, y0, x1, y1, fill);
+        return;
+    }
+    //a diagonal move is a horizontal move followed by a vertical move, both vacate into the fill value
+    if (layout == SCROLL_LAYOUT_VERTICAL) {
+        if (dx != 0)
+            shiftVerticalX(buffer, tileWidth * 8, x0, y0, x1, y1, dx, fill);
+        if (dy != 0)
+            shiftVerticalY(buffer, tileWidth * 8, x0, y0, x1, y1, dy, fill);
+    } else {
+        if (dx != 0)
+            shiftHorizontalX(buffer, tileWidth, x0, y0, x1, y1, dx, fill);
+        if (dy != 0)
+            shiftHorizontalY(buffer, tileWidth, x0, y0, x1, y1, dy, fill);
+    }
+}
+
+auto U8g2Scroll::fillRegion(uint8_t *buffer, int stride, int layout, int x0, int y0, int x1, int y1, bool fill) -> void {
+    uint8_t value = fill ? 0xff : 0x00;
+    if (layout == SCROLL_LAYOUT_VERTICAL) {
+        int bufWidth = stride * 8;
+        for (int page = y0 >> 3; page <= (y1 - 1) >> 3; page++) {
+            uint8_t mask = pageMask(page, y0, y1);
+            uint8_t *row = buffer + page * bufWidth;
+            if (mask == 0xff) {
+                std::memset(row + x0, value, x1 - x0);
+            } else {
+                for (int col = x0; col < x1; col++)
+                    merge(row + col, value, mask);
+            }
+        }
+    } else {
+        int first = x0 >> 3, last = (x1 - 1) >> 3;
+        for (int y = y0; y < y1; y++) {
+            uint8_t *row = buffer + y * stride;
+            for (int b = first; b <= last; b++)
+                merge(row + b, value, byteMask(b, x0, x1));
+        }
+    }
+}
+
+auto U8g2Scroll::shiftVerticalX(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dx, bool fill) -> void {
+    uint8_t value = fill ? 0xff : 0x00;
+    int n = std::abs(dx);
+    int keep = (x1 - x0) - n;
+    for (int page = y0 >> 3; page <= (y1 - 1) >> 3; page++) {
+        uint8_t mask = pageMask(page, y0, y1);
+        uint8_t *row = buffer + page * stride;
+        //the page holds whole columns of the region: move the bytes
+        if (mask == 0xff) {
+            if (dx > 0) {
+                std::memmove(row + x0 + n, row + x0, keep);
+                std::memset(row + x0, value, n);
+            } else {
+                std::memmove(row + x0, row + x0 + n, keep);
+                std::memset(row + x1 - n, value, n);
+            }
+            continue;
+        }
+        if (dx > 0) {
+            for (int col = x1 - 1; col >= x0 + n; col--)
+                merge(row + col, row[col - n], mask);
+            for (int col = x0; col < x0 + n; col++)
+                merge(row + col, value, mask);
+        } else {
+            for (int col = x0; col < x1 - n; col++)
+                merge(row + col, row[col + n], mask);
+            for (int col = x1 - n; col < x1; col++)
+                merge(row + col, value, mask);
+        }
+    }
+}
+
+auto U8g2Scroll::shiftVerticalY(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dy, bool fill) -> void {
+    int firstPage = y0 >> 3, lastPage = (y1 - 1) >> 3;
+    int n = std::abs(dy);
+    int q = n >> 3, r = n & 7;
+    uint64_t fillWord = fill ? ~0ULL : 0ULL;
+
+    //8 columns are processed at once, one byte lane per column
+    for (int col = x0; col < x1; col += 8) {
+        auto count = static_cast<size_t>(std::min(8, x1 - col));
+        //read a page of the region, the rows outside of the region read as the fill value
+        auto load = [&](int page) -> uint64_t {
+            if (page < firstPage || page > lastPage)
+                return fillWord;
+            uint64_t mask = LANES * pageMask(page, y0, y1);
+            uint64_t word = 0;
+            std::memcpy(&word, buffer + page * stride + col, count);
+            return (word & mask) | (fillWord & ~mask);
+        };
+        auto store = [&](int page, uint64_t value) {
+            uint64_t mask = LANES * pageMask(page, y0, y1);
+            uint8_t *dst = buffer + page * stride + col;
+            uint64_t word = 0;
+            std::memcpy(&word, dst, count);
+            word = (word & ~mask) | (value & mask);
+            std::memcpy(dst, &word, count);
+        };
+
+        if (dy > 0) {
+            //moving down (towards the msb): the source pages are above, walk upwards
+            for (int page = lastPage; page >= firstPage; page--) {
+                uint64_t value = laneShl(load(page - q), r);
+                if (r != 0)
+                    value |= laneShr(load(page - q - 1), 8 - r);
+                store(page, value);
+            }
+        } else {
+            for (int page = firstPage; page <= lastPage; page++) {
+                uint64_t value = laneShr(load(page + q), r);
+                if (r != 0)
+                    value |= laneShl(load(page + q + 1), 8 - r);
+                store(page, value);
+            }
+        }
+    }
+}
+
+auto U8g2Scroll::shiftHorizontalX(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dx, bool fill) -> void {
+    uint8_t value = fill ? 0xff : 0x00;
+    int first = x0 >> 3, last = (x1 - 1) >> 3;
+
+    //tile aligned: whole bytes move
+    if (((x0 | x1 | dx) & 7) == 0) {
+        int n = std::abs(dx) >> 3;
+        int keep = (last - first + 1) - n;
+        for (int y = y0; y < y1; y++) {
+            uint8_t *row = buffer + y * stride;
+            if (dx > 0) {
+                std::memmove(row + first + n, row + first, keep);
+                std::memset(row + first, value, n);
+            } else {
+                std::memmove(row + first, row + first + n, keep);
+                std::memset(row + last + 1 - n, value, n);
+            }
+        }
+        return;
+    }
+
+    //the row is copied into a scratch line padded with the fill value, so the source of any destination word can be
+    //read as 64 consecutive bits without bound checks (|dx| is smaller than the width of the buffer)
+    int origin = stride + 8;
+    std::vector<uint8_t> line(static_cast<size_t>(3 * stride + 16));
+    uint8_t leftMask = byteMask(first, x0, x1);
+    uint8_t rightMask = byteMask(last, x0, x1);
+    for (int y = y0; y < y1; y++) {
+        uint8_t *row = buffer + y * stride;
+        std::memset(line.data(), value, line.size());
+        std::memcpy(line.data() + origin + first, row + first, last - first + 1);
+        merge(line.data() + origin + first, value, static_cast<uint8_t>(~leftMask));
+        merge(line.data() + origin + last, value, static_cast<uint8_t>(~rightMask));
+
+        for (int b = first; b <= last; b += 8) {
+            long bit = static_cast<long>(origin + b) * 8 - dx;
+            const uint8_t *src = line.data() + (bit >> 3);
+            int s = static_cast<int>(bit & 7);
+            uint64_t word = loadBE64(src);
+            if (s != 0)
+                word = (word << s) | (src[8] >> (8 - s));
+            int count = std::min(8, last - b + 1);
+            for (int k = 0; k < count; k++)
+                merge(row + b + k, static_cast<uint8_t>(word >> (56 - 8 * k)), byteMask(b + k, x0, x1));
+        }
+    }
+}
+
+auto U8g2Scroll::shiftHorizontalY(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dy, bool fill) -> void {
+    uint8_t value = fill ? 0xff : 0x00;
+    int first = x0 >> 3, last = (x1 - 1) >> 3;
+    uint8_t leftMask = byteMask(first, x0, x1);
+    uint8_t rightMask = byteMask(last, x0, x1);
+    int n = std::abs(dy);
+
+    auto copyRow = [&](int dstY, int srcY) {
+        uint8_t *dst = buffer + dstY * stride;
+        const uint8_t *src = buffer + srcY * stride;
+        if (first == last) {
+            merge(dst + first, src[first], leftMask);
+            return;
+        }
+        merge(dst + first, src[first], leftMask);
+        if (last - first > 1)
+            std::memcpy(dst + first + 1, src + first + 1, last - first - 1);
+        merge(dst + last, src[last], rightMask);
+    };
+    auto fillRow = [&](int y) {
+        uint8_t *dst = buffer + y * stride;
+        for (int b = first; b <= last; b++)
+            merge(dst + b, value, byteMask(b, x0, x1));
+    };
+
+    if (dy > 0) {
+        for (int y = y1 - 1; y >= y0 + n; y--)
+            copyRow(y, y - n);
+        for (int y = y0; y < y0 + n; y++)
+            fillRow(y);
+    } else {
+        for (int y = y0; y < y1 - n; y++)
+            copyRow(y, y + n);
+        for (int y = y1 - n; y < y1; y++)
+            fillRow(y);
+    }
+}
+
+auto U8g2Scroll::hasHardwareScroll(const std::string &setupProcName) -> bool {
+    return setupProcName.find("ssd1306") != std::string::npos || setupProcName.find("ssd1309") != std::string::npos;
+}
+
+auto U8g2Scroll::startHardwareScroll(u8g2_t *u8g2, int direction, int startPage, int endPage, int interval, int verticalOffset) -> void {
+    //the scroll has to be deactivated before its parameters are changed
+    if (direction == SCROLL_RIGHT || direction == SCROLL_LEFT) {
+        u8g2_SendF(u8g2, "ccaaaaaac", 0x2e, direction == SCROLL_RIGHT ? 0x26 : 0x27,
+                   0x00, startPage, interval, endPage, 0x00, 0xff, 0x2f);
+    } else {
+        //the whole display is the vertical scroll area
+        int rows = u8g2_GetU8x8(u8g2)->display_info->tile_height * 8;
+        u8g2_SendF(u8g2, "ccaacaaaaac", 0x2e, 0xa3, 0x00, rows, direction == SCROLL_VERTICAL_RIGHT ? 0x29 : 0x2a,
+                   0x00, startPage, interval, endPage, verticalOffset, 0x2f);
+    }
+}
+
+auto U8g2Scroll::stopHardwareScroll(u8g2_t *u8g2) -> void {
+    u8g2_SendF(u8g2, "c", 0x2e);
+}
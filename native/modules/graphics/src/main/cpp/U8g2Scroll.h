@@ -0,0 +1,87 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2SCROLL_H
+#define UCGD_MOD_GRAPHICS_U8G2SCROLL_H
+
+#include <cstdint>
+#include <string>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//Buffer layouts supported by the shift routines
+#define SCROLL_LAYOUT_VERTICAL 0
+#define SCROLL_LAYOUT_HORIZONTAL 1
+
+//Hardware scroll directions (SSD1306/SSD1309)
+#define SCROLL_RIGHT 0
+#define SCROLL_LEFT 1
+#define SCROLL_VERTICAL_RIGHT 2
+#define SCROLL_VERTICAL_LEFT 3
+
+/**
+ * Shifts rectangular regions of the u8g2 tile buffer and drives the scroll engine of the controllers that have one
+ */
+class U8g2Scroll {
+public:
+    /**
+     * Shift the pixels inside the region (user coordinates) by dx, dy. Pixels moved out of the region are discarded,
+     * vacated pixels are set to the fill value. In page mode only the rows of the current page are affected.
+     *
+     * @return false if the buffer layout or the display rotation is not supported
+     */
+    static auto scroll(u8g2_t *u8g2, int x, int y, int width, int height, int dx, int dy, bool fill) -> bool;
+
+    /**
+     * Shift a region of a raw tile buffer (buffer coordinates, end exclusive). The region must lie within the buffer.
+     */
+    static auto shift(uint8_t *buffer, int tileWidth, int tileHeight, int layout, int x0, int y0, int x1, int y1, int dx, int dy, bool fill) -> void;
+
+    /**
+     * @return true if the controller of the setup procedure has a scroll engine
+     */
+    static auto hasHardwareScroll(const std::string &setupProcName) -> bool;
+
+    /**
+     * Configure and activate the continuous scroll of the controller. The interval is the 3-bit frame interval code of the controller.
+     */
+    static auto startHardwareScroll(u8g2_t *u8g2, int direction, int startPage, int endPage, int interval, int verticalOffset) -> void;
+
+    /**
+     * Deactivate the scroll of the controller. The display RAM must be rewritten after this call.
+     */
+    static auto stopHardwareScroll(u8g2_t *u8g2) -> void;
+
+private:
+    static auto shiftVerticalX(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dx, bool fill) -> void;
+
+    static auto shiftVerticalY(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dy, bool fill) -> void;
+
+    static auto shiftHorizontalX(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dx, bool fill) -> void;
+
+    static auto shiftHorizontalY(uint8_t *buffer, int stride, int x0, int y0, int x1, int y1, int dy, bool fill) -> void;
+
+    static auto fillRegion(uint8_t *buffer, int stride, int layout, int x0, int y0, int x1, int y1, bool fill) -> void;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2SCROLL_H
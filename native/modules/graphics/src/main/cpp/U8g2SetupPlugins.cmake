@@ -0,0 +1,63 @@
+#
+# THIS IS AN AUTO-GENERATED CODE!! DO NOT MODIFY (Last updated: Sun, 18 Oct 2026 19:26:41 +0000)
+#
+
+set(UCGD_SETUP_CONTROLLERS
+        a2printer
+        hx1230
+        il3820
+        ist3020
+        ist7920
+        ks0108
+        lc7981
+        ld7032
+        ls013b7dh03
+        ls013b7dh05
+        ls027b7dh01
+        max7219
+        nt7534
+        pcd8544
+        pcf8812
+        ra8835
+        s1d15e06
+        sbn1661
+        sed1330
+        sed1520
+        sh1106
+        sh1107
+        sh1108
+        sh1122
+        ssd0323
+        ssd1305
+        ssd1306
+        ssd1309
+        ssd1316
+        ssd1317
+        ssd1318
+        ssd1320
+        ssd1322
+        ssd1325
+        ssd1326
+        ssd1327
+        ssd1329
+        ssd1606
+        ssd1607
+        st7511
+        st75256
+        st7528
+        st75320
+        st7565
+        st7567
+        st7571
+        st7586s
+        st7588
+        st7920
+        t6963
+        uc1601
+        uc1604
+        uc1608
+        uc1610
+        uc1611
+        uc1638
+        uc1701
+        )
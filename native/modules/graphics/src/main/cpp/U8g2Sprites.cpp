@@ -0,0 +1,332 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include "U8g2Sprites.h"
+#include "U8g2Blit.h"
+
+namespace {
+    const int LAYOUT_UNSUPPORTED = 0;
+    const int LAYOUT_VERTICAL = 1;
+    const int LAYOUT_HORIZONTAL = 2;
+
+    inline int layoutOf(u8g2_t *u8g2) {
+        //converted copies are only made for the unrotated buffer (or the canvas of U8g2Rotator), rotated displays go through the blitter
+        if (u8g2->cb->draw_l90 != u8g2_draw_l90_r0 || u8g2->tile_buf_ptr == nullptr)
+            return LAYOUT_UNSUPPORTED;
+        if (u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb)
+            return LAYOUT_VERTICAL;
+        if (u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb)
+            return LAYOUT_HORIZONTAL;
+        return LAYOUT_UNSUPPORTED;
+    }
+
+    inline void applyRow(uint8_t *dst, const uint8_t *src, int count, uint8_t mask, int mode, bool invert) {
+        uint8_t flip = invert ? 0xff : 0;
+        switch (mode) {
+            case BLIT_MODE_CLEAR:
+                for (int i = 0; i < count; i++)
+                    dst[i] &= static_cast<uint8_t>(~((src[i] ^ flip) & mask));
+                break;
+            case BLIT_MODE_SET:
+                for (int i = 0; i < count; i++)
+                    dst[i] |= static_cast<uint8_t>((src[i] ^ flip) & mask);
+                break;
+            default:
+                for (int i = 0; i < count; i++)
+                    dst[i] ^= static_cast<uint8_t>((src[i] ^ flip) & mask);
+                break;
+        }
+    }
+
+    inline uint8_t reverseBits(uint8_t b) {
+        b = static_cast<uint8_t>((b & 0xf0U) >> 4 | (b & 0x0fU) << 4);
+        b = static_cast<uint8_t>((b & 0xccU) >> 2 | (b & 0x33U) << 2);
+        b = static_cast<uint8_t>((b & 0xaaU) >> 1 | (b & 0x55U) << 1);
+        return b;
+    }
+
+    struct clip_t {
+        int x0, y0, x1, y1;
+    };
+
+    inline bool clipSprite(u8g2_t *u8g2, int x, int y, int width, int height, clip_t &clip) {
+        if (u8g2->is_page_clip_window_intersection == 0)
+            return false;
+        clip = {std::max<int>(x, u8g2->user_x0), std::max<int>(y, u8g2->user_y0),
+                std::min<int>(x + width, u8g2->user_x1), std::min<int>(y + height, u8g2->user_y1)};
+        return clip.x0 < clip.x1 && clip.y0 < clip.y1;
+    }
+}
+
+U8g2Sprites::U8g2Sprites(size_t budget) : m_Budget(budget) {
+}
+
+U8g2Sprites::~U8g2Sprites() = default;
+
+auto U8g2Sprites::upload(const uint8_t *data, size_t length, int width, int height, int format) -> uint32_t {
+    if (data == nullptr || width <= 0 || height <= 0 || (format != SPRITE_FORMAT_XBM && format != SPRITE_FORMAT_1BPP))
+        return 0;
+    size_t rowBytes = (static_cast<size_t>(width) + 7) / 8;
+    size_t size = rowBytes * height;
+    if (length < size)
+        return 0;
+    if (m_Usage + size > m_Budget)
+        trim(size);
+    if (m_Usage + size > m_Budget)
+        return 0;
+
+    uint32_t handle = m_NextHandle++;
+    sprite_t &sprite = m_Sprites[handle];
+    sprite.width = width;
+    sprite.height = height;
+    sprite.bitmap.assign(data, data + size);
+    if (format == SPRITE_FORMAT_XBM) {
+        for (auto &b : sprite.bitmap)
+            b = reverseBits(b);
+    }
+    m_Usage += size;
+    return handle;
+}
+
+auto U8g2Sprites::draw(u8g2_t *u8g2, uint32_t handle, int x, int y) -> bool {
+    auto it = m_Sprites.find(handle);
+    if (it == m_Sprites.end())
+        return false;
+    sprite_t &sprite = it->second;
+
+    //same colors as u8g2_DrawHXBM: unset bits use the inverse color unless the bitmap mode is transparent
+    int mode = U8g2Blit::fromDrawColor(u8g2);
+    int background = (u8g2->bitmap_transparency != 0) ? -1 : (u8g2->draw_color == 0 ? BLIT_MODE_SET : BLIT_MODE_CLEAR);
+
+    int layout = layoutOf(u8g2);
+    const std::vector<uint8_t> *converted = nullptr;
+    if (layout == LAYOUT_VERTICAL) {
+        converted = prepare(sprite, handle, layout, (y - u8g2->pixel_curr_row) & 7);
+        if (converted != nullptr)
+            drawVertical(u8g2, sprite, *converted, x, y, mode, background);
+    } else if (layout == LAYOUT_HORIZONTAL) {
+        converted = prepare(sprite, handle, layout, x & 7);
+        if (converted != nullptr)
+            drawHorizontal(u8g2, sprite, *converted, x, y, mode, background);
+    }
+    //rotated/unsupported buffers or not enough budget for the converted copy
+    if (converted == nullptr)
+        drawBitmap(u8g2, sprite, x, y, mode, background);
+    return true;
+}
+
+auto U8g2Sprites::evict(uint32_t handle) -> bool {
+    auto it = m_Sprites.find(handle);
+    if (it == m_Sprites.end())
+        return false;
+    for (int slot = 0; slot < SPRITE_SHIFT_COUNT * 2; slot++)
+        release(it->second, slot);
+    m_Usage -= it->second.bitmap.size();
+    m_Sprites.erase(it);
+    return true;
+}
+
+auto U8g2Sprites::clear() -> void {
+    m_Sprites.clear();
+    m_Lru.clear();
+    m_Usage = 0;
+}
+
+auto U8g2Sprites::setBudget(size_t budget) -> void {
+    m_Budget = budget;
+    trim(0);
+}
+
+auto U8g2Sprites::getBudget() const -> size_t {
+    return m_Budget;
+}
+
+auto U8g2Sprites::getUsage() const -> size_t {
+    return m_Usage;
+}
+
+auto U8g2Sprites::contains(uint32_t handle) const -> bool {
+    return m_Sprites.find(handle) != m_Sprites.end();
+}
+
+auto U8g2Sprites::getCount() const -> size_t {
+    return m_Sprites.size();
+}
+
+auto U8g2Sprites::prepare(sprite_t &sprite, uint32_t handle, int layout, int shift) -> const std::vector<uint8_t> * {
+    if (layout == LAYOUT_UNSUPPORTED)
+        return nullptr;
+    int slot = (layout - 1) * SPRITE_SHIFT_COUNT + shift;
+    std::vector<uint8_t> &data = sprite.shifted[slot];
+    if (!data.empty()) {
+        m_Lru.splice(m_Lru.end(), m_Lru, sprite.lru[slot]);
+        return &data;
+    }
+
+    size_t size;
+    if (layout == LAYOUT_VERTICAL) {
+        size = ((static_cast<size_t>(sprite.height) + shift + 7) / 8) * sprite.width;
+    } else {
+        size = ((static_cast<size_t>(sprite.width) + shift + 7) / 8) * sprite.height;
+    }
+    if (m_Usage + size > m_Budget)
+        trim(size);
+    if (m_Usage + size > m_Budget)
+        return nullptr;
+
+    convert(sprite, layout, shift, data);
+    sprite.lru[slot] = m_Lru.insert(m_Lru.end(), slot_key_t(handle, slot));
+    m_Usage += data.size();
+    return &data;
+}
+
+auto U8g2Sprites::release(sprite_t &sprite, int slot) -> void {
+    std::vector<uint8_t> &data = sprite.shifted[slot];
+    if (data.empty())
+        return;
+    m_Usage -= data.size();
+    std::vector<uint8_t>().swap(data);
+    m_Lru.erase(sprite.lru[slot]);
+}
+
+auto U8g2Sprites::trim(size_t required) -> void {
+    while (!m_Lru.empty() && m_Usage + required > m_Budget) {
+        slot_key_t key = m_Lru.front();
+        release(m_Sprites[key.first], key.second);
+    }
+}
+
+auto U8g2Sprites::convert(const sprite_t &sprite, int layout, int shift, std::vector<uint8_t> &output) -> void {
+    size_t rowBytes = (static_cast<size_t>(sprite.width) + 7) / 8;
+    if (layout == LAYOUT_VERTICAL) {
+        size_t pages = (static_cast<size_t>(sprite.height) + shift + 7) / 8;
+        output.assign(pages * sprite.width, 0);
+        for (int row = 0; row < sprite.height; row++) {
+            int target = row + shift;
+            uint8_t *page = output.data() + (target >> 3) * sprite.width;
+            auto bit = static_cast<uint8_t>(1U << (target & 7));
+            const uint8_t *src = sprite.bitmap.data() + row * rowBytes;
+            for (int col = 0; col < sprite.width; col++) {
+                if (src[col >> 3] & (0x80U >> (col & 7)))
+                    page[col] |= bit;
+            }
+        }
+    } else {
+        size_t shiftedBytes = (static_cast<size_t>(sprite.width) + shift + 7) / 8;
+        output.assign(shiftedBytes * sprite.height, 0);
+        for (int row = 0; row < sprite.height; row++) {
+            const uint8_t *src = sprite.bitmap.data() + row * rowBytes;
+            uint8_t *dst = output.data() + row * shiftedBytes;
+            for (size_t b = 0; b < rowBytes; b++) {
+                dst[b] |= static_cast<uint8_t>(src[b] >> shift);
+                if (shift != 0 && b + 1 < shiftedBytes)
+                    dst[b + 1] |= static_cast<uint8_t>(src[b] << (8 - shift));
+            }
+            //padding bits of the last source byte are not part of the sprite
+            int end = sprite.width + shift;
+            if (end & 7)
+                dst[shiftedBytes - 1] &= static_cast<uint8_t>(0xffU << (8 - (end & 7)));
+        }
+    }
+}
+
+auto U8g2Sprites::drawVertical(u8g2_t *u8g2, const sprite_t &sprite, const std::vector<uint8_t> &pages, int x, int y, int mode, int background) -> void {
+    clip_t clip{};
+    if (!clipSprite(u8g2, x, y, sprite.width, sprite.height, clip))
+        return;
+    int stride = u8g2_GetU8x8(u8g2)->display_info->tile_width * 8;
+    int currRow = u8g2->pixel_curr_row;
+    int bx0 = std::max(0, clip.x0);
+    int bx1 = std::min(stride, clip.x1);
+    int by0 = clip.y0 - currRow;
+    int by1 = clip.y1 - currRow;
+    if (bx0 >= bx1 || by0 >= by1)
+        return;
+    //buffer row of the first page of the converted copy
+    int top = y - currRow;
+    int origin = top - (top & 7);
+
+    for (int page = by0 >> 3; page <= (by1 - 1) >> 3; page++) {
+        uint8_t rowMask = 0;
+        for (int j = 0; j < 8; j++) {
+            int by = page * 8 + j;
+            if (by >= by0 && by < by1)
+                rowMask |= static_cast<uint8_t>(1U << j);
+        }
+        const uint8_t *src = pages.data() + ((page * 8 - origin) >> 3) * sprite.width + (bx0 - x);
+        uint8_t *dst = u8g2->tile_buf_ptr + page * stride + bx0;
+        applyRow(dst, src, bx1 - bx0, rowMask, mode, false);
+        if (background >= 0)
+            applyRow(dst, src, bx1 - bx0, rowMask, background, true);
+    }
+}
+
+auto U8g2Sprites::drawHorizontal(u8g2_t *u8g2, const sprite_t &sprite, const std::vector<uint8_t> &rows, int x, int y, int mode, int background) -> void {
+    clip_t clip{};
+    if (!clipSprite(u8g2, x, y, sprite.width, sprite.height, clip))
+        return;
+    int tileWidth = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+    int currRow = u8g2->pixel_curr_row;
+    int bx0 = std::max(0, clip.x0);
+    int bx1 = std::min(tileWidth * 8, clip.x1);
+    if (bx0 >= bx1)
+        return;
+    int firstByte = bx0 >> 3;
+    int lastByte = (bx1 - 1) >> 3;
+    auto leftMask = static_cast<uint8_t>(0xffU >> (bx0 & 7));
+    auto rightMask = static_cast<uint8_t>(0xffU << (7 - ((bx1 - 1) & 7)));
+    //byte index of the first byte of the converted copy
+    int origin = (x - (x & 7)) / 8;
+    size_t shiftedBytes = rows.size() / sprite.height;
+
+    for (int row = clip.y0; row < clip.y1; row++) {
+        const uint8_t *src = rows.data() + (row - y) * shiftedBytes + (firstByte - origin);
+        uint8_t *dst = u8g2->tile_buf_ptr + (row - currRow) * tileWidth + firstByte;
+        for (int pass = 0; pass < (background >= 0 ? 2 : 1); pass++) {
+            int op = (pass == 0) ? mode : background;
+            bool invert = pass != 0;
+            if (firstByte == lastByte) {
+                applyRow(dst, src, 1, leftMask & rightMask, op, invert);
+                continue;
+            }
+            applyRow(dst, src, 1, leftMask, op, invert);
+            applyRow(dst + 1, src + 1, lastByte - firstByte - 1, 0xff, op, invert);
+            applyRow(dst + (lastByte - firstByte), src + (lastByte - firstByte), 1, rightMask, op, invert);
+        }
+    }
+}
+
+auto U8g2Sprites::drawBitmap(u8g2_t *u8g2, const sprite_t &sprite, int x, int y, int mode, int background) -> void {
+    size_t rowBits = ((static_cast<size_t>(sprite.width) + 7) / 8) * 8;
+    if (background < 0 || (mode == BLIT_MODE_SET && background == BLIT_MODE_CLEAR)) {
+        ucgd_bitmap_t bitmap{sprite.bitmap.data(), sprite.bitmap.size(), sprite.width, sprite.height, rowBits};
+        U8g2Blit::blit(u8g2, x, y, bitmap, background < 0 ? mode : BLIT_MODE_COPY);
+        return;
+    }
+    ucgd_bitmap_t bitmap{sprite.bitmap.data(), sprite.bitmap.size(), sprite.width, sprite.height, rowBits};
+    U8g2Blit::blit(u8g2, x, y, bitmap, mode);
+    std::vector<uint8_t> inverted(sprite.bitmap.size());
+    std::transform(sprite.bitmap.begin(), sprite.bitmap.end(), inverted.begin(), [](uint8_t b) { return static_cast<uint8_t>(~b); });
+    ucgd_bitmap_t unset{inverted.data(), inverted.size(), sprite.width, sprite.height, rowBits};
+    U8g2Blit::blit(u8g2, x, y, unset, background);
+}
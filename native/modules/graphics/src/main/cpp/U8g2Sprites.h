@@ -0,0 +1,132 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2SPRITES_H
+#define UCGD_MOD_GRAPHICS_U8G2SPRITES_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+#define SPRITE_STORE_DEFAULT_BUDGET (64 * 1024)
+
+//XBM data: rows are byte aligned, least significant bit first (same as u8g2_DrawXBM)
+#define SPRITE_FORMAT_XBM 0
+//1bpp data: rows are byte aligned, most significant bit first (same as drawBitmap/blit)
+#define SPRITE_FORMAT_1BPP 1
+
+//Number of pre-shifted copies per buffer layout (one per bit offset within a byte/page)
+#define SPRITE_SHIFT_COUNT 8
+
+/**
+ * Per-display store of uploaded 1bpp images, referenced by handle.
+ *
+ * The source image is kept until it is evicted explicitly. Copies converted to the tile layout of the buffer
+ * (one per y offset within a page for vertical layouts, one per x offset within a byte for horizontal layouts)
+ * are created on first use and are dropped in least-recently-used order once the memory budget is exceeded.
+ */
+class U8g2Sprites {
+public:
+    explicit U8g2Sprites(size_t budget = SPRITE_STORE_DEFAULT_BUDGET);
+
+    virtual ~U8g2Sprites();
+
+    /**
+     * Store a copy of the image.
+     *
+     * @return The handle of the sprite or 0 if the image does not fit within the memory budget
+     */
+    auto upload(const uint8_t *data, size_t length, int width, int height, int format) -> uint32_t;
+
+    /**
+     * Draw the sprite at x, y using the same rules as u8g2_DrawXBM (draw color and bitmap transparency).
+     *
+     * @return false if the handle is unknown
+     */
+    auto draw(u8g2_t *u8g2, uint32_t handle, int x, int y) -> bool;
+
+    /**
+     * Release the sprite and its converted copies
+     *
+     * @return false if the handle is unknown
+     */
+    auto evict(uint32_t handle) -> bool;
+
+    [[nodiscard]] auto contains(uint32_t handle) const -> bool;
+
+    auto clear() -> void;
+
+    /**
+     * Change the memory budget. Converted copies are released until the store fits, sources are never released implicitly.
+     */
+    auto setBudget(size_t budget) -> void;
+
+    [[nodiscard]] auto getBudget() const -> size_t;
+
+    //Number of bytes used by the sources and the converted copies
+    [[nodiscard]] auto getUsage() const -> size_t;
+
+    [[nodiscard]] auto getCount() const -> size_t;
+
+private:
+    //slot = layout index * SPRITE_SHIFT_COUNT + shift
+    typedef std::pair<uint32_t, int> slot_key_t;
+
+    struct sprite_t {
+        int width;
+        int height;
+        //msb first, byte aligned rows
+        std::vector<uint8_t> bitmap;
+        //vertical layout: [page][column] (lsb on top), horizontal layout: [row][byte] (msb on the left)
+        std::array<std::vector<uint8_t>, SPRITE_SHIFT_COUNT * 2> shifted;
+        std::array<std::list<slot_key_t>::iterator, SPRITE_SHIFT_COUNT * 2> lru;
+    };
+
+    auto prepare(sprite_t &sprite, uint32_t handle, int layout, int shift) -> const std::vector<uint8_t> *;
+
+    auto release(sprite_t &sprite, int slot) -> void;
+
+    auto trim(size_t required) -> void;
+
+    static auto convert(const sprite_t &sprite, int layout, int shift, std::vector<uint8_t> &output) -> void;
+
+    static auto drawVertical(u8g2_t *u8g2, const sprite_t &sprite, const std::vector<uint8_t> &pages, int x, int y, int mode, int background) -> void;
+
+    static auto drawHorizontal(u8g2_t *u8g2, const sprite_t &sprite, const std::vector<uint8_t> &rows, int x, int y, int mode, int background) -> void;
+
+    static auto drawBitmap(u8g2_t *u8g2, const sprite_t &sprite, int x, int y, int mode, int background) -> void;
+
+    size_t m_Budget;
+    size_t m_Usage = 0;
+    uint32_t m_NextHandle = 1;
+    std::unordered_map<uint32_t, sprite_t> m_Sprites;
+    //converted copies, least recently used first
+    std::list<slot_key_t> m_Lru;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2SPRITES_H
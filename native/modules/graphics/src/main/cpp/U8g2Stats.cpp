@@ -0,0 +1,179 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "U8g2Stats.h"
+
+#include <cmath>
+
+auto U8g2Histogram::bucketOf(uint64_t value) -> int {
+    if (value < HISTOGRAM_SUB_COUNT)
+        return static_cast<int>(value);
+    int msb = 63 - __builtin_clzll(value);
+    int sub = static_cast<int>(value >> (msb - HISTOGRAM_SUB_BITS)) & (HISTOGRAM_SUB_COUNT - 1);
+    return (msb - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_COUNT + sub;
+}
+
+auto U8g2Histogram::lowerBoundOf(int bucket) -> uint64_t {
+    if (bucket < HISTOGRAM_SUB_COUNT)
+        return static_cast<uint64_t>(bucket);
+    int shift = bucket / HISTOGRAM_SUB_COUNT - 1;
+    uint64_t sub = static_cast<uint64_t>(bucket % HISTOGRAM_SUB_COUNT);
+    return (HISTOGRAM_SUB_COUNT + sub) << shift;
+}
+
+auto U8g2Histogram::record(uint64_t value) -> void {
+    m_Buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    m_Count.fetch_add(1, std::memory_order_relaxed);
+    //single writer per device, a plain compare is enough
+    if (value > m_Max.load(std::memory_order_relaxed))
+        m_Max.store(value, std::memory_order_relaxed);
+}
+
+auto U8g2Histogram::percentile(double p) const -> uint64_t {
+    uint64_t total = 0;
+    for (const auto &bucket : m_Buckets)
+        total += bucket.load(std::memory_order_relaxed);
+    if (total == 0)
+        return 0;
+    auto target = static_cast<uint64_t>(std::ceil(p * static_cast<double>(total)));
+    if (target == 0)
+        target = 1;
+    uint64_t max = getMax();
+    uint64_t seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += m_Buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            uint64_t upper = i + 1 < HISTOGRAM_BUCKETS ? lowerBoundOf(i + 1) - 1 : UINT64_MAX;
+            return upper < max ? upper : max;
+        }
+    }
+    return max;
+}
+
+auto U8g2Histogram::getCount() const -> uint64_t {
+    return m_Count.load(std::memory_order_relaxed);
+}
+
+auto U8g2Histogram::getMax() const -> uint64_t {
+    return m_Max.load(std::memory_order_relaxed);
+}
+
+auto U8g2Histogram::reset() -> void {
+    for (auto &bucket : m_Buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    m_Count.store(0, std::memory_order_relaxed);
+    m_Max.store(0, std::memory_order_relaxed);
+}
+
+auto U8g2Stats::addByteCallback(uint64_t elapsed, size_t sent) -> void {
+    m_TransportCalls.fetch_add(1, std::memory_order_relaxed);
+    m_ByteTime.fetch_add(elapsed, std::memory_order_relaxed);
+    if (sent > 0) {
+        m_TransportWrites.fetch_add(1, std::memory_order_relaxed);
+        m_Bytes.fetch_add(sent, std::memory_order_relaxed);
+    }
+}
+
+auto U8g2Stats::addGpioCallback(uint64_t elapsed) -> void {
+    m_GpioCalls.fetch_add(1, std::memory_order_relaxed);
+    m_GpioTime.fetch_add(elapsed, std::memory_order_relaxed);
+}
+
+auto U8g2Stats::addDelay(uint64_t elapsed) -> void {
+    m_DelayCalls.fetch_add(1, std::memory_order_relaxed);
+    m_DelayTime.fetch_add(elapsed, std::memory_order_relaxed);
+}
+
+auto U8g2Stats::beginFrame() const -> ucgd_stats_mark_t {
+    return {now(), m_Bytes.load(std::memory_order_relaxed), m_TransportCalls.load(std::memory_order_relaxed), m_TransportWrites.load(std::memory_order_relaxed)};
+}
+
+auto U8g2Stats::endFrame(const ucgd_stats_mark_t &mark) -> uint64_t {
+    uint64_t elapsed = now() - mark.start;
+    m_Frames.fetch_add(1, std::memory_order_relaxed);
+    m_SendTime.fetch_add(elapsed, std::memory_order_relaxed);
+    m_SendLatency.record(elapsed);
+    //a reset during the frame leaves the counters below the mark, count the frame as empty
+    uint64_t bytes = m_Bytes.load(std::memory_order_relaxed);
+    uint64_t calls = m_TransportCalls.load(std::memory_order_relaxed);
+    uint64_t writes = m_TransportWrites.load(std::memory_order_relaxed);
+    m_BytesPerFrame.record(bytes >= mark.bytes ? bytes - mark.bytes : 0);
+    m_CallsPerFrame.record(calls >= mark.calls ? calls - mark.calls : 0);
+    m_WritesPerFrame.record(writes >= mark.writes ? writes - mark.writes : 0);
+    return elapsed;
+}
+
+auto U8g2Stats::addBgraConversion(uint64_t elapsed) -> void {
+    m_BgraConversions.fetch_add(1, std::memory_order_relaxed);
+    m_BgraTime.fetch_add(elapsed, std::memory_order_relaxed);
+}
+
+auto U8g2Stats::addMissedDeadlines(uint64_t count) -> void {
+    m_MissedDeadlines.fetch_add(count, std::memory_order_relaxed);
+}
+
+auto U8g2Stats::setFrameInterval(uint64_t interval) -> void {
+    m_FrameInterval.store(interval, std::memory_order_relaxed);
+}
+
+auto U8g2Stats::snapshot(int64_t *values, int count) const -> int {
+    uint64_t all[STATS_COUNT];
+    all[STATS_FRAMES] = m_Frames.load(std::memory_order_relaxed);
+    all[STATS_BYTES] = m_Bytes.load(std::memory_order_relaxed);
+    all[STATS_TRANSPORT_CALLS] = m_TransportCalls.load(std::memory_order_relaxed);
+    all[STATS_TRANSPORT_WRITES] = m_TransportWrites.load(std::memory_order_relaxed);
+    all[STATS_BYTE_CB_TIME] = m_ByteTime.load(std::memory_order_relaxed);
+    all[STATS_GPIO_CALLS] = m_GpioCalls.load(std::memory_order_relaxed);
+    all[STATS_GPIO_CB_TIME] = m_GpioTime.load(std::memory_order_relaxed);
+    all[STATS_DELAY_CALLS] = m_DelayCalls.load(std::memory_order_relaxed);
+    all[STATS_DELAY_TIME] = m_DelayTime.load(std::memory_order_relaxed);
+    all[STATS_SEND_TIME] = m_SendTime.load(std::memory_order_relaxed);
+    all[STATS_SEND_P50] = m_SendLatency.percentile(0.50);
+    all[STATS_SEND_P90] = m_SendLatency.percentile(0.90);
+    all[STATS_SEND_P99] = m_SendLatency.percentile(0.99);
+    all[STATS_SEND_MAX] = m_SendLatency.getMax();
+    all[STATS_BYTES_PER_FRAME_P50] = m_BytesPerFrame.percentile(0.50);
+    all[STATS_BYTES_PER_FRAME_P99] = m_BytesPerFrame.percentile(0.99);
+    all[STATS_BYTES_PER_FRAME_MAX] = m_BytesPerFrame.getMax();
+    all[STATS_CALLS_PER_FRAME_P50] = m_CallsPerFrame.percentile(0.50);
+    all[STATS_CALLS_PER_FRAME_P99] = m_CallsPerFrame.percentile(0.99);
+    all[STATS_CALLS_PER_FRAME_MAX] = m_CallsPerFrame.getMax();
+    all[STATS_WRITES_PER_FRAME_P50] = m_WritesPerFrame.percentile(0.50);
+    all[STATS_WRITES_PER_FRAME_P99] = m_WritesPerFrame.percentile(0.99);
+    all[STATS_WRITES_PER_FRAME_MAX] = m_WritesPerFrame.getMax();
+    all[STATS_BGRA_CONVERSIONS] = m_BgraConversions.load(std::memory_order_relaxed);
+    all[STATS_BGRA_TIME] = m_BgraTime.load(std::memory_order_relaxed);
+    all[STATS_MISSED_DEADLINES] = m_MissedDeadlines.load(std::memory_order_relaxed);
+    all[STATS_FRAME_INTERVAL] = m_FrameInterval.load(std::memory_order_relaxed);
+    int n = count < STATS_COUNT ? count : STATS_COUNT;
+    for (int i = 0; i < n; i++)
+        values[i] = static_cast<int64_t>(all[i]);
+    return n < 0 ? 0 : n;
+}
+
+auto U8g2Stats::reset() -> void {
+    for (auto *counter : {&m_Frames, &m_Bytes, &m_TransportCalls, &m_TransportWrites, &m_ByteTime, &m_GpioCalls, &m_GpioTime, &m_DelayCalls, &m_DelayTime, &m_SendTime, &m_BgraConversions, &m_BgraTime, &m_MissedDeadlines, &m_FrameInterval})
+        counter->store(0, std::memory_order_relaxed);
+    m_SendLatency.reset();
+    m_BytesPerFrame.reset();
+    m_CallsPerFrame.reset();
+    m_WritesPerFrame.reset();
+}
@@ -0,0 +1,161 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2STATS_H
+#define UCGD_MOD_GRAPHICS_U8G2STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+//Indices of the values returned by U8g2Stats::snapshot() (and U8g2Graphics.getStatistics)
+#define STATS_FRAMES 0
+#define STATS_BYTES 1
+#define STATS_TRANSPORT_CALLS 2
+#define STATS_TRANSPORT_WRITES 3
+#define STATS_BYTE_CB_TIME 4
+#define STATS_GPIO_CALLS 5
+#define STATS_GPIO_CB_TIME 6
+#define STATS_DELAY_CALLS 7
+#define STATS_DELAY_TIME 8
+#define STATS_SEND_TIME 9
+#define STATS_SEND_P50 10
+#define STATS_SEND_P90 11
+#define STATS_SEND_P99 12
+#define STATS_SEND_MAX 13
+#define STATS_BYTES_PER_FRAME_P50 14
+#define STATS_BYTES_PER_FRAME_P99 15
+#define STATS_BYTES_PER_FRAME_MAX 16
+#define STATS_CALLS_PER_FRAME_P50 17
+#define STATS_CALLS_PER_FRAME_P99 18
+#define STATS_CALLS_PER_FRAME_MAX 19
+#define STATS_WRITES_PER_FRAME_P50 20
+#define STATS_WRITES_PER_FRAME_P99 21
+#define STATS_WRITES_PER_FRAME_MAX 22
+#define STATS_BGRA_CONVERSIONS 23
+#define STATS_BGRA_TIME 24
+#define STATS_MISSED_DEADLINES 25
+#define STATS_FRAME_INTERVAL 26
+#define STATS_COUNT 27
+
+/**
+ * Log-linear histogram. Values are grouped by their most significant bit and each group is split in
+ * 2^HISTOGRAM_SUB_BITS linear buckets, so a reported percentile is at most 1/8 above the real value.
+ */
+class U8g2Histogram {
+public:
+    static constexpr int HISTOGRAM_SUB_BITS = 3;
+    static constexpr int HISTOGRAM_SUB_COUNT = 1 << HISTOGRAM_SUB_BITS;
+    static constexpr int HISTOGRAM_BUCKETS = (65 - HISTOGRAM_SUB_BITS) * HISTOGRAM_SUB_COUNT;
+
+    auto record(uint64_t value) -> void;
+
+    //Upper bound of the bucket holding the p-th fraction (0..1) of the recorded values, clamped to getMax()
+    [[nodiscard]] auto percentile(double p) const -> uint64_t;
+
+    [[nodiscard]] auto getCount() const -> uint64_t;
+
+    [[nodiscard]] auto getMax() const -> uint64_t;
+
+    auto reset() -> void;
+
+    static auto bucketOf(uint64_t value) -> int;
+
+    //Smallest value mapped to the bucket
+    static auto lowerBoundOf(int bucket) -> uint64_t;
+
+private:
+    std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> m_Buckets{};
+    std::atomic<uint64_t> m_Count{0};
+    std::atomic<uint64_t> m_Max{0};
+};
+
+//Transport counters captured at the start of a frame
+struct ucgd_stats_mark_t {
+    uint64_t start;
+    uint64_t bytes;
+    uint64_t calls;
+    uint64_t writes;
+};
+
+/**
+ * Per-device transport and render counters.
+ *
+ * All values are updated with relaxed atomics from the thread driving the display and can be read or reset from any
+ * other thread without locking. Values read while a frame is in flight may be slightly out of step with each other.
+ * Times are in nanoseconds. The byte callback time includes the time spent in the gpio callbacks and delays issued
+ * from within it (software bit-bang), the gpio callback time excludes delays.
+ */
+class U8g2Stats {
+public:
+    static auto now() -> uint64_t {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    //A byte callback invocation. sent is the number of bytes written for U8X8_MSG_BYTE_SEND, otherwise 0.
+    auto addByteCallback(uint64_t elapsed, size_t sent) -> void;
+
+    auto addGpioCallback(uint64_t elapsed) -> void;
+
+    auto addDelay(uint64_t elapsed) -> void;
+
+    auto beginFrame() const -> ucgd_stats_mark_t;
+
+    //Returns the send time of the frame
+    auto endFrame(const ucgd_stats_mark_t &mark) -> uint64_t;
+
+    auto addBgraConversion(uint64_t elapsed) -> void;
+
+    //Frame scheduler ticks that passed without a frame (the frame before them was late)
+    auto addMissedDeadlines(uint64_t count) -> void;
+
+    //Current tick interval of the frame scheduler (0 if the frames are not scheduled)
+    auto setFrameInterval(uint64_t interval) -> void;
+
+    //Fill values with up to count entries (see STATS_*). Returns the number of entries written.
+    auto snapshot(int64_t *values, int count) const -> int;
+
+    auto reset() -> void;
+
+private:
+    std::atomic<uint64_t> m_Frames{0};
+    std::atomic<uint64_t> m_Bytes{0};
+    std::atomic<uint64_t> m_TransportCalls{0};
+    std::atomic<uint64_t> m_TransportWrites{0};
+    std::atomic<uint64_t> m_ByteTime{0};
+    std::atomic<uint64_t> m_GpioCalls{0};
+    std::atomic<uint64_t> m_GpioTime{0};
+    std::atomic<uint64_t> m_DelayCalls{0};
+    std::atomic<uint64_t> m_DelayTime{0};
+    std::atomic<uint64_t> m_SendTime{0};
+    std::atomic<uint64_t> m_BgraConversions{0};
+    std::atomic<uint64_t> m_BgraTime{0};
+    std::atomic<uint64_t> m_MissedDeadlines{0};
+    std::atomic<uint64_t> m_FrameInterval{0};
+    U8g2Histogram m_SendLatency;
+    U8g2Histogram m_BytesPerFrame;
+    U8g2Histogram m_CallsPerFrame;
+    U8g2Histogram m_WritesPerFrame;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2STATS_H
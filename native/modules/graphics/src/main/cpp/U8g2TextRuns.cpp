@@ -0,0 +1,133 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include <algorithm>
+#include "U8g2TextRuns.h"
+
+U8g2TextRuns::U8g2TextRuns(size_t capacity) : m_Capacity(capacity) {
+}
+
+U8g2TextRuns::~U8g2TextRuns() = default;
+
+auto U8g2TextRuns::hash(const uint16_t *text, size_t length) -> uint64_t {
+    //FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        h ^= text[i];
+        h *= 1099511628211ULL;
+    }
+    return h ^ length;
+}
+
+auto U8g2TextRuns::measure(u8g2_t *u8g2, U8g2GlyphCache &cache, const uint16_t *text, size_t length) -> int {
+    if (u8g2->font == nullptr || length == 0)
+        return 0;
+    if (m_Capacity == 0)
+        return computeWidth(u8g2, cache, text, length);
+
+    width_key_t key{u8g2->font, hash(text, length)};
+    auto it = m_Widths.find(key);
+    if (it != m_Widths.end() && it->second.text.size() == length && std::equal(text, text + length, it->second.text.begin())) {
+        m_Hits++;
+        return it->second.width;
+    }
+
+    m_Misses++;
+    int width = computeWidth(u8g2, cache, text, length);
+    //the labels of a screen rarely change, start over instead of tracking the usage of each entry
+    if (it == m_Widths.end() && m_Widths.size() >= m_Capacity)
+        m_Widths.clear();
+    m_Widths[key] = width_entry_t{std::u16string(text, text + length), width};
+    return width;
+}
+
+auto U8g2TextRuns::computeWidth(u8g2_t *u8g2, U8g2GlyphCache &cache, const uint16_t *text, size_t length) -> int {
+    //same rules as u8g2_string_width(): the advance of the last glyph is replaced by its pixel width
+    int width = 0, delta = 0;
+    int glyphWidth = 0, glyphX = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] >= 0xfffe)
+            continue;
+        int w, x, d;
+        if (cache.getMetrics(u8g2, text[i], w, x, d)) {
+            glyphWidth = w;
+            glyphX = x;
+            delta = d;
+        } else {
+            delta = 0;
+        }
+        width += delta;
+    }
+    if (glyphWidth != 0) {
+        width -= delta;
+        width += glyphWidth;
+        width += glyphX;
+    }
+    return static_cast<u8g2_uint_t>(width);
+}
+
+auto U8g2TextRuns::layout(u8g2_t *u8g2, U8g2GlyphCache &cache, const uint16_t *text, size_t length, int x, int y, int flags) -> ucgd_text_extent_t {
+    int width = measure(u8g2, cache, text, length);
+    uint8_t dir = u8g2->font_decode.dir;
+
+    //move the anchor back along the font direction
+    int offset = 0;
+    switch (flags & TEXT_ALIGN_MASK) {
+        case TEXT_ALIGN_CENTER: offset = width / 2; break;
+        case TEXT_ALIGN_RIGHT: offset = width; break;
+        default: break;
+    }
+    switch (dir) {
+        case 0: x -= offset; break;
+        case 1: y -= offset; break;
+        case 2: x += offset; break;
+        default: y += offset; break;
+    }
+
+    //bounding box in text space (a = along the baseline, b = downwards), see u8g2_DrawGlyph for the vertical reference
+    int vref = (u8g2->font == nullptr) ? 0 : static_cast<int16_t>(u8g2->font_calc_vref(u8g2));
+    int a0 = 0, a1 = width;
+    int b0 = vref - u8g2->font_ref_ascent, b1 = vref - u8g2->font_ref_descent;
+    ucgd_text_extent_t extent{};
+    switch (dir) {
+        case 0: extent = {x + a0, y + b0, a1 - a0, b1 - b0}; break;
+        case 1: extent = {x - b1 + 1, y + a0, b1 - b0, a1 - a0}; break;
+        case 2: extent = {x - a1 + 1, y - b1 + 1, a1 - a0, b1 - b0}; break;
+        default: extent = {x + b0, y - a1 + 1, b1 - b0, a1 - a0}; break;
+    }
+
+    if ((flags & TEXT_MEASURE_ONLY) == 0 && u8g2->font != nullptr)
+        cache.drawGlyphs(u8g2, static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), text, length);
+    return extent;
+}
+
+auto U8g2TextRuns::clear() -> void {
+    m_Widths.clear();
+}
+
+auto U8g2TextRuns::getHits() const -> uint64_t {
+    return m_Hits;
+}
+
+auto U8g2TextRuns::getMisses() const -> uint64_t {
+    return m_Misses;
+}
@@ -0,0 +1,116 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_U8G2TEXTRUNS_H
+#define UCGD_MOD_GRAPHICS_U8G2TEXTRUNS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include <U8g2GlyphCache.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+//Horizontal alignment of a text run, relative to its anchor point (along the font direction)
+#define TEXT_ALIGN_LEFT 0x0
+#define TEXT_ALIGN_CENTER 0x1
+#define TEXT_ALIGN_RIGHT 0x2
+#define TEXT_ALIGN_MASK 0x3
+//Only measure the run, do not draw it
+#define TEXT_MEASURE_ONLY 0x100
+
+#define TEXT_RUN_PARAM_SIZE 3
+#define TEXT_RUN_EXTENT_SIZE 4
+#define TEXT_RUN_HEADER_SIZE 16
+
+#define TEXT_WIDTH_CACHE_DEFAULT_SIZE 256
+
+/**
+ * The on-screen bounding box of a text run
+ */
+struct ucgd_text_extent_t {
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+/**
+ * Measures and draws UTF-16 text runs with the current font of the display. String widths are cached per font.
+ */
+class U8g2TextRuns {
+public:
+    explicit U8g2TextRuns(size_t capacity = TEXT_WIDTH_CACHE_DEFAULT_SIZE);
+
+    virtual ~U8g2TextRuns();
+
+    /**
+     * Equivalent of u8g2_GetUTF8Width() for UTF-16 text
+     */
+    auto measure(u8g2_t *u8g2, U8g2GlyphCache &cache, const uint16_t *text, size_t length) -> int;
+
+    /**
+     * Align the run on its anchor point, draw it (unless TEXT_MEASURE_ONLY is set) and return its bounding box
+     */
+    auto layout(u8g2_t *u8g2, U8g2GlyphCache &cache, const uint16_t *text, size_t length, int x, int y, int flags) -> ucgd_text_extent_t;
+
+    auto clear() -> void;
+
+    [[nodiscard]] auto getHits() const -> uint64_t;
+
+    [[nodiscard]] auto getMisses() const -> uint64_t;
+
+private:
+    struct width_key_t {
+        const uint8_t *font;
+        uint64_t hash;
+
+        bool operator==(const width_key_t &other) const {
+            return font == other.font && hash == other.hash;
+        }
+    };
+
+    struct width_key_hash_t {
+        size_t operator()(const width_key_t &key) const {
+            return std::hash<uint64_t>()(key.hash ^ reinterpret_cast<uintptr_t>(key.font));
+        }
+    };
+
+    struct width_entry_t {
+        std::u16string text;
+        int width;
+    };
+
+    static auto hash(const uint16_t *text, size_t length) -> uint64_t;
+
+    auto computeWidth(u8g2_t *u8g2, U8g2GlyphCache &cache, const uint16_t *text, size_t length) -> int;
+
+    size_t m_Capacity;
+    uint64_t m_Hits = 0;
+    uint64_t m_Misses = 0;
+    std::unordered_map<width_key_t, width_entry_t, width_key_hash_t> m_Widths;
+};
+
+#endif //UCGD_MOD_GRAPHICS_U8G2TEXTRUNS_H
@@ -21,6 +21,7 @@
  */
 
 #include <memory>
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <system_error>
@@ -30,8 +31,10 @@
 #include <UcgdConfig.h>
 #include <U8g2Hal.h>
 #include <U8g2Utils.h>
+#include <UcgdTrace.h>
 #include <ServiceLocator.h>
 #include <DeviceManager.h>
+#include <UcgdProvider.h>
 
 #if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
 
@@ -169,7 +172,7 @@ u8g2_msg_func_info_t U8g2Util_GetByteCb(int commInt, int commType) {
     return nullptr;
 }
 
-std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_proc_name, int commInt, int commType, const u8g2_cb_t *rotation, u8g2_pin_map_t pin_config, option_map_t &options, uint8_t* buffer, bool virtualMode) {
+std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_proc_name, int commInt, int commType, const u8g2_cb_t *rotation, u8g2_pin_map_t pin_config, const ucgd_settings_t &settings, uint8_t* buffer, bool virtualMode) {
     JNIEnv *env;
     GETENV(env);
 
@@ -188,9 +191,15 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
     context->comm_int = commInt;
     context->comm_type = commType;
 
-#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
-    std::string defaultProviderName = context->getOptionString(OPT_PROVIDER);
-    context->options = std::map(options);
+    //Glyph cache budget in bytes (0 = disabled)
+    int glyphCacheSize = settings.has(OPTION_GLYPH_CACHE_SIZE) ? std::max(0, settings.glyph_cache_size) : GLYPH_CACHE_DEFAULT_BUDGET;
+    context->glyph_cache = std::make_unique<U8g2GlyphCache>(glyphCacheSize);
+
+    //Sprite store budget in bytes
+    int spriteBudget = settings.has(OPTION_SPRITE_BUDGET) ? std::max(0, settings.sprite_budget) : SPRITE_STORE_DEFAULT_BUDGET;
+    context->sprites = std::make_unique<U8g2Sprites>(spriteBudget);
+
+    context->settings = settings;
     context->setDefaultProvider(ServiceLocator::getInstance().getProviderManager()->getProvider(context));
     auto defaultProvider = context->getDefaultProvider();
 
@@ -215,13 +224,9 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
 
     //Assign the i2c addres if applicable
     if (commType == COMINT_I2C) {
-        std::any addr = context->options[OPT_I2C_ADDRESS];
-        if (addr.has_value()) {
-            int intVal = std::any_cast<int>(addr);
-            u8g2_SetI2CAddress(context->u8g2.get(), intVal);
-        }
+        if (settings.has(OPTION_I2C_ADDRESS))
+            u8g2_SetI2CAddress(context->u8g2.get(), settings.i2c_address);
     }
-#endif
 
     //Get the setup procedure callback
     u8g2_setup_func_t setup_proc_callback = U8g2Hal_GetSetupProc(setup_proc_name);
@@ -247,16 +252,22 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
     context->byte_cb = [cb_byte, weak_context, virtualMode](u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) -> uint8_t {
         auto context = weak_context.lock();
 
+        //Nothing is thrown from here, errors are recorded in context->transport and raised at the end of the jni call
         if (!context)
-            throw UcgdByteCallbackException("context->byte_cb() : Context out of scope");
+            return 0;
 
         if (virtualMode) {
+            if (context->emulator)
+                context->emulator->feed(msg, arg_int, arg_ptr);
+
             JNIEnv *lenv;
             GETENV(lenv);
 
             if (!JNI_HasByteListeners(lenv))
                 return 1;
 
+            UCGD_TRACE_SCOPE_ARG("event", "byte_event", "msg", msg);
+
             if (msg == U8X8_MSG_BYTE_SEND) {
                 uint8_t value;
                 uint8_t size = arg_int;
@@ -273,16 +284,14 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
             }
             return 1;
         }
-        try {
-            if (g_SignalStatus)
-                throw SignalInterruptedException(g_SignalStatus, "Caught signal interrupt");
-
-            return cb_byte(context, u8x8, msg, arg_int, arg_ptr);
-         } catch (SignalInterruptedException& e) {
-            throw e;
-         } catch (std::exception &e) {
-            throw UcgdByteCallbackException(std::string("context->byte_cb() : Error thrown from the Byte Callback. Reason: ") + std::string(e.what()));
+        //Skip the rest of the frame once a transfer failed
+        if (context->transport.failed())
+            return 0;
+        if (g_SignalStatus) {
+            context->transport.interrupt(g_SignalStatus);
+            return 0;
         }
+        return cb_byte(context, u8x8, msg, arg_int, arg_ptr);
     };
 
     //Configure Gpio callback
@@ -290,27 +299,25 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
         auto context = weak_context.lock();
 
         if (!context)
-            throw UcgdGpioCallbackException("context->gpio_cb() : Context out of scope");
+            return 0;
 
         if (virtualMode) {
             JNIEnv *lenv;
             GETENV(lenv);
             if (!JNI_HasGpioListeners(lenv))
                 return 1;
+            UCGD_TRACE_SCOPE_ARG("event", "gpio_event", "msg", msg);
             JNI_FireGpioEvent(lenv, context->address(), msg, arg_int);
             return 1;
         }
 
-       try {
-            if (g_SignalStatus)
-                throw SignalInterruptedException(g_SignalStatus, "Caught signal interrupt");
-
-            return cb_gpio_delay(context, u8x8, msg, arg_int, arg_ptr);
-       } catch (SignalInterruptedException& e) {
-            throw e;
-       } catch (std::exception &e) {
-            throw UcgdGpioCallbackException(std::string("context->gpio_cb() : Error thrown from the Gpio Callback. Reason: ") + std::string(e.what()));
-       }
+        if (context->transport.failed())
+            return 0;
+        if (g_SignalStatus) {
+            context->transport.interrupt(g_SignalStatus);
+            return 0;
+        }
+        return cb_gpio_delay(context, u8x8, msg, arg_int, arg_ptr);
     };
 
     //Obtain the u8g2 raw pointer
@@ -319,8 +326,48 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
     //Call the setup procedure
     context->setup_cb(pU8g2, rotation, U8g2Util_ByteCallbackWrapper, U8g2Util_GpioCallbackWrapper);
 
+    //Emulate the controller of virtual devices, must exist before the startup sequence is sent
+    if (virtualMode) {
+        context->emulator = U8g2Emulator::create(setup_proc_name, pU8g2->u8x8.display_info->pixel_width, pU8g2->u8x8.display_info->pixel_height);
+        if (!context->emulator)
+            log.debug("setup_display() : No emulator available for '{}'", setup_proc_name);
+    }
+
     //Allocate dynamic buffer
     u8g2_SetBufferPtr(pU8g2, buffer);
+
+    //Draw rotated displays into an unrotated canvas, rotated once per frame when the buffer is sent
+    if (settings.rotate_at_send) {
+        context->rotator = std::make_unique<U8g2Rotator>(pU8g2);
+        context->rotator->setRotation(pU8g2, rotation);
+        if (!context->rotator->isActive() && rotation != U8G2_R0)
+            log.debug("setup_display() : Rotation at send time is not available for '{}', using the rotation of u8g2", setup_proc_name);
+    }
+
+    //Send the changed tiles only when layers are composited (the controller must support u8g2_UpdateDisplayArea)
+    context->flag_partial_update = settings.partial_update;
+
+    //Failed writes are repeated before the frame is aborted
+    context->transport.setRetryPolicy(settings.transport_retries, settings.has(OPTION_TRANSPORT_BACKOFF) ? settings.transport_backoff : TRANSPORT_DEFAULT_BACKOFF);
+
+    //Fonts that are not embedded in the library are loaded from the font pack
+    if (!settings.font_pack.empty())
+        U8g2Hal_SetFontPack(settings.font_pack);
+
+    //Publish the frames to shared memory (bgra images are only available in virtual mode)
+    if (!settings.shm_name.empty()) {
+        int format = settings.has(OPTION_SHM_FORMAT) ? settings.shm_format : (SHM_FORMAT_MONO | SHM_FORMAT_BGRA);
+        if (!virtualMode)
+            format &= ~SHM_FORMAT_BGRA;
+        int layout = pU8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb ? SHM_LAYOUT_VERTICAL : SHM_LAYOUT_HORIZONTAL;
+        try {
+            context->publisher = std::make_unique<UcgdFramePublisher>(settings.shm_name, pU8g2->pixel_buf_width, pU8g2->u8x8.display_info->tile_height * 8, layout, format,
+                                                                      settings.has(OPTION_SHM_SLOTS) ? settings.shm_slots : SHM_DEFAULT_SLOTS);
+        } catch (std::runtime_error &e) {
+            throw UcgdSetupException(std::string("setup_display() : ") + e.what());
+        }
+        log.debug("setup_display() : Publishing frames to shared memory '{}'", context->publisher->getName());
+    }
     //log.debug("setup_display() : Allocating pixel buffers dynamically (size: {})", size);
 
     //Initialize the display
@@ -328,21 +375,82 @@ std::shared_ptr<ucgd_t> &U8g2Util_SetupAndInitDisplay(const std::string &setup_p
     u8g2_InitDisplay(pU8g2);
     u8g2_SetPowerSave(pU8g2, 0);
     u8g2_ClearDisplay(pU8g2);
+    U8g2Util_RaiseTransportError(context);
 
     log.debug("setup_display() : Display start sequence complete");
     return context;
 }
 
+void U8g2Util_RaiseTransportError(const std::shared_ptr<ucgd_t> &context) {
+    UcgdTransport &transport = context->transport;
+    if (!transport.failed())
+        return;
+    int code = transport.getCode();
+    int signal = transport.getSignal();
+    std::string message = transport.getMessage();
+    transport.clear();
+    if (code == TRANSPORT_ERR_INTERRUPTED)
+        throw SignalInterruptedException(signal, message);
+    throw UcgdTransportException(code, message);
+}
+
+std::shared_ptr<ucgd_t> &U8g2Util_SetupCanvas(int width, int height) {
+    Log &log = ServiceLocator::getInstance().getLogger();
+    const std::unique_ptr<DeviceManager> &devMgr = ServiceLocator::getInstance().getDeviceManager();
+
+    std::shared_ptr<ucgd_t> &context = devMgr->createDevice();
+    try {
+        context->canvas = std::make_unique<U8g2Canvas>(context->u8g2.get(), width, height);
+    } catch (std::runtime_error &e) {
+        devMgr->deleteDevice(context->address());
+        throw;
+    }
+    context->rotation = const_cast<u8g2_cb_t *>(U8G2_R0);
+    context->glyph_cache = std::make_unique<U8g2GlyphCache>(GLYPH_CACHE_DEFAULT_BUDGET);
+    context->sprites = std::make_unique<U8g2Sprites>(SPRITE_STORE_DEFAULT_BUDGET);
+    log.debug("setup_canvas() : Created {}x{} canvas '{}'", width, height, std::to_string(context->address()));
+    return context;
+}
+
+/**
+ * Device of the u8x8 descriptor, the callback wrappers run inside u8g2's C frames and must not throw
+ */
+static ucgd_t *findDevice(u8x8_t *u8x8) {
+    const auto &devices = ServiceLocator::getInstance().getDeviceManager()->getAllDevices();
+    auto it = devices.find((uintptr_t) u8x8);
+    return it != devices.end() ? it->second.get() : nullptr;
+}
+
 uint8_t U8g2Util_ByteCallbackWrapper(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
-    auto addr = (uintptr_t) u8x8;
-    std::shared_ptr<ucgd_t> &context = ServiceLocator::getInstance().getDeviceManager()->getDevice(addr);
-    return context->byte_cb(u8x8, msg, arg_int, arg_ptr);
+    ucgd_t *context = findDevice(u8x8);
+    if (context == nullptr)
+        return 0;
+    UCGD_TRACE_SCOPE_ARG("hal", "byte_cb", "msg", msg);
+    uint64_t start = U8g2Stats::now();
+    uint8_t result = context->byte_cb(u8x8, msg, arg_int, arg_ptr);
+    context->stats.addByteCallback(U8g2Stats::now() - start, msg == U8X8_MSG_BYTE_SEND ? arg_int : 0);
+    return result;
 }
 
 uint8_t U8g2Util_GpioCallbackWrapper(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
-    auto addr = (uintptr_t) u8x8;
-    std::shared_ptr<ucgd_t> &context = ServiceLocator::getInstance().getDeviceManager()->getDevice(addr);
-    return context->gpio_cb(u8x8, msg, arg_int, arg_ptr);
+    ucgd_t *context = findDevice(u8x8);
+    if (context == nullptr)
+        return 0;
+    uint64_t start = U8g2Stats::now();
+    uint8_t result = context->gpio_cb(u8x8, msg, arg_int, arg_ptr);
+    switch (msg) {
+        case U8X8_MSG_DELAY_NANO:
+        case U8X8_MSG_DELAY_100NANO:
+        case U8X8_MSG_DELAY_10MICRO:
+        case U8X8_MSG_DELAY_MILLI:
+        case U8X8_MSG_DELAY_I2C:
+            context->stats.addDelay(U8g2Stats::now() - start);
+            break;
+        default:
+            context->stats.addGpioCallback(U8g2Stats::now() - start);
+            break;
+    }
+    return result;
 }
 
 std::string U8g2Util_GetPinIndexDesc(int index) {
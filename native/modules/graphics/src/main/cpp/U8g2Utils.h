@@ -36,22 +36,17 @@ public:
     explicit UcgdSetupException(const runtime_error &error) : std::runtime_error(error) {};
 };
 
-class UcgdByteCallbackException : public std::runtime_error {
+class UcgdTransportException : public std::runtime_error {
 public:
-    explicit UcgdByteCallbackException(const std::string &arg) : std::runtime_error(arg) {};
+    explicit UcgdTransportException(int code, const std::string &arg) : std::runtime_error(arg), m_Code(code) {};
 
-    explicit UcgdByteCallbackException(const char *string) : std::runtime_error(string) {};
+    //One of the TRANSPORT_ERR_* codes
+    int getCode() const {
+        return m_Code;
+    }
 
-    explicit UcgdByteCallbackException(const runtime_error &error) : std::runtime_error(error) {};
-};
-
-class UcgdGpioCallbackException : public std::runtime_error {
-public:
-    explicit UcgdGpioCallbackException(const std::string &arg) : std::runtime_error(arg) {};
-
-    explicit UcgdGpioCallbackException(const char *string) : std::runtime_error(string) {};
-
-    explicit UcgdGpioCallbackException(const runtime_error &error) : std::runtime_error(error) {};
+private:
+    int m_Code;
 };
 
 class UcgdByteCallbackWrapperException : public std::runtime_error {
@@ -127,7 +122,26 @@ u8g2_cb_t *U8g2Util_ToRotation(int rotation);
  * @param virtualMode Set to true to activate emulator mode
  * @return
  */
-std::shared_ptr<ucgd_t>& U8g2Util_SetupAndInitDisplay(const std::string &setup_proc_name, int commInt, int commType, const u8g2_cb_t *rotation, u8g2_pin_map_t pin_config, option_map_t &options, uint8_t* buffer, bool virtualMode = false);
+std::shared_ptr<ucgd_t>& U8g2Util_SetupAndInitDisplay(const std::string &setup_proc_name, int commInt, int commType, const u8g2_cb_t *rotation, u8g2_pin_map_t pin_config, const ucgd_settings_t &settings, uint8_t* buffer, bool virtualMode = false);
+
+/**
+ * Raise the transport error recorded by the u8x8 callbacks (if any) and clear it. Called once at the end of a jni call
+ * that transferred data, after u8g2 returned.
+ *
+ * @param context The device context
+ * @throws SignalInterruptedException if the transfer was interrupted by a signal
+ * @throws UcgdTransportException if a transfer failed
+ */
+void U8g2Util_RaiseTransportError(const std::shared_ptr<ucgd_t> &context);
+
+/**
+ * Create an offscreen canvas device (no controller, no transport). The device accepts the same draw calls as a display.
+ *
+ * @param width Width of the canvas in pixels
+ * @param height Height of the canvas in pixels
+ * @return The canvas context
+ */
+std::shared_ptr<ucgd_t>& U8g2Util_SetupCanvas(int width, int height);
 
 /**
  * Byte callback wrapper for u8g2 setup procedures
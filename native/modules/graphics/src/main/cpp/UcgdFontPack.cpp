@@ -0,0 +1,191 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include "UcgdFontPack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+UcgdFontPack::UcgdFontPack(const std::string &path) : m_Path(path) {
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::runtime_error("UcgdFontPack : Unable to open '" + path + "' (" + std::strerror(errno) + ")");
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(ucgd_font_pack_header_t))) {
+        ::close(fd);
+        throw std::runtime_error("UcgdFontPack : '" + path + "' is not a font pack");
+    }
+    m_Size = static_cast<size_t>(info.st_size);
+    void *base = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED)
+        throw std::runtime_error("UcgdFontPack : Unable to map '" + path + "' (" + std::strerror(errno) + ")");
+    m_Data = static_cast<const uint8_t *>(base);
+    //lookups touch the index and a few fonts, read ahead would fault in the neighbours as well
+    posix_madvise(base, m_Size, POSIX_MADV_RANDOM);
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("UcgdFontPack : Unable to open '" + path + "'");
+    m_Buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    m_Data = m_Buffer.data();
+    m_Size = m_Buffer.size();
+#endif
+
+    //validate the header and the bounds of every entry, the data itself is not touched
+    std::string error;
+    ucgd_font_pack_header_t header{};
+    if (m_Size >= sizeof(header))
+        std::memcpy(&header, m_Data, sizeof(header));
+    if (m_Size < sizeof(header) || header.magic != FONT_PACK_MAGIC) {
+        error = "not a font pack";
+    } else if (header.version != FONT_PACK_VERSION) {
+        error = "unsupported version " + std::to_string(header.version);
+    } else if (header.header_size < sizeof(header) || (header.header_size % alignof(ucgd_font_pack_entry_t)) != 0 ||
+               header.header_size > m_Size || (m_Size - header.header_size) / sizeof(ucgd_font_pack_entry_t) < header.count) {
+        error = "truncated index";
+    } else {
+        m_Count = header.count;
+        for (size_t i = 0; i < m_Count && error.empty(); i++) {
+            const ucgd_font_pack_entry_t &e = entry(i);
+            if (e.name_offset > m_Size || e.name_length > m_Size - e.name_offset || e.data_offset > m_Size || e.data_length > m_Size - e.data_offset)
+                error = "entry " + std::to_string(i) + " is out of bounds";
+        }
+    }
+    if (!error.empty()) {
+#if !defined(_WIN32)
+        munmap(const_cast<uint8_t *>(m_Data), m_Size);
+#endif
+        throw std::runtime_error("UcgdFontPack : '" + path + "' is invalid (" + error + ")");
+    }
+}
+
+UcgdFontPack::~UcgdFontPack() {
+#if !defined(_WIN32)
+    if (m_Data != nullptr)
+        munmap(const_cast<uint8_t *>(m_Data), m_Size);
+#endif
+}
+
+auto UcgdFontPack::entry(size_t index) const -> const ucgd_font_pack_entry_t & {
+    auto header = reinterpret_cast<const ucgd_font_pack_header_t *>(m_Data);
+    return reinterpret_cast<const ucgd_font_pack_entry_t *>(m_Data + header->header_size)[index];
+}
+
+auto UcgdFontPack::compare(size_t index, const std::string &name) const -> int {
+    const ucgd_font_pack_entry_t &e = entry(index);
+    size_t length = std::min<size_t>(e.name_length, name.size());
+    int result = std::memcmp(m_Data + e.name_offset, name.data(), length);
+    if (result != 0)
+        return result;
+    return (e.name_length < name.size()) ? -1 : (e.name_length > name.size()) ? 1 : 0;
+}
+
+auto UcgdFontPack::find(const std::string &name) const -> const uint8_t * {
+    size_t lo = 0, hi = m_Count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int result = compare(mid, name);
+        if (result == 0) {
+            const ucgd_font_pack_entry_t &e = entry(mid);
+#if !defined(_WIN32)
+            //fault the whole font in at once instead of one page at a time while the first string is drawn
+            auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            size_t start = e.data_offset - (e.data_offset % page);
+            posix_madvise(const_cast<uint8_t *>(m_Data) + start, e.data_offset + e.data_length - start, POSIX_MADV_WILLNEED);
+#endif
+            return m_Data + e.data_offset;
+        }
+        if (result < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return nullptr;
+}
+
+auto UcgdFontPack::getCount() const -> size_t {
+    return m_Count;
+}
+
+auto UcgdFontPack::getName(size_t index) const -> std::string {
+    if (index >= m_Count)
+        return std::string();
+    const ucgd_font_pack_entry_t &e = entry(index);
+    return std::string(reinterpret_cast<const char *>(m_Data + e.name_offset), e.name_length);
+}
+
+auto UcgdFontPack::getPath() const -> const std::string & {
+    return m_Path;
+}
+
+auto UcgdFontPack::getSize() const -> size_t {
+    return m_Size;
+}
+
+auto UcgdFontPack::write(const std::string &path, std::vector<std::pair<std::string, std::vector<uint8_t>>> fonts) -> void {
+    std::sort(fonts.begin(), fonts.end(), [](const auto &a, const auto &b) {
+        return a.first < b.first;
+    });
+    for (size_t i = 1; i < fonts.size(); i++) {
+        if (fonts[i].first == fonts[i - 1].first)
+            throw std::runtime_error("UcgdFontPack : Duplicate font '" + fonts[i].first + "'");
+    }
+
+    ucgd_font_pack_header_t header{FONT_PACK_MAGIC, FONT_PACK_VERSION, static_cast<uint32_t>(fonts.size()), sizeof(ucgd_font_pack_header_t)};
+    std::vector<ucgd_font_pack_entry_t> entries(fonts.size());
+    size_t offset = sizeof(header) + entries.size() * sizeof(ucgd_font_pack_entry_t);
+    for (size_t i = 0; i < fonts.size(); i++) {
+        entries[i].name_offset = static_cast<uint32_t>(offset);
+        entries[i].name_length = static_cast<uint32_t>(fonts[i].first.size());
+        offset += fonts[i].first.size();
+    }
+    for (size_t i = 0; i < fonts.size(); i++) {
+        entries[i].data_offset = static_cast<uint32_t>(offset);
+        entries[i].data_length = static_cast<uint32_t>(fonts[i].second.size());
+        offset += fonts[i].second.size();
+    }
+    if (offset > std::numeric_limits<uint32_t>::max())
+        throw std::runtime_error("UcgdFontPack : The fonts do not fit in a pack (" + std::to_string(offset) + " bytes)");
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(ucgd_font_pack_entry_t)));
+    for (const auto &font : fonts)
+        out.write(font.first.data(), static_cast<std::streamsize>(font.first.size()));
+    for (const auto &font : fonts)
+        out.write(reinterpret_cast<const char *>(font.second.data()), static_cast<std::streamsize>(font.second.size()));
+    out.close();
+    if (!out)
+        throw std::runtime_error("UcgdFontPack : Unable to write '" + path + "'");
+}
@@ -0,0 +1,122 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDFONTPACK_H
+#define UCGD_MOD_GRAPHICS_UCGDFONTPACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * Font pack written by the code generator (ucgd-code --font-pack). The file starts with a ucgd_font_pack_header_t,
+ * followed by count ucgd_font_pack_entry_t sorted by name (byte order), the names and the u8g2 font data. All offsets
+ * are from the start of the file, values are stored in the byte order of the writer (a pack written with another byte
+ * order is rejected by the magic).
+ *
+ * The library maps the pack on the first lookup of a font that is not linked into it. Only the index, the names and
+ * the fonts passed to setFont are ever read, so unused fonts cost neither memory nor load time.
+ */
+
+#define FONT_PACK_MAGIC 0x4B504655u //"UFPK"
+#define FONT_PACK_VERSION 1
+
+//Default file name, looked up in the directory of the library
+#define FONT_PACK_FILE "ucgd-fonts.pack"
+//Environment variable overriding the location of the pack
+#define FONT_PACK_ENV "UCGD_FONT_PACK"
+
+struct ucgd_font_pack_header_t {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    //offset of the first entry
+    uint32_t header_size;
+};
+
+struct ucgd_font_pack_entry_t {
+    uint32_t name_offset;
+    uint32_t name_length;
+    uint32_t data_offset;
+    uint32_t data_length;
+};
+
+/**
+ * Read-only memory mapped font pack
+ */
+class UcgdFontPack {
+public:
+    /**
+     * Map a font pack. Throws std::runtime_error if the file can not be mapped or is not a valid pack.
+     */
+    explicit UcgdFontPack(const std::string &path);
+
+    UcgdFontPack(const UcgdFontPack &) = delete;
+
+    auto operator=(const UcgdFontPack &) -> UcgdFontPack & = delete;
+
+    virtual ~UcgdFontPack();
+
+    /**
+     * Binary search of the name table
+     *
+     * @return The font data (valid as long as the pack is mapped), null if the pack does not contain the font
+     */
+    auto find(const std::string &name) const -> const uint8_t *;
+
+    /**
+     * @return The number of fonts in the pack
+     */
+    auto getCount() const -> size_t;
+
+    /**
+     * @return The name of the font at the index (sorted)
+     */
+    auto getName(size_t index) const -> std::string;
+
+    auto getPath() const -> const std::string &;
+
+    /**
+     * @return The size of the file in bytes
+     */
+    auto getSize() const -> size_t;
+
+    /**
+     * Write a font pack. The fonts are sorted by name, duplicate names are rejected. Throws std::runtime_error on failure.
+     */
+    static auto write(const std::string &path, std::vector<std::pair<std::string, std::vector<uint8_t>>> fonts) -> void;
+
+private:
+    auto entry(size_t index) const -> const ucgd_font_pack_entry_t &;
+
+    auto compare(size_t index, const std::string &name) const -> int;
+
+    std::string m_Path;
+    const uint8_t *m_Data = nullptr;
+    size_t m_Size = 0;
+    size_t m_Count = 0;
+    //the pack is read into memory where it can not be mapped
+    std::vector<uint8_t> m_Buffer;
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDFONTPACK_H
@@ -0,0 +1,156 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "UcgdFramePublisher.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+UcgdFramePublisher::UcgdFramePublisher(const std::string &name, int width, int height, int layout, int format, int slots) : m_Name(name),
+                                                                                                                          m_TileHeight(height / 8),
+                                                                                                                          m_MonoRowBytes(static_cast<size_t>(width)),
+                                                                                                                          m_BgraRowBytes(static_cast<size_t>(width) * 8 * 4) {
+    if (m_Name.empty())
+        throw std::runtime_error("UcgdFramePublisher() : Shared memory name cannot be empty");
+    if (m_Name[0] != '/')
+        m_Name.insert(0, "/");
+    if (width <= 0 || height <= 0 || (width % 8) != 0 || (height % 8) != 0)
+        throw std::runtime_error("UcgdFramePublisher() : Invalid frame size " + std::to_string(width) + "x" + std::to_string(height));
+    if ((format & (SHM_FORMAT_MONO | SHM_FORMAT_BGRA)) == 0)
+        throw std::runtime_error("UcgdFramePublisher() : No image format selected");
+    slots = std::max(2, std::min(slots, SHM_MAX_SLOTS));
+
+    auto monoSize = static_cast<uint32_t>((format & SHM_FORMAT_MONO) ? m_MonoRowBytes * m_TileHeight : 0);
+    auto bgraSize = static_cast<uint32_t>((format & SHM_FORMAT_BGRA) ? m_BgraRowBytes * m_TileHeight : 0);
+    size_t slotSize = (ucgdShmBgraOffset(monoSize) + bgraSize + 63u) & ~static_cast<size_t>(63u);
+    size_t headerSize = (sizeof(ucgd_shm_header_t) + 63u) & ~static_cast<size_t>(63u);
+    m_Size = headerSize + slotSize * slots;
+
+#ifdef __linux__
+    //replace a ring left behind by a previous instance, readers still mapping it keep their copy
+    shm_unlink(m_Name.c_str());
+    m_Fd = shm_open(m_Name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+    if (m_Fd < 0)
+        throw std::runtime_error("UcgdFramePublisher() : Unable to create shared memory '" + m_Name + "' (" + std::string(strerror(errno)) + ")");
+    if (ftruncate(m_Fd, static_cast<off_t>(m_Size)) != 0) {
+        int err = errno;
+        close(m_Fd);
+        shm_unlink(m_Name.c_str());
+        throw std::runtime_error("UcgdFramePublisher() : Unable to resize shared memory '" + m_Name + "' (" + std::string(strerror(err)) + ")");
+    }
+    void *base = mmap(nullptr, m_Size, PROT_READ | PROT_WRITE, MAP_SHARED, m_Fd, 0);
+    if (base == MAP_FAILED) {
+        int err = errno;
+        close(m_Fd);
+        shm_unlink(m_Name.c_str());
+        throw std::runtime_error("UcgdFramePublisher() : Unable to map shared memory '" + m_Name + "' (" + std::string(strerror(err)) + ")");
+    }
+    m_Base = static_cast<uint8_t *>(base);
+    //ftruncate zero fills the object, the atomics start at 0
+    m_Header = reinterpret_cast<ucgd_shm_header_t *>(m_Base);
+    m_Header->version = SHM_FRAME_VERSION;
+    m_Header->width = static_cast<uint32_t>(width);
+    m_Header->height = static_cast<uint32_t>(height);
+    m_Header->format = static_cast<uint32_t>(format & (SHM_FORMAT_MONO | SHM_FORMAT_BGRA));
+    m_Header->layout = static_cast<uint32_t>(layout);
+    m_Header->slot_count = static_cast<uint32_t>(slots);
+    m_Header->slot_size = static_cast<uint32_t>(slotSize);
+    m_Header->mono_size = monoSize;
+    m_Header->bgra_size = bgraSize;
+    m_Header->header_size = static_cast<uint32_t>(headerSize);
+    m_Header->writer_pid = static_cast<uint32_t>(getpid());
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Header->magic = SHM_FRAME_MAGIC;
+#else
+    throw std::runtime_error("UcgdFramePublisher() : Shared memory frames are only supported on linux");
+#endif
+}
+
+UcgdFramePublisher::~UcgdFramePublisher() {
+#ifdef __linux__
+    if (m_Base != nullptr)
+        munmap(m_Base, m_Size);
+    if (m_Fd >= 0) {
+        close(m_Fd);
+        shm_unlink(m_Name.c_str());
+    }
+#endif
+}
+
+auto UcgdFramePublisher::slotAt(uint32_t frame) const -> uint8_t * {
+    return m_Base + m_Header->header_size + static_cast<size_t>(frame % m_Header->slot_count) * m_Header->slot_size;
+}
+
+auto UcgdFramePublisher::setDirtyArea(int tx, int ty, int tw, int th) -> void {
+    m_Dirty = {static_cast<uint16_t>(std::max(tx, 0)), static_cast<uint16_t>(std::max(ty, 0)), static_cast<uint16_t>(std::max(tw, 0)), static_cast<uint16_t>(std::max(th, 0))};
+    m_HasDirty = true;
+}
+
+auto UcgdFramePublisher::writePage(int tileRow, int tileRows, const uint8_t *mono, const uint8_t *bgra) -> bool {
+    if (m_Base == nullptr || tileRow < 0 || tileRows <= 0 || tileRow >= m_TileHeight)
+        return false;
+    uint32_t frame = m_Published + 1;
+    uint8_t *slotBase = slotAt(frame);
+    auto *slot = reinterpret_cast<ucgd_shm_slot_t *>(slotBase);
+
+    if (!m_Writing) {
+        //a frame starting in the middle (page loop entered late) is not published
+        if (tileRow != 0)
+            return false;
+        slot->sequence.store(frame * 2 - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Writing = true;
+    }
+
+    tileRows = std::min(tileRows, m_TileHeight - tileRow);
+    if (mono != nullptr && m_Header->mono_size > 0)
+        memcpy(slotBase + SHM_SLOT_DATA_OFFSET + tileRow * m_MonoRowBytes, mono, tileRows * m_MonoRowBytes);
+    if (bgra != nullptr && m_Header->bgra_size > 0)
+        memcpy(slotBase + ucgdShmBgraOffset(m_Header->mono_size) + tileRow * m_BgraRowBytes, bgra + tileRow * m_BgraRowBytes, tileRows * m_BgraRowBytes);
+
+    if (tileRow + tileRows < m_TileHeight)
+        return false;
+
+    slot->frame = frame;
+    slot->timestamp = ucgdMonotonicNanos();
+    if (m_HasDirty)
+        slot->dirty = m_Dirty;
+    else
+        slot->dirty = {0, 0, static_cast<uint16_t>(m_Header->width / 8), static_cast<uint16_t>(m_TileHeight)};
+    m_HasDirty = false;
+    slot->sequence.store(frame * 2, std::memory_order_release);
+    m_Header->frame.store(frame, std::memory_order_release);
+    m_Header->futex.fetch_add(1, std::memory_order_acq_rel);
+    //a reader registering after this check sees the new futex value and does not block
+    if (m_Header->waiters.load(std::memory_order_acquire) > 0)
+        ucgdFutexWake(&m_Header->futex);
+    m_Published = frame;
+    m_Writing = false;
+    return true;
+}
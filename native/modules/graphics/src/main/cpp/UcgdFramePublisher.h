@@ -0,0 +1,94 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDFRAMEPUBLISHER_H
+#define UCGD_MOD_GRAPHICS_UCGDFRAMEPUBLISHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "UcgdFrameShm.h"
+
+/**
+ * Publishes the frames of a display to a POSIX shared memory ring (see UcgdFrameShm.h for the layout) so local
+ * processes can map it and consume the frames without copying them through the JVM. The object is created (or
+ * replaced) on construction and unlinked on destruction.
+ */
+class UcgdFramePublisher {
+public:
+    /**
+     * @param name Name of the shared memory object (a leading '/' is added if missing)
+     * @param width Width of the buffer in pixels (multiple of 8)
+     * @param height Height of the display in pixels (multiple of 8)
+     * @param layout SHM_LAYOUT_* of the 1bpp image
+     * @param format SHM_FORMAT_* flags of the images to publish
+     * @param slots Number of frames in the ring (2 to SHM_MAX_SLOTS)
+     * @throws std::runtime_error if the shared memory object cannot be created
+     */
+    UcgdFramePublisher(const std::string &name, int width, int height, int layout, int format, int slots);
+
+    ~UcgdFramePublisher();
+
+    UcgdFramePublisher(const UcgdFramePublisher &) = delete;
+
+    UcgdFramePublisher &operator=(const UcgdFramePublisher &) = delete;
+
+    /**
+     * Copy tile rows [tileRow, tileRow + tileRows) of the current frame. mono holds these rows only (page buffer), bgra
+     * is the complete bgra frame and may be null. Pages must be written from the top, the frame is published once its
+     * last tile row has been written. Returns true if the frame was published.
+     */
+    auto writePage(int tileRow, int tileRows, const uint8_t *mono, const uint8_t *bgra) -> bool;
+
+    /**
+     * Set the dirty area (in tiles) of the frame being written. Applies to the next published frame only, frames
+     * published without it are marked as completely dirty.
+     */
+    auto setDirtyArea(int tx, int ty, int tw, int th) -> void;
+
+    [[nodiscard]] auto getName() const -> const std::string & {
+        return m_Name;
+    }
+
+    //Number of frames published
+    [[nodiscard]] auto getFrameCount() const -> uint32_t {
+        return m_Published;
+    }
+
+private:
+    auto slotAt(uint32_t frame) const -> uint8_t *;
+
+    std::string m_Name;
+    int m_Fd{-1};
+    size_t m_Size{0};
+    uint8_t *m_Base{nullptr};
+    ucgd_shm_header_t *m_Header{nullptr};
+    int m_TileHeight;
+    //bytes of one tile row (8 pixel rows) of each image
+    size_t m_MonoRowBytes;
+    size_t m_BgraRowBytes;
+    uint32_t m_Published{0};
+    bool m_Writing{false};
+    bool m_HasDirty{false};
+    ucgd_shm_area_t m_Dirty{};
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDFRAMEPUBLISHER_H
@@ -0,0 +1,140 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "UcgdFrameScheduler.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+auto UcgdFrameScheduler::adapt(uint64_t interval, uint64_t target, uint64_t sendTime) -> uint64_t {
+    uint64_t required = sendTime + sendTime / 4;
+    if (required > interval) {
+        //overshoot by 1/8 so a send time hovering around the interval does not re-arm the timer on every frame
+        return std::min<uint64_t>(std::max(required + required / 8, target), SCHEDULER_MAX_INTERVAL);
+    }
+    uint64_t faster = interval - interval / 8;
+    if (interval > target && required < faster)
+        return std::max(faster, target);
+    return std::max(interval, target);
+}
+
+#ifdef __linux__
+
+UcgdFrameScheduler::UcgdFrameScheduler(int fps, bool adaptive) : m_Adaptive(adaptive) {
+    if (fps < 1 || fps > SCHEDULER_MAX_FPS)
+        throw std::runtime_error("UcgdFrameScheduler() : Frame rate must be between 1 and " + std::to_string(SCHEDULER_MAX_FPS));
+    m_Target = 1000000000ull / static_cast<uint64_t>(fps);
+    m_Interval = m_Target;
+    m_TimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    m_StopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (m_TimerFd < 0 || m_StopFd < 0) {
+        std::string error(strerror(errno));
+        if (m_TimerFd >= 0)
+            close(m_TimerFd);
+        if (m_StopFd >= 0)
+            close(m_StopFd);
+        throw std::runtime_error("UcgdFrameScheduler() : Unable to create the frame timer (" + error + ")");
+    }
+    arm(m_Target);
+}
+
+UcgdFrameScheduler::~UcgdFrameScheduler() {
+    close(m_TimerFd);
+    close(m_StopFd);
+}
+
+auto UcgdFrameScheduler::arm(uint64_t interval) -> void {
+    itimerspec spec{};
+    spec.it_interval.tv_sec = static_cast<time_t>(interval / 1000000000ull);
+    spec.it_interval.tv_nsec = static_cast<long>(interval % 1000000000ull);
+    spec.it_value = spec.it_interval;
+    timerfd_settime(m_TimerFd, 0, &spec, nullptr);
+}
+
+auto UcgdFrameScheduler::wait(int timeout) -> int {
+    if (m_Stopped)
+        return SCHEDULER_STOPPED;
+    pollfd fds[2] = {{m_TimerFd, POLLIN, 0}, {m_StopFd, POLLIN, 0}};
+    int result = poll(fds, 2, timeout);
+    if (m_Stopped || (result > 0 && (fds[1].revents & POLLIN)))
+        return SCHEDULER_STOPPED;
+    uint64_t ticks = 0;
+    //a timeout, a signal or the timer re-armed (counter reset) by frameSent() in between
+    if (result <= 0 || read(m_TimerFd, &ticks, sizeof(ticks)) != sizeof(ticks) || ticks == 0)
+        return SCHEDULER_TIMEOUT;
+    return static_cast<int>(std::min<uint64_t>(ticks, INT_MAX));
+}
+
+auto UcgdFrameScheduler::frameSent(uint64_t elapsed) -> void {
+    uint64_t average = m_SendTime.load(std::memory_order_relaxed);
+    //moving average over ~8 frames
+    average = average == 0 ? elapsed : average - average / 8 + elapsed / 8;
+    m_SendTime.store(average, std::memory_order_relaxed);
+    if (!m_Adaptive)
+        return;
+    uint64_t interval = m_Interval.load(std::memory_order_relaxed);
+    uint64_t next = adapt(interval, m_Target, average);
+    if (next != interval) {
+        m_Interval.store(next, std::memory_order_relaxed);
+        arm(next);
+    }
+}
+
+auto UcgdFrameScheduler::stop() -> void {
+    m_Stopped = true;
+    uint64_t one = 1;
+    ssize_t ignored = write(m_StopFd, &one, sizeof(one));
+    (void) ignored;
+}
+
+#else
+
+UcgdFrameScheduler::UcgdFrameScheduler(int fps, bool adaptive) : m_Target(0), m_Adaptive(adaptive), m_Interval(0) {
+    throw std::runtime_error("UcgdFrameScheduler() : Frame scheduling is only supported on linux");
+}
+
+UcgdFrameScheduler::~UcgdFrameScheduler() = default;
+
+auto UcgdFrameScheduler::arm(uint64_t interval) -> void {
+}
+
+auto UcgdFrameScheduler::wait(int timeout) -> int {
+    return SCHEDULER_STOPPED;
+}
+
+auto UcgdFrameScheduler::frameSent(uint64_t elapsed) -> void {
+}
+
+auto UcgdFrameScheduler::stop() -> void {
+}
+
+#endif
@@ -0,0 +1,107 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDFRAMESCHEDULER_H
+#define UCGD_MOD_GRAPHICS_UCGDFRAMESCHEDULER_H
+
+#include <atomic>
+#include <cstdint>
+
+#define SCHEDULER_MAX_FPS 1000
+//Slowest rate the adaptive pacing falls back to (1 fps)
+#define SCHEDULER_MAX_INTERVAL 1000000000ull
+//Return values of UcgdFrameScheduler::wait() besides the number of ticks
+#define SCHEDULER_TIMEOUT 0
+#define SCHEDULER_STOPPED (-1)
+
+/**
+ * Paces the frames of a display with a timerfd (CLOCK_MONOTONIC) instead of sleeping in java. The render thread blocks
+ * in wait() until the next tick, draws and sends the frame, then reports the time the frame took to send. In adaptive
+ * mode the tick interval is stretched when the transport cannot deliver frames at the target rate (send time plus 25%
+ * headroom for drawing) and brought back towards the target once it can. Linux only.
+ */
+class UcgdFrameScheduler {
+public:
+    /**
+     * @param fps Target frame rate (1 to SCHEDULER_MAX_FPS)
+     * @param adaptive Lower the rate when the transport cannot keep up
+     * @throws std::runtime_error if the timer cannot be created
+     */
+    UcgdFrameScheduler(int fps, bool adaptive);
+
+    ~UcgdFrameScheduler();
+
+    UcgdFrameScheduler(const UcgdFrameScheduler &) = delete;
+
+    UcgdFrameScheduler &operator=(const UcgdFrameScheduler &) = delete;
+
+    /**
+     * Block until the next tick.
+     *
+     * @param timeout Maximum wait in milliseconds (negative waits until the next tick or stop())
+     * @return The number of ticks since the previous call (more than 1 if deadlines were missed), SCHEDULER_TIMEOUT or
+     * SCHEDULER_STOPPED
+     */
+    auto wait(int timeout) -> int;
+
+    /**
+     * Report the time the last frame took to send, adjusts the interval in adaptive mode.
+     *
+     * @param elapsed Send time in nanoseconds
+     */
+    auto frameSent(uint64_t elapsed) -> void;
+
+    //Release the threads waiting for a tick, wait() returns SCHEDULER_STOPPED from now on
+    auto stop() -> void;
+
+    //Current tick interval in nanoseconds
+    [[nodiscard]] auto getInterval() const -> uint64_t {
+        return m_Interval.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto getTargetInterval() const -> uint64_t {
+        return m_Target;
+    }
+
+    //Moving average of the send time in nanoseconds
+    [[nodiscard]] auto getSendTime() const -> uint64_t {
+        return m_SendTime.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Interval needed for a frame rate target given the average send time (adaptive pacing). The rate is lowered as
+     * soon as the frames no longer fit, and raised back in steps of 1/8 once they fit with room to spare.
+     */
+    static auto adapt(uint64_t interval, uint64_t target, uint64_t sendTime) -> uint64_t;
+
+private:
+    auto arm(uint64_t interval) -> void;
+
+    uint64_t m_Target;
+    bool m_Adaptive;
+    std::atomic<uint64_t> m_Interval;
+    std::atomic<uint64_t> m_SendTime{0};
+    std::atomic<bool> m_Stopped{false};
+    int m_TimerFd = -1;
+    int m_StopFd = -1;
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDFRAMESCHEDULER_H
@@ -0,0 +1,171 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "UcgdFrameShm.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+auto ucgdMonotonicNanos() -> uint64_t {
+    struct timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+#ifdef __linux__
+
+auto ucgdFutexWait(std::atomic<uint32_t> *word, uint32_t expected, int timeoutMs) -> bool {
+    struct timespec ts{};
+    struct timespec *timeout = nullptr;
+    if (timeoutMs >= 0) {
+        ts.tv_sec = timeoutMs / 1000;
+        ts.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+        timeout = &ts;
+    }
+    //not FUTEX_PRIVATE_FLAG, the word is shared with other processes
+    long res = syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAIT, expected, timeout, nullptr, 0);
+    return !(res == -1 && errno == ETIMEDOUT);
+}
+
+auto ucgdFutexWake(std::atomic<uint32_t> *word) -> void {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+UcgdFrameReader::UcgdFrameReader(const std::string &name) {
+    m_Fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (m_Fd < 0)
+        throw std::runtime_error("UcgdFrameReader() : Unable to open shared memory '" + name + "' (" + std::string(strerror(errno)) + ")");
+    struct stat st{};
+    if (fstat(m_Fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ucgd_shm_header_t)) {
+        close(m_Fd);
+        throw std::runtime_error("UcgdFrameReader() : Shared memory '" + name + "' is too small");
+    }
+    m_Size = static_cast<size_t>(st.st_size);
+    void *base = mmap(nullptr, m_Size, PROT_READ | PROT_WRITE, MAP_SHARED, m_Fd, 0);
+    if (base == MAP_FAILED) {
+        close(m_Fd);
+        throw std::runtime_error("UcgdFrameReader() : Unable to map shared memory '" + name + "' (" + std::string(strerror(errno)) + ")");
+    }
+    m_Base = static_cast<uint8_t *>(base);
+    m_Header = reinterpret_cast<ucgd_shm_header_t *>(m_Base);
+    bool valid = m_Header->magic == SHM_FRAME_MAGIC && m_Header->version == SHM_FRAME_VERSION &&
+                 static_cast<size_t>(m_Header->header_size) + static_cast<size_t>(m_Header->slot_count) * m_Header->slot_size <= m_Size &&
+                 m_Header->slot_count > 0 && ucgdShmBgraOffset(m_Header->mono_size) + m_Header->bgra_size <= m_Header->slot_size;
+    if (!valid) {
+        munmap(m_Base, m_Size);
+        close(m_Fd);
+        throw std::runtime_error("UcgdFrameReader() : Shared memory '" + name + "' is not a frame ring (or has an unsupported version)");
+    }
+}
+
+UcgdFrameReader::~UcgdFrameReader() {
+    if (m_Base != nullptr)
+        munmap(m_Base, m_Size);
+    if (m_Fd >= 0)
+        close(m_Fd);
+}
+
+#else
+
+auto ucgdFutexWait(std::atomic<uint32_t> *word, uint32_t expected, int timeoutMs) -> bool {
+    return false;
+}
+
+auto ucgdFutexWake(std::atomic<uint32_t> *word) -> void {
+}
+
+UcgdFrameReader::UcgdFrameReader(const std::string &name) {
+    throw std::runtime_error("UcgdFrameReader() : Shared memory frames are only supported on linux");
+}
+
+UcgdFrameReader::~UcgdFrameReader() = default;
+
+#endif
+
+auto UcgdFrameReader::latest() const -> uint32_t {
+    return m_Header->frame.load(std::memory_order_acquire);
+}
+
+auto UcgdFrameReader::wait(uint32_t last, int timeoutMs) -> uint32_t {
+    uint64_t deadline = timeoutMs >= 0 ? ucgdMonotonicNanos() + static_cast<uint64_t>(timeoutMs) * 1000000ull : 0;
+    while (true) {
+        //read the futex word before the frame, a publish in between changes it and the wait returns immediately
+        uint32_t word = m_Header->futex.load(std::memory_order_acquire);
+        uint32_t frame = latest();
+        if (frame != last)
+            return frame;
+        int remaining = -1;
+        if (timeoutMs >= 0) {
+            uint64_t now = ucgdMonotonicNanos();
+            if (now >= deadline)
+                return 0;
+            remaining = static_cast<int>((deadline - now + 999999) / 1000000);
+        }
+        m_Header->waiters.fetch_add(1, std::memory_order_acq_rel);
+        ucgdFutexWait(&m_Header->futex, word, remaining);
+        m_Header->waiters.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+auto UcgdFrameReader::tryRead(uint32_t n, uint8_t *mono, uint8_t *bgra, uint64_t *timestamp, ucgd_shm_area_t *dirty) -> bool {
+    uint8_t *slotBase = m_Base + m_Header->header_size + static_cast<size_t>(n % m_Header->slot_count) * m_Header->slot_size;
+    auto *slot = reinterpret_cast<ucgd_shm_slot_t *>(slotBase);
+    uint32_t expected = n * 2;
+    if (slot->sequence.load(std::memory_order_acquire) != expected)
+        return false;
+    uint64_t ts = slot->timestamp;
+    ucgd_shm_area_t area = slot->dirty;
+    if (mono != nullptr && (m_Header->format & SHM_FORMAT_MONO))
+        memcpy(mono, slotBase + SHM_SLOT_DATA_OFFSET, m_Header->mono_size);
+    if (bgra != nullptr && (m_Header->format & SHM_FORMAT_BGRA))
+        memcpy(bgra, slotBase + ucgdShmBgraOffset(m_Header->mono_size), m_Header->bgra_size);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->sequence.load(std::memory_order_relaxed) != expected)
+        return false;
+    if (timestamp != nullptr)
+        *timestamp = ts;
+    if (dirty != nullptr)
+        *dirty = area;
+    return true;
+}
+
+auto UcgdFrameReader::read(uint8_t *mono, uint8_t *bgra, uint64_t *timestamp, ucgd_shm_area_t *dirty) -> uint32_t {
+    while (true) {
+        uint32_t n = latest();
+        if (n == 0)
+            return 0;
+        if (tryRead(n, mono, bgra, timestamp, dirty))
+            return n;
+        //the writer lapped the ring while copying, retry with the newest frame
+    }
+}
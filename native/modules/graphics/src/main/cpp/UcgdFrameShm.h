@@ -0,0 +1,157 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDFRAMESHM_H
+#define UCGD_MOD_GRAPHICS_UCGDFRAMESHM_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * Shared memory frame ring written by UcgdFramePublisher. The object starts with a ucgd_shm_header_t, followed by
+ * slot_count slots of slot_size bytes. Each slot starts with a ucgd_shm_slot_t, the 1bpp image (u8g2 buffer layout) is
+ * at SHM_SLOT_DATA_OFFSET and the bgra image follows it (64 byte aligned).
+ *
+ * Frame n (starting at 1) is written to slot n % slot_count. The slot sequence is a seqlock: 2n - 1 while frame n is
+ * being written, 2n once complete. A reader copies the slot and accepts the copy if the sequence was 2n before and
+ * after. After each frame the writer stores n in the header, increments the futex word and wakes the waiters. Only
+ * 32-bit atomics are used, they are lock-free (and usable across processes) on every supported target.
+ *
+ * The dirty area of a slot is the area (in 8x8 tiles of the 1bpp image) that differs from frame n - 1, the whole frame
+ * unless the writer tracks the changes (layers). A reader that skipped a frame must treat the whole frame as dirty.
+ */
+
+#define SHM_FRAME_MAGIC 0x46474355u //"UCGF"
+#define SHM_FRAME_VERSION 2
+
+//Images present in each slot
+#define SHM_FORMAT_MONO 0x01
+#define SHM_FORMAT_BGRA 0x02
+
+//Layout of the 1bpp image
+#define SHM_LAYOUT_VERTICAL 0   //u8g2_ll_hvline_vertical_top_lsb, one byte per 8 rows of a column
+#define SHM_LAYOUT_HORIZONTAL 1 //u8g2_ll_hvline_horizontal_right_lsb, one byte per 8 columns of a row, msb first
+
+#define SHM_SLOT_DATA_OFFSET 64
+#define SHM_DEFAULT_SLOTS 4
+#define SHM_MAX_SLOTS 64
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "32-bit atomics must be lock-free to be shared across processes");
+
+struct ucgd_shm_header_t {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    //SHM_FORMAT_* flags
+    uint32_t format;
+    //SHM_LAYOUT_* of the 1bpp image
+    uint32_t layout;
+    uint32_t slot_count;
+    uint32_t slot_size;
+    uint32_t mono_size;
+    uint32_t bgra_size;
+    //offset of the first slot
+    uint32_t header_size;
+    uint32_t writer_pid;
+    alignas(64) std::atomic<uint32_t> frame;
+    //incremented after each frame, readers wait on it with FUTEX_WAIT
+    std::atomic<uint32_t> futex;
+    //number of readers blocked in a futex wait, the writer skips the wake syscall if zero
+    std::atomic<uint32_t> waiters;
+};
+
+//Area in tiles (8x8 pixels), a width or height of 0 is an empty area
+struct ucgd_shm_area_t {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+struct ucgd_shm_slot_t {
+    std::atomic<uint32_t> sequence;
+    uint32_t frame;
+    //CLOCK_MONOTONIC time of the publication in nanoseconds
+    uint64_t timestamp;
+    //area that changed since the previous frame
+    ucgd_shm_area_t dirty;
+};
+
+static_assert(sizeof(ucgd_shm_slot_t) <= SHM_SLOT_DATA_OFFSET, "slot header overlaps the image data");
+
+//Offset of the bgra image within a slot
+inline auto ucgdShmBgraOffset(uint32_t monoSize) -> size_t {
+    return SHM_SLOT_DATA_OFFSET + ((static_cast<size_t>(monoSize) + 63u) & ~static_cast<size_t>(63u));
+}
+
+//Futex helpers on a 32-bit word of a shared mapping. Wait returns false on timeout (timeoutMs < 0 waits forever).
+auto ucgdFutexWait(std::atomic<uint32_t> *word, uint32_t expected, int timeoutMs) -> bool;
+
+auto ucgdFutexWake(std::atomic<uint32_t> *word) -> void;
+
+//Monotonic clock in nanoseconds, comparable between processes
+auto ucgdMonotonicNanos() -> uint64_t;
+
+/**
+ * Reference reader of a frame ring created by UcgdFramePublisher. Maps the shared memory object read-write (the
+ * waiter count lives in the header) and copies consistent frames out of it.
+ */
+class UcgdFrameReader {
+public:
+    //Opens the shared memory object, throws std::runtime_error if it does not exist or is not a frame ring
+    explicit UcgdFrameReader(const std::string &name);
+
+    ~UcgdFrameReader();
+
+    UcgdFrameReader(const UcgdFrameReader &) = delete;
+
+    UcgdFrameReader &operator=(const UcgdFrameReader &) = delete;
+
+    [[nodiscard]] auto header() const -> const ucgd_shm_header_t & {
+        return *m_Header;
+    }
+
+    //Number of the last published frame (0 if none)
+    [[nodiscard]] auto latest() const -> uint32_t;
+
+    //Block until a frame newer than last is published. Returns the latest frame number or 0 on timeout.
+    auto wait(uint32_t last, int timeoutMs) -> uint32_t;
+
+    /**
+     * Copy the latest frame. mono (mono_size bytes) and bgra (bgra_size bytes) may be null. Retries while the writer
+     * overwrites the slot. Returns the frame number or 0 if nothing has been published yet.
+     */
+    auto read(uint8_t *mono, uint8_t *bgra, uint64_t *timestamp = nullptr, ucgd_shm_area_t *dirty = nullptr) -> uint32_t;
+
+private:
+    //Copy frame n if its slot still holds it
+    auto tryRead(uint32_t n, uint8_t *mono, uint8_t *bgra, uint64_t *timestamp, ucgd_shm_area_t *dirty) -> bool;
+
+    int m_Fd{-1};
+    size_t m_Size{0};
+    uint8_t *m_Base{nullptr};
+    ucgd_shm_header_t *m_Header{nullptr};
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDFRAMESHM_H
@@ -0,0 +1,470 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "UcgdInput.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <linux/input.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#define SOURCE_EVDEV 0
+#define SOURCE_BUTTON 1
+#define SOURCE_ENCODER 2
+
+//epoll data of the stop eventfd, devices use (handle << 1) | line index
+#define STOP_TOKEN 0
+
+#define EPOLL_BATCH 16
+#define READ_BATCH 32
+
+//Quadrature step for each (previous state << 2) | current state, the state being (A << 1) | B
+static const int8_t quadratureSteps[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+UcgdInputRing::UcgdInputRing(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity)
+        size <<= 1;
+    m_Events.resize(size);
+    m_Mask = size - 1;
+}
+
+auto UcgdInputRing::push(const ucgd_input_event_t &event) noexcept -> bool {
+    size_t head = m_Head.load(std::memory_order_relaxed);
+    if (head - m_Tail.load(std::memory_order_acquire) >= m_Events.size()) {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    m_Events[head & m_Mask] = event;
+    m_Head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+auto UcgdInputRing::pop(ucgd_input_event_t *events, size_t max) noexcept -> size_t {
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+    size_t count = std::min(m_Head.load(std::memory_order_acquire) - tail, max);
+    for (size_t i = 0; i < count; i++)
+        events[i] = m_Events[(tail + i) & m_Mask];
+    m_Tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+auto UcgdInputRing::size() const noexcept -> size_t {
+    return m_Head.load(std::memory_order_acquire) - m_Tail.load(std::memory_order_acquire);
+}
+
+auto UcgdDebouncer::reset(uint64_t lockout, bool level) noexcept -> void {
+    m_Lockout = lockout;
+    m_LockUntil = 0;
+    m_Reported = m_Raw = level;
+    m_Pending = false;
+}
+
+auto UcgdDebouncer::edge(bool level, uint64_t timestamp) noexcept -> bool {
+    m_Raw = level;
+    if (timestamp < m_LockUntil) {
+        m_Pending = true;
+        return false;
+    }
+    if (level == m_Reported)
+        return false;
+    m_Reported = level;
+    m_LockUntil = timestamp + m_Lockout;
+    m_Pending = false;
+    return true;
+}
+
+auto UcgdDebouncer::expire(uint64_t now) noexcept -> bool {
+    if (!m_Pending || now < m_LockUntil)
+        return false;
+    m_Pending = false;
+    if (m_Raw == m_Reported)
+        return false;
+    m_Reported = m_Raw;
+    m_LockUntil = now + m_Lockout;
+    return true;
+}
+
+auto UcgdQuadrature::reset(int stepsPerDetent, bool a, bool b) noexcept -> void {
+    m_Steps = std::max(1, stepsPerDetent);
+    m_Count = 0;
+    m_State = static_cast<uint8_t>((a << 1) | b);
+}
+
+auto UcgdQuadrature::update(bool a, bool b) noexcept -> int {
+    auto state = static_cast<uint8_t>((a << 1) | b);
+    m_Count += quadratureSteps[(m_State << 2) | state];
+    m_State = state;
+    int detents = m_Count / m_Steps;
+    m_Count -= detents * m_Steps;
+    return detents;
+}
+
+struct UcgdInputManager::source_t {
+    int kind = SOURCE_EVDEV;
+    uint32_t handle = 0;
+    int fd[2]{-1, -1};
+    int line = 0;
+    bool level[2]{};
+    UcgdDebouncer debouncer;
+    UcgdQuadrature quadrature;
+
+    ~source_t() {
+#ifdef __linux__
+        for (int f : fd) {
+            if (f >= 0)
+                ::close(f);
+        }
+#endif
+    }
+};
+
+#ifdef __linux__
+
+static auto monotonicNow() -> uint64_t {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static auto errorString() -> std::string {
+    return std::string(strerror(errno));
+}
+
+/**
+ * Request the edge events of a gpio line, returns the (non-blocking) event fd. Active low lines are inverted by the
+ * kernel and get a pull-up where the kernel supports bias flags (5.5+).
+ */
+static auto requestLine(const std::string &chip, int line, bool activeLow, bool &level) -> int {
+    std::string path = chip.find('/') == std::string::npos ? "/dev/" + chip : chip;
+    int chipFd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (chipFd < 0)
+        throw std::runtime_error("requestLine() : Unable to open gpio chip '" + path + "' (" + errorString() + ")");
+
+    gpioevent_request req{};
+    req.lineoffset = static_cast<uint32_t>(line);
+    req.handleflags = GPIOHANDLE_REQUEST_INPUT | (activeLow ? (GPIOHANDLE_REQUEST_ACTIVE_LOW | GPIOHANDLE_REQUEST_BIAS_PULL_UP) : 0);
+    req.eventflags = GPIOEVENT_REQUEST_BOTH_EDGES;
+    std::strncpy(req.consumer_label, "ucgdisp", sizeof(req.consumer_label) - 1);
+    int result = ioctl(chipFd, GPIO_GET_LINEEVENT_IOCTL, &req);
+    if (result < 0 && errno == EINVAL && activeLow) {
+        req.handleflags &= ~GPIOHANDLE_REQUEST_BIAS_PULL_UP;
+        result = ioctl(chipFd, GPIO_GET_LINEEVENT_IOCTL, &req);
+    }
+    int err = errno;
+    ::close(chipFd);
+    if (result < 0)
+        throw std::runtime_error("requestLine() : Unable to request line " + std::to_string(line) + " of '" + path + "' (" + std::string(strerror(err)) + ")");
+
+    gpiohandle_data data{};
+    if (ioctl(req.fd, GPIOHANDLE_GET_LINE_VALUES_IOCTL, &data) < 0 || fcntl(req.fd, F_SETFL, fcntl(req.fd, F_GETFL) | O_NONBLOCK) < 0) {
+        err = errno;
+        ::close(req.fd);
+        throw std::runtime_error("requestLine() : Unable to configure line " + std::to_string(line) + " of '" + path + "' (" + std::string(strerror(err)) + ")");
+    }
+    level = data.values[0] != 0;
+    return req.fd;
+}
+
+UcgdInputManager::UcgdInputManager(size_t capacity) : m_Ring(capacity) {
+    m_EpollFd = epoll_create1(EPOLL_CLOEXEC);
+    m_StopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    m_ReadyFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = STOP_TOKEN;
+    if (m_EpollFd < 0 || m_StopFd < 0 || m_ReadyFd < 0 || epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, m_StopFd, &ev) < 0) {
+        std::string error = errorString();
+        for (int fd : {m_EpollFd, m_StopFd, m_ReadyFd}) {
+            if (fd >= 0)
+                ::close(fd);
+        }
+        throw std::runtime_error("UcgdInputManager() : Unable to create the event loop (" + error + ")");
+    }
+}
+
+UcgdInputManager::~UcgdInputManager() {
+    stop();
+    ::close(m_EpollFd);
+    ::close(m_StopFd);
+    ::close(m_ReadyFd);
+}
+
+auto UcgdInputManager::openEvdev(const std::string &path, bool grab) -> uint32_t {
+    auto source = std::make_unique<source_t>();
+    source->kind = SOURCE_EVDEV;
+    source->fd[0] = open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (source->fd[0] < 0)
+        throw std::runtime_error("openEvdev() : Unable to open '" + path + "' (" + errorString() + ")");
+    //same clock as the gpio events
+    int clock = CLOCK_MONOTONIC;
+    ioctl(source->fd[0], EVIOCSCLOCKID, &clock);
+    if (grab && ioctl(source->fd[0], EVIOCGRAB, 1) < 0)
+        throw std::runtime_error("openEvdev() : Unable to grab '" + path + "' (" + errorString() + ")");
+    return add(std::move(source));
+}
+
+auto UcgdInputManager::openButton(const std::string &chip, int line, int debounce, bool activeLow) -> uint32_t {
+    if (line < 0)
+        throw std::runtime_error("openButton() : Invalid line " + std::to_string(line));
+    if (debounce < 0 || debounce > INPUT_MAX_DEBOUNCE)
+        throw std::runtime_error("openButton() : Debounce must be between 0 and " + std::to_string(INPUT_MAX_DEBOUNCE) + " us");
+    auto source = std::make_unique<source_t>();
+    source->kind = SOURCE_BUTTON;
+    source->line = line;
+    source->fd[0] = requestLine(chip, line, activeLow, source->level[0]);
+    source->debouncer.reset(static_cast<uint64_t>(debounce) * 1000u, source->level[0]);
+    return add(std::move(source));
+}
+
+auto UcgdInputManager::openEncoder(const std::string &chip, int lineA, int lineB, int stepsPerDetent) -> uint32_t {
+    if (lineA < 0 || lineB < 0 || lineA == lineB)
+        throw std::runtime_error("openEncoder() : Invalid lines " + std::to_string(lineA) + "/" + std::to_string(lineB));
+    if (stepsPerDetent != 1 && stepsPerDetent != 2 && stepsPerDetent != 4)
+        throw std::runtime_error("openEncoder() : Steps per detent must be 1, 2 or 4");
+    auto source = std::make_unique<source_t>();
+    source->kind = SOURCE_ENCODER;
+    source->line = lineA;
+    source->fd[0] = requestLine(chip, lineA, false, source->level[0]);
+    source->fd[1] = requestLine(chip, lineB, false, source->level[1]);
+    source->quadrature.reset(stepsPerDetent, source->level[0], source->level[1]);
+    return add(std::move(source));
+}
+
+auto UcgdInputManager::add(std::unique_ptr<source_t> source) -> uint32_t {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    if (m_Stopped)
+        throw std::runtime_error("add() : The input manager has been stopped");
+    uint32_t handle = m_NextHandle++;
+    source->handle = handle;
+    for (int i = 0; i < 2; i++) {
+        if (source->fd[i] < 0)
+            continue;
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.u64 = (static_cast<uint64_t>(handle) << 1) | static_cast<uint64_t>(i);
+        if (epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, source->fd[i], &ev) < 0) {
+            std::string error = errorString();
+            if (i == 1)
+                epoll_ctl(m_EpollFd, EPOLL_CTL_DEL, source->fd[0], nullptr);
+            throw std::runtime_error("add() : Unable to watch the device (" + error + ")");
+        }
+    }
+    m_Sources[handle] = std::move(source);
+    if (!m_Thread.joinable())
+        m_Thread = std::thread(&UcgdInputManager::run, this);
+    return handle;
+}
+
+auto UcgdInputManager::close(uint32_t handle) -> bool {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    auto it = m_Sources.find(handle);
+    if (it == m_Sources.end())
+        return false;
+    for (int fd : it->second->fd) {
+        if (fd >= 0)
+            epoll_ctl(m_EpollFd, EPOLL_CTL_DEL, fd, nullptr);
+    }
+    m_Sources.erase(it);
+    return true;
+}
+
+auto UcgdInputManager::read(ucgd_input_event_t *events, size_t max, int timeout) -> size_t {
+    std::lock_guard<std::mutex> lock(m_ReadLock);
+    size_t count = m_Ring.pop(events, max);
+    while (count == 0 && timeout != 0 && !m_Stopped) {
+        pollfd pfd{m_ReadyFd, POLLIN, 0};
+        if (poll(&pfd, 1, timeout) <= 0)
+            return 0;
+        uint64_t value;
+        ssize_t ignored = ::read(m_ReadyFd, &value, sizeof(value));
+        (void) ignored;
+        count = m_Ring.pop(events, max);
+        //a timed wait returns after the first wake up, an unbounded one waits for events
+        if (timeout > 0)
+            break;
+    }
+    return count;
+}
+
+auto UcgdInputManager::stop() -> void {
+    {
+        std::lock_guard<std::mutex> lock(m_Lock);
+        if (m_Stopped)
+            return;
+        m_Stopped = true;
+    }
+    if (m_Thread.joinable()) {
+        uint64_t one = 1;
+        ssize_t ignored = write(m_StopFd, &one, sizeof(one));
+        (void) ignored;
+        m_Thread.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_Lock);
+        m_Sources.clear();
+    }
+    //release a blocked reader
+    uint64_t one = 1;
+    ssize_t ignored = write(m_ReadyFd, &one, sizeof(one));
+    (void) ignored;
+}
+
+auto UcgdInputManager::run() noexcept -> void {
+    epoll_event events[EPOLL_BATCH];
+    int timeout = -1;
+    for (;;) {
+        int count = epoll_wait(m_EpollFd, events, EPOLL_BATCH, timeout);
+        if (count < 0 && errno != EINTR)
+            return;
+        uint64_t now = monotonicNow();
+        std::lock_guard<std::mutex> lock(m_Lock);
+        for (int i = 0; i < count; i++) {
+            if (events[i].data.u64 == STOP_TOKEN)
+                return;
+            auto it = m_Sources.find(static_cast<uint32_t>(events[i].data.u64 >> 1));
+            if (it != m_Sources.end())
+                dispatch(*it->second, static_cast<int>(events[i].data.u64 & 1u), now);
+        }
+        timeout = expire(now);
+        //one wake up of the reader per batch
+        if (m_Emitted) {
+            m_Emitted = false;
+            uint64_t one = 1;
+            ssize_t ignored = write(m_ReadyFd, &one, sizeof(one));
+            (void) ignored;
+        }
+    }
+}
+
+auto UcgdInputManager::dispatch(source_t &source, int index, uint64_t now) noexcept -> void {
+    int &fd = source.fd[index];
+    ssize_t size;
+    if (source.kind == SOURCE_EVDEV) {
+        input_event events[READ_BATCH];
+        while ((size = ::read(fd, events, sizeof(events))) > 0) {
+            for (size_t i = 0; i < static_cast<size_t>(size) / sizeof(input_event); i++) {
+                const input_event &ev = events[i];
+                if (ev.type != EV_KEY && ev.type != EV_REL && ev.type != EV_ABS && ev.type != EV_SW)
+                    continue;
+                uint64_t timestamp = static_cast<uint64_t>(ev.input_event_sec) * 1000000000ull + static_cast<uint64_t>(ev.input_event_usec) * 1000u;
+                emit(source, timestamp, ev.type, ev.code, ev.value);
+            }
+        }
+    } else {
+        gpioevent_data events[READ_BATCH];
+        while ((size = ::read(fd, events, sizeof(events))) > 0) {
+            for (size_t i = 0; i < static_cast<size_t>(size) / sizeof(gpioevent_data); i++) {
+                bool level = events[i].id == GPIOEVENT_EVENT_RISING_EDGE;
+                if (source.kind == SOURCE_BUTTON) {
+                    //debounced on the time of arrival, the kernel stamps gpio events with CLOCK_REALTIME before 5.7
+                    if (source.debouncer.edge(level, now))
+                        emit(source, events[i].timestamp, INPUT_TYPE_KEY, source.line, level);
+                } else {
+                    source.level[index] = level;
+                    int detents = source.quadrature.update(source.level[0], source.level[1]);
+                    if (detents != 0)
+                        emit(source, events[i].timestamp, INPUT_TYPE_REL, INPUT_CODE_ENCODER, detents);
+                }
+            }
+        }
+    }
+    //the device is gone (e.g. unplugged), stop watching it, the handle stays valid until it is closed
+    if (size < 0 && errno != EAGAIN && errno != EINTR) {
+        epoll_ctl(m_EpollFd, EPOLL_CTL_DEL, fd, nullptr);
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+auto UcgdInputManager::expire(uint64_t now) noexcept -> int {
+    uint64_t next = 0;
+    for (auto &entry : m_Sources) {
+        source_t &source = *entry.second;
+        if (source.kind != SOURCE_BUTTON)
+            continue;
+        uint64_t deadline = source.debouncer.getDeadline();
+        if (deadline != 0 && deadline <= now && source.debouncer.expire(now))
+            emit(source, now, INPUT_TYPE_KEY, source.line, source.debouncer.getLevel());
+        deadline = source.debouncer.getDeadline();
+        if (deadline != 0 && (next == 0 || deadline < next))
+            next = deadline;
+    }
+    if (next == 0)
+        return -1;
+    //rounded up, waking before the deadline would spin
+    return static_cast<int>((next - now + 999999u) / 1000000u);
+}
+
+#else
+
+UcgdInputManager::UcgdInputManager(size_t capacity) : m_Ring(capacity) {
+}
+
+UcgdInputManager::~UcgdInputManager() = default;
+
+auto UcgdInputManager::openEvdev(const std::string &path, bool grab) -> uint32_t {
+    throw std::runtime_error("openEvdev() : Input devices are only supported on linux");
+}
+
+auto UcgdInputManager::openButton(const std::string &chip, int line, int debounce, bool activeLow) -> uint32_t {
+    throw std::runtime_error("openButton() : Input devices are only supported on linux");
+}
+
+auto UcgdInputManager::openEncoder(const std::string &chip, int lineA, int lineB, int stepsPerDetent) -> uint32_t {
+    throw std::runtime_error("openEncoder() : Input devices are only supported on linux");
+}
+
+auto UcgdInputManager::close(uint32_t handle) -> bool {
+    return false;
+}
+
+auto UcgdInputManager::read(ucgd_input_event_t *events, size_t max, int timeout) -> size_t {
+    return 0;
+}
+
+auto UcgdInputManager::stop() -> void {
+}
+
+#endif
+
+auto UcgdInputManager::emit(const source_t &source, uint64_t timestamp, int type, int code, int value) noexcept -> void {
+    ucgd_input_event_t event{};
+    event.timestamp = timestamp;
+    event.source = source.handle;
+    event.type = static_cast<uint16_t>(type);
+    event.code = static_cast<uint16_t>(code);
+    event.value = value;
+    m_Ring.push(event);
+    m_Emitted = true;
+}
@@ -0,0 +1,233 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDINPUT_H
+#define UCGD_MOD_GRAPHICS_UCGDINPUT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//Event types, the same values as the linux evdev types so evdev events are passed through unchanged
+#define INPUT_TYPE_KEY 0x01
+#define INPUT_TYPE_REL 0x02
+#define INPUT_TYPE_ABS 0x03
+#define INPUT_TYPE_SW 0x05
+
+//Code of the relative events reported by a gpio rotary encoder (REL_DIAL)
+#define INPUT_CODE_ENCODER 0x07
+
+#define INPUT_EVENT_SIZE 24
+#define INPUT_RING_CAPACITY 1024
+#define INPUT_MAX_DEBOUNCE 1000000
+
+/**
+ * An input event as read by java (little endian, INPUT_EVENT_SIZE bytes). For gpio buttons the code is the line
+ * offset and the value is 1 (pressed) or 0 (released), encoders report INPUT_TYPE_REL/INPUT_CODE_ENCODER with the
+ * number of detents turned (negative counter clockwise).
+ */
+struct ucgd_input_event_t {
+    uint64_t timestamp;  //CLOCK_MONOTONIC in nanoseconds (kernel edge time, gpio events use CLOCK_REALTIME before linux 5.7)
+    uint32_t source;     //Handle returned when the device was opened
+    uint16_t type;       //INPUT_TYPE_*
+    uint16_t code;
+    int32_t value;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(ucgd_input_event_t) == INPUT_EVENT_SIZE, "Input events are read by java at fixed offsets");
+
+/**
+ * Single producer / single consumer ring of input events. Neither side blocks, events are dropped (and counted) when
+ * the ring is full.
+ */
+class UcgdInputRing {
+public:
+    //@param capacity Number of events, rounded up to a power of two
+    explicit UcgdInputRing(size_t capacity = INPUT_RING_CAPACITY);
+
+    //Producer side, returns false if the ring is full
+    auto push(const ucgd_input_event_t &event) noexcept -> bool;
+
+    //Consumer side, moves up to max events into events
+    auto pop(ucgd_input_event_t *events, size_t max) noexcept -> size_t;
+
+    [[nodiscard]] auto size() const noexcept -> size_t;
+
+    [[nodiscard]] auto getCapacity() const noexcept -> size_t {
+        return m_Events.size();
+    }
+
+    [[nodiscard]] auto getDropped() const noexcept -> uint64_t {
+        return m_Dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<ucgd_input_event_t> m_Events;
+    size_t m_Mask;
+    alignas(64) std::atomic<size_t> m_Head{0};
+    alignas(64) std::atomic<size_t> m_Tail{0};
+    std::atomic<uint64_t> m_Dropped{0};
+};
+
+/**
+ * Debounces the edges of a button. The first edge is reported immediately and starts a lockout, edges inside the
+ * lockout are only recorded. If the level at the end of the lockout differs from the reported one, it is reported
+ * then (so a release inside the lockout is never lost).
+ */
+class UcgdDebouncer {
+public:
+    //@param lockout Lockout after a reported edge in nanoseconds
+    auto reset(uint64_t lockout, bool level) noexcept -> void;
+
+    //Returns true if the edge must be reported, the level to report is getLevel()
+    auto edge(bool level, uint64_t timestamp) noexcept -> bool;
+
+    //Call once the deadline has passed, returns true if a level must be reported
+    auto expire(uint64_t now) noexcept -> bool;
+
+    //End of the pending lockout (0 if no edge is waiting for it)
+    [[nodiscard]] auto getDeadline() const noexcept -> uint64_t {
+        return m_Pending ? m_LockUntil : 0;
+    }
+
+    [[nodiscard]] auto getLevel() const noexcept -> bool {
+        return m_Reported;
+    }
+
+private:
+    uint64_t m_Lockout = 0;
+    uint64_t m_LockUntil = 0;
+    bool m_Reported = false;
+    bool m_Raw = false;
+    bool m_Pending = false;
+};
+
+/**
+ * Quadrature decoder of a rotary encoder. Invalid transitions (both lines changed, a missed edge) are ignored.
+ */
+class UcgdQuadrature {
+public:
+    //@param stepsPerDetent Number of quadrature steps between two detents (usually 4, 2 or 1)
+    auto reset(int stepsPerDetent, bool a, bool b) noexcept -> void;
+
+    //Feed the current line levels, returns the number of detents completed (negative counter clockwise)
+    auto update(bool a, bool b) noexcept -> int;
+
+private:
+    int m_Steps = 4;
+    int m_Count = 0;
+    uint8_t m_State = 0;
+};
+
+/**
+ * Native input subsystem. One thread waits (epoll) on every opened device: evdev devices (/dev/input/event*) and gpio
+ * lines (edge events of the gpio character device). Events are decoded (debounced buttons, quadrature encoders) on
+ * that thread and stored in a lock-free ring that java drains in batches with read(), there is no upcall per event.
+ * Linux only, open() throws on other platforms.
+ */
+class UcgdInputManager {
+public:
+    explicit UcgdInputManager(size_t capacity = INPUT_RING_CAPACITY);
+
+    ~UcgdInputManager();
+
+    UcgdInputManager(const UcgdInputManager &) = delete;
+
+    UcgdInputManager &operator=(const UcgdInputManager &) = delete;
+
+    /**
+     * @param path Path of the evdev device (e.g. /dev/input/event0)
+     * @param grab Grab the device, other readers (e.g. the console) stop receiving its events
+     * @return The handle of the device (source of its events)
+     * @throws std::runtime_error if the device cannot be opened
+     */
+    auto openEvdev(const std::string &path, bool grab) -> uint32_t;
+
+    /**
+     * @param chip Gpio chip (gpiochip0 or /dev/gpiochip0)
+     * @param line Line offset
+     * @param debounce Debounce lockout in microseconds (0 to disable)
+     * @param activeLow The button pulls the line low when pressed
+     * @throws std::runtime_error if the line cannot be requested
+     */
+    auto openButton(const std::string &chip, int line, int debounce, bool activeLow) -> uint32_t;
+
+    /**
+     * @param chip Gpio chip (gpiochip0 or /dev/gpiochip0)
+     * @param lineA Line offset of channel A
+     * @param lineB Line offset of channel B
+     * @param stepsPerDetent Quadrature steps per detent (1, 2 or 4)
+     * @throws std::runtime_error if the lines cannot be requested
+     */
+    auto openEncoder(const std::string &chip, int lineA, int lineB, int stepsPerDetent) -> uint32_t;
+
+    //Returns false if the handle is unknown
+    auto close(uint32_t handle) -> bool;
+
+    /**
+     * Move up to max pending events into events.
+     *
+     * @param timeout Time to wait for the first event in milliseconds (0 returns immediately, negative waits forever)
+     * @return The number of events (0 on timeout or once the manager is stopped)
+     */
+    auto read(ucgd_input_event_t *events, size_t max, int timeout) -> size_t;
+
+    //Close every device and stop the thread
+    auto stop() -> void;
+
+    [[nodiscard]] auto getDropped() const noexcept -> uint64_t {
+        return m_Ring.getDropped();
+    }
+
+private:
+    struct source_t;
+
+    auto add(std::unique_ptr<source_t> source) -> uint32_t;
+
+    auto run() noexcept -> void;
+
+    auto dispatch(source_t &source, int index, uint64_t now) noexcept -> void;
+
+    auto emit(const source_t &source, uint64_t timestamp, int type, int code, int value) noexcept -> void;
+
+    auto expire(uint64_t now) noexcept -> int;
+
+    UcgdInputRing m_Ring;
+    std::mutex m_Lock;
+    std::mutex m_ReadLock;
+    std::map<uint32_t, std::unique_ptr<source_t>> m_Sources;
+    std::thread m_Thread;
+    std::atomic<bool> m_Stopped{false};
+    uint32_t m_NextHandle = 1;
+    int m_EpollFd = -1;
+    int m_StopFd = -1;
+    int m_ReadyFd = -1;
+    bool m_Emitted = false;
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDINPUT_H
@@ -0,0 +1,205 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+
+#include "UcgdSettings.h"
+
+#include <cstring>
+#include <utility>
+
+namespace {
+    enum ucgd_option_kind_t : uint8_t {
+        KIND_INT,
+        KIND_BOOL,
+        KIND_STRING
+    };
+
+    struct ucgd_option_info_t {
+        const char *name;
+        ucgd_option_kind_t kind;
+        int ucgd_settings_t::*intField;
+        bool ucgd_settings_t::*boolField;
+        std::string ucgd_settings_t::*stringField;
+    };
+
+    constexpr ucgd_option_info_t intOption(const char *name, int ucgd_settings_t::*field) {
+        return {name, KIND_INT, field, nullptr, nullptr};
+    }
+
+    constexpr ucgd_option_info_t boolOption(const char *name, bool ucgd_settings_t::*field) {
+        return {name, KIND_BOOL, nullptr, field, nullptr};
+    }
+
+    constexpr ucgd_option_info_t stringOption(const char *name, std::string ucgd_settings_t::*field) {
+        return {name, KIND_STRING, nullptr, nullptr, field};
+    }
+
+    //Indexed by ucgd_option_id_t
+    const ucgd_option_info_t options[OPTION_COUNT] = {
+            intOption(OPT_ROTATION, &ucgd_settings_t::rotation),
+            intOption(OPT_BUS_SPEED, &ucgd_settings_t::bus_speed),
+            stringOption(OPT_PROVIDER, &ucgd_settings_t::default_provider),
+            intOption(OPT_GPIO_CHIP, &ucgd_settings_t::gpio_chip),
+            stringOption(OPT_PROVIDER_GPIO, &ucgd_settings_t::provider_gpio),
+            stringOption(OPT_PROVIDER_SPI, &ucgd_settings_t::provider_spi),
+            stringOption(OPT_PROVIDER_I2C, &ucgd_settings_t::provider_i2c),
+            intOption(OPT_SPI_CHANNEL, &ucgd_settings_t::spi_channel),
+            intOption(OPT_SPI_BUS, &ucgd_settings_t::spi_bus_number),
+            intOption(OPT_SPI_FLAGS, &ucgd_settings_t::spi_flags),
+            intOption(OPT_SPI_MODE, &ucgd_settings_t::spi_mode),
+            intOption(OPT_SPI_BIT_ORDER, &ucgd_settings_t::spi_bit_order),
+            intOption(OPT_SPI_BITS_PER_WORD, &ucgd_settings_t::spi_bits_per_word),
+            intOption(OPT_I2C_BUS, &ucgd_settings_t::i2c_bus_number),
+            intOption(OPT_I2C_FLAGS, &ucgd_settings_t::i2c_flags),
+            intOption(OPT_I2C_ADDRESS, &ucgd_settings_t::i2c_address),
+            intOption(OPT_PIGPIO_TYPE, &ucgd_settings_t::pigpio_mode),
+            stringOption(OPT_PIGPIO_ADDR, &ucgd_settings_t::pigpio_addr),
+            intOption(OPT_PIGPIO_PORT, &ucgd_settings_t::pigpio_port),
+            intOption(OPT_SIM_LATENCY, &ucgd_settings_t::sim_latency),
+            intOption(OPT_SIM_JITTER, &ucgd_settings_t::sim_jitter),
+            intOption(OPT_SIM_GPIO_LATENCY, &ucgd_settings_t::sim_gpio_latency),
+            stringOption(OPT_SIM_CAPTURE, &ucgd_settings_t::sim_capture),
+            boolOption(OPT_EXTRA_DEBUG_INFO, &ucgd_settings_t::extra_debug_info),
+            intOption(OPT_GLYPH_CACHE_SIZE, &ucgd_settings_t::glyph_cache_size),
+            intOption(OPT_SPRITE_BUDGET, &ucgd_settings_t::sprite_budget),
+            boolOption(OPT_ROTATE_AT_SEND, &ucgd_settings_t::rotate_at_send),
+            boolOption(OPT_PARTIAL_UPDATE, &ucgd_settings_t::partial_update),
+            stringOption(OPT_FONT_PACK, &ucgd_settings_t::font_pack),
+            intOption(OPT_TRANSPORT_RETRIES, &ucgd_settings_t::transport_retries),
+            intOption(OPT_TRANSPORT_BACKOFF, &ucgd_settings_t::transport_backoff),
+            stringOption(OPT_SHM_NAME, &ucgd_settings_t::shm_name),
+            intOption(OPT_SHM_SLOTS, &ucgd_settings_t::shm_slots),
+            intOption(OPT_SHM_FORMAT, &ucgd_settings_t::shm_format),
+    };
+
+    static_assert(OPTION_COUNT <= 64, "ucgd_settings_t::provided holds one bit per option");
+
+    auto findOption(const char *key, size_t length) -> int {
+        for (int i = 0; i < OPTION_COUNT; i++) {
+            if (std::strlen(options[i].name) == length && std::memcmp(options[i].name, key, length) == 0)
+                return i;
+        }
+        return -1;
+    }
+
+    class Reader {
+    public:
+        Reader(const uint8_t *data, size_t length) : m_Data(data), m_Length(length) {}
+
+        auto take(size_t count) -> const uint8_t * {
+            if (m_Length - m_Position < count)
+                throw std::runtime_error("UcgdSettings : Encoded options are truncated");
+            const uint8_t *p = m_Data + m_Position;
+            m_Position += count;
+            return p;
+        }
+
+        auto u8() -> uint8_t {
+            return *take(1);
+        }
+
+        auto u16() -> uint16_t {
+            const uint8_t *p = take(2);
+            return static_cast<uint16_t>(p[0] | (p[1] << 8));
+        }
+
+        auto i32() -> int32_t {
+            const uint8_t *p = take(4);
+            return static_cast<int32_t>(static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24));
+        }
+
+        [[nodiscard]] auto remaining() const -> size_t {
+            return m_Length - m_Position;
+        }
+
+    private:
+        const uint8_t *m_Data;
+        size_t m_Length;
+        size_t m_Position = 0;
+    };
+}
+
+auto ucgd_settings_t::require(ucgd_option_id_t id) const -> void {
+    if (!has(id))
+        throw OptionNotFoundException(std::string("Key '") + UcgdSettings_GetName(id) + std::string("' not found in options"));
+}
+
+auto UcgdSettings_GetName(ucgd_option_id_t id) -> const char * {
+    return id < OPTION_COUNT ? options[id].name : "";
+}
+
+auto UcgdSettings_Decode(const uint8_t *data, size_t length) -> ucgd_settings_t {
+    ucgd_settings_t settings;
+    if (data == nullptr || length == 0)
+        return settings;
+    Reader reader(data, length);
+    uint16_t count = reader.u16();
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t type = reader.u8();
+        uint8_t keyLength = reader.u8();
+        auto key = reinterpret_cast<const char *>(reader.take(keyLength));
+        int32_t intValue = 0;
+        std::string stringValue;
+        switch (type) {
+            case OPTION_TYPE_NULL:
+                break;
+            case OPTION_TYPE_INT:
+                intValue = reader.i32();
+                break;
+            case OPTION_TYPE_BOOL:
+                intValue = reader.u8() != 0 ? 1 : 0;
+                break;
+            case OPTION_TYPE_STRING: {
+                uint16_t stringLength = reader.u16();
+                stringValue.assign(reinterpret_cast<const char *>(reader.take(stringLength)), stringLength);
+                break;
+            }
+            default:
+                throw std::runtime_error("UcgdSettings : Unknown value type " + std::to_string(type) + " for key '" + std::string(key, keyLength) + "'");
+        }
+
+        //options only read by the java side (e.g. buffer_size) are not stored, a null value leaves the default
+        int id = findOption(key, keyLength);
+        if (id < 0 || type == OPTION_TYPE_NULL)
+            continue;
+        const ucgd_option_info_t &option = options[id];
+        //integers and booleans are interchangeable (e.g. rotate_at_send = 1 or true)
+        if ((option.kind == KIND_STRING) != (type == OPTION_TYPE_STRING)) {
+            throw std::runtime_error(std::string("UcgdSettings : Option '") + option.name + "' expects " +
+                                     (option.kind == KIND_STRING ? "a string" : option.kind == KIND_BOOL ? "a boolean" : "an integer"));
+        }
+        switch (option.kind) {
+            case KIND_INT:
+                settings.*option.intField = intValue;
+                break;
+            case KIND_BOOL:
+                settings.*option.boolField = intValue != 0;
+                break;
+            case KIND_STRING:
+                settings.*option.stringField = std::move(stringValue);
+                break;
+        }
+        settings.provided |= uint64_t(1) << id;
+    }
+    if (reader.remaining() != 0)
+        throw std::runtime_error("UcgdSettings : " + std::to_string(reader.remaining()) + " trailing byte(s) after the encoded options");
+    return settings;
+}
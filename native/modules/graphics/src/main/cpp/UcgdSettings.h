@@ -0,0 +1,213 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDSETTINGS_H
+#define UCGD_MOD_GRAPHICS_UCGDSETTINGS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+//Options
+#define OPT_ROTATION "rotation"
+#define OPT_BUS_SPEED "bus_speed"
+#define OPT_PROVIDER "default_provider"
+#define OPT_GPIO_CHIP "gpio_chip"
+
+#define OPT_PROVIDER_GPIO "provider_gpio"
+#define OPT_PROVIDER_SPI "provider_spi"
+#define OPT_PROVIDER_I2C "provider_i2c"
+
+#define OPT_SPI_CHANNEL "spi_channel"
+#define OPT_SPI_BUS "spi_bus_number"
+#define OPT_SPI_FLAGS "spi_flags"
+#define OPT_SPI_MODE "spi_mode"
+#define OPT_SPI_BIT_ORDER "spi_bit_order"
+#define OPT_SPI_BITS_PER_WORD "spi_bits_per_word"
+
+#define OPT_I2C_BUS "i2c_bus_number"
+#define OPT_I2C_FLAGS "i2c_flags"
+#define OPT_I2C_ADDRESS "i2c_address"
+
+//Pigpio specific options
+#define OPT_PIGPIO_TYPE "pigpio_mode"
+#define OPT_PIGPIO_ADDR "pigpio_addr"
+#define OPT_PIGPIO_PORT "pigpio_port"
+
+//Simulated provider options
+#define OPT_SIM_LATENCY "sim_latency"
+#define OPT_SIM_JITTER "sim_jitter"
+#define OPT_SIM_GPIO_LATENCY "sim_gpio_latency"
+#define OPT_SIM_CAPTURE "sim_capture"
+
+//Misc options
+#define OPT_EXTRA_DEBUG_INFO "extra_debug_info"
+#define OPT_GLYPH_CACHE_SIZE "glyph_cache_size"
+#define OPT_SPRITE_BUDGET "sprite_budget"
+#define OPT_ROTATE_AT_SEND "rotate_at_send"
+#define OPT_PARTIAL_UPDATE "partial_update"
+#define OPT_FONT_PACK "font_pack"
+#define OPT_TRANSPORT_RETRIES "transport_retries"
+#define OPT_TRANSPORT_BACKOFF "transport_backoff"
+
+//Shared memory frame publishing
+#define OPT_SHM_NAME "shm_name"
+#define OPT_SHM_SLOTS "shm_slots"
+#define OPT_SHM_FORMAT "shm_format"
+
+/*
+ * Encoded options passed to setup (built by NativeUtils.encodeOptions). Multi-byte values are little endian, strings
+ * are UTF-8 without a terminator:
+ *
+ *   u16 count
+ *   count entries of: u8 type (OPTION_TYPE_*), u8 key length, key, value
+ *
+ * Values: OPTION_TYPE_NULL has none, OPTION_TYPE_INT is an i32, OPTION_TYPE_BOOL is an u8 and OPTION_TYPE_STRING is an
+ * u16 length followed by the characters.
+ */
+#define OPTION_TYPE_NULL 0
+#define OPTION_TYPE_INT 1
+#define OPTION_TYPE_BOOL 2
+#define OPTION_TYPE_STRING 3
+
+class OptionNotFoundException : public std::runtime_error {
+public:
+    explicit OptionNotFoundException(const std::string &arg) : runtime_error(arg) {}
+
+    explicit OptionNotFoundException(const char *string) : runtime_error(string) {}
+
+    explicit OptionNotFoundException(const runtime_error &error) : runtime_error(error) {}
+};
+
+enum ucgd_option_id_t : uint8_t {
+    OPTION_ROTATION,
+    OPTION_BUS_SPEED,
+    OPTION_PROVIDER,
+    OPTION_GPIO_CHIP,
+    OPTION_PROVIDER_GPIO,
+    OPTION_PROVIDER_SPI,
+    OPTION_PROVIDER_I2C,
+    OPTION_SPI_CHANNEL,
+    OPTION_SPI_BUS,
+    OPTION_SPI_FLAGS,
+    OPTION_SPI_MODE,
+    OPTION_SPI_BIT_ORDER,
+    OPTION_SPI_BITS_PER_WORD,
+    OPTION_I2C_BUS,
+    OPTION_I2C_FLAGS,
+    OPTION_I2C_ADDRESS,
+    OPTION_PIGPIO_TYPE,
+    OPTION_PIGPIO_ADDR,
+    OPTION_PIGPIO_PORT,
+    OPTION_SIM_LATENCY,
+    OPTION_SIM_JITTER,
+    OPTION_SIM_GPIO_LATENCY,
+    OPTION_SIM_CAPTURE,
+    OPTION_EXTRA_DEBUG_INFO,
+    OPTION_GLYPH_CACHE_SIZE,
+    OPTION_SPRITE_BUDGET,
+    OPTION_ROTATE_AT_SEND,
+    OPTION_PARTIAL_UPDATE,
+    OPTION_FONT_PACK,
+    OPTION_TRANSPORT_RETRIES,
+    OPTION_TRANSPORT_BACKOFF,
+    OPTION_SHM_NAME,
+    OPTION_SHM_SLOTS,
+    OPTION_SHM_FORMAT,
+    OPTION_COUNT
+};
+
+/**
+ * Options of a device, decoded and type checked once at setup. Options that were not provided hold the default value
+ * of the field, use has() where the default depends on the reader.
+ */
+struct ucgd_settings_t {
+    int rotation = 0;
+    int bus_speed = 0;
+    std::string default_provider;
+    int gpio_chip = 0;
+    std::string provider_gpio;
+    std::string provider_spi;
+    std::string provider_i2c;
+
+    int spi_channel = 0;
+    int spi_bus_number = 0;
+    int spi_flags = 0;
+    int spi_mode = 0;
+    int spi_bit_order = 0;
+    int spi_bits_per_word = 8;
+
+    int i2c_bus_number = 1;
+    int i2c_flags = 0;
+    int i2c_address = 0;
+
+    int pigpio_mode = 0;
+    std::string pigpio_addr;
+    int pigpio_port = 0;
+
+    int sim_latency = 0;
+    int sim_jitter = 0;
+    int sim_gpio_latency = 0;
+    std::string sim_capture;
+
+    bool extra_debug_info = false;
+    int glyph_cache_size = 0;
+    int sprite_budget = 0;
+    bool rotate_at_send = false;
+    bool partial_update = false;
+    std::string font_pack;
+    int transport_retries = 0;
+    int transport_backoff = 0;
+
+    std::string shm_name;
+    int shm_slots = 0;
+    int shm_format = 0;
+
+    //bit n is set if option n was provided
+    uint64_t provided = 0;
+
+    [[nodiscard]] auto has(ucgd_option_id_t id) const -> bool {
+        return (provided >> id) & 1u;
+    }
+
+    /**
+     * Throws OptionNotFoundException if a mandatory option was not provided
+     */
+    auto require(ucgd_option_id_t id) const -> void;
+};
+
+/**
+ * Decode the options encoded by NativeUtils.encodeOptions. Unknown keys and null values are skipped, a value of the
+ * wrong type or a malformed buffer throws std::runtime_error.
+ *
+ * @param data The encoded options
+ * @param length The length of the encoded options in bytes
+ * @return The decoded settings
+ */
+auto UcgdSettings_Decode(const uint8_t *data, size_t length) -> ucgd_settings_t;
+
+/**
+ * @return The key of the option (e.g. "spi_bus_number")
+ */
+auto UcgdSettings_GetName(ucgd_option_id_t id) -> const char *;
+
+#endif //UCGD_MOD_GRAPHICS_UCGDSETTINGS_H
@@ -0,0 +1,66 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDSETUPPLUGIN_H
+#define UCGD_MOD_GRAPHICS_UCGDSETUPPLUGIN_H
+
+#include <cstdint>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+/*
+ * Controller plugins (UCGD_SETUP_PLUGINS). The code generator groups the u8g2 setup procedures by controller into
+ * U8g2SetupPlugins.cpp, each plugin (libucgd-setup-<controller>.so) is that file built with the group of one controller
+ * and links only the u8g2 drivers it references. The library keeps an index of setup procedure names to controllers
+ * (U8g2LookupSetupIndex.cpp) and opens the plugin the first time one of its setup procedures is requested.
+ */
+
+#define SETUP_PLUGIN_ABI 1
+
+//File name of a plugin is SETUP_PLUGIN_PREFIX + controller + SETUP_PLUGIN_SUFFIX, looked up in the directory of the library
+#define SETUP_PLUGIN_PREFIX "libucgd-setup-"
+#define SETUP_PLUGIN_SUFFIX ".so"
+//Environment variable overriding the directory of the plugins
+#define SETUP_PLUGIN_DIR_ENV "UCGD_SETUP_PLUGIN_DIR"
+//Symbol exported by the plugins (ucgd_setup_plugin_func_t)
+#define SETUP_PLUGIN_SYMBOL "ucgd_setup_plugin"
+
+#define UCGD_SETUP_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+
+typedef void (*ucgd_setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+struct ucgd_setup_entry_t {
+    const char *name;
+    ucgd_setup_proc_t proc;
+};
+
+struct ucgd_setup_plugin_t {
+    uint32_t abi;
+    const char *controller;
+    //terminated by an entry without a name
+    const ucgd_setup_entry_t *entries;
+};
+
+typedef const ucgd_setup_plugin_t *(*ucgd_setup_plugin_func_t)();
+
+#endif //UCGD_MOD_GRAPHICS_UCGDSETUPPLUGIN_H
@@ -0,0 +1,180 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "UcgdTrace.h"
+
+#ifdef UCGD_TRACE
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+std::atomic<bool> UcgdTrace::s_Enabled{false};
+
+namespace {
+    /**
+     * Single producer ring. The owning thread is the only writer, readers copy the events and discard the ones that
+     * may have been overwritten while copying.
+     */
+    struct trace_buffer_t {
+        int tid = 0;
+        std::string thread_name;
+        std::vector<ucgd_trace_event_t> events = std::vector<ucgd_trace_event_t>(TRACE_BUFFER_EVENTS);
+        std::atomic<uint64_t> head{0};
+
+        void add(const ucgd_trace_event_t &event) {
+            uint64_t h = head.load(std::memory_order_relaxed);
+            events[h % TRACE_BUFFER_EVENTS] = event;
+            head.store(h + 1, std::memory_order_release);
+        }
+
+        void copy(std::vector<ucgd_trace_event_t> &out) const {
+            uint64_t end = head.load(std::memory_order_acquire);
+            uint64_t begin = end > TRACE_BUFFER_EVENTS ? end - TRACE_BUFFER_EVENTS : 0;
+            std::vector<ucgd_trace_event_t> snapshot;
+            snapshot.reserve(end - begin);
+            for (uint64_t i = begin; i < end; i++)
+                snapshot.push_back(events[i % TRACE_BUFFER_EVENTS]);
+            //events below the new lower bound were being overwritten while copying
+            uint64_t after = head.load(std::memory_order_acquire);
+            uint64_t valid = after > TRACE_BUFFER_EVENTS ? after - TRACE_BUFFER_EVENTS : 0;
+            for (uint64_t i = begin; i < end; i++) {
+                if (i >= valid)
+                    out.push_back(snapshot[i - begin]);
+            }
+        }
+    };
+
+    std::mutex g_TraceLock; //NOLINT
+    std::vector<std::shared_ptr<trace_buffer_t>> g_TraceBuffers; //NOLINT
+    std::atomic<uint64_t> g_TraceStart{0};
+    thread_local std::shared_ptr<trace_buffer_t> t_TraceBuffer; //NOLINT
+
+    auto threadBuffer() -> trace_buffer_t & {
+        if (!t_TraceBuffer) {
+            auto buffer = std::make_shared<trace_buffer_t>();
+#if defined(__linux__)
+            char name[16] = {};
+            if (pthread_getname_np(pthread_self(), name, sizeof(name)) == 0)
+                buffer->thread_name = name;
+#endif
+            std::lock_guard<std::mutex> lock(g_TraceLock);
+            buffer->tid = static_cast<int>(g_TraceBuffers.size()) + 1;
+            if (buffer->thread_name.empty())
+                buffer->thread_name = "thread-" + std::to_string(buffer->tid);
+            g_TraceBuffers.push_back(buffer);
+            t_TraceBuffer = buffer;
+        }
+        return *t_TraceBuffer;
+    }
+
+    auto writeString(std::ostream &out, const char *value) -> void {
+        out << '"';
+        for (const char *c = value; *c != '\0'; c++) {
+            if (*c == '"' || *c == '\\')
+                out << '\\';
+            if (static_cast<unsigned char>(*c) >= 0x20)
+                out << *c;
+        }
+        out << '"';
+    }
+
+    //nanoseconds to the microseconds (with fraction) used by the trace-event format
+    auto writeMicros(std::ostream &out, uint64_t ns) -> void {
+        out << ns / 1000 << '.' << (ns % 1000) / 100 << (ns % 100) / 10 << ns % 10;
+    }
+}
+
+auto UcgdTrace::setEnabled(bool enabled) -> void {
+    s_Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+auto UcgdTrace::now() -> uint64_t {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+auto UcgdTrace::add(const ucgd_trace_event_t &event) -> void {
+    threadBuffer().add(event);
+}
+
+auto UcgdTrace::clear() -> void {
+    g_TraceStart.store(now(), std::memory_order_relaxed);
+}
+
+auto UcgdTrace::exportJson(std::ostream &out) -> size_t {
+    std::vector<std::shared_ptr<trace_buffer_t>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(g_TraceLock);
+        buffers = g_TraceBuffers;
+    }
+    uint64_t start = g_TraceStart.load(std::memory_order_relaxed);
+    //timestamps are written relative to the oldest exported event
+    std::vector<std::vector<ucgd_trace_event_t>> events(buffers.size());
+    uint64_t origin = UINT64_MAX;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        buffers[i]->copy(events[i]);
+        for (const auto &event : events[i]) {
+            if (event.start >= start && event.start < origin)
+                origin = event.start;
+        }
+    }
+
+    size_t count = 0;
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        if (events[i].empty())
+            continue;
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffers[i]->tid << ",\"args\":{\"name\":";
+        writeString(out, buffers[i]->thread_name.c_str());
+        out << "}}";
+        first = false;
+        for (const auto &event : events[i]) {
+            if (event.start < start)
+                continue;
+            out << ",\n{\"name\":";
+            writeString(out, event.name);
+            out << ",\"cat\":";
+            writeString(out, event.category);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffers[i]->tid << ",\"ts\":";
+            writeMicros(out, event.start - origin);
+            out << ",\"dur\":";
+            writeMicros(out, event.duration);
+            if (event.arg_name != nullptr) {
+                out << ",\"args\":{";
+                writeString(out, event.arg_name);
+                out << ':' << event.arg << '}';
+            }
+            out << '}';
+            count++;
+        }
+    }
+    out << "\n]}\n";
+    return count;
+}
+
+#endif
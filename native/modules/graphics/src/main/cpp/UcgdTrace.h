@@ -0,0 +1,121 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_TRACE_H
+#define UCGD_MOD_GRAPHICS_TRACE_H
+
+#include <UcgdConfig.h>
+
+/*
+ * Trace markers for the frame pipeline. Only compiled in when the library is configured with -DUCGD_TRACE=ON, the
+ * macros below expand to nothing otherwise.
+ *
+ *   UCGD_TRACE_SCOPE(category, name)                    Records the time spent until the end of the enclosing scope
+ *   UCGD_TRACE_SCOPE_ARG(category, name, argName, arg)  Same as above, with one integer argument (e.g. the display id)
+ *
+ * The category and names must be string literals (or otherwise outlive the trace). Events are only recorded while
+ * tracing is enabled (UcgdTrace::setEnabled).
+ */
+#ifdef UCGD_TRACE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#define UCGD_TRACE_CONCAT_(a, b) a##b
+#define UCGD_TRACE_CONCAT(a, b) UCGD_TRACE_CONCAT_(a, b)
+#define UCGD_TRACE_SCOPE(category, name) UcgdTraceScope UCGD_TRACE_CONCAT(_ucgd_trace_, __LINE__)(category, name)
+#define UCGD_TRACE_SCOPE_ARG(category, name, argName, arg) UcgdTraceScope UCGD_TRACE_CONCAT(_ucgd_trace_, __LINE__)(category, name, argName, static_cast<int64_t>(arg))
+
+//Number of events retained per thread (oldest events are overwritten)
+#define TRACE_BUFFER_EVENTS 8192
+
+struct ucgd_trace_event_t {
+    const char *category;
+    const char *name;
+    const char *arg_name;
+    int64_t arg;
+    //nanoseconds (steady clock)
+    uint64_t start;
+    uint64_t duration;
+};
+
+/**
+ * Collects the events recorded by all threads. Each thread writes into its own ring buffer without locking, the rings
+ * are kept after the thread exits so its events can still be exported.
+ */
+class UcgdTrace {
+public:
+    static auto isEnabled() -> bool {
+        return s_Enabled.load(std::memory_order_relaxed);
+    }
+
+    static auto setEnabled(bool enabled) -> void;
+
+    static auto now() -> uint64_t;
+
+    static auto add(const ucgd_trace_event_t &event) -> void;
+
+    //Drop the events recorded so far
+    static auto clear() -> void;
+
+    /**
+     * Write the events recorded by all threads as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev)
+     *
+     * @return The number of events written
+     */
+    static auto exportJson(std::ostream &out) -> size_t;
+
+private:
+    static std::atomic<bool> s_Enabled;
+};
+
+class UcgdTraceScope {
+public:
+    UcgdTraceScope(const char *category, const char *name, const char *argName = nullptr, int64_t arg = 0) {
+        if (UcgdTrace::isEnabled())
+            m_Event = {category, name, argName, arg, UcgdTrace::now(), 0};
+    }
+
+    UcgdTraceScope(const UcgdTraceScope &) = delete;
+
+    UcgdTraceScope &operator=(const UcgdTraceScope &) = delete;
+
+    ~UcgdTraceScope() {
+        if (m_Event.name != nullptr) {
+            m_Event.duration = UcgdTrace::now() - m_Event.start;
+            UcgdTrace::add(m_Event);
+        }
+    }
+
+private:
+    ucgd_trace_event_t m_Event{};
+};
+
+#else
+
+#define UCGD_TRACE_SCOPE(category, name) ((void) 0)
+#define UCGD_TRACE_SCOPE_ARG(category, name, argName, arg) ((void) 0)
+
+#endif
+
+#endif //UCGD_MOD_GRAPHICS_TRACE_H
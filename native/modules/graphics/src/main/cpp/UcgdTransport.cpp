@@ -0,0 +1,62 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include "UcgdTransport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <thread>
+
+auto UcgdTransport::fail(int code, const char *format, ...) noexcept -> int {
+    if (failed())
+        return code;
+    m_Code = code == TRANSPORT_OK ? TRANSPORT_ERR_WRITE : code;
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(m_Message, sizeof(m_Message), format, args);
+    va_end(args);
+    return code;
+}
+
+auto UcgdTransport::interrupt(int signal) noexcept -> void {
+    if (failed())
+        return;
+    m_Signal = signal;
+    fail(TRANSPORT_ERR_INTERRUPTED, "Caught signal interrupt");
+}
+
+auto UcgdTransport::clear() noexcept -> void {
+    m_Code = TRANSPORT_OK;
+    m_Signal = 0;
+    m_Message[0] = '\0';
+}
+
+auto UcgdTransport::setRetryPolicy(int retries, int backoff) noexcept -> void {
+    m_Retries = std::max(0, retries);
+    m_Backoff = std::clamp(backoff, 0, TRANSPORT_MAX_BACKOFF);
+}
+
+auto UcgdTransport::wait(int usec) noexcept -> void {
+    if (usec > 0)
+        std::this_thread::sleep_for(std::chrono::microseconds(usec));
+}
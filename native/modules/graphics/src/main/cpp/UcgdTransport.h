@@ -0,0 +1,124 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDTRANSPORT_H
+#define UCGD_MOD_GRAPHICS_UCGDTRANSPORT_H
+
+#include <cstdint>
+
+//Transport status codes, the peripherals return these (negative on failure) instead of throwing
+#define TRANSPORT_OK 0
+#define TRANSPORT_ERR_WRITE (-1)
+#define TRANSPORT_ERR_NOT_OPEN (-2)
+#define TRANSPORT_ERR_INIT (-3)
+#define TRANSPORT_ERR_PROVIDER (-4)
+#define TRANSPORT_ERR_INTERRUPTED (-5)
+
+#define TRANSPORT_MESSAGE_SIZE 192
+#define TRANSPORT_DEFAULT_BACKOFF 100
+#define TRANSPORT_MAX_BACKOFF 100000
+
+/**
+ * Transport error state of a device. The u8x8 byte and gpio callbacks run inside u8g2's C frames and must not throw:
+ * a failed transfer is recorded here instead and every following transfer of the frame is skipped. The first error is
+ * kept (sticky) until it is taken by the JNI call that started the transfer and raised to java.
+ */
+class UcgdTransport {
+public:
+    /**
+     * Record an error. Only the first error is kept until clear() is called.
+     *
+     * @param code One of the TRANSPORT_ERR_* codes
+     * @param format printf style message
+     * @return The code
+     */
+    auto fail(int code, const char *format, ...) noexcept -> int __attribute__((format(printf, 3, 4)));
+
+    //Record a caught signal, the current frame is aborted
+    auto interrupt(int signal) noexcept -> void;
+
+    [[nodiscard]] auto failed() const noexcept -> bool {
+        return m_Code != TRANSPORT_OK;
+    }
+
+    [[nodiscard]] auto getCode() const noexcept -> int {
+        return m_Code;
+    }
+
+    [[nodiscard]] auto getSignal() const noexcept -> int {
+        return m_Signal;
+    }
+
+    [[nodiscard]] auto getMessage() const noexcept -> const char * {
+        return m_Message;
+    }
+
+    auto clear() noexcept -> void;
+
+    /**
+     * @param retries Number of times a failed write is repeated before the frame is aborted
+     * @param backoff Wait before the first retry in microseconds, doubled for each following retry
+     */
+    auto setRetryPolicy(int retries, int backoff) noexcept -> void;
+
+    //Total number of retried writes
+    [[nodiscard]] auto getRetryCount() const noexcept -> uint64_t {
+        return m_RetryCount;
+    }
+
+    /**
+     * Run a write with the retry policy. Nothing is written once an error is recorded (the rest of the frame is
+     * skipped). A write returns a negative TRANSPORT_ERR_* code on failure, only TRANSPORT_ERR_WRITE is retried.
+     *
+     * @return true if the write succeeded
+     */
+    template<typename F>
+    auto run(F &&write) noexcept -> bool {
+        if (failed())
+            return false;
+        int backoff = m_Backoff;
+        for (int attempt = 0;; attempt++) {
+            int result = write();
+            if (result >= 0 && !failed())
+                return true;
+            if (!failed())
+                fail(result, "Transfer failed (code %d)", result);
+            if (attempt >= m_Retries || m_Code != TRANSPORT_ERR_WRITE)
+                return false;
+            m_Code = TRANSPORT_OK;
+            m_RetryCount++;
+            wait(backoff);
+            backoff = backoff >= TRANSPORT_MAX_BACKOFF / 2 ? TRANSPORT_MAX_BACKOFF : backoff * 2;
+        }
+    }
+
+private:
+    static auto wait(int usec) noexcept -> void;
+
+    int m_Code = TRANSPORT_OK;
+    int m_Signal = 0;
+    int m_Retries = 0;
+    int m_Backoff = TRANSPORT_DEFAULT_BACKOFF;
+    uint64_t m_RetryCount = 0;
+    char m_Message[TRANSPORT_MESSAGE_SIZE]{};
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDTRANSPORT_H
@@ -30,31 +30,37 @@
 #include <Global.h>
 #include <sstream>
 
-#if defined(__APPLE__) && !defined(__AVAILABILITY__)
-#include <Availability.h>
-#endif
-
-//The <any> header for Mac OSX i386 is only available from the experimental namespace
-#if defined(__APPLE__) && defined(__MAC_10_13) && !defined(__MAC_10_15)
-#include <experimental/any>
-typedef std::map<std::string, std::experimental::any> option_map_t;
-#else
-
-#include <any>
-
-typedef std::map<std::string, std::any> option_map_t;
-#endif
-
 extern "C" {
 #include <u8g2.h>
 }
 
+#include <U8g2GlyphCache.h>
+#include <U8g2TextRuns.h>
+#include <U8g2Dither.h>
+#include <U8g2Sprites.h>
+#include <U8g2Recorder.h>
+#include <U8g2DisplayList.h>
+#include <U8g2Emulator.h>
+#include <U8g2Rotator.h>
+#include <U8g2Layers.h>
+#include <U8g2Canvas.h>
+#include <UcgdFramePublisher.h>
+#include <UcgdFrameScheduler.h>
+#include <U8g2Stats.h>
+#include <UcgdTransport.h>
+#include <UcgdSettings.h>
+
 //Global macros
 #define PROVIDER_LIBGPIOD "libgpiod"
 #define PROVIDER_CPERIPHERY "cperiphery"
 #define PROVIDER_PIGPIO "pigpio" //pigpio - standalone
 #define PROVIDER_PIGPIOD "pigpiod" //pigpio - daemon
+#define PROVIDER_SIM "sim" //simulated transport, available on all platforms
+#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
 #define PROVIDER_DEFAULT PROVIDER_CPERIPHERY
+#else
+#define PROVIDER_DEFAULT PROVIDER_SIM
+#endif
 /**
  * C linked against pigpio. Fastest code, slowest development.
  * Only one program linked against the pigpio library can be running at a time (the program in effect becomes the pigpio daemon).
@@ -73,35 +79,6 @@ extern "C" {
  */
 #define PIGPIO_TYPE_DAEMON 1
 
-//Options
-#define OPT_ROTATION "rotation"
-#define OPT_BUS_SPEED "bus_speed"
-#define OPT_PROVIDER "default_provider"
-#define OPT_GPIO_CHIP "gpio_chip"
-
-#define OPT_PROVIDER_GPIO "provider_gpio"
-#define OPT_PROVIDER_SPI "provider_spi"
-#define OPT_PROVIDER_I2C "provider_i2c"
-
-#define OPT_SPI_CHANNEL "spi_channel"
-#define OPT_SPI_BUS "spi_bus_number"
-#define OPT_SPI_FLAGS "spi_flags"
-#define OPT_SPI_MODE "spi_mode"
-#define OPT_SPI_BIT_ORDER "spi_bit_order"
-#define OPT_SPI_BITS_PER_WORD "spi_bits_per_word"
-
-#define OPT_I2C_BUS "i2c_bus_number"
-#define OPT_I2C_FLAGS "i2c_flags"
-#define OPT_I2C_ADDRESS "i2c_address"
-
-//Pigpio specific options
-#define OPT_PIGPIO_TYPE "pigpio_mode"
-#define OPT_PIGPIO_ADDR "pigpio_addr"
-#define OPT_PIGPIO_PORT "pigpio_port"
-
-//Misc options
-#define OPT_EXTRA_DEBUG_INFO "extra_debug_info"
-
 /*
  * -------------------------------------------------------------------------------------------------------------
  * Note: To enable SPI Auxillary channel on the Raspberry Pi, you need to enable it on the device tree overlay
@@ -173,15 +150,6 @@ extern "C" {
 //Uncomment to enable debbugging
 #define DEBUG_UCGD
 
-class OptionNotFoundException : public std::runtime_error {
-public:
-    explicit OptionNotFoundException(const std::string &arg) : runtime_error(arg) {}
-
-    explicit OptionNotFoundException(const char *string) : runtime_error(string) {}
-
-    explicit OptionNotFoundException(const runtime_error &error) : runtime_error(error) {}
-};
-
 //Forward declarations
 class UcgdProvider;
 
@@ -225,6 +193,9 @@ typedef std::function<void(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb
 
 typedef std::map<std::string, u8g2_setup_func_t> u8g2_setup_func_map_t;
 
+//setup procedure name to the controller plugin holding it (UCGD_SETUP_PLUGINS)
+typedef std::map<std::string, std::string> u8g2_setup_index_map_t;
+
 typedef std::map<std::string, const uint8_t *> u8g2_lookup_font_map_t;
 
 typedef std::function<uint8_t(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
@@ -278,6 +249,8 @@ struct ucgd_t {
     int comm_type{};
     //debug flag
     bool debug{};
+    //send only the tiles that changed (layers only)
+    bool flag_partial_update{};
     //pixel buffer
     uint8_t* buffer{};
     //u8g2 buffer size
@@ -292,6 +265,34 @@ struct ucgd_t {
     int secondary_color;
     //output buffer
     std::unique_ptr<std::stringstream> output_buffer;
+    //decoded glyph cache used by the text drawing functions
+    std::unique_ptr<U8g2GlyphCache> glyph_cache;
+    //string width cache and text run layout
+    std::unique_ptr<U8g2TextRuns> text_runs;
+    //bgra to 1bpp conversion (dither mode and scratch buffers)
+    std::unique_ptr<U8g2Dither> dither;
+    //uploaded sprites, referenced by handle
+    std::unique_ptr<U8g2Sprites> sprites;
+    //frame recorder, only present while recording
+    std::unique_ptr<U8g2Recorder> recorder;
+    //recorded draw operations, replayed for each page by renderDisplayList()
+    std::unique_ptr<U8g2DisplayList> display_list;
+    //controller emulator fed with the byte stream of a virtual device (nullptr if the controller is not emulated)
+    std::unique_ptr<U8g2Emulator> emulator;
+    //shared memory frame ring, only present if the shm_name option is set
+    std::unique_ptr<UcgdFramePublisher> publisher;
+    //unrotated canvas rotated at send time, only present if the rotate_at_send option is set
+    std::unique_ptr<U8g2Rotator> rotator;
+    //offscreen layers composited before the buffer is sent, created on first use
+    std::unique_ptr<U8g2Layers> layers;
+    //offscreen canvas (buffer and display info of the u8g2 descriptor), only present for devices created by createCanvas()
+    std::unique_ptr<U8g2Canvas> canvas;
+    //frame pacing timer, only present while scheduled (shared with the threads blocked in waitFrame, use std::atomic_load/store)
+    std::shared_ptr<UcgdFrameScheduler> scheduler;
+    //transport and render counters
+    U8g2Stats stats;
+    //sticky transport error of the current frame, raised to java at the end of the jni call
+    UcgdTransport transport;
 
     const void writeOutputBuffer(const char *output) {
 
@@ -301,6 +302,8 @@ struct ucgd_t {
         primary_color = 255;
         secondary_color = 0;
         output_buffer = std::make_unique<std::stringstream>();
+        text_runs = std::make_unique<U8g2TextRuns>();
+        dither = std::make_unique<U8g2Dither>();
     }
 
     ~ucgd_t() {
@@ -321,8 +324,9 @@ struct ucgd_t {
     std::unique_ptr<cp_spi_t> sys_spi_handle;
     //the system i2c handle (c-periphery)
     std::unique_ptr<cp_i2c_t> sys_i2c_handle;
-    //options associated with this context
-    std::map<std::string, std::any> options;
+#endif
+    //options associated with this context, decoded at setup
+    ucgd_settings_t settings;
 
     auto setDefaultProvider(std::shared_ptr<UcgdProvider> &prvdr) -> void {
         this->provider = prvdr;
@@ -335,44 +339,12 @@ struct ucgd_t {
         throw std::runtime_error("Provider no longer available");
     }
 
-    std::any &getOption(const std::string &key) {
-        auto it = this->options.find(key);
-        if (it != this->options.end()) {
-            return it->second;
-        }
-        throw OptionNotFoundException(std::string("Key '") + key + std::string("' not found in options"));
-    }
-
-    std::string getOptionString(const std::string &key, std::string defaultVal = "") {
-        try {
-            std::any value = getOption(key);
-            return std::any_cast<std::string>(value);
-        } catch (OptionNotFoundException &e) {
-            return defaultVal;
-        }
-    }
-
-    int getOptionInt(const std::string &key) {
-        std::any value = getOption(key);
-        return std::any_cast<int>(value);
-    }
-
-    int getOptionInt(const std::string &key, int defaultVal) {
-        try {
-            std::any value = getOption(key);
-            return std::any_cast<int>(value);
-        } catch (OptionNotFoundException &e) {
-            return defaultVal;
-        }
-    }
-
     [[nodiscard]] const std::weak_ptr<UcgdProvider> &getProvider() const {
         return provider;
     }
 
 private:
     std::weak_ptr<UcgdProvider> provider;
-#endif
 };
 
 #endif //UCGD_MOD_GRAPHICS_TYPES_H
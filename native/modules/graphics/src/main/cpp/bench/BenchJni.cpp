@@ -0,0 +1,315 @@
+#include "BenchJni.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <unordered_set>
+
+namespace {
+    enum object_kind_t {
+        KIND_OBJECT,
+        KIND_STRING,
+        KIND_ARRAY,
+        KIND_BUFFER
+    };
+
+    struct bench_object_t {
+        object_kind_t kind = KIND_OBJECT;
+        std::string str;
+        std::vector<uint8_t> data;
+        size_t elementSize = 1;
+        void *address = nullptr;
+        jlong capacity = 0;
+    };
+
+    //classes, method/field ids and the results of calls into Java all share one object
+    bench_object_t g_Generic; // NOLINT(cert-err58-cpp)
+    std::unordered_set<bench_object_t *> g_Objects; // NOLINT(cert-err58-cpp)
+    std::string g_Exception; // NOLINT(cert-err58-cpp)
+    JNINativeInterface_ g_Functions{};
+    JNIInvokeInterface_ g_Invoke{};
+    JNIEnv g_Env{};
+    JavaVM g_Vm{};
+
+    bench_object_t *toObject(jobject ref) {
+        return reinterpret_cast<bench_object_t *>(ref);
+    }
+
+    jobject add(bench_object_t *object) {
+        g_Objects.insert(object);
+        return reinterpret_cast<jobject>(object);
+    }
+
+    jclass JNICALL findClass(JNIEnv *, const char *) {
+        return reinterpret_cast<jclass>(&g_Generic);
+    }
+
+    jclass JNICALL getObjectClass(JNIEnv *, jobject) {
+        return reinterpret_cast<jclass>(&g_Generic);
+    }
+
+    jmethodID JNICALL getMethodId(JNIEnv *, jclass, const char *, const char *) {
+        return reinterpret_cast<jmethodID>(&g_Generic);
+    }
+
+    jfieldID JNICALL getFieldId(JNIEnv *, jclass, const char *, const char *) {
+        return reinterpret_cast<jfieldID>(&g_Generic);
+    }
+
+    jobject JNICALL getStaticObjectField(JNIEnv *, jclass, jfieldID) {
+        return reinterpret_cast<jobject>(&g_Generic);
+    }
+
+    jobject JNICALL newGlobalRef(JNIEnv *, jobject ref) {
+        return ref;
+    }
+
+    void JNICALL deleteObject(JNIEnv *, jobject ref) {
+        auto it = g_Objects.find(toObject(ref));
+        if (it != g_Objects.end()) {
+            delete *it;
+            g_Objects.erase(it);
+        }
+    }
+
+    jint JNICALL throwNew(JNIEnv *, jclass, const char *msg) {
+        g_Exception = msg != nullptr ? msg : "";
+        return 0;
+    }
+
+    jboolean JNICALL exceptionCheck(JNIEnv *) {
+        return g_Exception.empty() ? JNI_FALSE : JNI_TRUE;
+    }
+
+    jboolean JNICALL isInstanceOf(JNIEnv *, jobject, jclass) {
+        return JNI_FALSE;
+    }
+
+    jobject JNICALL callObjectMethodV(JNIEnv *, jobject, jmethodID, va_list) {
+        return reinterpret_cast<jobject>(&g_Generic);
+    }
+
+    jobject JNICALL newObjectV(JNIEnv *, jclass, jmethodID, va_list) {
+        return reinterpret_cast<jobject>(&g_Generic);
+    }
+
+    jboolean JNICALL callBooleanMethodV(JNIEnv *, jobject, jmethodID, va_list) {
+        return JNI_FALSE;
+    }
+
+    void JNICALL callVoidMethodV(JNIEnv *, jobject, jmethodID, va_list) {
+    }
+
+    jboolean JNICALL callStaticBooleanMethodV(JNIEnv *, jclass, jmethodID, va_list) {
+        return JNI_FALSE;
+    }
+
+    jint JNICALL callStaticIntMethodV(JNIEnv *, jclass, jmethodID, va_list) {
+        return 0;
+    }
+
+    void JNICALL callStaticVoidMethodV(JNIEnv *, jclass, jmethodID, va_list) {
+    }
+
+    jstring JNICALL newStringUtf(JNIEnv *, const char *) {
+        //log messages, the content is not needed
+        return reinterpret_cast<jstring>(&g_Generic);
+    }
+
+    const char *JNICALL getStringUtfChars(JNIEnv *, jstring str, jboolean *isCopy) {
+        const std::string &value = toObject(str)->str;
+        auto *copy = static_cast<char *>(malloc(value.size() + 1));
+        memcpy(copy, value.c_str(), value.size() + 1);
+        if (isCopy != nullptr)
+            *isCopy = JNI_TRUE;
+        return copy;
+    }
+
+    void JNICALL releaseStringUtfChars(JNIEnv *, jstring, const char *chars) {
+        free(const_cast<char *>(chars));
+    }
+
+    jobjectArray JNICALL newObjectArray(JNIEnv *, jsize, jclass, jobject) {
+        return reinterpret_cast<jobjectArray>(&g_Generic);
+    }
+
+    void JNICALL setObjectArrayElement(JNIEnv *, jobjectArray, jsize, jobject) {
+    }
+
+    jsize JNICALL getArrayLength(JNIEnv *, jarray array) {
+        bench_object_t *object = toObject(array);
+        return static_cast<jsize>(object->data.size() / object->elementSize);
+    }
+
+    void *getElements(jarray array, jboolean *isCopy) {
+        bench_object_t *object = toObject(array);
+        void *copy = malloc(object->data.size() + 1);
+        memcpy(copy, object->data.data(), object->data.size());
+        if (isCopy != nullptr)
+            *isCopy = JNI_TRUE;
+        return copy;
+    }
+
+    void releaseElements(jarray array, void *elements, jint mode) {
+        bench_object_t *object = toObject(array);
+        if (mode != JNI_ABORT)
+            memcpy(object->data.data(), elements, object->data.size());
+        if (mode != JNI_COMMIT)
+            free(elements);
+    }
+
+    jbyte *JNICALL getByteArrayElements(JNIEnv *, jbyteArray array, jboolean *isCopy) {
+        return static_cast<jbyte *>(getElements(array, isCopy));
+    }
+
+    void JNICALL releaseByteArrayElements(JNIEnv *, jbyteArray array, jbyte *elements, jint mode) {
+        releaseElements(array, elements, mode);
+    }
+
+    jint *JNICALL getIntArrayElements(JNIEnv *, jintArray array, jboolean *isCopy) {
+        return static_cast<jint *>(getElements(array, isCopy));
+    }
+
+    void JNICALL releaseIntArrayElements(JNIEnv *, jintArray array, jint *elements, jint mode) {
+        releaseElements(array, elements, mode);
+    }
+
+    void *JNICALL getPrimitiveArrayCritical(JNIEnv *, jarray array, jboolean *isCopy) {
+        if (isCopy != nullptr)
+            *isCopy = JNI_FALSE;
+        return toObject(array)->data.data();
+    }
+
+    void JNICALL releasePrimitiveArrayCritical(JNIEnv *, jarray, void *, jint) {
+    }
+
+    jbyteArray JNICALL allocByteArray(JNIEnv *, jsize length) {
+        auto *object = new bench_object_t();
+        object->kind = KIND_ARRAY;
+        object->data.assign(static_cast<size_t>(length), 0);
+        return reinterpret_cast<jbyteArray>(add(object));
+    }
+
+    void JNICALL setByteArrayRegion(JNIEnv *, jbyteArray array, jsize start, jsize len, const jbyte *buf) {
+        memcpy(toObject(array)->data.data() + start, buf, static_cast<size_t>(len));
+    }
+
+    void JNICALL getByteArrayRegion(JNIEnv *, jbyteArray array, jsize start, jsize len, jbyte *buf) {
+        memcpy(buf, toObject(array)->data.data() + start, static_cast<size_t>(len));
+    }
+
+    void *JNICALL getDirectBufferAddress(JNIEnv *, jobject buffer) {
+        bench_object_t *object = toObject(buffer);
+        return object->kind == KIND_BUFFER ? object->address : nullptr;
+    }
+
+    jlong JNICALL getDirectBufferCapacity(JNIEnv *, jobject buffer) {
+        bench_object_t *object = toObject(buffer);
+        return object->kind == KIND_BUFFER ? object->capacity : -1;
+    }
+
+    jint JNICALL getEnv(JavaVM *, void **penv, jint) {
+        *penv = &g_Env;
+        return JNI_OK;
+    }
+}
+
+BenchJni::BenchJni() {
+    g_Functions.FindClass = findClass;
+    g_Functions.GetObjectClass = getObjectClass;
+    g_Functions.GetMethodID = getMethodId;
+    g_Functions.GetStaticMethodID = getMethodId;
+    g_Functions.GetFieldID = getFieldId;
+    g_Functions.GetStaticFieldID = getFieldId;
+    g_Functions.GetStaticObjectField = getStaticObjectField;
+    g_Functions.NewGlobalRef = newGlobalRef;
+    g_Functions.NewLocalRef = newGlobalRef;
+    g_Functions.DeleteGlobalRef = deleteObject;
+    g_Functions.DeleteLocalRef = deleteObject;
+    g_Functions.ThrowNew = throwNew;
+    g_Functions.ExceptionCheck = exceptionCheck;
+    g_Functions.IsInstanceOf = isInstanceOf;
+    g_Functions.CallObjectMethodV = callObjectMethodV;
+    g_Functions.CallBooleanMethodV = callBooleanMethodV;
+    g_Functions.CallVoidMethodV = callVoidMethodV;
+    g_Functions.CallStaticBooleanMethodV = callStaticBooleanMethodV;
+    g_Functions.CallStaticIntMethodV = callStaticIntMethodV;
+    g_Functions.CallStaticVoidMethodV = callStaticVoidMethodV;
+    g_Functions.NewObjectV = newObjectV;
+    g_Functions.NewStringUTF = newStringUtf;
+    g_Functions.GetStringUTFChars = getStringUtfChars;
+    g_Functions.ReleaseStringUTFChars = releaseStringUtfChars;
+    g_Functions.NewObjectArray = newObjectArray;
+    g_Functions.SetObjectArrayElement = setObjectArrayElement;
+    g_Functions.GetArrayLength = getArrayLength;
+    g_Functions.GetByteArrayElements = getByteArrayElements;
+    g_Functions.ReleaseByteArrayElements = releaseByteArrayElements;
+    g_Functions.GetIntArrayElements = getIntArrayElements;
+    g_Functions.ReleaseIntArrayElements = releaseIntArrayElements;
+    g_Functions.GetPrimitiveArrayCritical = getPrimitiveArrayCritical;
+    g_Functions.ReleasePrimitiveArrayCritical = releasePrimitiveArrayCritical;
+    g_Functions.NewByteArray = allocByteArray;
+    g_Functions.SetByteArrayRegion = setByteArrayRegion;
+    g_Functions.GetByteArrayRegion = getByteArrayRegion;
+    g_Functions.GetDirectBufferAddress = getDirectBufferAddress;
+    g_Functions.GetDirectBufferCapacity = getDirectBufferCapacity;
+    g_Env.functions = &g_Functions;
+
+    g_Invoke.GetEnv = getEnv;
+    g_Vm.functions = &g_Invoke;
+}
+
+BenchJni::~BenchJni() {
+    for (auto object : g_Objects)
+        delete object;
+    g_Objects.clear();
+}
+
+auto BenchJni::env() -> JNIEnv * {
+    return &g_Env;
+}
+
+auto BenchJni::vm() -> JavaVM * {
+    return &g_Vm;
+}
+
+auto BenchJni::newString(const std::string &value) -> jstring {
+    auto *object = new bench_object_t();
+    object->kind = KIND_STRING;
+    object->str = value;
+    return reinterpret_cast<jstring>(add(object));
+}
+
+auto BenchJni::newByteArray(size_t length) -> jbyteArray {
+    return allocByteArray(&g_Env, static_cast<jsize>(length));
+}
+
+auto BenchJni::newIntArray(const std::vector<jint> &values) -> jintArray {
+    auto *object = new bench_object_t();
+    object->kind = KIND_ARRAY;
+    object->elementSize = sizeof(jint);
+    object->data.resize(values.size() * sizeof(jint));
+    memcpy(object->data.data(), values.data(), object->data.size());
+    return reinterpret_cast<jintArray>(add(object));
+}
+
+auto BenchJni::newDirectBuffer(void *address, size_t capacity) -> jobject {
+    auto *object = new bench_object_t();
+    object->kind = KIND_BUFFER;
+    object->address = address;
+    object->capacity = static_cast<jlong>(capacity);
+    return add(object);
+}
+
+auto BenchJni::newObject() -> jobject {
+    return add(new bench_object_t());
+}
+
+auto BenchJni::deleteRef(jobject ref) -> void {
+    deleteObject(&g_Env, ref);
+}
+
+auto BenchJni::takeException() -> std::string {
+    std::string message;
+    message.swap(g_Exception);
+    return message;
+}
@@ -0,0 +1,44 @@
+#ifndef UCGD_BENCH_BENCHJNI_H
+#define UCGD_BENCH_BENCHJNI_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <jni.h>
+
+/**
+ * Minimal in-process JNI environment, enough to call the native entry points of the library without a JVM.
+ *
+ * Arrays and strings are copied in and out the way HotSpot does it (Get*ArrayElements and GetStringUTFChars return a
+ * copy, GetPrimitiveArrayCritical returns the array itself) so the marshaling cost is representative. Method calls
+ * into Java are no-ops, boolean methods return false (no event listeners, empty option maps).
+ */
+class BenchJni {
+public:
+    BenchJni();
+
+    virtual ~BenchJni();
+
+    auto env() -> JNIEnv *;
+
+    auto vm() -> JavaVM *;
+
+    auto newString(const std::string &value) -> jstring;
+
+    auto newByteArray(size_t length) -> jbyteArray;
+
+    auto newIntArray(const std::vector<jint> &values) -> jintArray;
+
+    auto newDirectBuffer(void *address, size_t capacity) -> jobject;
+
+    //A plain object (options map, logger)
+    auto newObject() -> jobject;
+
+    auto deleteRef(jobject ref) -> void;
+
+    //Message of the last exception thrown through ThrowNew, empty if none. Clears the exception.
+    auto takeException() -> std::string;
+};
+
+#endif //UCGD_BENCH_BENCHJNI_H
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <U8g2Canvas.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+typedef void (*setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+struct bench_case_t {
+    const char *name;
+    setup_proc_t full;
+};
+
+//A dashboard: a frame, a header bar, a few lines of text and a bar graph
+static void drawFrame(u8g2_t *u8g2, int frame) {
+    char value[32];
+    auto w = static_cast<int>(u8g2_GetDisplayWidth(u8g2));
+    auto h = static_cast<int>(u8g2_GetDisplayHeight(u8g2));
+    u8g2_ClearBuffer(u8g2);
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    u8g2_DrawBox(u8g2, 0, 0, w, 14);
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_SetDrawColor(u8g2, 0);
+    u8g2_DrawStr(u8g2, 4, 11, "DEPARTURES");
+    u8g2_SetDrawColor(u8g2, 1);
+    for (int i = 0; i < 4; i++) {
+        std::snprintf(value, sizeof(value), "LINE %d  %02d:%02d", i + 1, (frame / 60 + i) % 24, (frame + i * 7) % 60);
+        u8g2_DrawStr(u8g2, 4, 26 + (i * 11), value);
+    }
+    for (int i = 0; i < 16; i++) {
+        int bar = ((i * 37 + frame) % (h / 3)) + 2;
+        u8g2_DrawBox(u8g2, (w / 2) + (i * ((w / 2) - 8) / 16), h - 2 - bar, 3, bar);
+    }
+}
+
+template<typename F>
+static double timeFrames(int frames, F frame) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+        frame(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+static void runCase(const bench_case_t &c, int displayCount, int frames) {
+    std::vector<u8g2_t> displays(displayCount);
+    std::vector<std::vector<uint8_t>> buffers(displayCount);
+    for (int i = 0; i < displayCount; i++) {
+        c.full(&displays[i], U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+        //Own buffer per instance, the _f setup procedures share a static one
+        buffers[i].resize(8 * u8g2_GetBufferTileWidth(&displays[i]) * displays[i].tile_buf_height);
+        u8g2_SetBufferPtr(&displays[i], buffers[i].data());
+    }
+    auto width = static_cast<int>(u8g2_GetDisplayWidth(&displays[0]));
+    auto height = static_cast<int>(u8g2_GetDisplayHeight(&displays[0]));
+
+    double drawEach = timeFrames(frames, [&](int frame) {
+        for (auto &display : displays)
+            drawFrame(&display, frame);
+    });
+
+    u8g2_t canvasU8g2;
+    U8g2Canvas canvas(&canvasU8g2, width, height);
+    double mirror = timeFrames(frames, [&](int frame) {
+        drawFrame(&canvasU8g2, frame);
+        for (auto &display : displays)
+            canvas.blit(&display, 0, 0, width, height, 0, 0);
+    });
+
+    //one canvas spanning a row of displays
+    u8g2_t wallU8g2;
+    U8g2Canvas wall(&wallU8g2, width * displayCount, height);
+    double span = timeFrames(frames, [&](int frame) {
+        drawFrame(&wallU8g2, frame);
+        for (int i = 0; i < displayCount; i++)
+            wall.blit(&displays[i], i * width, 0, width, height, 0, 0);
+    });
+
+    std::cout << c.name << " x " << displayCount << ": draw on each = " << drawEach << " us/frame"
+              << ", mirrored canvas = " << mirror << " us/frame"
+              << ", spanned canvas = " << span << " us/frame" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = (argc > 1) ? std::stoi(argv[1]) : 500;
+
+    const bench_case_t cases[] = {
+            {"ssd1306 128x64 (vertical)", u8g2_Setup_ssd1306_128x64_noname_f},
+            {"st7920 128x64 (horizontal)", u8g2_Setup_st7920_s_128x64_f},
+    };
+    for (const auto &c : cases) {
+        runCase(c, 4, frames);
+        runCase(c, 12, frames);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <U8g2Stats.h>
+#include <UcgdFramePublisher.h>
+#include <UcgdFrameShm.h>
+
+struct bench_case_t {
+    const char *name;
+    int width;
+    int height;
+    int format;
+};
+
+/**
+ * Reader process: wait for each frame, copy it out and record the publish-to-copy latency. Frames overwritten before
+ * the reader got to them are counted as skipped.
+ */
+static int runReader(const std::string &name, int frames) {
+    UcgdFrameReader reader(name);
+    const ucgd_shm_header_t &header = reader.header();
+    std::vector<uint8_t> mono(header.mono_size), bgra(header.bgra_size);
+    U8g2Histogram latency;
+    uint32_t last = 0;
+    int skipped = 0;
+    while (last < static_cast<uint32_t>(frames)) {
+        if (reader.wait(last, 2000) == 0)
+            break;
+        uint64_t timestamp = 0;
+        uint32_t frame = reader.read(mono.data(), bgra.data(), &timestamp);
+        latency.record(ucgdMonotonicNanos() - timestamp);
+        skipped += static_cast<int>(frame - last - 1);
+        last = frame;
+    }
+    std::cout << "  reader: frames = " << latency.getCount() << ", skipped = " << skipped
+              << ", latency p50 = " << latency.percentile(0.50) / 1000.0 << " us"
+              << ", p99 = " << latency.percentile(0.99) / 1000.0 << " us"
+              << ", max = " << latency.getMax() / 1000.0 << " us" << std::endl;
+    return last == static_cast<uint32_t>(frames) ? 0 : 1;
+}
+
+static void runCase(const bench_case_t &c, int frames, int intervalUs) {
+    std::string name = "/ucgd-bench-shm-" + std::to_string(getpid());
+    UcgdFramePublisher publisher(name, c.width, c.height, SHM_LAYOUT_VERTICAL, c.format, SHM_DEFAULT_SLOTS);
+    std::vector<uint8_t> mono(static_cast<size_t>(c.width) * c.height / 8, 0x5a);
+    std::vector<uint8_t> bgra(static_cast<size_t>(c.width) * c.height * 4, 0x7f);
+
+    std::cout << c.name << ":" << std::endl;
+    std::cout.flush();
+    pid_t child = fork();
+    if (child == 0) {
+        int res = 1;
+        try {
+            res = runReader(name, frames);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+        _exit(res);
+    }
+    //give the reader time to map the ring and block
+    usleep(50000);
+
+    U8g2Histogram publish;
+    for (int i = 0; i < frames; i++) {
+        mono[i % mono.size()] ^= 0xff;
+        uint64_t start = ucgdMonotonicNanos();
+        publisher.writePage(0, c.height / 8, mono.data(), bgra.data());
+        publish.record(ucgdMonotonicNanos() - start);
+        if (intervalUs > 0)
+            usleep(static_cast<useconds_t>(intervalUs));
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    std::cout << "  writer: publish p50 = " << publish.percentile(0.50) / 1000.0 << " us"
+              << ", p99 = " << publish.percentile(0.99) / 1000.0 << " us"
+              << ", max = " << publish.getMax() / 1000.0 << " us"
+              << (WIFEXITED(status) && WEXITSTATUS(status) == 0 ? "" : " (reader failed)") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = (argc > 1) ? std::stoi(argv[1]) : 1000;
+    int intervalUs = (argc > 2) ? std::stoi(argv[2]) : 1000;
+
+    const bench_case_t cases[] = {
+            {"128x64 1bpp", 128, 64, SHM_FORMAT_MONO},
+            {"128x64 1bpp+bgra", 128, 64, SHM_FORMAT_MONO | SHM_FORMAT_BGRA},
+            {"400x240 1bpp+bgra", 400, 240, SHM_FORMAT_MONO | SHM_FORMAT_BGRA},
+    };
+
+    for (const auto &c : cases)
+        runCase(c, frames, intervalUs);
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <U8g2GlyphCache.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+static const char *const lines[] = {
+        "CPU  42%  48.2C",
+        "MEM  128/512 MB",
+        "NET  eth0 UP",
+        "UPTIME 12:04:33",
+        "LOAD 0.42 0.36",
+        "DISK 12.4 GB free"
+};
+
+struct bench_case_t {
+    const char *name;
+    const uint8_t *font;
+    uint8_t fontMode;
+    uint8_t drawColor;
+};
+
+static void setupDisplay(u8g2_t *u8g2) {
+    u8g2_Setup_ssd1306_128x64_noname_f(u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_ClearBuffer(u8g2);
+}
+
+static void applyCase(u8g2_t *u8g2, const bench_case_t &c) {
+    u8g2_SetFont(u8g2, c.font);
+    u8g2_SetFontMode(u8g2, c.fontMode);
+    u8g2_SetDrawColor(u8g2, c.drawColor);
+}
+
+template<typename F>
+static double timeFrames(u8g2_t *u8g2, int frames, F draw) {
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        u8g2_ClearBuffer(u8g2);
+        for (int i = 0; i < 6; i++)
+            draw(static_cast<u8g2_uint_t>(2), static_cast<u8g2_uint_t>(10 + (i * 10)), lines[i]);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+static bool runCase(const bench_case_t &c, int frames) {
+    u8g2_t ref, cached;
+    U8g2GlyphCache cache;
+
+    setupDisplay(&ref);
+    setupDisplay(&cached);
+    applyCase(&ref, c);
+    applyCase(&cached, c);
+
+    double refTime = timeFrames(&ref, frames, [&](u8g2_uint_t x, u8g2_uint_t y, const char *s) {
+        u8g2_DrawStr(&ref, x, y, s);
+    });
+    double cacheTime = timeFrames(&cached, frames, [&](u8g2_uint_t x, u8g2_uint_t y, const char *s) {
+        cache.drawString(&cached, x, y, s, false);
+    });
+
+    size_t bufSize = 8 * u8g2_GetBufferTileHeight(&ref) * u8g2_GetBufferTileWidth(&ref);
+    bool identical = std::memcmp(u8g2_GetBufferPtr(&ref), u8g2_GetBufferPtr(&cached), bufSize) == 0;
+
+    std::cout << c.name
+              << ": u8g2_DrawStr = " << refTime << " us/frame"
+              << ", glyph cache = " << cacheTime << " us/frame"
+              << ", speedup = " << (refTime / cacheTime) << "x"
+              << ", entries size = " << cache.getSize() << " bytes"
+              << ", hits = " << cache.getHits() << ", misses = " << cache.getMisses()
+              << (identical ? "" : "  ** BUFFER MISMATCH **") << std::endl;
+    return identical;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = (argc > 1) ? std::stoi(argv[1]) : 2000;
+
+    const bench_case_t cases[] = {
+            {"6x10 transparent", u8g2_font_6x10_tf, 1, 1},
+            {"6x10 solid", u8g2_font_6x10_tf, 0, 1},
+            {"ncenB08 xor", u8g2_font_ncenB08_tr, 1, 2},
+            {"helvB10 transparent", u8g2_font_helvB10_tf, 1, 1},
+    };
+
+    bool ok = true;
+    for (const auto &c : cases)
+        ok &= runCase(c, frames);
+    return ok ? 0 : 1;
+}
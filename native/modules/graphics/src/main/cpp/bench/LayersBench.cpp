@@ -0,0 +1,102 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <U8g2Layers.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+typedef void (*setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+struct bench_case_t {
+    const char *name;
+    setup_proc_t full;
+};
+
+static const char *const labels[] = {"CPU", "MEM", "NET", "UPTIME", "LOAD", "DISK"};
+
+//The static part of a status screen: a frame, a header bar, the labels, a grid and an icon
+static void drawStatic(u8g2_t *u8g2) {
+    auto w = static_cast<int>(u8g2_GetDisplayWidth(u8g2));
+    auto h = static_cast<int>(u8g2_GetDisplayHeight(u8g2));
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    u8g2_DrawBox(u8g2, 0, 0, w, 14);
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_SetDrawColor(u8g2, 0);
+    u8g2_DrawStr(u8g2, 4, 11, "STATUS");
+    u8g2_SetDrawColor(u8g2, 1);
+    for (int i = 0; i < 6; i++)
+        u8g2_DrawStr(u8g2, 4, 30 + (i * 14), labels[i]);
+    for (int x = w / 2; x < w - 4; x += 8)
+        u8g2_DrawVLine(u8g2, x, 20, h - 24);
+    u8g2_DrawRFrame(u8g2, w - 40, 20, 34, 20, 4);
+    u8g2_DrawDisc(u8g2, w - 23, 30, 6, U8G2_DRAW_ALL);
+}
+
+//The changing values
+static void drawValues(u8g2_t *u8g2, int frame) {
+    char value[16];
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    for (int i = 0; i < 6; i++) {
+        std::snprintf(value, sizeof(value), "%d", (frame * (i + 1)) % 1000);
+        u8g2_DrawStr(u8g2, 50, 30 + (i * 14), value);
+    }
+}
+
+template<typename F>
+static double timeFrames(int frames, F frame) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+        frame(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+static void runCase(const bench_case_t &c, int frames) {
+    u8g2_t u8g2;
+    c.full(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    std::vector<uint8_t> buffer(8 * u8g2_GetBufferTileWidth(&u8g2) * u8g2.tile_buf_height);
+    u8g2_SetBufferPtr(&u8g2, buffer.data());
+
+    double redraw = timeFrames(frames, [&](int i) {
+        u8g2_ClearBuffer(&u8g2);
+        drawStatic(&u8g2);
+        drawValues(&u8g2, i);
+        u8g2_SendBuffer(&u8g2);
+    });
+
+    U8g2Layers layers;
+    uint32_t background = layers.create(&u8g2, 0, LAYER_OP_OR);
+    layers.begin(&u8g2, background);
+    drawStatic(&u8g2);
+    layers.end(&u8g2);
+    int dirtyTiles = 0;
+    double layered = timeFrames(frames, [&](int i) {
+        u8g2_ClearBuffer(&u8g2);
+        drawValues(&u8g2, i);
+        layers.composite(&u8g2);
+        u8g2_SendBuffer(&u8g2);
+        dirtyTiles += layers.getDirtyArea().width * layers.getDirtyArea().height;
+    });
+
+    int tiles = u8g2_GetBufferTileWidth(&u8g2) * u8g2.tile_buf_height;
+    std::cout << c.name << ": redraw = " << redraw << " us/frame"
+              << ", static layer = " << layered << " us/frame"
+              << ", dirty = " << dirtyTiles / frames << "/" << tiles << " tiles/frame" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = (argc > 1) ? std::stoi(argv[1]) : 500;
+
+    const bench_case_t cases[] = {
+            {"ssd1306 128x64 (vertical)", u8g2_Setup_ssd1306_128x64_noname_f},
+            {"st7920 128x64 (horizontal)", u8g2_Setup_st7920_s_128x64_f},
+            {"ls027b7dh01 400x240 (horizontal)", u8g2_Setup_ls027b7dh01_400x240_f},
+    };
+    for (const auto &c : cases)
+        runCase(c, frames);
+    return 0;
+}
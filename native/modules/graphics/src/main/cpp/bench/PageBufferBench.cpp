@@ -0,0 +1,102 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <U8g2DisplayList.h>
+#include <U8g2GlyphCache.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+typedef void (*setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+struct bench_case_t {
+    const char *name;
+    setup_proc_t full;
+    setup_proc_t page1;
+    setup_proc_t page2;
+};
+
+static const char *const lines[] = {
+        "CPU  42%  48.2C",
+        "MEM  128/512 MB",
+        "NET  eth0 UP",
+        "UPTIME 12:04:33",
+        "LOAD 0.42 0.36",
+        "DISK 12.4 GB free"
+};
+
+static size_t bufferSize(u8g2_t *u8g2) {
+    return 8 * u8g2_GetBufferTileWidth(u8g2) * u8g2->tile_buf_height;
+}
+
+//A status screen: a frame, a header bar, six lines of text and a bar graph
+static void record(u8g2_t *u8g2, U8g2DisplayList &list) {
+    auto w = static_cast<int>(u8g2_GetDisplayWidth(u8g2));
+    auto h = static_cast<int>(u8g2_GetDisplayHeight(u8g2));
+    list.begin(u8g2);
+    list.add(DL_OP_FRAME, 0, 0, w, h);
+    list.add(DL_OP_BOX, 0, 0, w, 14);
+    list.addFont(u8g2_font_6x10_tf);
+    list.add(DL_OP_FONT_MODE, 1);
+    list.add(DL_OP_DRAW_COLOR, 0);
+    const char title[] = "STATUS";
+    list.addData(DL_OP_STR, title, sizeof(title), 4, 11);
+    list.add(DL_OP_DRAW_COLOR, 1);
+    for (int i = 0; i < 6; i++)
+        list.addData(DL_OP_STR, lines[i], std::strlen(lines[i]) + 1, 4, 30 + (i * 14));
+    for (int i = 0; i < 16; i++) {
+        int bar = ((i * 37) % (h / 2)) + 4;
+        list.add(DL_OP_BOX, (w / 2) + (i * ((w / 2) - 8) / 16), h - 4 - bar, ((w / 2) - 8) / 16 - 2, bar);
+    }
+    list.add(DL_OP_RFRAME, w / 2, 20, (w / 2) - 6, (h / 2) - 24, 4);
+    list.add(DL_OP_DISC, (3 * w) / 4, h / 4 + 8, h / 8, U8G2_DRAW_ALL);
+    list.end();
+}
+
+template<typename F>
+static double timeFrames(int frames, F frame) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+        frame();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+static void runVariant(const char *name, const char *variant, setup_proc_t setup, int frames) {
+    u8g2_t u8g2;
+    U8g2GlyphCache cache;
+    U8g2DisplayList list;
+    setup(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    record(&u8g2, list);
+
+    int pages = 0;
+    double time = timeFrames(frames, [&]() {
+        pages = list.render(&u8g2, &cache, nullptr);
+    });
+    size_t bgra = static_cast<size_t>(u8g2_GetDisplayWidth(&u8g2)) * u8g2_GetDisplayHeight(&u8g2) * 4;
+
+    std::cout << name << " " << variant
+              << ": pixel buffer = " << bufferSize(&u8g2) << " bytes"
+              << ", display list = " << list.getSize() << " bytes (" << list.getCount() << " ops)"
+              << ", bgra (virtual only) = " << bgra << " bytes"
+              << ", pages = " << pages
+              << ", render = " << time << " us/frame" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = (argc > 1) ? std::stoi(argv[1]) : 500;
+
+    const bench_case_t cases[] = {
+            {"ls027b7dh01 400x240", u8g2_Setup_ls027b7dh01_400x240_f, u8g2_Setup_ls027b7dh01_400x240_1, u8g2_Setup_ls027b7dh01_400x240_2},
+            {"ra8835 320x240", u8g2_Setup_ra8835_320x240_f, u8g2_Setup_ra8835_320x240_1, u8g2_Setup_ra8835_320x240_2},
+    };
+
+    for (const auto &c : cases) {
+        runVariant(c.name, "_f", c.full, frames);
+        runVariant(c.name, "_2", c.page2, frames);
+        runVariant(c.name, "_1", c.page1, frames);
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <U8g2DisplayList.h>
+#include <U8g2GlyphCache.h>
+#include <U8g2Rotator.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+
+typedef void (*setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+struct bench_case_t {
+    const char *name;
+    setup_proc_t full;
+};
+
+static const char *const lines[] = {
+        "CPU  42%  48.2C",
+        "MEM  128/512 MB",
+        "NET  eth0 UP",
+        "UPTIME 12:04:33",
+        "LOAD 0.42 0.36",
+        "DISK 12.4 GB free"
+};
+
+//A status screen: a frame, a header bar, six lines of text and a bar graph
+static void record(u8g2_t *u8g2, U8g2DisplayList &list) {
+    auto w = static_cast<int>(u8g2_GetDisplayWidth(u8g2));
+    auto h = static_cast<int>(u8g2_GetDisplayHeight(u8g2));
+    list.begin(u8g2);
+    list.add(DL_OP_FRAME, 0, 0, w, h);
+    list.add(DL_OP_BOX, 0, 0, w, 14);
+    list.addFont(u8g2_font_6x10_tf);
+    list.add(DL_OP_FONT_MODE, 1);
+    list.add(DL_OP_DRAW_COLOR, 0);
+    const char title[] = "STATUS";
+    list.addData(DL_OP_STR, title, sizeof(title), 4, 11);
+    list.add(DL_OP_DRAW_COLOR, 1);
+    for (int i = 0; i < 6; i++)
+        list.addData(DL_OP_STR, lines[i], std::strlen(lines[i]) + 1, 4, 30 + (i * 14));
+    for (int i = 0; i < 16; i++) {
+        int bar = ((i * 37) % (h / 2)) + 4;
+        list.add(DL_OP_BOX, (w / 2) + (i * ((w / 2) - 8) / 16), h - 4 - bar, ((w / 2) - 8) / 16 - 2, bar);
+    }
+    list.add(DL_OP_RFRAME, w / 2, 20, (w / 2) - 6, (h / 2) - 24, 4);
+    list.add(DL_OP_DISC, (3 * w) / 4, h / 4 + 8, h / 8, U8G2_DRAW_ALL);
+    list.end();
+}
+
+template<typename F>
+static double timeFrames(int frames, F frame) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+        frame();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+static void runVariant(const char *name, const char *variant, setup_proc_t setup, const u8g2_cb_t *rotation, bool atSend, int frames) {
+    u8g2_t u8g2;
+    U8g2GlyphCache cache;
+    U8g2DisplayList list;
+    setup(&u8g2, atSend ? U8G2_R0 : rotation, u8x8_byte_empty, u8x8_dummy_cb);
+
+    //Own buffer per instance, the _f setup procedures share a static one
+    std::vector<uint8_t> buffer(8 * u8g2_GetBufferTileWidth(&u8g2) * u8g2.tile_buf_height);
+    u8g2_SetBufferPtr(&u8g2, buffer.data());
+
+    U8g2Rotator rotator(&u8g2);
+    if (atSend) {
+        rotator.setRotation(&u8g2, rotation);
+        if (!rotator.isActive()) {
+            std::cout << name << " " << variant << ": not supported" << std::endl;
+            return;
+        }
+    }
+    record(&u8g2, list);
+
+    double time = timeFrames(frames, [&]() {
+        u8g2_ClearBuffer(&u8g2);
+        list.replay(&u8g2, &cache, nullptr);
+        if (atSend)
+            rotator.sendBuffer(&u8g2);
+        else
+            u8g2_SendBuffer(&u8g2);
+    });
+
+    std::cout << name << " " << variant
+              << ": " << u8g2_GetDisplayWidth(&u8g2) << "x" << u8g2_GetDisplayHeight(&u8g2)
+              << ", glyph cache = " << (U8g2GlyphCache::isSupported(&u8g2) ? "yes" : "no")
+              << ", frame = " << time << " us";
+    if (atSend) {
+        double rotate = timeFrames(frames, [&]() {
+            rotator.rotate();
+        });
+        std::cout << " (rotate = " << rotate << " us)";
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = (argc > 1) ? std::stoi(argv[1]) : 500;
+
+    const bench_case_t cases[] = {
+            {"ssd1306 128x64 (vertical)", u8g2_Setup_ssd1306_128x64_noname_f},
+            {"st7920 128x64 (horizontal)", u8g2_Setup_st7920_s_128x64_f},
+            {"ls027b7dh01 400x240 (horizontal)", u8g2_Setup_ls027b7dh01_400x240_f},
+    };
+
+    for (const auto &c : cases) {
+        runVariant(c.name, "R0", c.full, U8G2_R0, false, frames);
+        runVariant(c.name, "R1 (u8g2)", c.full, U8G2_R1, false, frames);
+        runVariant(c.name, "R1 (rotate_at_send)", c.full, U8G2_R1, true, frames);
+        runVariant(c.name, "R2 (u8g2)", c.full, U8G2_R2, false, frames);
+        runVariant(c.name, "R2 (rotate_at_send)", c.full, U8G2_R2, true, frames);
+    }
+    return 0;
+}
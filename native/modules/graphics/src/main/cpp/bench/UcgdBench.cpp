@@ -0,0 +1,348 @@
+/*
+ * ucgd-bench : headless benchmark of the native graphics library
+ *
+ * Drives the JNI entry points through an in-process JNI environment (see BenchJni.h) against displays running in
+ * virtual mode (no byte listeners, so the transport is a no-op) and, on non-ARM hosts, a software SPI display whose
+ * GPIO callbacks are no-ops.
+ *
+ * Usage:
+ *   ucgd-bench [--min-time <ms>] [--samples <n>] [--filter <text>] [--output <file>]
+ *   ucgd-bench --compare <baseline.json> <current.json> [--threshold <percent>]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <UcgdConfig.h>
+#include <Global.h>
+#include <U8g2Graphics.h>
+#include <U8g2Utils.h>
+#include "BenchJni.h"
+
+//Defined in U8g2Graphics.cpp, converts the pixel buffer of a virtual display into its bgra buffer
+void updateBgraBuffer(jlong id);
+
+#define BENCH_FORMAT_VERSION 1
+
+#if (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
+//software SPI goes through the GPIO providers on ARM, only virtual displays are used
+#define BENCH_NULL_GPIO 0
+#else
+#define BENCH_NULL_GPIO 1
+#endif
+
+struct bench_options_t {
+    double minTimeMs = 250;
+    int samples = 5;
+    std::string filter;
+    std::string output;
+};
+
+struct bench_result_t {
+    std::string name;
+    uint64_t iterations;
+    double nsPerOp;
+    double minNs;
+    double maxNs;
+};
+
+struct bench_display_t {
+    std::string name;
+    jlong id = -1;
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> bgra;
+};
+
+class BenchRunner {
+public:
+    BenchRunner(BenchJni &jni, const bench_options_t &options) : m_Jni(jni), m_Options(options) {}
+
+    /**
+     * Time fn. The iteration count is doubled until one sample takes min-time / samples, the reported time per
+     * operation is the median of the samples.
+     */
+    template<typename F>
+    void run(const std::string &name, F fn) {
+        if (!m_Options.filter.empty() && name.find(m_Options.filter) == std::string::npos)
+            return;
+        double sampleNs = m_Options.minTimeMs * 1e6 / m_Options.samples;
+        uint64_t iterations = 1;
+        double elapsed = time(fn, iterations);
+        while (elapsed < sampleNs && iterations < (1ULL << 40)) {
+            iterations = elapsed > 0 ? std::max(iterations * 2, static_cast<uint64_t>(iterations * sampleNs / elapsed)) : iterations * 2;
+            elapsed = time(fn, iterations);
+        }
+        std::vector<double> perOp;
+        for (int i = 0; i < m_Options.samples; i++)
+            perOp.push_back(time(fn, iterations) / static_cast<double>(iterations));
+        std::sort(perOp.begin(), perOp.end());
+
+        std::string error = m_Jni.takeException();
+        if (!error.empty()) {
+            std::cerr << std::left << std::setw(40) << name << " FAILED: " << error << std::endl;
+            m_Failed = true;
+            return;
+        }
+        bench_result_t result{name, iterations, perOp[perOp.size() / 2], perOp.front(), perOp.back()};
+        std::cerr << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(1) << std::setw(12) << result.nsPerOp << " ns/op" << std::endl;
+        m_Results.push_back(result);
+    }
+
+    [[nodiscard]] const std::vector<bench_result_t> &getResults() const {
+        return m_Results;
+    }
+
+    [[nodiscard]] bool hasFailed() const {
+        return m_Failed;
+    }
+
+private:
+    template<typename F>
+    static double time(F &fn, uint64_t iterations) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+            fn();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    BenchJni &m_Jni;
+    const bench_options_t &m_Options;
+    std::vector<bench_result_t> m_Results;
+    bool m_Failed = false;
+};
+
+static bool setupDisplay(BenchJni &jni, bench_display_t &display, const std::string &name, const char *setupProc, int commInt, int commType, bool virtualMode) {
+    display.name = name;
+    display.buffer.assign(128 * 64 / 8, 0);
+    display.bgra.assign(128 * 64 * 4, 0);
+    display.id = Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setup(jni.env(), nullptr, jni.newString(setupProc), commInt, commType, 0,
+                                                                         jni.newIntArray(std::vector<jint>(16, -1)),
+                                                                         jni.newDirectBuffer(display.buffer.data(), display.buffer.size()),
+                                                                         jni.newDirectBuffer(display.bgra.data(), display.bgra.size()),
+                                                                         jni.newObject(), virtualMode ? JNI_TRUE : JNI_FALSE, jni.newObject(),
+                                                                         jni.newString("bench"));
+    std::string error = jni.takeException();
+    if (display.id == -1 || !error.empty()) {
+        std::cerr << "Unable to setup display '" << display.name << "': " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static u8x8_t *toU8x8(jlong id) {
+    return u8g2_GetU8x8(reinterpret_cast<u8g2_t *>(id));
+}
+
+static void benchPrimitives(BenchRunner &runner, JNIEnv *env, jlong id) {
+    runner.run("primitive/pixel", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawPixel(env, nullptr, id, 17, 23); });
+    runner.run("primitive/hline-128", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawHLine(env, nullptr, id, 0, 21, 128); });
+    runner.run("primitive/line-diagonal", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawLine(env, nullptr, id, 0, 0, 127, 63); });
+    runner.run("primitive/box-64x32", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawBox(env, nullptr, id, 8, 8, 64, 32); });
+    runner.run("primitive/frame-64x32", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawFrame(env, nullptr, id, 8, 8, 64, 32); });
+    runner.run("primitive/circle-r20", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawCircle(env, nullptr, id, 64, 32, 20, U8G2_DRAW_ALL); });
+    runner.run("primitive/disc-r20", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawDisc(env, nullptr, id, 64, 32, 20, U8G2_DRAW_ALL); });
+    runner.run("primitive/triangle", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawTriangle(env, nullptr, id, 0, 0, 127, 20, 40, 63); });
+    runner.run("primitive/clear-buffer", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_clearBuffer(env, nullptr, id); });
+}
+
+static void benchText(BenchRunner &runner, BenchJni &jni, jlong id) {
+    struct font_class_t {
+        const char *name;
+        const char *font;
+        const char *text;
+    };
+    const font_class_t classes[] = {
+            {"text/small-fixed", "u8g2_font_4x6_tf", "CPU 42% 48.2C MEM 128/512"},
+            {"text/fixed", "u8g2_font_6x10_tf", "CPU 42% 48.2C"},
+            {"text/proportional", "u8g2_font_helvR10_tf", "Temperature"},
+            {"text/proportional-bold", "u8g2_font_ncenB14_tr", "Status OK"},
+            {"text/large-numeric", "u8g2_font_logisoso32_tn", "12:45"},
+            {"text/unicode", "u8g2_font_unifont_t_symbols", "\xe2\x98\x80 \xe2\x98\x81 \xe2\x98\x82"},
+    };
+    JNIEnv *env = jni.env();
+    for (const auto &c : classes) {
+        Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_setFont__JLjava_lang_String_2(env, nullptr, id, jni.newString(c.font));
+        jstring text = jni.newString(c.text);
+        runner.run(c.name, [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawUTF8(env, nullptr, id, 0, 40, text); });
+    }
+}
+
+static void benchMarshaling(BenchRunner &runner, BenchJni &jni, jlong id) {
+    JNIEnv *env = jni.env();
+    jbyteArray array = jni.newByteArray(1024);
+    std::vector<uint8_t> target(1024);
+    runner.run("marshal/copy-jbytearray-1k", [&] { JNI_CopyJByteArray(env, array, target.data(), static_cast<int>(target.size())); });
+    runner.run("marshal/get-buffer", [&] { jni.deleteRef(Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_getBuffer(env, nullptr, id)); });
+    jbyteArray xbm = jni.newByteArray(32 * 32 / 8);
+    runner.run("marshal/draw-xbm-32x32", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_drawXBM(env, nullptr, id, 10, 10, 32, 32, xbm); });
+}
+
+static void benchDispatch(BenchRunner &runner, const std::string &suffix, jlong id) {
+    u8x8_t *u8x8 = toU8x8(id);
+    uint8_t data = 0x5a;
+    runner.run("dispatch/byte-send-" + suffix, [&] { U8g2Util_ByteCallbackWrapper(u8x8, U8X8_MSG_BYTE_SEND, 1, &data); });
+    runner.run("dispatch/gpio-" + suffix, [&] { U8g2Util_GpioCallbackWrapper(u8x8, U8X8_MSG_GPIO_DC, 1, nullptr); });
+}
+
+static std::string escape(const std::string &value) {
+    std::string out;
+    for (char c : value) {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static void writeJson(std::ostream &out, const std::vector<bench_result_t> &results) {
+    std::time_t now = std::time(nullptr);
+    char timestamp[32];
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    out << "{\n"
+        << "  \"format\": \"ucgd-bench\",\n"
+        << "  \"version\": " << BENCH_FORMAT_VERSION << ",\n"
+        << "  \"library\": \"" << UCGD_VERSION_MAJOR << "." << UCGD_VERSION_MINOR << "." << UCGD_VERSION_PATCH << "\",\n"
+        << "  \"compiler\": \"" << escape(__VERSION__) << "\",\n"
+        << "  \"timestamp\": \"" << timestamp << "\",\n"
+        << "  \"results\": [\n";
+    out << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < results.size(); i++) {
+        const bench_result_t &r = results[i];
+        out << "    {\"name\": \"" << escape(r.name) << "\", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.nsPerOp
+            << ", \"min_ns\": " << r.minNs << ", \"max_ns\": " << r.maxNs << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+//Reads the name/ns_per_op pairs of a file written by writeJson
+static bool readJson(const std::string &path, std::map<std::string, double> &results) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Unable to read '" << path << "'" << std::endl;
+        return false;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string content = ss.str();
+    if (content.find("\"format\": \"ucgd-bench\"") == std::string::npos) {
+        std::cerr << "'" << path << "' is not a ucgd-bench result file" << std::endl;
+        return false;
+    }
+    static const std::regex entry(R"re("name":\s*"([^"]+)"[^}]*"ns_per_op":\s*([0-9.eE+-]+))re");
+    for (auto it = std::sregex_iterator(content.begin(), content.end(), entry); it != std::sregex_iterator(); ++it)
+        results[(*it)[1].str()] = std::stod((*it)[2].str());
+    return true;
+}
+
+static int compare(const std::string &baselinePath, const std::string &currentPath, double threshold) {
+    std::map<std::string, double> baseline, current;
+    if (!readJson(baselinePath, baseline) || !readJson(currentPath, current))
+        return 2;
+    int regressions = 0;
+    std::cout << std::left << std::setw(40) << "benchmark" << std::right << std::setw(14) << "baseline" << std::setw(14) << "current" << std::setw(10) << "change" << std::endl;
+    for (const auto &entry : current) {
+        auto base = baseline.find(entry.first);
+        std::cout << std::left << std::setw(40) << entry.first << std::right << std::fixed << std::setprecision(1);
+        if (base == baseline.end()) {
+            std::cout << std::setw(14) << "-" << std::setw(14) << entry.second << std::setw(10) << "new" << std::endl;
+            continue;
+        }
+        double change = base->second > 0 ? (entry.second - base->second) * 100.0 / base->second : 0;
+        std::cout << std::setw(14) << base->second << std::setw(14) << entry.second << std::setw(9) << std::showpos << change << std::noshowpos << "%";
+        if (change > threshold) {
+            std::cout << "  REGRESSION";
+            regressions++;
+        } else if (change < -threshold) {
+            std::cout << "  improved";
+        }
+        std::cout << std::endl;
+    }
+    for (const auto &entry : baseline) {
+        if (current.find(entry.first) == current.end())
+            std::cout << std::left << std::setw(40) << entry.first << std::right << std::setw(14) << entry.second << std::setw(14) << "-" << std::setw(10) << "missing" << std::endl;
+    }
+    std::cout << regressions << " regression(s) above " << threshold << "%" << std::endl;
+    return regressions > 0 ? 1 : 0;
+}
+
+static void usage(const char *program) {
+    std::cerr << "Usage: " << program << " [--min-time <ms>] [--samples <n>] [--filter <text>] [--output <file>]" << std::endl
+              << "       " << program << " --compare <baseline.json> <current.json> [--threshold <percent>]" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    bench_options_t options;
+    std::vector<std::string> compareFiles;
+    double threshold = 10.0;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--min-time" && hasValue)
+            options.minTimeMs = std::stod(argv[++i]);
+        else if (arg == "--samples" && hasValue)
+            options.samples = std::max(1, std::stoi(argv[++i]));
+        else if (arg == "--filter" && hasValue)
+            options.filter = argv[++i];
+        else if (arg == "--output" && hasValue)
+            options.output = argv[++i];
+        else if (arg == "--threshold" && hasValue)
+            threshold = std::stod(argv[++i]);
+        else if (arg == "--compare" && i + 2 < argc) {
+            compareFiles.emplace_back(argv[++i]);
+            compareFiles.emplace_back(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!compareFiles.empty())
+        return compare(compareFiles[0], compareFiles[1], threshold);
+
+    BenchJni jni;
+    JNI_OnLoad(jni.vm(), nullptr);
+
+    //vertical_top_lsb and horizontal_right_lsb buffer layouts
+    bench_display_t vertical, horizontal;
+    if (!setupDisplay(jni, vertical, "ssd1306 (virtual)", "u8g2_Setup_ssd1306_128x64_noname_f", COMINT_4WSPI, COMTYPE_SW, true) ||
+        !setupDisplay(jni, horizontal, "st7920 (virtual)", "u8g2_Setup_st7920_s_128x64_f", COMINT_ST7920SPI, COMTYPE_SW, true))
+        return 2;
+#if BENCH_NULL_GPIO
+    bench_display_t softSpi;
+    if (!setupDisplay(jni, softSpi, "ssd1306 (software spi)", "u8g2_Setup_ssd1306_128x64_noname_f", COMINT_4WSPI, COMTYPE_SW, false))
+        return 2;
+#endif
+
+    BenchRunner runner(jni, options);
+    JNIEnv *env = jni.env();
+    benchPrimitives(runner, env, vertical.id);
+    benchText(runner, jni, vertical.id);
+    runner.run("bgra/vertical", [&] { updateBgraBuffer(vertical.id); });
+    runner.run("bgra/horizontal", [&] { updateBgraBuffer(horizontal.id); });
+    benchDispatch(runner, "virtual", vertical.id);
+#if BENCH_NULL_GPIO
+    benchDispatch(runner, "sw-spi", softSpi.id);
+#endif
+    benchMarshaling(runner, jni, vertical.id);
+    runner.run("send-buffer/vertical-virtual", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_sendBuffer(env, nullptr, vertical.id); });
+    runner.run("send-buffer/horizontal-virtual", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_sendBuffer(env, nullptr, horizontal.id); });
+#if BENCH_NULL_GPIO
+    runner.run("send-buffer/vertical-sw-spi", [&] { Java_com_ibasco_ucgdisplay_core_u8g2_U8g2Graphics_sendBuffer(env, nullptr, softSpi.id); });
+#endif
+
+    if (options.output.empty()) {
+        writeJson(std::cout, runner.getResults());
+    } else {
+        std::ofstream out(options.output);
+        writeJson(out, runner.getResults());
+    }
+    return runner.hasFailed() ? 1 : 0;
+}
@@ -47,13 +47,6 @@ public:
     explicit GpioInitException(const runtime_error &error) : GpioException(error) {}
 };
 
-class GpioWriteException : public GpioException {
-public:
-    explicit GpioWriteException(const std::string &arg) : GpioException(arg) {}
-
-    explicit GpioWriteException(const runtime_error &error) : GpioException(error) {}
-};
-
 class GpioModeException : public GpioException {
 public:
     explicit GpioModeException(const std::string &arg) : GpioException(arg) {}
@@ -90,10 +83,15 @@ public:
         }
     };
 
-    virtual void write(int pin, uint8_t value) = 0;
+    /**
+     * Called from the u8x8 gpio callback, must not throw. A failure is described with context->transport.fail()
+     *
+     * @return TRANSPORT_OK or a negative TRANSPORT_ERR_* code
+     */
+    virtual int write(const std::shared_ptr<ucgd_t>& context, int pin, uint8_t value) = 0;
 
     static std::string buildGpioDevicePath(const std::shared_ptr<ucgd_t>& context) {
-        int chipNum = context->getOptionInt(OPT_GPIO_CHIP, 0);
+        int chipNum = context->settings.gpio_chip;
         return std::string("/dev/gpiochip") + std::to_string(chipNum);
     }
 protected:
@@ -49,15 +49,6 @@ public:
     explicit I2COpenException(const runtime_error &error) : I2CException(error) {}
 };
 
-class I2CWriteException : public I2CException {
-public:
-    explicit I2CWriteException(const std::string &arg) : I2CException(arg) {}
-
-    explicit I2CWriteException(const char *string) : I2CException(string) {}
-
-    explicit I2CWriteException(const runtime_error &error) : I2CException(error) {}
-};
-
 class UcgdI2CPeripheral : public UcgdPeripheral {
 
 public:
@@ -67,19 +58,24 @@ public:
         debug("UcgdI2CPeripheral: destructor");
     }
 
-    virtual int write(const std::shared_ptr<ucgd_t>& context, unsigned short address, const uint8_t *buffer, unsigned short length) {};
+    /**
+     * Called from the u8x8 byte callback, must not throw. A failure is described with context->transport.fail()
+     *
+     * @return The number of bytes written or a negative TRANSPORT_ERR_* code
+     */
+    virtual int write(const std::shared_ptr<ucgd_t>& context, unsigned short address, const uint8_t *buffer, unsigned short length) = 0;
 
 protected:
 
     static std::string buildI2CDevicePath(const std::shared_ptr<ucgd_t>& context) {
-        return std::string("/dev/i2c-") + std::to_string(context->getOptionInt(OPT_I2C_BUS, 1));
+        return std::string("/dev/i2c-") + std::to_string(context->settings.i2c_bus_number);
     }
 
     void printDebugInfo(const std::shared_ptr<ucgd_t>& context) {
         //std::string devicePath = context->getOptionString(OPT_DEVICE_I2C_PATH, DEFAULT_I2C_DEVICE_PATH);
         std::string devicePath = buildI2CDevicePath(context);
-        int bus = context->getOptionInt(OPT_I2C_BUS, 1);
-        int flags = context->getOptionInt(OPT_I2C_FLAGS, 0);
+        int bus = context->settings.i2c_bus_number;
+        int flags = context->settings.i2c_flags;
         Log log = ServiceLocator::getInstance().getLogger();
         log.debug("=====================================================================");
         log.debug("I2C Setup Info");
@@ -56,15 +56,6 @@ public:
     explicit SpiOpenException(const runtime_error &error) : SpiException(error) {}
 };
 
-class SpiWriteException : public SpiException {
-public:
-    explicit SpiWriteException(const std::string &arg) : SpiException(arg) {}
-
-    explicit SpiWriteException(const char *string) : SpiException(string) {}
-
-    explicit SpiWriteException(const runtime_error &error) : SpiException(error) {}
-};
-
 class UcgdSpiPeripheral : public UcgdPeripheral {
 
 public:
@@ -76,14 +67,21 @@ public:
         debug("UcgdSpiPeripheral: destructor");
     };
 
+    /**
+     * Called from the u8x8 byte callback, must not throw. A failure is described with context->transport.fail()
+     *
+     * @return The number of bytes written or a negative TRANSPORT_ERR_* code
+     */
     virtual int write(const std::shared_ptr<ucgd_t> &context, uint8_t *buffer, int count) = 0;
 
 protected:
 
     static std::string buildSPIDevicePath(const std::shared_ptr<ucgd_t>& context) {
         Log& log = ServiceLocator::getInstance().getLogger();
-        int peripheral = context->getOptionInt(OPT_SPI_BUS);
-        int channel = context->getOptionInt(OPT_SPI_CHANNEL);
+        context->settings.require(OPTION_SPI_BUS);
+        context->settings.require(OPTION_SPI_CHANNEL);
+        int peripheral = context->settings.spi_bus_number;
+        int channel = context->settings.spi_channel;
         std::string path = std::string("/dev/spidev") + std::to_string(peripheral) + std::string(".") + std::to_string(channel);
         log.debug(std::string("buildSPIDevicePath() : Building device path: BUS = ") + std::to_string(peripheral) + std::string(", CHANNEL = ") + std::to_string(channel) + std::string(", PATH = ") + path);
         return path;
@@ -93,10 +91,11 @@ protected:
         Log& log = ServiceLocator::getInstance().getLogger();
 
         std::string devicePath = buildSPIDevicePath(context);
-        int peripheral = context->getOptionInt(OPT_SPI_BUS, DEFAULT_SPI_PERIPHERAL);
-        int speed = context->getOptionInt(OPT_BUS_SPEED, DEFAULT_SPI_SPEED);
-        int channel = context->getOptionInt(OPT_SPI_CHANNEL, DEFAULT_SPI_CHANNEL);
-        int flags = context->getOptionInt(OPT_SPI_FLAGS, 0);
+        const ucgd_settings_t &settings = context->settings;
+        int peripheral = settings.has(OPTION_SPI_BUS) ? settings.spi_bus_number : DEFAULT_SPI_PERIPHERAL;
+        int speed = settings.has(OPTION_BUS_SPEED) ? settings.bus_speed : DEFAULT_SPI_SPEED;
+        int channel = settings.has(OPTION_SPI_CHANNEL) ? settings.spi_channel : DEFAULT_SPI_CHANNEL;
+        int flags = settings.spi_flags;
 
         log.debug("=====================================================================");
         log.debug("SPI Configuration Parameters");
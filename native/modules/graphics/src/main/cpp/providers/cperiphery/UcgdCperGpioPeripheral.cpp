@@ -82,16 +82,16 @@ void UcgdCperGpioPeripheral::init(const std::shared_ptr<ucgd_t> &context, int pi
     log.debug("init_gpio() : [C-PERIPHERY] Pin = {}, Mode = {}", pin, std::to_string(mode));
 }
 
-void UcgdCperGpioPeripheral::write(int pin, uint8_t value) {
+int UcgdCperGpioPeripheral::write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) {
     if (pin < 0)
-        return;
-    std::shared_ptr<gpio_t> gpio = findOrCreateGpioLine(pin);
-    int retval = cp_gpio_write(gpio.get(), value);
-    if (retval < 0) {
-        std::stringstream ss;
-        ss << "Failed to write to gpio pin: " << std::to_string(pin) << " with value '" << std::to_string(value) << ", Reason: " << std::string(cp_gpio_errmsg(gpio.get()));
-        throw GpioWriteException(ss.str());
-    }
+        return TRANSPORT_OK;
+    auto it = m_GpioLineCache.find(pin);
+    if (it == m_GpioLineCache.end())
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "Gpio pin %d has not been initialized", pin);
+    gpio_t *gpio = it->second.get();
+    if (cp_gpio_write(gpio, value) < 0)
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to gpio pin: %d with value '%d', Reason: %s", pin, value, cp_gpio_errmsg(gpio));
+    return TRANSPORT_OK;
 }
 
 bool UcgdCperGpioPeripheral::isModeSupported(const UcgdGpioPeripheral::GpioMode &mode) {
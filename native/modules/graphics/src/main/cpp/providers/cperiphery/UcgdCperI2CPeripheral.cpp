@@ -26,6 +26,7 @@
 #include <UcgdCperI2CPeripheral.h>
 #include <sstream>
 #include <i2c.h>
+#include <UcgdTrace.h>
 
 UcgdCperI2CPeripheral::UcgdCperI2CPeripheral(const std::shared_ptr<UcgdProvider>& provider) : UcgdI2CPeripheral(provider) {
 }
@@ -61,16 +62,12 @@ void UcgdCperI2CPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 }
 
 int UcgdCperI2CPeripheral::write(const std::shared_ptr<ucgd_t>& context, unsigned short address, const uint8_t *buffer, unsigned short length) {
-    if (context->sys_i2c_handle == nullptr) {
-        return -1;
-    }
+    UCGD_TRACE_SCOPE_ARG("transport", "i2c.write", "bytes", length);
+    if (context->sys_i2c_handle == nullptr)
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : I2C device has not been opened");
     struct i2c_msg i2cMsg = {.addr = address, .flags = 0, .len = length, .buf = const_cast<__u8 *>(buffer)};
     int retval;
-    if ((retval = cp_i2c_transfer(context->sys_i2c_handle.get(), &i2cMsg, 1)) < 0) {
-        const char *errmsg = cp_i2c_errmsg(context->sys_i2c_handle.get());
-        std::stringstream ss;
-        ss << "Failed to write to i2c device: " << std::string(errmsg);
-        throw I2CWriteException(ss.str());
-    }
+    if ((retval = cp_i2c_transfer(context->sys_i2c_handle.get(), &i2cMsg, 1)) < 0)
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to i2c device: %s", cp_i2c_errmsg(context->sys_i2c_handle.get()));
     return retval;
 }
@@ -26,6 +26,7 @@
 
 #include <UcgdCperSpiPeripheral.h>
 #include <spi.h>
+#include <UcgdTrace.h>
 #include <sstream>
 #include <iostream>
 
@@ -62,12 +63,13 @@ void UcgdCperSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
     printDebugInfo(context);
 
     std::string devicePath = UcgdSpiPeripheral::buildSPIDevicePath(context);
-    int speed = context->getOptionInt(OPT_BUS_SPEED, DEFAULT_SPI_SPEED);
-    int flags = context->getOptionInt(OPT_SPI_FLAGS, DEFAULT_SPI_FLAGS);
+    const ucgd_settings_t &settings = context->settings;
+    int speed = settings.has(OPTION_BUS_SPEED) ? settings.bus_speed : DEFAULT_SPI_SPEED;
+    int flags = settings.spi_flags;
 
-    cp_spi_bit_order bit_order = static_cast<cp_spi_bit_order>(context->getOptionInt(OPT_SPI_BIT_ORDER, DEFAULT_SPI_BIT_ORDER));
-    uint8_t bits_per_word = context->getOptionInt(OPT_SPI_BITS_PER_WORD, DEFAULT_SPI_BITS_PER_WORD);
-    int mode = context->getOptionInt(OPT_SPI_MODE, DEFAULT_SPI_MODE);
+    cp_spi_bit_order bit_order = static_cast<cp_spi_bit_order>(settings.spi_bit_order);
+    uint8_t bits_per_word = settings.spi_bits_per_word;
+    int mode = settings.spi_mode;
 
     log.debug("open() : [C-PERIPHERY] Bit Order = {}, Bits Per Word = {}, Mode = {}", bit_order, bits_per_word, mode);
 
@@ -86,9 +88,9 @@ void UcgdCperSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 }
 
 int UcgdCperSpiPeripheral::write(const std::shared_ptr<ucgd_t> &context, uint8_t *buffer, int count) {
+    UCGD_TRACE_SCOPE_ARG("transport", "spi.write", "bytes", count);
     int retval;
-    if ((retval = cp_spi_transfer(context->sys_spi_handle.get(), buffer, buffer, count)) < 0) {
-        throw SpiWriteException(std::string("write() : Failed to write to spi device. Reason: \"") + std::string(cp_spi_errmsg(context->sys_spi_handle.get())) + std::string("\""));
-    }
+    if ((retval = cp_spi_transfer(context->sys_spi_handle.get(), buffer, buffer, count)) < 0)
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : Failed to write to spi device. Reason: \"%s\"", cp_spi_errmsg(context->sys_spi_handle.get()));
     return retval;
 }
@@ -69,18 +69,21 @@ void UcgdLibgpiodGpioPeripheral::init(const std::shared_ptr<ucgd_t> &context, in
     log.debug("init_gpio() : [LIBGPIOD] Pin = {}, Mode = {}", pin, std::to_string(direction));
 }
 
-void UcgdLibgpiodGpioPeripheral::write(int pin, uint8_t value) {
+int UcgdLibgpiodGpioPeripheral::write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) {
     //Ignore pins < 0
     if (pin <= -1)
-        return;
+        return TRANSPORT_OK;
     //GPIO Userspace code
     gpiod::line *gpio_line = findGpioLine(pin);
-    if (gpio_line == nullptr) {
-        std::stringstream ss;
-        ss << "Could not obtain line reference for line offset: " << std::to_string(pin);
-        throw GpioWriteException(ss.str());
+    if (gpio_line == nullptr)
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "Could not obtain line reference for line offset: %d", pin);
+    //libgpiod reports errors with std::system_error, converted here so nothing is thrown through the u8x8 callback
+    try {
+        gpio_line->set_value(value);
+    } catch (std::exception &e) {
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to line offset %d: %s", pin, e.what());
     }
-    gpio_line->set_value(value);
+    return TRANSPORT_OK;
 }
 
 gpiod::line *UcgdLibgpiodGpioPeripheral::findGpioLine(int pin) {
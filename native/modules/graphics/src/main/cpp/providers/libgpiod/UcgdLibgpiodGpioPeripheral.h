@@ -39,7 +39,7 @@ public:
 
     void init(const std::shared_ptr<ucgd_t> &context, int pin, GpioMode direction) override;
 
-    void write(int pin, uint8_t value) override;
+    int write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) override;
 
     /*std::shared_ptr<UcgdLibgpiodProvider> getProvider() override {
         return dynamic_cast<UcgdLibgpiodProvider *>(UcgdPeripheral::getProvider());
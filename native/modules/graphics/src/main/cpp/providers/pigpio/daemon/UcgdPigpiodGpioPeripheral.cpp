@@ -72,24 +72,26 @@ void UcgdPigpiodGpioPeripheral::init(const std::shared_ptr<ucgd_t> &context, int
     log.debug("init_gpio() : [PIGPIOD] Pin = {}, Mode = {}", pin, std::to_string(mode));
 }
 
-void UcgdPigpiodGpioPeripheral::write(int pin, uint8_t value) {
-    checkHandle();
+int UcgdPigpiodGpioPeripheral::write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) {
     if (pin < 0)
-        return;
+        return TRANSPORT_OK;
 
     auto provider = std::dynamic_pointer_cast<UcgdPigpiodProvider>(getProvider());
+    if (provider->getHandle() < 0)
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : [PIGPIOD] Invalid pigpio handle: %d", provider->getHandle());
     int res = gpio_write(provider->getHandle(), pin, value);
 
     //TODO: Move all error messages to UcgPigpioCommon::getErrorMsg and use it instead
-    if (res == PI_BAD_GPIO) {
-        throw GpioWriteException(std::string("write() : [PIGPIOD] Invalid GPIO pin (") + std::to_string(pin) + std::string("). Must be between 0 and 53"));
+    if (res == 0) {
+        return TRANSPORT_OK;
+    } else if (res == PI_BAD_GPIO) {
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIOD] Invalid GPIO pin (%d). Must be between 0 and 53", pin);
     } else if (res == PI_BAD_LEVEL) {
-        throw GpioWriteException("write() : [PIGPIOD] Invalid level. Must be either 0 or 1");
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIOD] Invalid level. Must be either 0 or 1");
     } else if (res == PI_NOT_PERMITTED) {
-        throw GpioWriteException("write() : [PIGPIOD] GPIO operation not permitted");
-    } else {
-        throw GpioWriteException("write() : [PIGPIOD] Unknown error");
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIOD] GPIO operation not permitted");
     }
+    return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIOD] Unknown error (%d)", res);
 }
 
 void UcgdPigpiodGpioPeripheral::checkHandle() {
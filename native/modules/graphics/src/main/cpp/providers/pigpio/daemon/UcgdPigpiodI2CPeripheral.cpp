@@ -27,6 +27,7 @@
 #include <pigpiod_if2.h>
 #include <sstream>
 #include <UcgdPigpioCommon.h>
+#include <UcgdTrace.h>
 
 UcgdPigpiodI2CPeripheral::UcgdPigpiodI2CPeripheral(const std::shared_ptr<UcgdProvider>& provider) : UcgdI2CPeripheral(provider), m_PigpioHandle(-1) {
 
@@ -52,9 +53,11 @@ void UcgdPigpiodI2CPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
         m_PigpioHandle = provider->getHandle();
     }
 
-    int busNumber = context->getOptionInt(OPT_I2C_BUS, DEFAULT_I2C_BUS);
-    int address = context->getOptionInt(OPT_I2C_ADDRESS);
-    int flags = context->getOptionInt(OPT_I2C_FLAGS);
+    context->settings.require(OPTION_I2C_ADDRESS);
+    context->settings.require(OPTION_I2C_FLAGS);
+    int busNumber = context->settings.i2c_bus_number;
+    int address = context->settings.i2c_address;
+    int flags = context->settings.i2c_flags;
 
     //Note: Returns a handle (>=0) if OK, otherwise PI_BAD_I2C_BUS, PI_BAD_I2C_ADDR, PI_BAD_FLAGS, PI_NO_HANDLE, or PI_I2C_OPEN_FAILED.
     context->tp_i2c_handle = i2c_open(m_PigpioHandle, busNumber, address, flags);
@@ -69,13 +72,11 @@ void UcgdPigpiodI2CPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 }
 
 int UcgdPigpiodI2CPeripheral::write(const std::shared_ptr<ucgd_t>& context, unsigned short address, const uint8_t *buffer, unsigned short length) {
+    UCGD_TRACE_SCOPE_ARG("transport", "i2c.write", "bytes", length);
     int retval = -1;
     retval = i2c_write_device(m_PigpioHandle, context->tp_i2c_handle, (char *) buffer, length);
-    if (retval < 0) {
-        std::stringstream ss;
-        ss << "Failed to write to I2C device. Reason: " << _get_errmsg(retval);
-        throw I2CWriteException(ss.str());
-    }
+    if (retval < 0)
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to I2C device. Reason: %s", _get_errmsg(retval).c_str());
     return retval;
 }
 
@@ -28,6 +28,7 @@
 #include <UcgdGpioPeripheral.h>
 #include <iostream>
 #include <pigpiod_if2.h>
+#include <UcgdTrace.h>
 
 UcgdPigpiodSpiPeripheral::UcgdPigpiodSpiPeripheral(const std::shared_ptr<UcgdProvider> &provider) : UcgdSpiPeripheral(
         provider), m_PigpioHandle(-1) {
@@ -55,10 +56,11 @@ void UcgdPigpiodSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
         m_PigpioHandle = provider->getHandle();
     }
 
-    int speed = context->getOptionInt(OPT_BUS_SPEED, DEFAULT_SPI_SPEED);
-    int peripheral = context->getOptionInt(OPT_SPI_BUS, DEFAULT_SPI_PERIPHERAL);
-    int channel = context->getOptionInt(OPT_SPI_CHANNEL, DEFAULT_SPI_CHANNEL);
-    int flags = context->getOptionInt(OPT_SPI_FLAGS, DEFAULT_SPI_FLAGS);
+    const ucgd_settings_t &settings = context->settings;
+    int speed = settings.has(OPTION_BUS_SPEED) ? settings.bus_speed : DEFAULT_SPI_SPEED;
+    int peripheral = settings.has(OPTION_SPI_BUS) ? settings.spi_bus_number : DEFAULT_SPI_PERIPHERAL;
+    int channel = settings.has(OPTION_SPI_CHANNEL) ? settings.spi_channel : DEFAULT_SPI_CHANNEL;
+    int flags = settings.spi_flags;
 
     //Update peripheral flag
     if (peripheral == SPI_PERIPHERAL_MAIN) {
@@ -100,13 +102,13 @@ void UcgdPigpiodSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 }
 
 int UcgdPigpiodSpiPeripheral::write(const std::shared_ptr<ucgd_t> &context, uint8_t *buffer, int count) {
-    if (context->tp_spi_handle < 0) {
-        throw SpiWriteException("write() : [PIGPIOD] SPI device not open");
-    }
+    UCGD_TRACE_SCOPE_ARG("transport", "spi.write", "bytes", count);
+    if (context->tp_spi_handle < 0)
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : [PIGPIOD] SPI device not open");
     auto provider = std::dynamic_pointer_cast<UcgdPigpiodProvider>(getProvider());
     int retval = spi_write(provider->getHandle(), context->tp_spi_handle, (char *) buffer, count);
     if (retval < 0) {
-        std::string reason;
+        const char *reason;
         switch (retval) {
             case PI_BAD_HANDLE:
                 reason = "Unknown handle";
@@ -121,7 +123,7 @@ int UcgdPigpiodSpiPeripheral::write(const std::shared_ptr<ucgd_t> &context, uint
                 reason = "Unknown";
                 break;
         }
-        throw SpiWriteException(reason);
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to SPI device. Reason: %s", reason);
     }
 
     return retval;
@@ -70,23 +70,22 @@ void UcgdPigpioGpioPeripheral::init(const std::shared_ptr<ucgd_t> &context, int
     log.debug("init_gpio() : [PIGPIO] Pin = {}, Mode = {}", pin, std::to_string(mode));
 }
 
-void UcgdPigpioGpioPeripheral::write(int pin, uint8_t value) {
+int UcgdPigpioGpioPeripheral::write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) {
     if (pin < 0)
-        return;
+        return TRANSPORT_OK;
 
     int res = gpioWrite(pin, value);
 
     if (res == 0) {
-        return;
+        return TRANSPORT_OK;
     } else if (res == PI_BAD_GPIO) {
-        throw GpioWriteException(std::string("write() : [PIGPIO] Invalid GPIO pin (") + std::to_string(pin) + std::string("). Must be between 0 and 53"));
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIO] Invalid GPIO pin (%d). Must be between 0 and 53", pin);
     } else if (res == PI_BAD_LEVEL) {
-        throw GpioWriteException("write() : [PIGPIO] Invalid level. Must be either 0 or 1");
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIO] Invalid level. Must be either 0 or 1");
     } else if (res == PI_NOT_PERMITTED) {
-        throw GpioWriteException("write() : [PIGPIO] GPIO operation not permitted");
-    } else {
-        throw GpioWriteException(std::string("write() : [PIGPIO] Could not initialize GPIO pin. Reason code: ") + std::to_string(res));
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIO] GPIO operation not permitted");
     }
+    return context->transport.fail(TRANSPORT_ERR_WRITE, "write() : [PIGPIO] Could not write to GPIO pin. Reason code: %d", res);
 }
 
 bool UcgdPigpioGpioPeripheral::isModeSupported(const UcgdGpioPeripheral::GpioMode &mode) {
@@ -26,6 +26,7 @@
 #include "UcgdPigpioI2CPeripheral.h"
 #include <pigpio.h>
 #include <sstream>
+#include <UcgdTrace.h>
 
 UcgdPigpioI2CPeripheral::UcgdPigpioI2CPeripheral(const std::shared_ptr<UcgdProvider>& provider) : UcgdI2CPeripheral(provider) {}
 
@@ -45,9 +46,11 @@ void UcgdPigpioI2CPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 
     printDebugInfo(context);
 
-    int busNumber = context->getOptionInt(OPT_I2C_BUS, DEFAULT_I2C_BUS);
-    int address = context->getOptionInt(OPT_I2C_ADDRESS);
-    int flags = context->getOptionInt(OPT_I2C_FLAGS);
+    context->settings.require(OPTION_I2C_ADDRESS);
+    context->settings.require(OPTION_I2C_FLAGS);
+    int busNumber = context->settings.i2c_bus_number;
+    int address = context->settings.i2c_address;
+    int flags = context->settings.i2c_flags;
 
     context->tp_i2c_handle = i2cOpen(busNumber, address, flags);
     if (context->tp_i2c_handle < 0) {
@@ -60,14 +63,12 @@ void UcgdPigpioI2CPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 }
 
 int UcgdPigpioI2CPeripheral::write(const std::shared_ptr<ucgd_t> &context, unsigned short address, const uint8_t *buffer, unsigned short length) {
+    UCGD_TRACE_SCOPE_ARG("transport", "i2c.write", "bytes", length);
     if (context->tp_i2c_handle <= -1)
-        return -1;
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : [PIGPIO] I2C device not open");
     int retval = i2cWriteDevice(context->tp_i2c_handle, (char *) buffer, length);
-    if (retval < 0) {
-        std::stringstream ss;
-        ss << "Failed to write to I2C device. Reason: " << _get_errmsg(retval);
-        throw I2CWriteException(ss.str());
-    }
+    if (retval < 0)
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to I2C device. Reason: %s", _get_errmsg(retval).c_str());
     return retval;
 }
 
@@ -27,6 +27,7 @@
 #include <UcgdGpioPeripheral.h>
 #include <iostream>
 #include <pigpio.h>
+#include <UcgdTrace.h>
 
 enum SpiFlags : int {
     SPI_FLAG_MODE_0,                     //Mode 0           = 0 0                                                                                                                                            (Bits 0 and 1)
@@ -63,10 +64,13 @@ void UcgdPigpioSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
     if (context->tp_spi_handle >= 0)
         throw SpiOpenException(std::string("SPI device is already open: ") + std::to_string(context->tp_spi_handle));
 
-    int peripheral = context->getOptionInt(OPT_SPI_BUS); //required
-    int channel = context->getOptionInt(OPT_SPI_CHANNEL); //required
-    int speed = context->getOptionInt(OPT_BUS_SPEED, DEFAULT_SPI_SPEED);
-    unsigned int flags = context->getOptionInt(OPT_SPI_FLAGS, DEFAULT_SPI_FLAGS);
+    const ucgd_settings_t &settings = context->settings;
+    settings.require(OPTION_SPI_BUS);
+    settings.require(OPTION_SPI_CHANNEL);
+    int peripheral = settings.spi_bus_number;
+    int channel = settings.spi_channel;
+    int speed = settings.has(OPTION_BUS_SPEED) ? settings.bus_speed : DEFAULT_SPI_SPEED;
+    unsigned int flags = settings.spi_flags;
 
     //Update peripheral flag
     if (peripheral == SPI_PERIPHERAL_MAIN) {
@@ -104,15 +108,14 @@ void UcgdPigpioSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
 }
 
 int UcgdPigpioSpiPeripheral::write(const std::shared_ptr<ucgd_t> &context, uint8_t *buffer, int count) {
-    if (context->tp_spi_handle < 0) {
-        //throw SpiWriteException("write() : [PIGPIO] SPI device not open");
-        return -1;
-    }
+    UCGD_TRACE_SCOPE_ARG("transport", "spi.write", "bytes", count);
+    if (context->tp_spi_handle < 0)
+        return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : [PIGPIO] SPI device not open");
 
     int retval = spiWrite(context->tp_spi_handle, (char *) buffer, count);
 
     if (retval < 0) {
-        std::string reason;
+        const char *reason;
         switch (retval) {
             case PI_BAD_HANDLE:
                 reason = "Unknown handle";
@@ -127,7 +130,7 @@ int UcgdPigpioSpiPeripheral::write(const std::shared_ptr<ucgd_t> &context, uint8
                 reason = "Unknown";
                 break;
         }
-        throw SpiWriteException(reason);
+        return context->transport.fail(TRANSPORT_ERR_WRITE, "Failed to write to SPI device. Reason: %s", reason);
     }
 
     return retval;
@@ -0,0 +1,131 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <UcgdSimBus.h>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+//waits longer than this sleep for all but the last stretch, which is spun
+#define SIM_SPIN_THRESHOLD 200000
+
+UcgdSimBus::UcgdSimBus() : m_Random(1) {
+}
+
+UcgdSimBus::~UcgdSimBus() {
+    closeCapture();
+}
+
+auto UcgdSimBus::duration(const ucgd_sim_timing_t &timing, uint64_t bits) -> uint64_t {
+    uint64_t nanos = timing.latency > 0 ? timing.latency : 0;
+    if (timing.speed > 0)
+        nanos += (bits * 1000000000ULL) / (uint64_t) timing.speed;
+    if (timing.jitter > 0) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        nanos += m_Random() % ((uint64_t) timing.jitter + 1);
+    }
+    return nanos;
+}
+
+auto UcgdSimBus::transfer(const ucgd_sim_timing_t &timing, uint64_t bits) -> uint64_t {
+    uint64_t nanos = duration(timing, bits);
+    wait(nanos);
+    return nanos;
+}
+
+auto UcgdSimBus::openCapture(const std::string &path) -> void {
+    auto out = std::make_shared<std::ofstream>(path, std::ios::out | std::ios::trunc);
+    if (!out->is_open())
+        throw std::runtime_error(std::string("openCapture() : Unable to open capture file '") + path + std::string("'"));
+    setCapture(out);
+}
+
+auto UcgdSimBus::setCapture(std::shared_ptr<std::ostream> out) -> void {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Capture)
+        m_Capture->flush();
+    m_Capture = std::move(out);
+    m_Devices.clear();
+}
+
+auto UcgdSimBus::closeCapture() -> void {
+    setCapture(nullptr);
+}
+
+auto UcgdSimBus::isCapturing() const -> bool {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Capture != nullptr;
+}
+
+auto UcgdSimBus::captureSpi(uintptr_t device, const uint8_t *data, int count) -> void {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Capture)
+        return;
+    *m_Capture << "spi " << deviceIndex(device);
+    writeHex(data, count);
+    //flush per transaction, the library may be unloaded without the provider being destroyed
+    *m_Capture << std::endl;
+}
+
+auto UcgdSimBus::captureI2C(uintptr_t device, unsigned short address, const uint8_t *data, int count) -> void {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Capture)
+        return;
+    static const char digits[] = "0123456789abcdef";
+    *m_Capture << "i2c " << deviceIndex(device) << ' ' << digits[(address >> 4) & 0xf] << digits[address & 0xf];
+    writeHex(data, count);
+    *m_Capture << std::endl;
+}
+
+auto UcgdSimBus::captureGpio(int pin, uint8_t value) -> void {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Capture)
+        return;
+    *m_Capture << "gpio " << pin << ' ' << (int) value << std::endl;
+}
+
+auto UcgdSimBus::wait(uint64_t nanos) -> void {
+    if (nanos == 0)
+        return;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(nanos);
+    if (nanos > SIM_SPIN_THRESHOLD)
+        std::this_thread::sleep_until(deadline - std::chrono::nanoseconds(SIM_SPIN_THRESHOLD / 2));
+    while (std::chrono::steady_clock::now() < deadline) {
+        //spin
+    }
+}
+
+auto UcgdSimBus::deviceIndex(uintptr_t device) -> int {
+    auto it = m_Devices.find(device);
+    if (it != m_Devices.end())
+        return it->second;
+    int index = (int) m_Devices.size();
+    m_Devices.insert(std::make_pair(device, index));
+    return index;
+}
+
+auto UcgdSimBus::writeHex(const uint8_t *data, int count) -> void {
+    static const char digits[] = "0123456789abcdef";
+    *m_Capture << ' ';
+    for (int i = 0; i < count; i++)
+        *m_Capture << digits[data[i] >> 4] << digits[data[i] & 0xf];
+}
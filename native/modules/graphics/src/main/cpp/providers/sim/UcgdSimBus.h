@@ -0,0 +1,112 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDSIMBUS_H
+#define UCGD_MOD_GRAPHICS_UCGDSIMBUS_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <string>
+
+#define DEFAULT_SIM_I2C_SPEED 400000
+
+/**
+ * Timing of a simulated bus transaction
+ */
+struct ucgd_sim_timing_t {
+    //bus clock in Hz (0 = unlimited)
+    int speed = 0;
+    //fixed cost of each transaction in nanoseconds
+    int latency = 0;
+    //upper bound of the random delay added to each transaction in nanoseconds
+    int jitter = 0;
+};
+
+/**
+ * The wire shared by the peripherals of the simulated provider. Models the time taken by each transaction and records
+ * the traffic as text, one transaction per line:
+ *
+ * <pre>
+ * spi  &lt;device&gt; &lt;hex bytes&gt;
+ * i2c  &lt;device&gt; &lt;address&gt; &lt;hex bytes&gt;
+ * gpio &lt;pin&gt; &lt;value&gt;
+ * </pre>
+ *
+ * Devices are numbered in the order they first appear on the wire so the output of two runs can be compared.
+ */
+class UcgdSimBus {
+public:
+    UcgdSimBus();
+
+    ~UcgdSimBus();
+
+    /**
+     * @return The modelled duration (in nanoseconds) of a transaction transferring the given number of bits
+     */
+    auto duration(const ucgd_sim_timing_t &timing, uint64_t bits) -> uint64_t;
+
+    /**
+     * Model a transaction and block the caller for its duration
+     *
+     * @return The modelled duration in nanoseconds
+     */
+    auto transfer(const ucgd_sim_timing_t &timing, uint64_t bits) -> uint64_t;
+
+    /**
+     * Open a capture file, replacing the current capture target
+     *
+     * @throws std::runtime_error if the file could not be opened
+     */
+    auto openCapture(const std::string &path) -> void;
+
+    auto setCapture(std::shared_ptr<std::ostream> out) -> void;
+
+    auto closeCapture() -> void;
+
+    [[nodiscard]] auto isCapturing() const -> bool;
+
+    auto captureSpi(uintptr_t device, const uint8_t *data, int count) -> void;
+
+    auto captureI2C(uintptr_t device, unsigned short address, const uint8_t *data, int count) -> void;
+
+    auto captureGpio(int pin, uint8_t value) -> void;
+
+    /**
+     * Block the caller for the given number of nanoseconds. Short waits are spun so sub-microsecond timing stays accurate.
+     */
+    static auto wait(uint64_t nanos) -> void;
+
+private:
+    mutable std::mutex m_Mutex;
+    std::minstd_rand m_Random;
+    std::shared_ptr<std::ostream> m_Capture;
+    std::map<uintptr_t, int> m_Devices;
+
+    auto deviceIndex(uintptr_t device) -> int;
+
+    auto writeHex(const uint8_t *data, int count) -> void;
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDSIMBUS_H
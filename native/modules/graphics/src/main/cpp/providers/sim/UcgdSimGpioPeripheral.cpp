@@ -0,0 +1,50 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <UcgdSimGpioPeripheral.h>
+#include <algorithm>
+
+UcgdSimGpioPeripheral::UcgdSimGpioPeripheral(const std::shared_ptr<UcgdSimProvider>& provider) : UcgdGpioPeripheral(provider), m_Bus(provider->getBus()) {
+}
+
+UcgdSimGpioPeripheral::~UcgdSimGpioPeripheral() {
+    debug("UcgdSimGpioPeripheral : destructor");
+}
+
+void UcgdSimGpioPeripheral::init(const std::shared_ptr<ucgd_t> &context, int pin, UcgdGpioPeripheral::GpioMode mode) {
+    if (pin < 0)
+        return;
+    UcgdGpioPeripheral::init(context, pin, mode);
+    m_Latency = std::max(0, context->settings.sim_gpio_latency);
+    log.debug("init() : [SIM] Pin = {}, Mode = {}", pin, std::to_string(mode));
+}
+
+int UcgdSimGpioPeripheral::write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) {
+    if (pin < 0)
+        return TRANSPORT_OK;
+    m_Bus.captureGpio(pin, value);
+    UcgdSimBus::wait(m_Latency.load(std::memory_order_relaxed));
+    return TRANSPORT_OK;
+}
+
+bool UcgdSimGpioPeripheral::isModeSupported(const UcgdGpioPeripheral::GpioMode &mode) {
+    return true;
+}
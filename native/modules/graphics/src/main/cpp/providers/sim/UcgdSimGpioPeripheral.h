@@ -0,0 +1,48 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDSIMGPIOPERIPHERAL_H
+#define UCGD_MOD_GRAPHICS_UCGDSIMGPIOPERIPHERAL_H
+
+#include <atomic>
+#include <UcgdGpioPeripheral.h>
+#include <UcgdSimProvider.h>
+
+class UcgdSimGpioPeripheral : public UcgdGpioPeripheral {
+public:
+    explicit UcgdSimGpioPeripheral(const std::shared_ptr<UcgdSimProvider>& provider);
+
+    ~UcgdSimGpioPeripheral() override;
+
+    void init(const std::shared_ptr<ucgd_t>& context, int pin, GpioMode mode) override;
+
+    int write(const std::shared_ptr<ucgd_t> &context, int pin, uint8_t value) override;
+
+protected:
+    bool isModeSupported(const GpioMode &mode) override;
+
+private:
+    UcgdSimBus &m_Bus;
+    //gpio writes carry no context, the latency is shared by all devices (last initialized wins)
+    std::atomic<int> m_Latency{0};
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDSIMGPIOPERIPHERAL_H
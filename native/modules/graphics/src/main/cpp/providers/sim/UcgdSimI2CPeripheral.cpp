@@ -0,0 +1,59 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <UcgdSimI2CPeripheral.h>
+#include <UcgdTrace.h>
+
+UcgdSimI2CPeripheral::UcgdSimI2CPeripheral(const std::shared_ptr<UcgdSimProvider>& provider) : UcgdI2CPeripheral(provider), m_Bus(provider->getBus()) {
+}
+
+UcgdSimI2CPeripheral::~UcgdSimI2CPeripheral() {
+    debug("UcgdSimI2CPeripheral : destructor");
+    m_OpenDevices.clear();
+}
+
+void UcgdSimI2CPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
+    ucgd_sim_timing_t timing = UcgdSimProvider::readTiming(context, DEFAULT_SIM_I2C_SPEED);
+    log.debug("open() : [SIM] I2C Speed = {}, Latency = {}, Jitter = {}", timing.speed, timing.latency, timing.jitter);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Timing.find(context->address()) != m_Timing.end())
+            throw I2COpenException("There already is an existing i2c handle that is open for this context");
+        m_Timing[context->address()] = timing;
+    }
+    registerDevice(context);
+}
+
+int UcgdSimI2CPeripheral::write(const std::shared_ptr<ucgd_t>& context, unsigned short address, const uint8_t *buffer, unsigned short length) {
+    UCGD_TRACE_SCOPE_ARG("transport", "i2c.write", "bytes", length);
+    ucgd_sim_timing_t timing;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Timing.find(context->address());
+        if (it == m_Timing.end())
+            return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : I2C device has not been opened");
+        timing = it->second;
+    }
+    m_Bus.captureI2C(context->address(), address, buffer, length);
+    //start + address byte + payload, every byte is followed by an ack bit, then stop
+    m_Bus.transfer(timing, ((uint64_t) length + 1) * 9 + 2);
+    return length;
+}
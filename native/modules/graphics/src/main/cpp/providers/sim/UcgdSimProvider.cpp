@@ -0,0 +1,91 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <UcgdSimProvider.h>
+#include <UcgdSimSpiPeripheral.h>
+#include <UcgdSimI2CPeripheral.h>
+#include <UcgdSimGpioPeripheral.h>
+
+UcgdSimProvider::UcgdSimProvider() : UcgdProvider(PROVIDER_SIM) {
+}
+
+UcgdSimProvider::~UcgdSimProvider() {
+    debug("UcgdSimProvider : destructor");
+}
+
+void UcgdSimProvider::open(const std::shared_ptr<ucgd_t>& context) {
+    std::string capturePath = context != nullptr ? context->settings.sim_capture : "";
+    if (!capturePath.empty()) {
+        log.debug("open() : [SIM] Capturing bus traffic to '{}'", capturePath);
+        m_Bus.openCapture(capturePath);
+    }
+    setInitialized(true);
+}
+
+std::string UcgdSimProvider::getLibraryName() {
+    //built into this library
+    return std::string();
+}
+
+bool UcgdSimProvider::isProvided() {
+    return true;
+}
+
+bool UcgdSimProvider::supportsGpio() const {
+    return true;
+}
+
+bool UcgdSimProvider::supportsSPI() const {
+    return true;
+}
+
+bool UcgdSimProvider::supportsI2C() const {
+    return true;
+}
+
+auto UcgdSimProvider::getBus() -> UcgdSimBus & {
+    return m_Bus;
+}
+
+auto UcgdSimProvider::readTiming(const std::shared_ptr<ucgd_t>& context, int defaultSpeed) -> ucgd_sim_timing_t {
+    ucgd_sim_timing_t timing;
+    const ucgd_settings_t &settings = context->settings;
+    timing.speed = settings.has(OPTION_BUS_SPEED) ? settings.bus_speed : defaultSpeed;
+    timing.latency = settings.sim_latency;
+    timing.jitter = settings.sim_jitter;
+    return timing;
+}
+
+std::shared_ptr<UcgdGpioPeripheral> UcgdSimProvider::createGpioPeripheral() {
+    return std::make_shared<UcgdSimGpioPeripheral>(getPointer());
+}
+
+std::shared_ptr<UcgdI2CPeripheral> UcgdSimProvider::createI2CPeripheral() {
+    return std::make_shared<UcgdSimI2CPeripheral>(getPointer());
+}
+
+std::shared_ptr<UcgdSpiPeripheral> UcgdSimProvider::createSpiPeripheral() {
+    return std::make_shared<UcgdSimSpiPeripheral>(getPointer());
+}
+
+std::shared_ptr<UcgdSimProvider> UcgdSimProvider::getPointer() {
+    return this->shared_from_this();
+}
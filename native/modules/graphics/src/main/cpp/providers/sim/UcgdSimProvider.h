@@ -0,0 +1,73 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDSIMPROVIDER_H
+#define UCGD_MOD_GRAPHICS_UCGDSIMPROVIDER_H
+
+#include <UcgdProvider.h>
+#include <UcgdSimBus.h>
+
+/**
+ * Simulated transport provider. Available on all platforms, it runs the hardware code path (providers, peripherals and
+ * options) without a device attached, modelling the bus timing and optionally capturing the traffic (see UcgdSimBus).
+ */
+class UcgdSimProvider : public UcgdProvider, public std::enable_shared_from_this<UcgdSimProvider> {
+public:
+    UcgdSimProvider();
+
+    ~UcgdSimProvider() override;
+
+    void open(const std::shared_ptr<ucgd_t>& context) override;
+
+    std::string getLibraryName() override;
+
+    bool isProvided() override;
+
+    [[nodiscard]] bool supportsGpio() const override;
+
+    [[nodiscard]] bool supportsSPI() const override;
+
+    [[nodiscard]] bool supportsI2C() const override;
+
+    auto getBus() -> UcgdSimBus &;
+
+    std::shared_ptr<UcgdSimProvider> getPointer();
+
+    /**
+     * Read the timing options of the device
+     *
+     * @param context The device context
+     * @param defaultSpeed The bus speed (Hz) to use when OPT_BUS_SPEED is not specified
+     */
+    static auto readTiming(const std::shared_ptr<ucgd_t>& context, int defaultSpeed) -> ucgd_sim_timing_t;
+
+protected:
+    std::shared_ptr<UcgdGpioPeripheral> createGpioPeripheral() override;
+
+    std::shared_ptr<UcgdI2CPeripheral> createI2CPeripheral() override;
+
+    std::shared_ptr<UcgdSpiPeripheral> createSpiPeripheral() override;
+
+private:
+    UcgdSimBus m_Bus;
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDSIMPROVIDER_H
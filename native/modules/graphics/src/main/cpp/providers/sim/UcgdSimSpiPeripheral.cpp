@@ -0,0 +1,58 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#include <UcgdSimSpiPeripheral.h>
+#include <UcgdTrace.h>
+
+UcgdSimSpiPeripheral::UcgdSimSpiPeripheral(const std::shared_ptr<UcgdSimProvider>& provider) : UcgdSpiPeripheral(provider), m_Bus(provider->getBus()) {
+}
+
+UcgdSimSpiPeripheral::~UcgdSimSpiPeripheral() {
+    debug("UcgdSimSpiPeripheral : destructor");
+    m_OpenDevices.clear();
+}
+
+void UcgdSimSpiPeripheral::open(const std::shared_ptr<ucgd_t> &context) {
+    ucgd_sim_timing_t timing = UcgdSimProvider::readTiming(context, DEFAULT_SPI_SPEED);
+    log.debug("open() : [SIM] SPI Speed = {}, Latency = {}, Jitter = {}", timing.speed, timing.latency, timing.jitter);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Timing.find(context->address()) != m_Timing.end())
+            throw SpiOpenException("SPI device is already open");
+        m_Timing[context->address()] = timing;
+    }
+    registerDevice(context);
+}
+
+int UcgdSimSpiPeripheral::write(const std::shared_ptr<ucgd_t> &context, uint8_t *buffer, int count) {
+    UCGD_TRACE_SCOPE_ARG("transport", "spi.write", "bytes", count);
+    ucgd_sim_timing_t timing;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Timing.find(context->address());
+        if (it == m_Timing.end())
+            return context->transport.fail(TRANSPORT_ERR_NOT_OPEN, "write() : SPI device has not been opened");
+        timing = it->second;
+    }
+    m_Bus.captureSpi(context->address(), buffer, count);
+    m_Bus.transfer(timing, (uint64_t) count * 8);
+    return count;
+}
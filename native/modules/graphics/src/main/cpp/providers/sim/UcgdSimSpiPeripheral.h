@@ -0,0 +1,45 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+#ifndef UCGD_MOD_GRAPHICS_UCGDSIMSPIPERIPHERAL_H
+#define UCGD_MOD_GRAPHICS_UCGDSIMSPIPERIPHERAL_H
+
+#include <mutex>
+#include <UcgdSpiPeripheral.h>
+#include <UcgdSimProvider.h>
+
+class UcgdSimSpiPeripheral : public UcgdSpiPeripheral {
+public:
+    explicit UcgdSimSpiPeripheral(const std::shared_ptr<UcgdSimProvider>& provider);
+
+    ~UcgdSimSpiPeripheral() override;
+
+    void open(const std::shared_ptr<ucgd_t> &context) override;
+
+    int write(const std::shared_ptr<ucgd_t> &context, uint8_t *buffer, int count) override;
+
+private:
+    UcgdSimBus &m_Bus;
+    std::mutex m_Mutex;
+    std::map<uintptr_t, ucgd_sim_timing_t> m_Timing;
+};
+
+#endif //UCGD_MOD_GRAPHICS_UCGDSIMSPIPERIPHERAL_H
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <string>
+#include <PlatformProbe.h>
+
+static int failures = 0;
+
+#define EXPECT(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << "FAILED: " << #cond << " (" << __FILE__ << ":" << __LINE__ << ")" << std::endl; \
+            failures++; \
+        } \
+    } while (0)
+
+void testRaspberryPiZeroW(const std::string &fixtures) {
+    platform_info_t info = PlatformProbe::probe(fixtures + "/rpi-zero-w");
+    EXPECT(info.hardware == "BCM2835");
+    EXPECT(info.revision == "9000c1");
+    EXPECT(info.model == "Raspberry Pi Zero W Rev 1.1");
+    EXPECT(info.dt_model == "Raspberry Pi Zero W Rev 1.1");
+    EXPECT(info.description == "Raspberry Pi Zero W v1.1 512MB");
+    EXPECT(info.raspberrypi);
+    EXPECT(info.spidev_bufsiz == 4096);
+    EXPECT(info.gpio_chips.size() == 2);
+    EXPECT(info.gpio_chips.size() == 2 && info.gpio_chips[0] == fixtures + "/rpi-zero-w/dev/gpiochip0");
+    //fixture device nodes are plain files, the adapter is listed but the I2C_FUNCS query fails
+    EXPECT(info.i2c_funcs.size() == 1);
+    EXPECT(info.i2c_funcs.count(1) == 1 && info.i2c_funcs[1] == 0);
+}
+
+void testUnlistedRevisionFallsBackToDeviceTree(const std::string &fixtures) {
+    platform_info_t info = PlatformProbe::probe(fixtures + "/rpi-4b-unlisted");
+    EXPECT(info.revision == "d03115");
+    EXPECT(info.raspberrypi);
+    EXPECT(info.description == "Raspberry Pi 4 Model B Rev 1.5");
+    EXPECT(info.spidev_bufsiz == -1);
+    EXPECT(info.gpio_chips.empty());
+    EXPECT(info.i2c_funcs.empty());
+}
+
+void testGenericPlatform(const std::string &fixtures) {
+    platform_info_t info = PlatformProbe::probe(fixtures + "/generic-x86");
+    EXPECT(info.model.empty());
+    EXPECT(info.hardware.empty());
+    EXPECT(info.revision.empty());
+    EXPECT(!info.raspberrypi);
+    EXPECT(info.description.empty());
+}
+
+void testMissingRoot(const std::string &fixtures) {
+    platform_info_t info = PlatformProbe::probe(fixtures + "/does-not-exist");
+    EXPECT(!info.raspberrypi);
+    EXPECT(info.spidev_bufsiz == -1);
+    EXPECT(info.gpio_chips.empty());
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <fixture directory>" << std::endl;
+        return 2;
+    }
+    std::string fixtures = argv[1];
+
+    testRaspberryPiZeroW(fixtures);
+    testUnlistedRevisionFallsBackToDeviceTree(fixtures);
+    testGenericPlatform(fixtures);
+    testMissingRoot(fixtures);
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All platform probe tests passed" << std::endl;
+    return 0;
+}
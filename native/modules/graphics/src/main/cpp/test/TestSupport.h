@@ -0,0 +1,72 @@
+#ifndef UCGD_MOD_GRAPHICS_TESTSUPPORT_H
+#define UCGD_MOD_GRAPHICS_TESTSUPPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/*
+ * Shared harness of the ucgd-test-* programs. EXPECT records a failed check and carries on, main() ends with
+ * testResult() which reports the outcome and gives the exit code.
+ */
+
+inline int failures = 0;
+
+#define EXPECT(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << "FAILED: " << #cond << " (" << __FILE__ << ":" << __LINE__ << ")" << std::endl; \
+            failures++; \
+        } \
+    } while (0)
+
+/**
+ * @param name The name of the test suite ("All <name> tests passed")
+ * @return The exit code of the test program
+ */
+inline int testResult(const char *name) {
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All " << name << " tests passed" << std::endl;
+    return 0;
+}
+
+//Display helpers, available when u8g2.h is included first
+#ifdef U8G2_H
+
+typedef void (*setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+/**
+ * Pixel of a buffer in the vertical_top_lsb (vertical) or the horizontal_right_lsb layout
+ */
+inline bool getPixel(const uint8_t *buf, int tileWidth, bool vertical, int x, int y) {
+    if (vertical)
+        return (buf[(y >> 3) * tileWidth * 8 + x] >> (y & 7)) & 1;
+    return (buf[y * tileWidth + (x >> 3)] >> (7 - (x & 7))) & 1;
+}
+
+inline void setPixel(uint8_t *buf, int tileWidth, bool vertical, int x, int y, bool value) {
+    uint8_t *byte;
+    uint8_t bit;
+    if (vertical) {
+        byte = &buf[(y >> 3) * tileWidth * 8 + x];
+        bit = static_cast<uint8_t>(1 << (y & 7));
+    } else {
+        byte = &buf[y * tileWidth + (x >> 3)];
+        bit = static_cast<uint8_t>(0x80 >> (x & 7));
+    }
+    *byte = static_cast<uint8_t>(value ? (*byte | bit) : (*byte & ~bit));
+}
+
+/**
+ * @return The size of the (page) buffer of the display
+ */
+inline size_t bufferSize(u8g2_t *u8g2) {
+    return 8 * u8g2_GetBufferTileHeight(u8g2) * u8g2_GetBufferTileWidth(u8g2);
+}
+
+#endif
+
+#endif //UCGD_MOD_GRAPHICS_TESTSUPPORT_H
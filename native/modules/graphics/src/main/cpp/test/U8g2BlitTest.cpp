@@ -0,0 +1,82 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2Blit.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static const u8g2_cb_t *const rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3, U8G2_MIRROR};
+
+/**
+ * Draw the same bitmap with the blitter and with u8g2_DrawPixel and compare the resulting buffers
+ */
+static void compare(setup_proc_t setup, const char *name, int iterations) {
+    u8g2_t ref, blit;
+    for (int i = 0; i < iterations; i++) {
+        const u8g2_cb_t *rotation = rotations[i % 5];
+        setup(&ref, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+        setup(&blit, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+
+        //start from the same random content
+        size_t size = bufferSize(&ref);
+        for (size_t b = 0; b < size; b++)
+            u8g2_GetBufferPtr(&ref)[b] = static_cast<uint8_t>(std::rand());
+        std::memcpy(u8g2_GetBufferPtr(&blit), u8g2_GetBufferPtr(&ref), size);
+
+        if (i % 3 == 0) {
+            int cx = std::rand() % 32, cy = std::rand() % 32;
+            u8g2_SetClipWindow(&ref, cx, cy, cx + 64, cy + 48);
+            u8g2_SetClipWindow(&blit, cx, cy, cx + 64, cy + 48);
+        }
+
+        int width = 1 + std::rand() % 150;
+        int height = 1 + std::rand() % 100;
+        int x = std::rand() % 160 - 20;
+        int y = std::rand() % 120 - 20;
+        int mode = std::rand() % 4;
+        size_t stride = (i & 1) ? static_cast<size_t>(width) : ((width + 7) / 8) * 8;
+        std::vector<uint8_t> src((stride * height + 7) / 8);
+        for (auto &c : src)
+            c = static_cast<uint8_t>(std::rand());
+
+        ucgd_bitmap_t bitmap{src.data(), src.size(), width, height, stride};
+        U8g2Blit::blit(&blit, x, y, bitmap, mode);
+
+        for (int r = 0; r < height; r++) {
+            for (int c = 0; c < width; c++) {
+                size_t pos = r * stride + c;
+                bool on = (src[pos >> 3] & (0x80U >> (pos & 7))) != 0;
+                if (mode == BLIT_MODE_COPY) {
+                    u8g2_SetDrawColor(&ref, on ? 1 : 0);
+                } else if (on) {
+                    u8g2_SetDrawColor(&ref, static_cast<uint8_t>(mode));
+                } else {
+                    continue;
+                }
+                int px = x + c, py = y + r;
+                if (px < 0 || py < 0)
+                    continue;
+                u8g2_DrawPixel(&ref, static_cast<u8g2_uint_t>(px), static_cast<u8g2_uint_t>(py));
+            }
+        }
+
+        bool identical = std::memcmp(u8g2_GetBufferPtr(&ref), u8g2_GetBufferPtr(&blit), size) == 0;
+        if (!identical)
+            std::cerr << name << ": mismatch (iteration = " << i << ", mode = " << mode << ", x = " << x << ", y = " << y << ", width = " << width << ", height = " << height << ")" << std::endl;
+        EXPECT(identical);
+    }
+}
+
+int main() {
+    std::srand(1);
+    //vertical_top_lsb layout
+    compare(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", 500);
+    //horizontal_right_lsb layout
+    compare(u8g2_Setup_st7920_s_128x64_f, "st7920", 500);
+
+    return testResult("blit");
+}
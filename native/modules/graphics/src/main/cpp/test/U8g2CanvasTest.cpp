@@ -0,0 +1,181 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <U8g2Canvas.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static bool getCanvasPixel(const U8g2Canvas &canvas, int x, int y) {
+    ucgd_bitmap_t bitmap = canvas.getBitmap();
+    return (bitmap.data[y * (bitmap.stride_bits / 8) + (x >> 3)] >> (7 - (x & 7))) & 1;
+}
+
+//A scene drawn with user coordinates
+static void drawScene(u8g2_t *u8g2, int seed) {
+    std::srand(seed);
+    int w = u8g2_GetDisplayWidth(u8g2), h = u8g2_GetDisplayHeight(u8g2);
+    u8g2_ClearBuffer(u8g2);
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    for (int i = 0; i < 40; i++) {
+        auto x = static_cast<u8g2_uint_t>(std::rand() % w), y = static_cast<u8g2_uint_t>(std::rand() % h);
+        auto x2 = static_cast<u8g2_uint_t>(std::rand() % w), y2 = static_cast<u8g2_uint_t>(std::rand() % h);
+        switch (i % 4) {
+            case 0: u8g2_DrawBox(u8g2, x, y, 1 + std::rand() % 20, 1 + std::rand() % 20); break;
+            case 1: u8g2_DrawLine(u8g2, x, y, x2, y2); break;
+            case 2: u8g2_DrawDisc(u8g2, x, y, 1 + std::rand() % 8, U8G2_DRAW_ALL); break;
+            default: u8g2_DrawPixel(u8g2, x, y); break;
+        }
+    }
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_DrawStr(u8g2, 2, 20, "Canvas");
+}
+
+/**
+ * A canvas rendered once and copied into a display must give the same buffer as drawing on the display
+ */
+static void compareMirror(setup_proc_t setup, const char *name, const u8g2_cb_t *rotation) {
+    u8g2_t ref, display, canvasU8g2;
+    setup(&ref, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    setup(&display, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    //the setup procedures share a static buffer
+    size_t size = 8 * u8g2_GetBufferTileWidth(&ref) * u8g2_GetBufferTileHeight(&ref);
+    std::vector<uint8_t> refBuffer(size), displayBuffer(size, 0xa5);
+    u8g2_SetBufferPtr(&ref, refBuffer.data());
+    u8g2_SetBufferPtr(&display, displayBuffer.data());
+
+    U8g2Canvas canvas(&canvasU8g2, u8g2_GetDisplayWidth(&ref), u8g2_GetDisplayHeight(&ref));
+    EXPECT(u8g2_GetDisplayWidth(&canvasU8g2) == u8g2_GetDisplayWidth(&ref));
+    EXPECT(u8g2_GetDisplayHeight(&canvasU8g2) == u8g2_GetDisplayHeight(&ref));
+
+    drawScene(&ref, 11);
+    drawScene(&canvasU8g2, 11);
+    canvas.blit(&display, 0, 0, canvas.getWidth(), canvas.getHeight(), 0, 0);
+
+    bool identical = refBuffer == displayBuffer;
+    if (!identical)
+        std::cerr << name << ": mirrored canvas mismatch" << std::endl;
+    EXPECT(identical);
+}
+
+/**
+ * One large canvas spanned across a grid of displays, each display shows its part of the canvas
+ */
+static void compareSpan(setup_proc_t setup, const char *name, bool vertical, int columns, int rows) {
+    u8g2_t first;
+    setup(&first, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    int width = u8g2_GetDisplayWidth(&first), height = u8g2_GetDisplayHeight(&first);
+    int tileWidth = u8g2_GetBufferTileWidth(&first);
+
+    u8g2_t canvasU8g2;
+    U8g2Canvas canvas(&canvasU8g2, width * columns, height * rows);
+    drawScene(&canvasU8g2, 5);
+
+    for (int row = 0; row < rows; row++) {
+        for (int column = 0; column < columns; column++) {
+            u8g2_t display;
+            setup(&display, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+            std::vector<uint8_t> buffer(8 * tileWidth * u8g2_GetBufferTileHeight(&display));
+            u8g2_SetBufferPtr(&display, buffer.data());
+            canvas.blit(&display, column * width, row * height, width, height, 0, 0);
+
+            bool identical = true;
+            for (int y = 0; y < height && identical; y++) {
+                for (int x = 0; x < width; x++) {
+                    if (getPixel(buffer.data(), tileWidth, vertical, x, y) != getCanvasPixel(canvas, column * width + x, row * height + y)) {
+                        std::cerr << name << ": display " << column << "," << row << " mismatch at " << x << "," << y << std::endl;
+                        identical = false;
+                        break;
+                    }
+                }
+            }
+            EXPECT(identical);
+        }
+    }
+}
+
+/**
+ * Copy random areas (any pixel position) into a random display buffer, pixels outside of the area are left untouched
+ */
+static void compareCrop(setup_proc_t setup, const char *name, bool vertical) {
+    u8g2_t display, canvasU8g2;
+    setup(&display, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    int width = u8g2_GetDisplayWidth(&display), height = u8g2_GetDisplayHeight(&display);
+    int tileWidth = u8g2_GetBufferTileWidth(&display);
+    std::vector<uint8_t> buffer(8 * tileWidth * u8g2_GetBufferTileHeight(&display));
+    u8g2_SetBufferPtr(&display, buffer.data());
+
+    U8g2Canvas canvas(&canvasU8g2, 203, 97);
+    drawScene(&canvasU8g2, 3);
+
+    for (int i = 0; i < 200; i++) {
+        for (auto &b : buffer)
+            b = static_cast<uint8_t>(std::rand());
+        auto before = buffer;
+        int srcX = std::rand() % 220 - 10, srcY = std::rand() % 110 - 10;
+        int w = std::rand() % 140, h = std::rand() % 80;
+        int x = std::rand() % (width + 20) - 10, y = std::rand() % (height + 20) - 10;
+        canvas.blit(&display, srcX, srcY, w, h, x, y);
+
+        bool identical = true;
+        for (int py = 0; py < height && identical; py++) {
+            for (int px = 0; px < width; px++) {
+                int cx = px - x + srcX, cy = py - y + srcY;
+                bool inside = px >= x && px < x + w && py >= y && py < y + h && cx >= 0 && cy >= 0 && cx < canvas.getWidth() && cy < canvas.getHeight();
+                bool expected = inside ? getCanvasPixel(canvas, cx, cy) : getPixel(before.data(), tileWidth, vertical, px, py);
+                if (getPixel(buffer.data(), tileWidth, vertical, px, py) != expected) {
+                    std::cerr << name << ": crop " << srcX << "," << srcY << " " << w << "x" << h << " to " << x << "," << y << " mismatch at " << px << "," << py << std::endl;
+                    identical = false;
+                    break;
+                }
+            }
+        }
+        EXPECT(identical);
+        if (!identical)
+            return;
+    }
+}
+
+int main() {
+    const u8g2_cb_t *const rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3, U8G2_MIRROR};
+    for (const u8g2_cb_t *rotation : rotations) {
+        //vertical_top_lsb layout
+        compareMirror(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", rotation);
+        //horizontal_right_lsb layout
+        compareMirror(u8g2_Setup_st7920_s_128x64_f, "st7920", rotation);
+    }
+    compareSpan(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", true, 3, 2);
+    compareSpan(u8g2_Setup_st7920_s_128x64_f, "st7920", false, 2, 2);
+    compareCrop(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", true);
+    compareCrop(u8g2_Setup_st7920_s_128x64_f, "st7920", false);
+
+    //the canvas buffer is the frame drawn on a display with the same layout
+    u8g2_t st7920, canvasU8g2;
+    u8g2_Setup_st7920_s_128x64_f(&st7920, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    U8g2Canvas canvas(&canvasU8g2, 128, 64);
+    drawScene(&st7920, 9);
+    drawScene(&canvasU8g2, 9);
+    EXPECT(std::memcmp(canvas.getBitmap().data, u8g2_GetBufferPtr(&st7920), canvas.getBitmap().length) == 0);
+
+    //size limits
+    const int sizes[][2] = {{0, 10}, {10, 0}, {-1, 10}, {CANVAS_MAX_SIZE + 1, 10}, {10, CANVAS_MAX_SIZE + 1}};
+    for (const auto &s : sizes) {
+        bool thrown = false;
+        try {
+            u8g2_t invalid;
+            U8g2Canvas c(&invalid, s[0], s[1]);
+        } catch (std::runtime_error &e) {
+            thrown = true;
+        }
+        EXPECT(thrown);
+    }
+    u8g2_t large;
+    U8g2Canvas largeCanvas(&large, CANVAS_MAX_SIZE, 1);
+    EXPECT(u8g2_GetDisplayWidth(&large) == CANVAS_MAX_SIZE);
+
+    return testResult("canvas");
+}
@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2DisplayList.h>
+#include <U8g2GlyphCache.h>
+#include <U8g2Sprites.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+struct setup_variant_t {
+    setup_proc_t full;
+    setup_proc_t page1;
+    setup_proc_t page2;
+    const char *name;
+};
+
+static const uint8_t xbm[] = {0xff, 0x81, 0x81, 0x99, 0x99, 0x81, 0x81, 0xff};
+
+static size_t frameSize(u8g2_t *u8g2) {
+    return 8 * u8g2_GetBufferTileWidth(u8g2) * u8g2_GetU8x8(u8g2)->display_info->tile_height;
+}
+
+/**
+ * Draw the test scene directly (list == nullptr) or record it
+ */
+static void scene(u8g2_t *u8g2, U8g2GlyphCache &glyphs, U8g2Sprites &sprites, uint32_t sprite, U8g2DisplayList *list) {
+    auto w = static_cast<int>(u8g2_GetDisplayWidth(u8g2));
+    auto h = static_cast<int>(u8g2_GetDisplayHeight(u8g2));
+    if (list != nullptr) {
+        list->add(DL_OP_FRAME, 0, 0, w, h);
+        list->add(DL_OP_BOX, 4, 4, w / 3, h / 3);
+        list->add(DL_OP_DRAW_COLOR, 2);
+        list->add(DL_OP_DISC, w / 2, h / 2, h / 3, U8G2_DRAW_ALL);
+        list->add(DL_OP_LINE, 0, h - 1, w - 1, 0);
+        list->add(DL_OP_TRIANGLE, 10, h - 10, w / 2, h / 2, w - 10, h - 4);
+        list->add(DL_OP_DRAW_COLOR, 1);
+        list->add(DL_OP_RFRAME, w / 2, 2, w / 3, h / 4, 3);
+        list->add(DL_OP_ELLIPSE, w / 4, (3 * h) / 4, w / 6, h / 8, U8G2_DRAW_ALL);
+        list->add(DL_OP_HLINE, 2, h / 2, w - 4);
+        list->add(DL_OP_VLINE, w / 3, 2, h - 4);
+        list->add(DL_OP_PIXEL, w - 3, h - 3);
+        list->addFont(u8g2_font_6x10_tf);
+        list->add(DL_OP_FONT_POS, DL_FONT_POS_TOP);
+        const char str[] = "Page 1/2/f";
+        list->addData(DL_OP_STR, str, sizeof(str), 6, h / 2 - 4);
+        list->add(DL_OP_FONT_MODE, 1);
+        list->add(DL_OP_GLYPH, w - 20, 12, 'Q');
+        list->add(DL_OP_CLIP_WINDOW, 0, 0, w / 2, h / 2);
+        list->add(DL_OP_FILLED_ELLIPSE, w / 2, h / 2, w / 4, h / 4, U8G2_DRAW_ALL);
+        list->add(DL_OP_MAX_CLIP_WINDOW);
+        list->addData(DL_OP_XBM, xbm, sizeof(xbm), w - 12, h - 12, 8, 8);
+        list->add(DL_OP_SPRITE, static_cast<int32_t>(sprite), 3, h - 13);
+        return;
+    }
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    u8g2_DrawBox(u8g2, 4, 4, w / 3, h / 3);
+    u8g2_SetDrawColor(u8g2, 2);
+    u8g2_DrawDisc(u8g2, w / 2, h / 2, h / 3, U8G2_DRAW_ALL);
+    u8g2_DrawLine(u8g2, 0, h - 1, w - 1, 0);
+    u8g2_DrawTriangle(u8g2, 10, h - 10, w / 2, h / 2, w - 10, h - 4);
+    u8g2_SetDrawColor(u8g2, 1);
+    u8g2_DrawRFrame(u8g2, w / 2, 2, w / 3, h / 4, 3);
+    u8g2_DrawEllipse(u8g2, w / 4, (3 * h) / 4, w / 6, h / 8, U8G2_DRAW_ALL);
+    u8g2_DrawHLine(u8g2, 2, h / 2, w - 4);
+    u8g2_DrawVLine(u8g2, w / 3, 2, h - 4);
+    u8g2_DrawPixel(u8g2, w - 3, h - 3);
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_SetFontPosTop(u8g2);
+    glyphs.drawString(u8g2, 6, h / 2 - 4, "Page 1/2/f", false);
+    u8g2_SetFontMode(u8g2, 1);
+    glyphs.drawGlyph(u8g2, w - 20, 12, 'Q');
+    u8g2_SetClipWindow(u8g2, 0, 0, w / 2, h / 2);
+    u8g2_DrawFilledEllipse(u8g2, w / 2, h / 2, w / 4, h / 4, U8G2_DRAW_ALL);
+    u8g2_SetMaxClipWindow(u8g2);
+    u8g2_DrawXBM(u8g2, w - 12, h - 12, 8, 8, xbm);
+    sprites.draw(u8g2, sprite, 3, h - 13);
+}
+
+static void resetState(u8g2_t *u8g2) {
+    u8g2_SetFont(u8g2, u8g2_font_5x7_tr);
+    u8g2_SetFontPosBaseline(u8g2);
+    u8g2_SetFontMode(u8g2, 0);
+    u8g2_SetDrawColor(u8g2, 1);
+    u8g2_SetBitmapMode(u8g2, 0);
+    u8g2_SetMaxClipWindow(u8g2);
+}
+
+/**
+ * Render the recorded scene with the page buffer variants and compare the assembled pages with the full buffer
+ */
+static void comparePages(const setup_variant_t &variant) {
+    u8g2_t ref;
+    U8g2GlyphCache refGlyphs;
+    U8g2Sprites refSprites;
+    uint32_t refSprite = refSprites.upload(xbm, sizeof(xbm), 8, 8, SPRITE_FORMAT_XBM);
+    variant.full(&ref, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    resetState(&ref);
+    u8g2_ClearBuffer(&ref);
+    scene(&ref, refGlyphs, refSprites, refSprite, nullptr);
+    size_t size = frameSize(&ref);
+
+    for (setup_proc_t setup : {variant.page1, variant.page2, variant.full}) {
+        u8g2_t u8g2;
+        U8g2GlyphCache glyphs;
+        U8g2Sprites sprites;
+        U8g2DisplayList list;
+        uint32_t sprite = sprites.upload(xbm, sizeof(xbm), 8, 8, SPRITE_FORMAT_XBM);
+        setup(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+        resetState(&u8g2);
+
+        list.begin(&u8g2);
+        EXPECT(list.isRecording());
+        EXPECT(U8g2DisplayList::isAnyRecording());
+        scene(&u8g2, glyphs, sprites, sprite, &list);
+        list.end();
+        EXPECT(!list.isRecording());
+
+        std::vector<uint8_t> frame(size, 0);
+        size_t pageSize = 8 * u8g2_GetBufferTileWidth(&u8g2) * u8g2.tile_buf_height;
+        int expectedPages = (u8g2_GetU8x8(&u8g2)->display_info->tile_height + u8g2.tile_buf_height - 1) / u8g2.tile_buf_height;
+        int pages = list.render(&u8g2, &glyphs, &sprites, [&]() {
+            //both buffer layouts store whole tile rows, the page starts at the current tile row
+            size_t offset = 8 * u8g2_GetBufferTileWidth(&u8g2) * u8g2.tile_curr_row;
+            std::memcpy(frame.data() + offset, u8g2_GetBufferPtr(&u8g2), std::min(pageSize, size - offset));
+        });
+        EXPECT(pages == expectedPages);
+
+        bool identical = std::memcmp(frame.data(), u8g2_GetBufferPtr(&ref), size) == 0;
+        if (!identical)
+            std::cerr << variant.name << ": mismatch (tile rows per page = " << static_cast<int>(u8g2.tile_buf_height) << ")" << std::endl;
+        EXPECT(identical);
+        //the display is left with the state at the end of the list
+        EXPECT(u8g2.draw_color == 1);
+        EXPECT(u8g2.font == u8g2_font_6x10_tf);
+    }
+}
+
+void testStateRestoredForEachPage() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_1(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_SetDrawColor(&u8g2, 1);
+
+    //the color change at the end of the list must not leak into the next page
+    U8g2DisplayList list;
+    list.begin(&u8g2);
+    list.add(DL_OP_BOX, 0, 0, 128, 64);
+    list.add(DL_OP_DRAW_COLOR, 0);
+    list.end();
+
+    int filledPages = 0;
+    int pages = list.render(&u8g2, nullptr, nullptr, [&]() {
+        filledPages += u8g2_GetBufferPtr(&u8g2)[0] == 0xff ? 1 : 0;
+    });
+    EXPECT(pages == 8);
+    EXPECT(filledPages == 8);
+    EXPECT(u8g2.draw_color == 0);
+}
+
+void testRecordingLifecycle() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    {
+        U8g2DisplayList list;
+        list.begin(&u8g2);
+        list.add(DL_OP_PIXEL, 1, 1);
+        list.add(DL_OP_PIXEL, 2, 2);
+        EXPECT(list.getCount() == 2);
+        //begin discards the previous operations
+        list.begin(&u8g2);
+        EXPECT(list.getCount() == 0);
+        EXPECT(U8g2DisplayList::isAnyRecording());
+
+        //identical font data shares the same copy
+        std::vector<uint8_t> font(u8g2_font_6x10_tf, u8g2_font_6x10_tf + 256);
+        const uint8_t *first = list.addFontData(font.data(), font.size());
+        const uint8_t *second = list.addFontData(font.data(), font.size());
+        EXPECT(first == second);
+        EXPECT(first != font.data());
+        EXPECT(list.getCount() == 2);
+        EXPECT(list.getSize() >= font.size());
+    }
+    //destroying a list that is still recording releases the global flag
+    EXPECT(!U8g2DisplayList::isAnyRecording());
+}
+
+int main() {
+    //vertical_top_lsb layout
+    comparePages({u8g2_Setup_ssd1306_128x64_noname_f, u8g2_Setup_ssd1306_128x64_noname_1, u8g2_Setup_ssd1306_128x64_noname_2, "ssd1306"});
+    //horizontal_right_lsb layout, 400x240
+    comparePages({u8g2_Setup_ls027b7dh01_400x240_f, u8g2_Setup_ls027b7dh01_400x240_1, u8g2_Setup_ls027b7dh01_400x240_2, "ls027b7dh01"});
+    testStateRestoredForEachPage();
+    testRecordingLifecycle();
+
+    return testResult("display list");
+}
@@ -0,0 +1,147 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2Dither.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static std::vector<uint8_t> solid(int width, int height, uint8_t b, uint8_t g, uint8_t r, uint8_t a) {
+    std::vector<uint8_t> image(static_cast<size_t>(width) * height * 4);
+    for (size_t i = 0; i < image.size(); i += 4) {
+        image[i] = b;
+        image[i + 1] = g;
+        image[i + 2] = r;
+        image[i + 3] = a;
+    }
+    return image;
+}
+
+static size_t countBits(const std::vector<uint8_t> &bits) {
+    size_t count = 0;
+    for (uint8_t b : bits) {
+        for (; b != 0; b &= static_cast<uint8_t>(b - 1))
+            count++;
+    }
+    return count;
+}
+
+/**
+ * The SIMD kernels must produce the same output as the scalar reference (including the tail of odd counts)
+ */
+void testKernelsMatchScalar() {
+    for (int i = 0; i < 200; i++) {
+        size_t count = 1 + std::rand() % 300;
+        std::vector<uint8_t> bgra(count * 4), thresholds(count);
+        for (auto &c : bgra)
+            c = static_cast<uint8_t>(std::rand());
+        for (auto &c : thresholds)
+            c = static_cast<uint8_t>(std::rand());
+
+        std::vector<uint8_t> luma(count), lumaRef(count);
+        U8g2Dither::luma(bgra.data(), luma.data(), count);
+        U8g2Dither::lumaScalar(bgra.data(), lumaRef.data(), count);
+        EXPECT(luma == lumaRef);
+
+        std::vector<uint8_t> bits((count + 7) / 8), bitsRef((count + 7) / 8);
+        U8g2Dither::threshold(luma.data(), thresholds.data(), bits.data(), count);
+        U8g2Dither::thresholdScalar(luma.data(), thresholds.data(), bitsRef.data(), count);
+        EXPECT(bits == bitsRef);
+    }
+}
+
+void testThresholdGradient() {
+    std::vector<uint8_t> image(256 * 4);
+    for (int x = 0; x < 256; x++) {
+        image[x * 4] = image[x * 4 + 1] = image[x * 4 + 2] = static_cast<uint8_t>(x);
+        image[x * 4 + 3] = 0xff;
+    }
+    U8g2Dither dither(DITHER_THRESHOLD, 127);
+    std::vector<uint8_t> out;
+    size_t stride = dither.convert({image.data(), image.size(), 256, 1, 256 * 4}, out);
+    EXPECT(stride == 32);
+    //gray levels are preserved by the luma weights, only x > 127 is set
+    for (int x = 0; x < 256; x++)
+        EXPECT(((out[x >> 3] & (0x80U >> (x & 7))) != 0) == (x > 127));
+}
+
+void testTransparentIsBlack() {
+    std::vector<uint8_t> image = solid(20, 3, 0xff, 0xff, 0xff, 0);
+    U8g2Dither dither(DITHER_THRESHOLD, 127);
+    std::vector<uint8_t> out;
+    dither.convert({image.data(), image.size(), 20, 3, 20 * 4}, out);
+    EXPECT(countBits(out) == 0);
+}
+
+void testOrderedCoverage() {
+    //mid gray sets exactly half of the matrix cells
+    std::vector<uint8_t> image = solid(64, 64, 128, 128, 128, 0xff);
+    std::vector<uint8_t> out;
+    U8g2Dither bayer4(DITHER_BAYER4);
+    bayer4.convert({image.data(), image.size(), 64, 64, 64 * 4}, out);
+    EXPECT(countBits(out) == 64 * 64 / 2);
+    U8g2Dither bayer8(DITHER_BAYER8);
+    bayer8.convert({image.data(), image.size(), 64, 64, 64 * 4}, out);
+    EXPECT(countBits(out) == 64 * 64 / 2);
+}
+
+void testDiffusionCoverage() {
+    std::vector<uint8_t> image = solid(64, 64, 64, 64, 64, 0xff);
+    std::vector<uint8_t> out;
+    //a quarter gray should set roughly a quarter of the pixels
+    U8g2Dither floyd(DITHER_FLOYD_STEINBERG);
+    floyd.convert({image.data(), image.size(), 64, 64, 64 * 4}, out);
+    size_t bits = countBits(out);
+    EXPECT(bits > 64 * 64 / 5 && bits < 64 * 64 * 3 / 10);
+    //atkinson only propagates 3/4 of the error, dark areas get lighter coverage
+    U8g2Dither atkinson(DITHER_ATKINSON);
+    atkinson.convert({image.data(), image.size(), 64, 64, 64 * 4}, out);
+    bits = countBits(out);
+    EXPECT(bits > 64 * 64 / 10 && bits < 64 * 64 / 4);
+}
+
+void testLegacyAndShortBuffer() {
+    std::vector<uint8_t> image(10 * 4 * 4, 0);
+    //non-zero alpha only still counts as set in legacy mode
+    image[3] = 1;
+    image[(10 + 9) * 4] = 0xff;
+    U8g2Dither dither;
+    std::vector<uint8_t> out;
+    //the last two rows are missing from the buffer
+    size_t stride = dither.convert({image.data(), 10 * 2 * 4 + 8, 10, 4, 10 * 4}, out);
+    EXPECT(stride == 2);
+    EXPECT(out.size() == 8);
+    EXPECT(out[0] == 0x80 && out[1] == 0);
+    EXPECT(out[2] == 0 && out[3] == 0x40);
+    EXPECT(countBits(out) == 2);
+}
+
+void testDrawIsOpaque() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    size_t size = 8 * u8g2_GetBufferTileHeight(&u8g2) * u8g2_GetBufferTileWidth(&u8g2);
+    std::memset(u8g2_GetBufferPtr(&u8g2), 0xff, size);
+    std::vector<uint8_t> image = solid(16, 8, 0, 0, 0, 0xff);
+    U8g2Dither dither(DITHER_BAYER4);
+    dither.draw(&u8g2, 0, 0, {image.data(), image.size(), 16, 8, 16 * 4});
+    //the first page of the first 16 columns is cleared, the rest is untouched
+    for (int x = 0; x < 16; x++)
+        EXPECT(u8g2_GetBufferPtr(&u8g2)[x] == 0);
+    EXPECT(u8g2_GetBufferPtr(&u8g2)[16] == 0xff);
+}
+
+int main() {
+    std::srand(1);
+    testKernelsMatchScalar();
+    testThresholdGradient();
+    testTransparentIsBlack();
+    testOrderedCoverage();
+    testDiffusionCoverage();
+    testLegacyAndShortBuffer();
+    testDrawIsOpaque();
+
+    return testResult("dither");
+}
@@ -0,0 +1,223 @@
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <U8g2Emulator.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static U8g2Emulator *s_Emulator = nullptr;
+
+static uint8_t emulatorByteCb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    if (s_Emulator != nullptr)
+        s_Emulator->feed(msg, arg_int, arg_ptr);
+    return 1;
+}
+
+static void scene(u8g2_t *u8g2) {
+    auto w = static_cast<int>(u8g2_GetDisplayWidth(u8g2));
+    auto h = static_cast<int>(u8g2_GetDisplayHeight(u8g2));
+    u8g2_ClearBuffer(u8g2);
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    u8g2_DrawBox(u8g2, 3, 3, w / 4, h / 3);
+    u8g2_DrawDisc(u8g2, w / 2, h / 2, h / 4, U8G2_DRAW_ALL);
+    u8g2_DrawLine(u8g2, 0, h - 1, w - 1, 0);
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_DrawStr(u8g2, 4, h - 4, "Emu");
+    u8g2_DrawPixel(u8g2, w - 2, 1);
+}
+
+/**
+ * Run the startup sequence and a full frame of the setup procedure through the emulator, the raw emulated ram must
+ * match the u8g2 buffer
+ */
+static void testWireProtocol(setup_proc_t setup, const char *name) {
+    u8g2_t u8g2;
+    setup(&u8g2, U8G2_R0, emulatorByteCb, u8x8_dummy_cb);
+    u8x8_t *u8x8 = u8g2_GetU8x8(&u8g2);
+    std::unique_ptr<U8g2Emulator> emulator = U8g2Emulator::create(name, u8x8->display_info->pixel_width, u8x8->display_info->pixel_height);
+    EXPECT(emulator != nullptr);
+    if (!emulator)
+        return;
+    s_Emulator = emulator.get();
+    u8g2_InitDisplay(&u8g2);
+    u8g2_SetPowerSave(&u8g2, 0);
+    u8g2_SetContrast(&u8g2, 0x42);
+    u8g2_ClearDisplay(&u8g2);
+    scene(&u8g2);
+    u8g2_SendBuffer(&u8g2);
+    s_Emulator = nullptr;
+
+    size_t size = 8 * u8g2_GetBufferTileWidth(&u8g2) * u8x8->display_info->tile_height;
+    EXPECT(emulator->getImageSize() == size);
+    std::vector<uint8_t> image(size, 0xaa);
+    EXPECT(emulator->getImage(image.data(), image.size(), u8x8->x_offset, false) == size);
+    bool same = std::memcmp(image.data(), u8g2_GetBufferPtr(&u8g2), size) == 0;
+    if (!same)
+        std::cerr << "Image mismatch for " << name << std::endl;
+    EXPECT(same);
+
+    //display on and not inverted, so the effects do not change the image
+    std::vector<uint8_t> shown(size);
+    emulator->getImage(shown.data(), shown.size(), u8x8->x_offset, true);
+    EXPECT(shown == image);
+
+    int64_t stats[EMU_STATS_COUNT];
+    EXPECT(emulator->snapshot(stats, EMU_STATS_COUNT) == EMU_STATS_COUNT);
+    EXPECT(stats[EMU_STATS_UNKNOWN] == 0);
+    EXPECT(stats[EMU_STATS_DROPPED] == 0);
+    EXPECT(stats[EMU_STATS_DISPLAY_ON] == 1);
+    EXPECT(stats[EMU_STATS_DATA_BYTES] >= static_cast<int64_t>(size));
+    EXPECT(stats[EMU_STATS_COMMANDS] > 0);
+    EXPECT(stats[EMU_STATS_TRANSFERS] > 0);
+    EXPECT(stats[EMU_STATS_ADDRESS_SETS] > 0);
+}
+
+static void feedCommands(U8g2Emulator &emulator, std::initializer_list<uint8_t> bytes) {
+    std::vector<uint8_t> data(bytes);
+    emulator.feed(U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    emulator.feed(U8X8_MSG_BYTE_SET_DC, 0, nullptr);
+    emulator.feed(U8X8_MSG_BYTE_SEND, static_cast<uint8_t>(data.size()), data.data());
+    emulator.feed(U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+}
+
+static void feedData(U8g2Emulator &emulator, const std::vector<uint8_t> &data) {
+    emulator.feed(U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    emulator.feed(U8X8_MSG_BYTE_SET_DC, 1, nullptr);
+    emulator.feed(U8X8_MSG_BYTE_SEND, static_cast<uint8_t>(data.size()), data.data());
+    emulator.feed(U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+}
+
+static void testSsd1306HorizontalAddressing() {
+    auto emulator = U8g2Emulator::create("u8g2_Setup_ssd1306_128x64_noname_f", 128, 64);
+    auto *page = dynamic_cast<U8g2PageEmulator *>(emulator.get());
+    EXPECT(page != nullptr);
+    if (page == nullptr)
+        return;
+    //horizontal addressing over columns 10-11 and pages 2-3, the fifth byte wraps back to the start
+    feedCommands(*page, {0x20, 0x00, 0x21, 10, 11, 0x22, 2, 3});
+    feedData(*page, {1, 2, 3, 4, 5});
+    EXPECT(page->ramAt(10, 2) == 5);
+    EXPECT(page->ramAt(11, 2) == 2);
+    EXPECT(page->ramAt(10, 3) == 3);
+    EXPECT(page->ramAt(11, 3) == 4);
+    int64_t stats[EMU_STATS_COUNT];
+    page->snapshot(stats, EMU_STATS_COUNT);
+    EXPECT(stats[EMU_STATS_COMMANDS] == 3);
+    EXPECT(stats[EMU_STATS_ARGUMENTS] == 5);
+    EXPECT(stats[EMU_STATS_DATA_BYTES] == 5);
+    EXPECT(stats[EMU_STATS_ADDRESS_SETS] == 2);
+
+    //page addressing wraps within the page
+    feedCommands(*page, {0x20, 0x02, 0xb5, 0x17, 0x0f});
+    feedData(*page, {0x11, 0x22});
+    EXPECT(page->ramAt(127, 5) == 0x11);
+    EXPECT(page->ramAt(0, 5) == 0x22);
+}
+
+static void testEffects() {
+    auto emulator = U8g2Emulator::create("u8g2_Setup_ssd1306_128x64_noname_f", 128, 64);
+    std::vector<uint8_t> image(emulator->getImageSize());
+    feedCommands(*emulator, {0xb0, 0x10, 0x00});
+    feedData(*emulator, {0x81});
+
+    //display off shows nothing, the raw ram is still readable
+    emulator->getImage(image.data(), image.size(), 0, true);
+    EXPECT(image[0] == 0x00);
+    emulator->getImage(image.data(), image.size(), 0, false);
+    EXPECT(image[0] == 0x81);
+
+    feedCommands(*emulator, {0xaf, 0xa7});
+    emulator->getImage(image.data(), image.size(), 0, true);
+    EXPECT(image[0] == 0x7e);
+    EXPECT(image[1] == 0xff);
+
+    //start line 1 moves ram row 1 to the top and ram row 0 to the bottom
+    feedCommands(*emulator, {0xa6, 0x41});
+    emulator->getImage(image.data(), image.size(), 0, true);
+    EXPECT(image[0] == 0x40);
+    EXPECT(image[7 * 128] == 0x80);
+
+    feedCommands(*emulator, {0x40, 0xa5});
+    emulator->getImage(image.data(), image.size(), 0, true);
+    EXPECT(image[5] == 0xff);
+
+    int64_t stats[EMU_STATS_COUNT];
+    emulator->snapshot(stats, EMU_STATS_COUNT);
+    EXPECT(stats[EMU_STATS_DISPLAY_ON] == 1);
+    EXPECT(stats[EMU_STATS_INVERTED] == 0);
+    EXPECT(stats[EMU_STATS_CONTRAST] == -1);
+    emulator->reset();
+    emulator->snapshot(stats, EMU_STATS_COUNT);
+    EXPECT(stats[EMU_STATS_COMMANDS] == 0);
+    EXPECT(stats[EMU_STATS_DISPLAY_ON] == 1);
+}
+
+static void testI2cControlBytes() {
+    auto emulator = U8g2Emulator::create("u8g2_Setup_ssd1306_i2c_128x64_noname_f", 128, 64);
+    auto *page = dynamic_cast<U8g2PageEmulator *>(emulator.get());
+    //single command with continuation, then a command stream, then data
+    std::vector<uint8_t> bytes = {0x80, 0xb3, 0x00, 0x10, 0x04, 0x40, 0x5a, 0xa5};
+    page->feed(U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    page->feed(U8X8_MSG_BYTE_SEND, 5, bytes.data());
+    page->feed(U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+    page->feed(U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    page->feed(U8X8_MSG_BYTE_SEND, 3, bytes.data() + 5);
+    page->feed(U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+    EXPECT(page->ramAt(4, 3) == 0x5a);
+    EXPECT(page->ramAt(5, 3) == 0xa5);
+    int64_t stats[EMU_STATS_COUNT];
+    page->snapshot(stats, EMU_STATS_COUNT);
+    EXPECT(stats[EMU_STATS_COMMANDS] == 3);
+    EXPECT(stats[EMU_STATS_DATA_BYTES] == 2);
+    EXPECT(stats[EMU_STATS_TRANSFERS] == 2);
+}
+
+static void testSt7920SerialFraming() {
+    auto emulator = U8g2Emulator::create("u8g2_Setup_st7920_s_128x64_f", 128, 64);
+    EXPECT(dynamic_cast<U8g2St7920Emulator *>(emulator.get()) != nullptr);
+    //extended mode with graphics on, display on, gdram row 3 word 8 (lower half) and two data bytes
+    std::vector<uint8_t> bytes = {0xf8, 0x30, 0x80, 0xf8, 0x00, 0xc0, 0xf8, 0x30, 0x60, 0xf8, 0x80, 0x30, 0xf8, 0x80, 0x80,
+                                  0xfa, 0xa0, 0x50, 0x30, 0xc0};
+    emulator->feed(U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    emulator->feed(U8X8_MSG_BYTE_SEND, static_cast<uint8_t>(bytes.size()), bytes.data());
+    emulator->feed(U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+    std::vector<uint8_t> image(emulator->getImageSize());
+    emulator->getImage(image.data(), image.size(), 0, true);
+    EXPECT(image[(32 + 3) * 16] == 0xa5);
+    EXPECT(image[(32 + 3) * 16 + 1] == 0x3c);
+    int64_t stats[EMU_STATS_COUNT];
+    emulator->snapshot(stats, EMU_STATS_COUNT);
+    EXPECT(stats[EMU_STATS_COMMANDS] == 5);
+    EXPECT(stats[EMU_STATS_DATA_BYTES] == 2);
+    EXPECT(stats[EMU_STATS_DISPLAY_ON] == 1);
+}
+
+static void testUnsupported() {
+    EXPECT(U8g2Emulator::create("u8g2_Setup_ssd1322_nhd_256x64_f", 256, 64) == nullptr);
+    EXPECT(U8g2Emulator::create("u8g2_Setup_st7565_64128n_f", 0, 64) == nullptr);
+    EXPECT(U8g2Emulator::create("u8g2_Setup_uc1701_mini12864_f", 128, 64) != nullptr);
+}
+
+int main() {
+    testWireProtocol(u8g2_Setup_ssd1306_128x64_noname_f, "u8g2_Setup_ssd1306_128x64_noname_f");
+    testWireProtocol(u8g2_Setup_ssd1306_i2c_128x64_noname_f, "u8g2_Setup_ssd1306_i2c_128x64_noname_f");
+    testWireProtocol(u8g2_Setup_ssd1306_72x40_er_f, "u8g2_Setup_ssd1306_72x40_er_f");
+    testWireProtocol(u8g2_Setup_sh1106_128x64_noname_f, "u8g2_Setup_sh1106_128x64_noname_f");
+    testWireProtocol(u8g2_Setup_sh1106_i2c_128x64_noname_f, "u8g2_Setup_sh1106_i2c_128x64_noname_f");
+    testWireProtocol(u8g2_Setup_st7565_64128n_f, "u8g2_Setup_st7565_64128n_f");
+    testWireProtocol(u8g2_Setup_uc1701_mini12864_f, "u8g2_Setup_uc1701_mini12864_f");
+    testWireProtocol(u8g2_Setup_st7920_s_128x64_f, "u8g2_Setup_st7920_s_128x64_f");
+    testWireProtocol(u8g2_Setup_st7920_p_128x64_f, "u8g2_Setup_st7920_p_128x64_f");
+    testWireProtocol(u8g2_Setup_st7920_s_192x32_f, "u8g2_Setup_st7920_s_192x32_f");
+    testSsd1306HorizontalAddressing();
+    testEffects();
+    testI2cControlBytes();
+    testSt7920SerialFraming();
+    testUnsupported();
+
+    return testResult("emulator");
+}
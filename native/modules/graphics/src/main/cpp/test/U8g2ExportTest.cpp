@@ -0,0 +1,158 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <U8g2Export.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+typedef void (*setup_proc_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+typedef void (*write_proc_t)(u8g2_t *u8g2, void (*out)(const char *s));
+
+static std::string captured;
+
+static void capture(const char *s) {
+    captured += s;
+}
+
+static std::vector<uint8_t> encode(u8g2_t *u8g2, int format) {
+    size_t size = U8g2Export::getSize(u8g2, format);
+    std::vector<uint8_t> output(size + 16, 0xcc);
+    EXPECT(U8g2Export::encode(u8g2, format, output.data(), size - 1) == 0);
+    size_t written = U8g2Export::encode(u8g2, format, output.data(), output.size());
+    EXPECT(written == size);
+    output.resize(written);
+    return output;
+}
+
+/**
+ * Pixels (one '0' or '1' per pixel, row by row) of the ASCII PBM written by u8g2
+ */
+static std::string referencePixels(u8g2_t *u8g2, write_proc_t writePbm) {
+    captured.clear();
+    writePbm(u8g2, capture);
+    std::istringstream in(captured);
+    std::string magic;
+    int width, height;
+    in >> magic >> width >> height;
+    std::string pixels;
+    char c;
+    while (in >> c) {
+        if (c == '0' || c == '1')
+            pixels += c;
+    }
+    return pixels;
+}
+
+static std::vector<uint8_t> referenceXbm(u8g2_t *u8g2, write_proc_t writeXbm) {
+    captured.clear();
+    writeXbm(u8g2, capture);
+    std::vector<uint8_t> bytes;
+    for (size_t pos = captured.find("0x"); pos != std::string::npos; pos = captured.find("0x", pos + 2))
+        bytes.push_back(static_cast<uint8_t>(std::strtoul(captured.substr(pos + 2, 2).c_str(), nullptr, 16)));
+    return bytes;
+}
+
+static std::string unpack(const uint8_t *data, size_t rowBytes, int width, int height, bool invert) {
+    std::string pixels;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            bool on = (data[y * rowBytes + (x >> 3)] & (0x80U >> (x & 7))) != 0;
+            pixels += (on != invert) ? '1' : '0';
+        }
+    }
+    return pixels;
+}
+
+static void compare(setup_proc_t setup, const char *name, write_proc_t writePbm, write_proc_t writeXbm) {
+    u8g2_t u8g2;
+    setup(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    size_t size = 8 * u8g2_GetBufferTileHeight(&u8g2) * u8g2_GetBufferTileWidth(&u8g2);
+    for (size_t b = 0; b < size; b++)
+        u8g2_GetBufferPtr(&u8g2)[b] = static_cast<uint8_t>(std::rand());
+
+    int width = u8g2_GetBufferTileWidth(&u8g2) * 8;
+    int height = u8g2_GetBufferTileHeight(&u8g2) * 8;
+    size_t rowBytes = width / 8;
+    std::string pixels = referencePixels(&u8g2, writePbm);
+    EXPECT(pixels.size() == static_cast<size_t>(width * height));
+
+    std::vector<uint8_t> raw = encode(&u8g2, EXPORT_FORMAT_RAW);
+    EXPECT(raw.size() == rowBytes * height);
+    bool rawMatches = unpack(raw.data(), rowBytes, width, height, false) == pixels;
+    if (!rawMatches)
+        std::cerr << name << ": raw export does not match u8g2" << std::endl;
+    EXPECT(rawMatches);
+
+    std::vector<uint8_t> pbm = encode(&u8g2, EXPORT_FORMAT_PBM);
+    std::string header = "P4\n" + std::to_string(width) + " " + std::to_string(height) + "\n";
+    EXPECT(pbm.size() == header.size() + raw.size());
+    EXPECT(std::memcmp(pbm.data(), header.data(), header.size()) == 0);
+    EXPECT(std::memcmp(pbm.data() + header.size(), raw.data(), raw.size()) == 0);
+
+    std::vector<uint8_t> xbm = encode(&u8g2, EXPORT_FORMAT_XBM);
+    std::string text(xbm.begin(), xbm.end());
+    std::vector<uint8_t> values;
+    for (size_t pos = text.find("0x"); pos != std::string::npos; pos = text.find("0x", pos + 2))
+        values.push_back(static_cast<uint8_t>(std::strtoul(text.substr(pos + 2, 2).c_str(), nullptr, 16)));
+    bool xbmMatches = values == referenceXbm(&u8g2, writeXbm);
+    if (!xbmMatches)
+        std::cerr << name << ": xbm export does not match u8g2" << std::endl;
+    EXPECT(xbmMatches);
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+/**
+ * Walk the chunks and unpack the stored deflate blocks
+ */
+void testPng() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_DrawBox(&u8g2, 3, 5, 40, 20);
+    std::vector<uint8_t> raw = encode(&u8g2, EXPORT_FORMAT_RAW);
+    std::vector<uint8_t> png = encode(&u8g2, EXPORT_FORMAT_PNG);
+
+    EXPECT(std::memcmp(png.data(), "\x89PNG\r\n\x1a\n", 8) == 0);
+    EXPECT(get32(png.data() + 8) == 13 && std::memcmp(png.data() + 12, "IHDR", 4) == 0);
+    EXPECT(get32(png.data() + 16) == 128 && get32(png.data() + 20) == 64);
+    EXPECT(png[24] == 1 && png[25] == 0);
+
+    size_t idat = 8 + 12 + 13;
+    EXPECT(std::memcmp(png.data() + idat + 4, "IDAT", 4) == 0);
+    const uint8_t *zlib = png.data() + idat + 8;
+    EXPECT(zlib[0] == 0x78 && ((zlib[0] << 8) | zlib[1]) % 31 == 0);
+    //a single stored block: final flag, length and its complement
+    size_t length = zlib[3] | (zlib[4] << 8);
+    EXPECT(zlib[2] == 1);
+    EXPECT(length == (16 + 1) * 64);
+    EXPECT(((zlib[5] | (zlib[6] << 8)) ^ 0xffff) == length);
+    const uint8_t *data = zlib + 7;
+    bool rowsMatch = true;
+    for (int y = 0; y < 64; y++) {
+        rowsMatch &= data[y * 17] == 0;
+        for (int b = 0; b < 16; b++)
+            rowsMatch &= static_cast<uint8_t>(~data[y * 17 + 1 + b]) == raw[y * 16 + b];
+    }
+    EXPECT(rowsMatch);
+    EXPECT(std::memcmp(png.data() + png.size() - 8, "IEND\xae\x42\x60\x82", 8) == 0);
+}
+
+int main() {
+    std::srand(1);
+    //vertical_top_lsb layout
+    compare(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", u8g2_WriteBufferPBM, u8g2_WriteBufferXBM);
+    //horizontal_right_lsb layout
+    compare(u8g2_Setup_st7920_s_128x64_f, "st7920", u8g2_WriteBufferPBM2, u8g2_WriteBufferXBM2);
+    testPng();
+
+    return testResult("export");
+}
@@ -0,0 +1,151 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2GlyphCache.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static const char *const strings[] = {"Hello, World!", "0123456789", "gjpqy |_^~", "AVAWAT", "{[()]}#%&@", "iIl1!"};
+
+struct font_case_t {
+    const uint8_t *font;
+    const char *name;
+};
+
+static const font_case_t fonts[] = {
+        {u8g2_font_6x10_tf, "6x10_tf"},
+        {u8g2_font_ncenB08_tr, "ncenB08_tr"},
+        {u8g2_font_helvB10_tf, "helvB10_tf"},
+};
+
+struct display_pair_t {
+    u8g2_t ref;
+    u8g2_t cached;
+    std::vector<uint8_t> refBuffer;
+    std::vector<uint8_t> cachedBuffer;
+};
+
+//Two instances of the same display with their own buffers (the setup procedures share a static buffer)
+static void setupPair(display_pair_t &pair, setup_proc_t setup) {
+    setup(&pair.ref, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    setup(&pair.cached, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    pair.refBuffer.assign(bufferSize(&pair.ref), 0);
+    pair.cachedBuffer.assign(bufferSize(&pair.cached), 0);
+    u8g2_SetBufferPtr(&pair.ref, pair.refBuffer.data());
+    u8g2_SetBufferPtr(&pair.cached, pair.cachedBuffer.data());
+}
+
+static void applyState(u8g2_t *u8g2, const uint8_t *font, uint8_t fontMode, uint8_t drawColor, uint8_t dir) {
+    u8g2_SetFont(u8g2, font);
+    u8g2_SetFontMode(u8g2, fontMode);
+    u8g2_SetDrawColor(u8g2, drawColor);
+    u8g2_SetFontDirection(u8g2, dir);
+}
+
+/**
+ * Draw the same strings with the cache and with u8g2_DrawStr and compare the buffers. Positions include strings
+ * crossing each edge of the display, the background is random so that solid and xor drawing are visible.
+ */
+static void compare(setup_proc_t setup, const char *name) {
+    display_pair_t pair;
+    setupPair(pair, setup);
+    EXPECT(U8g2GlyphCache::getLayout(&pair.cached) != GLYPH_LAYOUT_UNSUPPORTED);
+    int w = u8g2_GetDisplayWidth(&pair.ref), h = u8g2_GetDisplayHeight(&pair.ref);
+    const int edges[][2] = {{0, 0}, {w - 7, 10}, {5, h + 3}, {w - 3, h - 2}, {-20, 30}, {30, -4}, {w / 2, h / 2}};
+
+    std::srand(7);
+    for (const auto &font : fonts) {
+        for (uint8_t fontMode = 0; fontMode <= 1; fontMode++) {
+            for (uint8_t drawColor = 0; drawColor <= 2; drawColor++) {
+                //u8g2 does not support solid xor text
+                if (fontMode == 0 && drawColor == 2)
+                    continue;
+                for (uint8_t dir = 0; dir < 4; dir++) {
+                    U8g2GlyphCache cache;
+                    for (auto &b : pair.refBuffer)
+                        b = static_cast<uint8_t>(std::rand());
+                    pair.cachedBuffer = pair.refBuffer;
+                    applyState(&pair.ref, font.font, fontMode, drawColor, dir);
+                    applyState(&pair.cached, font.font, fontMode, drawColor, dir);
+                    EXPECT(U8g2GlyphCache::isSupported(&pair.cached));
+
+                    bool advances = true;
+                    int i = 0;
+                    for (const auto &edge : edges) {
+                        const char *s = strings[i++ % (sizeof(strings) / sizeof(*strings))];
+                        auto x = static_cast<u8g2_uint_t>(edge[0]), y = static_cast<u8g2_uint_t>(edge[1]);
+                        u8g2_uint_t expected = u8g2_DrawStr(&pair.ref, x, y, s);
+                        advances &= cache.drawString(&pair.cached, x, y, s, false) == expected;
+                    }
+                    for (int n = 0; n < 20; n++) {
+                        auto x = static_cast<u8g2_uint_t>(std::rand() % (w + 16) - 8);
+                        auto y = static_cast<u8g2_uint_t>(std::rand() % (h + 16) - 8);
+                        auto encoding = static_cast<uint16_t>(32 + std::rand() % 95);
+                        u8g2_uint_t expected = u8g2_DrawGlyph(&pair.ref, x, y, encoding);
+                        advances &= cache.drawGlyph(&pair.cached, x, y, encoding) == expected;
+                    }
+                    EXPECT(advances);
+
+                    if (pair.refBuffer != pair.cachedBuffer) {
+                        std::cerr << name << ": " << font.name << ", font mode = " << static_cast<int>(fontMode)
+                                  << ", draw color = " << static_cast<int>(drawColor) << ", direction = " << static_cast<int>(dir)
+                                  << ": mismatch" << std::endl;
+                        failures++;
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Glyphs clipped by a clip window, drawn again from the cache (hits) with a budget that forces evictions
+ */
+static void compareClipAndBudget(setup_proc_t setup, const char *name) {
+    display_pair_t pair;
+    setupPair(pair, setup);
+    int w = u8g2_GetDisplayWidth(&pair.ref), h = u8g2_GetDisplayHeight(&pair.ref);
+    U8g2GlyphCache cache(512);
+    for (int frame = 0; frame < 3; frame++) {
+        u8g2_ClearBuffer(&pair.ref);
+        u8g2_ClearBuffer(&pair.cached);
+        for (u8g2_t *u8g2 : {&pair.ref, &pair.cached}) {
+            applyState(u8g2, u8g2_font_helvB10_tf, frame == 1 ? 0 : 1, 1, 0);
+            u8g2_SetClipWindow(u8g2, 13, 5, w - 21, h - 9);
+        }
+        for (int i = 0; i < 6; i++) {
+            auto y = static_cast<u8g2_uint_t>(4 + i * 11);
+            u8g2_DrawStr(&pair.ref, static_cast<u8g2_uint_t>(i * 3), y, strings[i]);
+            cache.drawString(&pair.cached, static_cast<u8g2_uint_t>(i * 3), y, strings[i], false);
+        }
+        if (pair.refBuffer != pair.cachedBuffer) {
+            std::cerr << name << ": clipped frame " << frame << ": mismatch" << std::endl;
+            failures++;
+            return;
+        }
+    }
+    EXPECT(cache.getHits() > 0);
+    EXPECT(cache.getSize() <= cache.getBudget());
+}
+
+int main() {
+    //vertical_top_lsb layout
+    compare(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306");
+    //horizontal_right_lsb layout
+    compare(u8g2_Setup_st7920_s_128x64_f, "st7920");
+    compareClipAndBudget(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306");
+    compareClipAndBudget(u8g2_Setup_st7920_s_128x64_f, "st7920");
+
+    //rotated displays are left to u8g2
+    u8g2_t rotated;
+    u8g2_Setup_ssd1306_128x64_noname_f(&rotated, U8G2_R1, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_SetFont(&rotated, u8g2_font_6x10_tf);
+    EXPECT(!U8g2GlyphCache::isSupported(&rotated));
+
+    return testResult("glyph cache");
+}
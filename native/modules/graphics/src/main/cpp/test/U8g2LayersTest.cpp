@@ -0,0 +1,200 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2Layers.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static std::vector<uint8_t> randomBuffer(size_t size) {
+    std::vector<uint8_t> buf(size);
+    for (auto &b : buf)
+        b = static_cast<uint8_t>(std::rand());
+    return buf;
+}
+
+/**
+ * Blend random layers with every operation and a range of offsets, compare against a per-pixel reference
+ */
+static void compareBlend(bool vertical, int tileWidth, int tileHeight) {
+    const int offsets[] = {0, 1, 3, 7, 8, 9, 13, 16, 21, -1, -5, -8, -11, -24, 1000, -1000};
+    int width = tileWidth * 8, height = tileHeight * 8;
+    size_t size = static_cast<size_t>(tileWidth) * tileHeight * 8;
+    for (int op = LAYER_OP_OR; op <= LAYER_OP_XOR; op++) {
+        for (int dx : offsets) {
+            for (int dy : offsets) {
+                auto layer = randomBuffer(size);
+                auto buffer = randomBuffer(size);
+                auto expected = buffer;
+                for (int y = 0; y < height; y++) {
+                    for (int x = 0; x < width; x++) {
+                        int sx = x - dx, sy = y - dy;
+                        if (sx < 0 || sy < 0 || sx >= width || sy >= height || !getPixel(layer.data(), tileWidth, vertical, sx, sy))
+                            continue;
+                        bool value = getPixel(expected.data(), tileWidth, vertical, x, y);
+                        setPixel(expected.data(), tileWidth, vertical, x, y, op == LAYER_OP_OR ? true : op == LAYER_OP_MASK ? false : !value);
+                    }
+                }
+                U8g2Layers::blend(buffer.data(), layer.data(), tileWidth, tileHeight, vertical, op, dx, dy);
+                if (buffer != expected) {
+                    std::cerr << (vertical ? "vertical" : "horizontal") << " " << tileWidth << "x" << tileHeight << " tiles, op = " << op
+                              << ", offset = " << dx << "," << dy << ": mismatch" << std::endl;
+                    failures++;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * The dirty area is the bounding box of the changed tiles
+ */
+static void compareDiff(bool vertical, int tileWidth, int tileHeight) {
+    size_t size = static_cast<size_t>(tileWidth) * tileHeight * 8;
+    auto a = randomBuffer(size);
+    auto b = a;
+    ucgd_tile_area_t area = U8g2Layers::diff(a.data(), b.data(), tileWidth, tileHeight, vertical);
+    EXPECT(area.width == 0 && area.height == 0);
+
+    int width = tileWidth * 8, height = tileHeight * 8;
+    for (int i = 0; i < 50; i++) {
+        b = a;
+        int x0 = std::rand() % width, y0 = std::rand() % height;
+        int x1 = x0 + std::rand() % (width - x0), y1 = y0 + std::rand() % (height - y0);
+        setPixel(b.data(), tileWidth, vertical, x0, y0, !getPixel(a.data(), tileWidth, vertical, x0, y0));
+        setPixel(b.data(), tileWidth, vertical, x1, y1, !getPixel(a.data(), tileWidth, vertical, x1, y1));
+        area = U8g2Layers::diff(a.data(), b.data(), tileWidth, tileHeight, vertical);
+        bool match = area.x == x0 / 8 && area.y == y0 / 8 && area.width == x1 / 8 - x0 / 8 + 1 && area.height == y1 / 8 - y0 / 8 + 1;
+        if (!match) {
+            std::cerr << (vertical ? "vertical" : "horizontal") << " diff: pixels " << x0 << "," << y0 << " and " << x1 << "," << y1
+                      << " gave " << area.x << "," << area.y << " " << area.width << "x" << area.height << std::endl;
+            failures++;
+            return;
+        }
+    }
+}
+
+static void drawStatic(u8g2_t *u8g2) {
+    int w = u8g2_GetDisplayWidth(u8g2), h = u8g2_GetDisplayHeight(u8g2);
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    u8g2_DrawBox(u8g2, 0, 0, w, 12);
+    u8g2_DrawDisc(u8g2, w - 12, h - 12, 6, U8G2_DRAW_ALL);
+}
+
+static void drawValue(u8g2_t *u8g2, const char *value) {
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_DrawStr(u8g2, 4, 30, value);
+}
+
+/**
+ * A static layer composited under a redrawn value must equal the frame drawn in one pass, the dirty area covers the value
+ */
+static void compareDisplay(setup_proc_t setup, const char *name, const u8g2_cb_t *rotation) {
+    u8g2_t ref, lay;
+    setup(&ref, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    setup(&lay, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    //the setup procedures share a static buffer
+    size_t size = 8 * u8g2_GetBufferTileWidth(&ref) * u8g2_GetBufferTileHeight(&ref);
+    std::vector<uint8_t> refBuffer(size), layBuffer(size);
+    u8g2_SetBufferPtr(&ref, refBuffer.data());
+    u8g2_SetBufferPtr(&lay, layBuffer.data());
+    EXPECT(U8g2Layers::isSupported(&lay));
+
+    U8g2Layers layers;
+    uint32_t background = layers.create(&lay, 0, LAYER_OP_OR);
+    EXPECT(layers.begin(&lay, background));
+    EXPECT(layers.isDrawing());
+    EXPECT(u8g2_GetBufferPtr(&lay) != layBuffer.data());
+    drawStatic(&lay);
+    layers.end(&lay);
+    EXPECT(u8g2_GetBufferPtr(&lay) == layBuffer.data());
+
+    const char *values[] = {"12.5 V", "12.6 V", "12.6 V"};
+    for (int frame = 0; frame < 3; frame++) {
+        u8g2_ClearBuffer(&ref);
+        drawStatic(&ref);
+        drawValue(&ref, values[frame]);
+
+        u8g2_ClearBuffer(&lay);
+        drawValue(&lay, values[frame]);
+        layers.composite(&lay);
+
+        bool identical = refBuffer == layBuffer;
+        if (!identical)
+            std::cerr << name << ": mismatch in frame " << frame << std::endl;
+        EXPECT(identical);
+
+        const ucgd_tile_area_t &dirty = layers.getDirtyArea();
+        if (frame == 0) {
+            EXPECT(dirty.x == 0 && dirty.y == 0);
+            EXPECT(dirty.width == u8g2_GetBufferTileWidth(&lay) && dirty.height == u8g2_GetBufferTileHeight(&lay));
+        } else if (frame == 1) {
+            //only the last digit changed
+            EXPECT(dirty.width > 0 && dirty.width < u8g2_GetBufferTileWidth(&lay));
+            EXPECT(dirty.height > 0 && dirty.height < u8g2_GetBufferTileHeight(&lay));
+        } else {
+            EXPECT(dirty.width == 0 || dirty.height == 0);
+        }
+    }
+
+    //the offset is in display coordinates: a box moved by the layer offset equals the box drawn at the moved position
+    uint32_t overlay = layers.create(&lay, 1, LAYER_OP_XOR);
+    layers.setVisible(background, false);
+    layers.begin(&lay, overlay);
+    u8g2_DrawBox(&lay, 10, 5, 7, 9);
+    layers.end(&lay);
+    layers.setOffset(overlay, 3, 4);
+    u8g2_ClearBuffer(&lay);
+    layers.composite(&lay);
+    u8g2_ClearBuffer(&ref);
+    u8g2_DrawBox(&ref, 13, 9, 7, 9);
+    EXPECT(refBuffer == layBuffer);
+
+    //z-order: the mask is applied after the xor layer
+    uint32_t mask = layers.create(&lay, 2, LAYER_OP_MASK);
+    layers.begin(&lay, mask);
+    u8g2_DrawBox(&lay, 0, 0, 15, 40);
+    layers.end(&lay);
+    u8g2_ClearBuffer(&lay);
+    layers.composite(&lay);
+    u8g2_ClearBuffer(&ref);
+    u8g2_DrawBox(&ref, 15, 9, 5, 9);
+    EXPECT(refBuffer == layBuffer);
+
+    EXPECT(layers.remove(&lay, mask));
+    EXPECT(!layers.remove(&lay, mask));
+    EXPECT(layers.getCount() == 2);
+    layers.clear(&lay);
+    EXPECT(layers.getCount() == 0);
+}
+
+int main() {
+    std::srand(1);
+    compareBlend(true, 16, 8);
+    compareBlend(false, 16, 8);
+    compareBlend(true, 3, 2);
+    compareBlend(false, 3, 2);
+    compareBlend(false, 9, 2);
+    compareDiff(true, 16, 8);
+    compareDiff(false, 16, 8);
+    compareDiff(false, 50, 30);
+
+    const u8g2_cb_t *const rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3, U8G2_MIRROR};
+    for (const u8g2_cb_t *rotation : rotations) {
+        //vertical_top_lsb layout
+        compareDisplay(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", rotation);
+        //horizontal_right_lsb layout
+        compareDisplay(u8g2_Setup_st7920_s_128x64_f, "st7920", rotation);
+    }
+
+    //page buffers can not hold layers
+    u8g2_t page;
+    u8g2_Setup_ssd1306_128x64_noname_1(&page, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    EXPECT(!U8g2Layers::isSupported(&page));
+
+    return testResult("layer");
+}
@@ -0,0 +1,220 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <U8g2Recorder.h>
+#include <U8g2Rotator.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static std::mt19937 rng(1234); // NOLINT(cert-msc51-cpp)
+
+static std::string tempPath() {
+    return "/tmp/ucgd-recorder-test-" + std::to_string(getpid()) + ".rec";
+}
+
+//Mostly unchanged frames with a few modified regions, and an occasional full redraw
+static void nextFrame(std::vector<uint8_t> &frame, int n) {
+    if (n % 97 == 0) {
+        for (auto &b : frame)
+            b = static_cast<uint8_t>(rng());
+        return;
+    }
+    int regions = static_cast<int>(rng() % 4);
+    for (int r = 0; r < regions; r++) {
+        size_t start = rng() % frame.size();
+        size_t length = std::min<size_t>(rng() % 64 + 1, frame.size() - start);
+        for (size_t i = 0; i < length; i++)
+            frame[start + i] = static_cast<uint8_t>(rng());
+    }
+}
+
+void testEncodeRoundTrip() {
+    const size_t size = 1024;
+    std::vector<uint8_t> reference(size), current(size), output(U8g2Recorder::getMaxEncodedSize(size)), decoded(size);
+    for (int iteration = 0; iteration < 500; iteration++) {
+        for (size_t i = 0; i < size; i++) {
+            reference[i] = static_cast<uint8_t>(rng());
+            //vary the density of the changes, including the worst case of alternating runs
+            switch (iteration % 4) {
+                case 0:
+                    current[i] = reference[i];
+                    break;
+                case 1:
+                    current[i] = static_cast<uint8_t>(reference[i] ^ ((i % 3) == 0 ? 0x5a : 0));
+                    break;
+                case 2:
+                    current[i] = static_cast<uint8_t>(reference[i] ^ ((i % 129) != 128 ? 0x01 : 0));
+                    break;
+                default:
+                    current[i] = (rng() % 8 == 0) ? static_cast<uint8_t>(rng()) : reference[i];
+                    break;
+            }
+        }
+        size_t length = U8g2Recorder::encode(current.data(), reference.data(), size, output.data());
+        EXPECT(length <= U8g2Recorder::getMaxEncodedSize(size));
+        decoded = reference;
+        EXPECT(U8g2Recorder::decode(output.data(), length, decoded.data(), size));
+        EXPECT(decoded == current);
+    }
+    //unchanged frames cost a byte per 128 bytes
+    EXPECT(U8g2Recorder::encode(reference.data(), reference.data(), size, output.data()) == size / 128);
+}
+
+void testRingReplay() {
+    const int width = 128, height = 64, total = 3000;
+    const size_t size = width * height / 8;
+    std::string path = tempPath();
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<uint8_t> frame(size, 0);
+
+    U8g2Recorder recorder;
+    recorder.open(path, 96 * 1024, width, height, RECORDER_LAYOUT_VERTICAL, 32);
+    for (int n = 0; n < total; n++) {
+        nextFrame(frame, n);
+        frames.push_back(frame);
+        recorder.record(frame.data(), frame.size(), 1000 + n);
+    }
+    //frames of a different size are rejected
+    bool thrown = false;
+    try {
+        recorder.record(frame.data(), frame.size() - 1, 0);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    recorder.close();
+
+    U8g2Replay replay;
+    replay.open(path);
+    const ucgd_rec_header_t &header = replay.getHeader();
+    EXPECT(header.width == width && header.height == height && header.frame_size == size);
+    EXPECT(header.layout == RECORDER_LAYOUT_VERTICAL);
+    //the ring wrapped, the oldest frames were dropped a keyframe group at a time
+    EXPECT(replay.getFrameCount() > 0 && replay.getFrameCount() < total);
+    EXPECT(header.first_frame + replay.getFrameCount() == total);
+
+    std::vector<uint8_t> output(size);
+    uint64_t timestamp = 0;
+    //sequential
+    for (size_t i = 0; i < replay.getFrameCount(); i++) {
+        size_t n = header.first_frame + i;
+        EXPECT(replay.readFrame(i, output.data(), &timestamp));
+        EXPECT(output == frames[n]);
+        EXPECT(timestamp == 1000 + n);
+    }
+    //random access
+    for (int i = 0; i < 200; i++) {
+        size_t index = rng() % replay.getFrameCount();
+        EXPECT(replay.readFrame(index, output.data()));
+        EXPECT(output == frames[header.first_frame + index]);
+    }
+    EXPECT(!replay.readFrame(replay.getFrameCount(), output.data()));
+    replay.close();
+    remove(path.c_str());
+}
+
+void testInvalid() {
+    std::string path = tempPath();
+    U8g2Recorder recorder;
+    bool thrown = false;
+    try {
+        recorder.open(path, 1024, 128, 64, RECORDER_LAYOUT_VERTICAL);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    EXPECT(!recorder.isOpen());
+
+    thrown = false;
+    U8g2Replay replay;
+    try {
+        replay.open(path + ".missing");
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    remove(path.c_str());
+}
+
+/**
+ * With rotate_at_send the display buffer is recorded (sized like startRecording), not the canvas u8g2 draws into
+ */
+void testRotateAtSend() {
+    std::string path = tempPath();
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    U8g2Rotator rotator(&u8g2);
+    rotator.setRotation(&u8g2, U8G2_R1);
+    EXPECT(rotator.isActive());
+    //the canvas has tileWidth rows, more than the display
+    EXPECT(u8g2.tile_buf_height > rotator.getTileHeight());
+
+    U8g2Recorder recorder;
+    recorder.open(path, 64 * 1024, u8g2_GetBufferTileWidth(&u8g2) * 8, rotator.getTileHeight() * 8, RECORDER_LAYOUT_VERTICAL, 8);
+    std::vector<std::vector<uint8_t>> frames;
+    for (int n = 0; n < 20; n++) {
+        u8g2_ClearBuffer(&u8g2);
+        u8g2_DrawBox(&u8g2, n, 2 * n, 10, 20);
+        rotator.rotate();
+        frames.emplace_back(rotator.getBuffer(), rotator.getBuffer() + rotator.getBufferSize());
+        recorder.record(rotator.getBuffer(), rotator.getBufferSize(), n);
+    }
+    EXPECT(recorder.getFrameCount() == frames.size());
+
+    //the canvas does not fit the recording
+    bool thrown = false;
+    try {
+        recorder.record(u8g2_GetBufferPtr(&u8g2), bufferSize(&u8g2), 0);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    recorder.close();
+
+    U8g2Replay replay;
+    replay.open(path);
+    EXPECT(replay.getHeader().width == 128 && replay.getHeader().height == 64);
+    EXPECT(replay.getFrameCount() == frames.size());
+    std::vector<uint8_t> output(rotator.getBufferSize());
+    for (size_t i = 0; i < replay.getFrameCount() && i < frames.size(); i++) {
+        EXPECT(replay.readFrame(i, output.data()));
+        EXPECT(output == frames[i]);
+    }
+    replay.close();
+    remove(path.c_str());
+}
+
+void reportOverhead() {
+    const int width = 128, height = 64, total = 20000;
+    std::string path = tempPath();
+    std::vector<uint8_t> frame(width * height / 8, 0);
+    U8g2Recorder recorder;
+    recorder.open(path, RECORDER_DEFAULT_CAPACITY, width, height, RECORDER_LAYOUT_VERTICAL);
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < total; n++) {
+        frame[n % frame.size()] ^= 0xff;
+        recorder.record(frame.data(), frame.size());
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    recorder.close();
+    remove(path.c_str());
+    std::cout << "Average record time (128x64): " << (elapsed / total) << " ns" << std::endl;
+}
+
+int main() {
+    testEncodeRoundTrip();
+    testRingReplay();
+    testInvalid();
+    testRotateAtSend();
+    reportOverhead();
+
+    return testResult("recorder");
+}
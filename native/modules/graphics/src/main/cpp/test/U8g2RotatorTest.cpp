@@ -0,0 +1,133 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2Rotator.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static const u8g2_cb_t *const rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3};
+
+/**
+ * Rotate random canvases and compare against the coordinate transformations of u8g2 (u8g2_draw_l90_r1/r2/r3)
+ */
+static void compareKernel(bool vertical, int tileWidth, int tileHeight) {
+    int width = tileWidth * 8, height = tileHeight * 8;
+    for (int turns = 1; turns <= 3; turns++) {
+        int canvasRows = (turns == 2) ? tileHeight : tileWidth;
+        std::vector<uint8_t> canvas(static_cast<size_t>(canvasRows) * tileWidth * 8), buffer(static_cast<size_t>(tileWidth) * tileHeight * 8);
+        for (auto &c : canvas)
+            c = static_cast<uint8_t>(std::rand());
+        U8g2Rotator::rotate(canvas.data(), buffer.data(), tileWidth, tileHeight, vertical, turns);
+
+        bool identical = true;
+        for (int py = 0; py < height && identical; py++) {
+            for (int px = 0; px < width; px++) {
+                int cx, cy;
+                if (turns == 1) {
+                    cx = py;
+                    cy = width - 1 - px;
+                } else if (turns == 2) {
+                    cx = width - 1 - px;
+                    cy = height - 1 - py;
+                } else {
+                    cx = height - 1 - py;
+                    cy = px;
+                }
+                if (getPixel(buffer.data(), tileWidth, vertical, px, py) != getPixel(canvas.data(), tileWidth, vertical, cx, cy)) {
+                    std::cerr << (vertical ? "vertical" : "horizontal") << " " << tileWidth << "x" << tileHeight << " tiles, turns = " << turns
+                              << ": mismatch at " << px << "," << py << std::endl;
+                    identical = false;
+                    break;
+                }
+            }
+        }
+        EXPECT(identical);
+    }
+}
+
+//The same scene drawn with user coordinates
+static void drawScene(u8g2_t *u8g2, int seed) {
+    std::srand(seed);
+    int w = u8g2_GetDisplayWidth(u8g2), h = u8g2_GetDisplayHeight(u8g2);
+    u8g2_ClearBuffer(u8g2);
+    u8g2_DrawFrame(u8g2, 0, 0, w, h);
+    for (int i = 0; i < 20; i++) {
+        auto x = static_cast<u8g2_uint_t>(std::rand() % w), y = static_cast<u8g2_uint_t>(std::rand() % h);
+        auto x2 = static_cast<u8g2_uint_t>(std::rand() % w), y2 = static_cast<u8g2_uint_t>(std::rand() % h);
+        switch (i % 4) {
+            case 0: u8g2_DrawBox(u8g2, x, y, 1 + std::rand() % 20, 1 + std::rand() % 20); break;
+            case 1: u8g2_DrawLine(u8g2, x, y, x2, y2); break;
+            case 2: u8g2_DrawDisc(u8g2, x, y, 1 + std::rand() % 8, U8G2_DRAW_ALL); break;
+            default: u8g2_DrawPixel(u8g2, x, y); break;
+        }
+    }
+    u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+    u8g2_DrawStr(u8g2, 2, 20, "Rotate");
+}
+
+/**
+ * Drawing into the canvas and rotating at send time must give the same display buffer as the rotation of u8g2
+ */
+static void compareDisplay(setup_proc_t setup, const char *name) {
+    for (const u8g2_cb_t *rotation : rotations) {
+        u8g2_t ref, rot;
+        setup(&ref, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+        setup(&rot, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+        //the setup procedures share a static buffer
+        size_t size = 8 * u8g2_GetBufferTileWidth(&ref) * u8g2_GetBufferTileHeight(&ref);
+        std::vector<uint8_t> refBuffer(size), rotBuffer(size);
+        u8g2_SetBufferPtr(&ref, refBuffer.data());
+        u8g2_SetBufferPtr(&rot, rotBuffer.data());
+        U8g2Rotator rotator(&rot);
+        rotator.setRotation(&rot, rotation);
+        EXPECT(rotator.isActive() == (rotation != U8G2_R0));
+        EXPECT(u8g2_GetDisplayWidth(&rot) == u8g2_GetDisplayWidth(&ref));
+        EXPECT(u8g2_GetDisplayHeight(&rot) == u8g2_GetDisplayHeight(&ref));
+        //the unrotated fast paths (glyph cache, sprites, blitter) are enabled by the canvas
+        EXPECT(rot.cb->draw_l90 == u8g2_draw_l90_r0);
+
+        drawScene(&ref, 7);
+        drawScene(&rot, 7);
+        rotator.rotate();
+
+        EXPECT(rotator.getBufferSize() == size);
+        bool identical = std::memcmp(refBuffer.data(), rotBuffer.data(), size) == 0;
+        if (!identical)
+            std::cerr << name << ": mismatch (rotation = " << (rotation == U8G2_R1 ? 1 : rotation == U8G2_R2 ? 2 : rotation == U8G2_R3 ? 3 : 0) << ")" << std::endl;
+        EXPECT(identical);
+
+        //back to the rotation of u8g2 on the display buffer
+        rotator.setRotation(&rot, U8G2_R0);
+        EXPECT(!rotator.isActive());
+        EXPECT(u8g2_GetBufferPtr(&rot) == rotator.getBuffer());
+    }
+}
+
+int main() {
+    std::srand(1);
+    compareKernel(true, 16, 8);
+    compareKernel(false, 16, 8);
+    compareKernel(true, 8, 8);
+    compareKernel(false, 9, 5);
+    compareKernel(true, 9, 5);
+    compareKernel(false, 24, 4);
+
+    //vertical_top_lsb layout
+    compareDisplay(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306");
+    //horizontal_right_lsb layout
+    compareDisplay(u8g2_Setup_st7920_s_128x64_f, "st7920");
+
+    //page buffers are left to u8g2
+    u8g2_t page;
+    u8g2_Setup_ssd1306_128x64_noname_1(&page, U8G2_R1, u8x8_byte_empty, u8x8_dummy_cb);
+    U8g2Rotator rotator(&page);
+    rotator.setRotation(&page, U8G2_R1);
+    EXPECT(!rotator.isActive());
+    EXPECT(page.cb == U8G2_R1);
+
+    return testResult("rotator");
+}
@@ -0,0 +1,107 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2Scroll.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static const u8g2_cb_t *const rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3, U8G2_MIRROR};
+
+/**
+ * Shift random regions of a random buffer and compare against a pixel by pixel reference
+ */
+static void compareShift(int layout, const char *name, int tileWidth, int tileHeight, int iterations) {
+    int width = tileWidth * 8, height = tileHeight * 8;
+    size_t size = static_cast<size_t>(tileWidth) * tileHeight * 8;
+    bool vertical = layout == SCROLL_LAYOUT_VERTICAL;
+    for (int i = 0; i < iterations; i++) {
+        std::vector<uint8_t> buf(size), ref;
+        for (auto &c : buf)
+            c = static_cast<uint8_t>(std::rand());
+        ref = buf;
+
+        int x0 = std::rand() % width, y0 = std::rand() % height;
+        int x1 = x0 + 1 + std::rand() % (width - x0), y1 = y0 + 1 + std::rand() % (height - y0);
+        //exercise the byte aligned paths
+        if (i % 4 == 0) {
+            x0 &= ~7;
+            x1 = std::min(width, (x1 + 7) & ~7);
+        }
+        int dx = 0, dy = 0;
+        switch (i % 3) {
+            case 0: dx = std::rand() % (2 * width + 1) - width; break;
+            case 1: dy = std::rand() % (2 * height + 1) - height; break;
+            default:
+                dx = std::rand() % 41 - 20;
+                dy = std::rand() % 41 - 20;
+                break;
+        }
+        if (i % 8 == 0)
+            dx &= ~7;
+        bool fill = (i & 1) != 0;
+
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                int sx = x - dx, sy = y - dy;
+                bool on = (sx >= x0 && sx < x1 && sy >= y0 && sy < y1) ? getPixel(buf.data(), tileWidth, vertical, sx, sy) : fill;
+                setPixel(ref.data(), tileWidth, vertical, x, y, on);
+            }
+        }
+        U8g2Scroll::shift(buf.data(), tileWidth, tileHeight, layout, x0, y0, x1, y1, dx, dy, fill);
+
+        bool identical = buf == ref;
+        if (!identical)
+            std::cerr << name << ": mismatch (iteration = " << i << ", region = " << x0 << "," << y0 << "-" << x1 << "," << y1 << ", dx = " << dx << ", dy = " << dy << ")" << std::endl;
+        EXPECT(identical);
+    }
+}
+
+/**
+ * Scrolling a pixel in user coordinates must give the same buffer as drawing it at its destination (all rotations)
+ */
+static void compareRotated(setup_proc_t setup, const char *name, int iterations) {
+    u8g2_t scrolled, expected;
+    for (int i = 0; i < iterations; i++) {
+        const u8g2_cb_t *rotation = rotations[i % 5];
+        setup(&scrolled, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+        setup(&expected, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+        size_t size = 8 * u8g2_GetBufferTileHeight(&scrolled) * u8g2_GetBufferTileWidth(&scrolled);
+        std::memset(u8g2_GetBufferPtr(&scrolled), 0, size);
+        std::memset(u8g2_GetBufferPtr(&expected), 0, size);
+
+        int width = u8g2_GetDisplayWidth(&scrolled), height = u8g2_GetDisplayHeight(&scrolled);
+        int x = std::rand() % (width / 2), y = std::rand() % (height / 2);
+        int w = width / 2, h = height / 2;
+        int dx = std::rand() % 9 - 4, dy = std::rand() % 9 - 4;
+        for (int p = 0; p < 10; p++) {
+            int px = x + std::rand() % w, py = y + std::rand() % h;
+            u8g2_DrawPixel(&scrolled, static_cast<u8g2_uint_t>(px), static_cast<u8g2_uint_t>(py));
+            if (px + dx >= x && px + dx < x + w && py + dy >= y && py + dy < y + h)
+                u8g2_DrawPixel(&expected, static_cast<u8g2_uint_t>(px + dx), static_cast<u8g2_uint_t>(py + dy));
+        }
+        EXPECT(U8g2Scroll::scroll(&scrolled, x, y, w, h, dx, dy, false));
+
+        bool identical = std::memcmp(u8g2_GetBufferPtr(&scrolled), u8g2_GetBufferPtr(&expected), size) == 0;
+        if (!identical)
+            std::cerr << name << ": mismatch (iteration = " << i << ", dx = " << dx << ", dy = " << dy << ")" << std::endl;
+        EXPECT(identical);
+    }
+}
+
+int main() {
+    std::srand(1);
+    compareShift(SCROLL_LAYOUT_VERTICAL, "vertical", 16, 8, 2000);
+    compareShift(SCROLL_LAYOUT_HORIZONTAL, "horizontal", 16, 8, 2000);
+    //odd sizes (tails of the 8 column blocks and of the 64-bit words)
+    compareShift(SCROLL_LAYOUT_VERTICAL, "vertical (odd)", 9, 5, 1000);
+    compareShift(SCROLL_LAYOUT_HORIZONTAL, "horizontal (odd)", 9, 5, 1000);
+
+    compareRotated(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", 200);
+    compareRotated(u8g2_Setup_st7920_s_128x64_f, "st7920", 200);
+
+    return testResult("scroll");
+}
@@ -0,0 +1,116 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <U8g2Sprites.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static const u8g2_cb_t *const rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3, U8G2_MIRROR};
+
+/**
+ * Draw the same XBM image with the sprite store and with u8g2_DrawXBM and compare the resulting buffers
+ */
+static void compare(setup_proc_t setup, const char *name, int iterations) {
+    u8g2_t ref, sprite;
+    U8g2Sprites store(1024 * 1024);
+    for (int i = 0; i < iterations; i++) {
+        //mostly unrotated, this is where the converted copies are used
+        const u8g2_cb_t *rotation = rotations[(i % 4 == 0) ? (i / 4) % 5 : 0];
+        setup(&ref, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+        setup(&sprite, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+
+        size_t size = bufferSize(&ref);
+        for (size_t b = 0; b < size; b++)
+            u8g2_GetBufferPtr(&ref)[b] = static_cast<uint8_t>(std::rand());
+        std::memcpy(u8g2_GetBufferPtr(&sprite), u8g2_GetBufferPtr(&ref), size);
+
+        if (i % 3 == 0) {
+            int cx = std::rand() % 32, cy = std::rand() % 32;
+            u8g2_SetClipWindow(&ref, cx, cy, cx + 64, cy + 48);
+            u8g2_SetClipWindow(&sprite, cx, cy, cx + 64, cy + 48);
+        }
+        auto color = static_cast<uint8_t>(std::rand() % 3);
+        auto transparent = static_cast<uint8_t>(std::rand() % 2);
+        u8g2_SetDrawColor(&ref, color);
+        u8g2_SetDrawColor(&sprite, color);
+        u8g2_SetBitmapMode(&ref, transparent);
+        u8g2_SetBitmapMode(&sprite, transparent);
+
+        int width = 1 + std::rand() % 70;
+        int height = 1 + std::rand() % 50;
+        int x = std::rand() % 140;
+        int y = std::rand() % 80;
+        std::vector<uint8_t> xbm(((width + 7) / 8) * height);
+        for (auto &c : xbm)
+            c = static_cast<uint8_t>(std::rand());
+
+        uint32_t handle = store.upload(xbm.data(), xbm.size(), width, height, SPRITE_FORMAT_XBM);
+        EXPECT(handle != 0);
+        EXPECT(store.draw(&sprite, handle, x, y));
+        u8g2_DrawXBM(&ref, static_cast<u8g2_uint_t>(x), static_cast<u8g2_uint_t>(y), static_cast<u8g2_uint_t>(width), static_cast<u8g2_uint_t>(height), xbm.data());
+
+        bool identical = std::memcmp(u8g2_GetBufferPtr(&ref), u8g2_GetBufferPtr(&sprite), size) == 0;
+        if (!identical)
+            std::cerr << name << ": mismatch (iteration = " << i << ", color = " << static_cast<int>(color) << ", transparent = " << static_cast<int>(transparent)
+                      << ", x = " << x << ", y = " << y << ", width = " << width << ", height = " << height << ")" << std::endl;
+        EXPECT(identical);
+        if (i % 2 == 0)
+            EXPECT(store.evict(handle));
+    }
+}
+
+void testBudget() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_ClearBuffer(&u8g2);
+    std::vector<uint8_t> data(64, 0xff);
+
+    //a 64x8 source uses 64 bytes, a second one does not fit
+    U8g2Sprites store(100);
+    uint32_t first = store.upload(data.data(), data.size(), 64, 8, SPRITE_FORMAT_1BPP);
+    EXPECT(first != 0);
+    EXPECT(store.upload(data.data(), data.size(), 64, 8, SPRITE_FORMAT_1BPP) == 0);
+
+    //no room for the converted copy, drawn from the source
+    EXPECT(store.draw(&u8g2, first, 0, 3));
+    EXPECT(store.getUsage() == 64);
+    EXPECT(u8g2_GetBufferPtr(&u8g2)[0] == 0xf8);
+
+    //copies for y % 8 == 3 and y % 8 == 4 use two pages each, only one fits
+    store.setBudget(200);
+    EXPECT(store.draw(&u8g2, first, 0, 3));
+    EXPECT(store.getUsage() == 64 + 128);
+    EXPECT(store.draw(&u8g2, first, 0, 4));
+    EXPECT(store.getUsage() == 64 + 128);
+
+    EXPECT(store.evict(first));
+    EXPECT(!store.evict(first));
+    EXPECT(!store.draw(&u8g2, first, 0, 0));
+    EXPECT(store.getUsage() == 0);
+    EXPECT(store.getCount() == 0);
+}
+
+void testInvalidUpload() {
+    U8g2Sprites store;
+    std::vector<uint8_t> data(8, 0xff);
+    EXPECT(store.upload(data.data(), data.size(), 8, 9, SPRITE_FORMAT_XBM) == 0);
+    EXPECT(store.upload(data.data(), data.size(), 0, 8, SPRITE_FORMAT_XBM) == 0);
+    EXPECT(store.upload(data.data(), data.size(), 8, 8, 5) == 0);
+    EXPECT(store.upload(nullptr, 0, 8, 8, SPRITE_FORMAT_XBM) == 0);
+}
+
+int main() {
+    std::srand(1);
+    //vertical_top_lsb layout
+    compare(u8g2_Setup_ssd1306_128x64_noname_f, "ssd1306", 500);
+    //horizontal_right_lsb layout
+    compare(u8g2_Setup_st7920_s_128x64_f, "st7920", 500);
+    testBudget();
+    testInvalidUpload();
+
+    return testResult("sprite");
+}
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <U8g2Stats.h>
+#include "TestSupport.h"
+
+void testBucketBoundaries() {
+    //every bucket must hold the values between its lower bound and the next one
+    for (int b = 0; b + 1 < U8g2Histogram::HISTOGRAM_BUCKETS; b++) {
+        uint64_t lower = U8g2Histogram::lowerBoundOf(b);
+        uint64_t next = U8g2Histogram::lowerBoundOf(b + 1);
+        EXPECT(next > lower);
+        EXPECT(U8g2Histogram::bucketOf(lower) == b);
+        EXPECT(U8g2Histogram::bucketOf(next - 1) == b);
+    }
+    EXPECT(U8g2Histogram::bucketOf(0) == 0);
+    EXPECT(U8g2Histogram::bucketOf(UINT64_MAX) == U8g2Histogram::HISTOGRAM_BUCKETS - 1);
+}
+
+void testPercentiles() {
+    U8g2Histogram histogram;
+    EXPECT(histogram.percentile(0.5) == 0);
+    for (uint64_t v = 1; v <= 1000; v++)
+        histogram.record(v * 1000);
+    EXPECT(histogram.getCount() == 1000);
+    EXPECT(histogram.getMax() == 1000000);
+    uint64_t p50 = histogram.percentile(0.50);
+    uint64_t p99 = histogram.percentile(0.99);
+    //reported values are never below the real percentile and at most one sub-bucket (1/8) above it
+    EXPECT(p50 >= 500000 && p50 <= 500000 + 500000 / 8);
+    EXPECT(p99 >= 990000 && p99 <= 1000000);
+    EXPECT(histogram.percentile(1.0) == 1000000);
+    histogram.reset();
+    EXPECT(histogram.getCount() == 0);
+    EXPECT(histogram.getMax() == 0);
+    EXPECT(histogram.percentile(0.99) == 0);
+}
+
+void testFrameCounters() {
+    U8g2Stats stats;
+    for (int frame = 0; frame < 10; frame++) {
+        ucgd_stats_mark_t mark = stats.beginFrame();
+        stats.addByteCallback(100, 0); //start transfer
+        for (int i = 0; i < 8; i++)
+            stats.addByteCallback(1000, 128);
+        stats.addByteCallback(100, 0); //end transfer
+        stats.addGpioCallback(50);
+        stats.addDelay(10000);
+        stats.endFrame(mark);
+    }
+    stats.addBgraConversion(5000);
+    stats.addMissedDeadlines(2);
+    stats.addMissedDeadlines(1);
+    stats.setFrameInterval(16666666);
+
+    int64_t values[STATS_COUNT + 1] = {};
+    EXPECT(stats.snapshot(values, STATS_COUNT + 1) == STATS_COUNT);
+    EXPECT(values[STATS_FRAMES] == 10);
+    EXPECT(values[STATS_BYTES] == 10 * 8 * 128);
+    EXPECT(values[STATS_TRANSPORT_CALLS] == 10 * 10);
+    EXPECT(values[STATS_TRANSPORT_WRITES] == 10 * 8);
+    EXPECT(values[STATS_BYTE_CB_TIME] == 10 * (8 * 1000 + 200));
+    EXPECT(values[STATS_GPIO_CALLS] == 10);
+    EXPECT(values[STATS_GPIO_CB_TIME] == 10 * 50);
+    EXPECT(values[STATS_DELAY_CALLS] == 10);
+    EXPECT(values[STATS_DELAY_TIME] == 10 * 10000);
+    EXPECT(values[STATS_BYTES_PER_FRAME_P50] == 1024);
+    EXPECT(values[STATS_BYTES_PER_FRAME_MAX] == 1024);
+    EXPECT(values[STATS_CALLS_PER_FRAME_P99] == 10);
+    EXPECT(values[STATS_WRITES_PER_FRAME_P50] == 8);
+    EXPECT(values[STATS_SEND_P50] <= values[STATS_SEND_P99]);
+    EXPECT(values[STATS_SEND_P99] <= values[STATS_SEND_MAX]);
+    EXPECT(values[STATS_SEND_MAX] <= values[STATS_SEND_TIME]);
+    EXPECT(values[STATS_BGRA_CONVERSIONS] == 1);
+    EXPECT(values[STATS_BGRA_TIME] == 5000);
+    EXPECT(values[STATS_MISSED_DEADLINES] == 3);
+    EXPECT(values[STATS_FRAME_INTERVAL] == 16666666);
+
+    //partial snapshot
+    int64_t first[3] = {};
+    EXPECT(stats.snapshot(first, 3) == 3);
+    EXPECT(first[STATS_FRAMES] == 10);
+
+    stats.reset();
+    EXPECT(stats.snapshot(values, STATS_COUNT) == STATS_COUNT);
+    bool cleared = true;
+    for (int i = 0; i < STATS_COUNT; i++)
+        cleared = cleared && values[i] == 0;
+    EXPECT(cleared);
+}
+
+void testResetDuringFrame() {
+    U8g2Stats stats;
+    stats.addByteCallback(10, 64);
+    ucgd_stats_mark_t mark = stats.beginFrame();
+    stats.reset();
+    stats.addByteCallback(10, 16);
+    stats.endFrame(mark);
+    int64_t values[STATS_COUNT] = {};
+    stats.snapshot(values, STATS_COUNT);
+    EXPECT(values[STATS_FRAMES] == 1);
+    EXPECT(values[STATS_BYTES_PER_FRAME_MAX] == 0);
+}
+
+void testConcurrentReaders() {
+    U8g2Stats stats;
+    std::thread reader([&stats]() {
+        int64_t values[STATS_COUNT];
+        for (int i = 0; i < 1000; i++)
+            stats.snapshot(values, STATS_COUNT);
+    });
+    for (int i = 0; i < 100000; i++)
+        stats.addByteCallback(1, 1);
+    reader.join();
+    int64_t values[STATS_COUNT] = {};
+    stats.snapshot(values, STATS_COUNT);
+    EXPECT(values[STATS_TRANSPORT_CALLS] == 100000);
+}
+
+void reportOverhead() {
+    U8g2Stats stats;
+    const int iterations = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        uint64_t t = U8g2Stats::now();
+        stats.addByteCallback(U8g2Stats::now() - t, 32);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Timed byte callback accounting: " << elapsed / iterations << " ns per call" << std::endl;
+}
+
+int main() {
+    testBucketBoundaries();
+    testPercentiles();
+    testFrameCounters();
+    testResetDuringFrame();
+    testConcurrentReaders();
+    reportOverhead();
+
+    return testResult("statistics");
+}
@@ -11,6 +11,7 @@
 #include <UcgdSpiPeripheral.h>
 #include <UcgdPigpioProvider.h>
 #include "U8g2TestHal.h"
+#include <UcgdFrameScheduler.h>
 #include <sstream>
 
 static volatile bool complete = false;
@@ -53,6 +54,9 @@ void drawBannerText(u8g2_t *u8g2, uint32_t durationSecs) {
     u8g2_SetFont(u8g2, u8g2_font_7x13B_mf);
     uint32_t elapsed = 0;
 
+    //2 frames per second, lowered if the bus can not keep up
+    UcgdFrameScheduler scheduler(2, true);
+
     while (elapsed != durationSecs) {
         if (complete)
             break;
@@ -71,9 +75,11 @@ void drawBannerText(u8g2_t *u8g2, uint32_t durationSecs) {
         u8g2_ClearBuffer(u8g2);
         std::string text = "UCGDisplay v1.5.0-alpha";
         u8g2_DrawStr(u8g2, x, 32, text.c_str());
+        auto start = std::chrono::steady_clock::now();
         u8g2_SendBuffer(u8g2);
+        scheduler.frameSent(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
         x -= 5;
-        usleep(500000);
+        scheduler.wait(-1);
     }
 }
 
@@ -185,12 +191,14 @@ u8g2_t *setupDisplay(const std::string &provider) {
     info->comm_type = COMTYPE_HW;
 
     //Populate options
-    info->options[OPT_BUS_SPEED] = DEFAULT_SPI_SPEED;
-    info->options[OPT_PROVIDER] = std::string(PROVIDER_CPERIPHERY);
-    info->options[OPT_SPI_BUS] = SPI_PERIPHERAL_MAIN;
-    info->options[OPT_SPI_CHANNEL] = SPI_RPI_CHANNEL_CE1;
-    info->options[OPT_I2C_BUS] = 1;
-    info->options[OPT_PROVIDER] = provider;
+    ucgd_settings_t &settings = info->settings;
+    settings.bus_speed = DEFAULT_SPI_SPEED;
+    settings.spi_bus_number = SPI_PERIPHERAL_MAIN;
+    settings.spi_channel = SPI_RPI_CHANNEL_CE1;
+    settings.i2c_bus_number = 1;
+    settings.default_provider = provider;
+    for (ucgd_option_id_t id : {OPTION_BUS_SPEED, OPTION_SPI_BUS, OPTION_SPI_CHANNEL, OPTION_I2C_BUS, OPTION_PROVIDER})
+        settings.provided |= uint64_t(1) << id;
     info->provider = ServiceLocator::getInstance().getProviderManager()->getProvider(info);
     info->provider->open(info);
 
@@ -211,11 +219,8 @@ u8g2_t *setupDisplay(const std::string &provider) {
 
     //Assign the i2c addres if applicable
     if (info->comm_type == COMINT_I2C) {
-        std::any addr = info->options[OPT_I2C_ADDRESS];
-        if (addr.has_value()) {
-            int intVal = std::any_cast<int>(addr);
-            u8g2_SetI2CAddress(info->u8g2.get(), intVal);
-        }
+        if (info->settings.has(OPTION_I2C_ADDRESS))
+            u8g2_SetI2CAddress(info->u8g2.get(), info->settings.i2c_address);
     }
 
     std::cout << "initializeProviders : DONE" << std::endl;
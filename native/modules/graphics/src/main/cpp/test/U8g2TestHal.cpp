@@ -107,67 +107,67 @@ uint8_t cb_gpio_delay(const std::shared_ptr<ucgd_t> &info, u8x8_t *u8x8, uint8_t
             break;
         }
         case U8X8_MSG_GPIO_D0: {                // D0 or SPI clock pin: Output level in arg_int (U8X8_MSG_GPIO_SPI_CLOCK)
-            gpio->write(info->pin_map.d0, arg_int);
+            gpio->write(info, info->pin_map.d0, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D1: {                // D1 or SPI data pin: Output level in arg_int (U8X8_MSG_GPIO_SPI_DATA)
-            gpio->write(info->pin_map.d1, arg_int);
+            gpio->write(info, info->pin_map.d1, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D2: {                // D2 pin: Output level in arg_int
-            gpio->write(info->pin_map.d2, arg_int);
+            gpio->write(info, info->pin_map.d2, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D3: {                // D3 pin: Output level in arg_int
-            gpio->write(info->pin_map.d3, arg_int);
+            gpio->write(info, info->pin_map.d3, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D4: {                // D4 pin: Output level in arg_int
-            gpio->write(info->pin_map.d4, arg_int);
+            gpio->write(info, info->pin_map.d4, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D5: {                // D5 pin: Output level in arg_int
-            gpio->write(info->pin_map.d5, arg_int);
+            gpio->write(info, info->pin_map.d5, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D6: {                // D6 pin: Output level in arg_int
-            gpio->write(info->pin_map.d6, arg_int);
+            gpio->write(info, info->pin_map.d6, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_D7: {                // D7 pin: Output level in arg_int
-            gpio->write(info->pin_map.d7, arg_int);
+            gpio->write(info, info->pin_map.d7, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_E: {               // E/WR pin: Output level in arg_int
-            gpio->write(info->pin_map.en, arg_int);
+            gpio->write(info, info->pin_map.en, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_CS: {                // CS (m_Chip select) pin: Output level in arg_int
-            gpio->write(info->pin_map.cs, arg_int);
+            gpio->write(info, info->pin_map.cs, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_DC: {                // DC (data/cmd, A0, register select) pin: Output level in arg_int
-            gpio->write(info->pin_map.dc, arg_int);
+            gpio->write(info, info->pin_map.dc, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_RESET: {            // Reset pin: Output level in arg_int
-            gpio->write(info->pin_map.reset, arg_int);
+            gpio->write(info, info->pin_map.reset, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_CS1: {                // CS1 (m_Chip select) pin: Output level in arg_int
-            gpio->write(info->pin_map.cs1, arg_int);
+            gpio->write(info, info->pin_map.cs1, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_CS2: {                // CS2 (m_Chip select) pin: Output level in arg_int
-            gpio->write(info->pin_map.cs2, arg_int);
+            gpio->write(info, info->pin_map.cs2, arg_int);
             break;
         }
         case U8X8_MSG_GPIO_I2C_CLOCK: {        // arg_int=0: Output low at I2C clock pin
-            gpio->write(info->pin_map.scl, arg_int);
+            gpio->write(info, info->pin_map.scl, arg_int);
             break;                            // arg_int=1: Input dir with pullup high for I2C clock pin
         }
         case U8X8_MSG_GPIO_I2C_DATA: {           // arg_int=0: Output low at I2C data pin
-            gpio->write(info->pin_map.sda, arg_int);
+            gpio->write(info, info->pin_map.sda, arg_int);
             break;                            // arg_int=1: Input dir with pullup high for I2C data pin
         }
         default: {
@@ -227,7 +227,8 @@ void initializeGpio(const std::shared_ptr<ucgd_t>& info, const std::shared_ptr<U
 
             //Check which hardware peripheral device we need to configure
             if (comm_int == COMINT_3WSPI || comm_int == COMINT_4WSPI || comm_int == COMINT_ST7920SPI) {
-                int spi_bus_number = info->getOptionInt(OPT_SPI_BUS);
+                info->settings.require(OPTION_SPI_BUS);
+                int spi_bus_number = info->settings.spi_bus_number;
                 if (spi_bus_number == SPI_PERIPHERAL_MAIN) {
                     pigpioGpio->init(info, SPI_RPI_PIN_MAIN_MISO, UcgdGpioPeripheral::GpioMode::MODE_ALT0); //MISO
                     pigpioGpio->init(info, SPI_RPI_PIN_MAIN_MOSI, UcgdGpioPeripheral::GpioMode::MODE_ALT0); //MOSI
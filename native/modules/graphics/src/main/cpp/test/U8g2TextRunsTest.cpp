@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <U8g2TextRuns.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+static const char *const strings[] = {"Hello, World!", "0123456789", "gjpqy |_^~", "AVAWAT", "i", "Temperature: 21.5"};
+
+static const uint8_t *const fonts[] = {u8g2_font_6x10_tf, u8g2_font_ncenB08_tr, u8g2_font_helvB10_tf};
+
+static std::u16string toUtf16(const char *str) {
+    return {str, str + std::char_traits<char>::length(str)};
+}
+
+static auto text(const std::u16string &str) -> const uint16_t * {
+    return reinterpret_cast<const uint16_t *>(str.data());
+}
+
+/**
+ * Run widths against u8g2_GetStrWidth, with and without the width cache
+ */
+static void testWidths() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    U8g2GlyphCache cache;
+    U8g2TextRuns runs, uncached(0);
+    for (const uint8_t *font : fonts) {
+        u8g2_SetFont(&u8g2, font);
+        for (const char *str : strings) {
+            std::u16string s = toUtf16(str);
+            int expected = u8g2_GetStrWidth(&u8g2, str);
+            EXPECT(runs.measure(&u8g2, cache, text(s), s.size()) == expected);
+            //second time from the width cache
+            EXPECT(runs.measure(&u8g2, cache, text(s), s.size()) == expected);
+            EXPECT(uncached.measure(&u8g2, cache, text(s), s.size()) == expected);
+        }
+    }
+    size_t count = sizeof(fonts) / sizeof(*fonts) * sizeof(strings) / sizeof(*strings);
+    EXPECT(runs.getMisses() == count);
+    EXPECT(runs.getHits() == count);
+    EXPECT(uncached.getHits() == 0);
+    EXPECT(runs.measure(&u8g2, cache, nullptr, 0) == 0);
+}
+
+/**
+ * Changing the font must not return the width measured with the previous font
+ */
+static void testFontChange() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    U8g2GlyphCache cache;
+    U8g2TextRuns runs;
+    const char *str = "Hello, World!";
+    std::u16string s = toUtf16(str);
+
+    u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+    int small = u8g2_GetStrWidth(&u8g2, str);
+    EXPECT(runs.measure(&u8g2, cache, text(s), s.size()) == small);
+
+    u8g2_SetFont(&u8g2, u8g2_font_helvB10_tf);
+    int large = u8g2_GetStrWidth(&u8g2, str);
+    EXPECT(small != large);
+    uint64_t misses = runs.getMisses();
+    EXPECT(runs.measure(&u8g2, cache, text(s), s.size()) == large);
+    EXPECT(runs.getMisses() == misses + 1);
+
+    //the width of the first font is still cached
+    u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+    uint64_t hits = runs.getHits();
+    EXPECT(runs.measure(&u8g2, cache, text(s), s.size()) == small);
+    EXPECT(runs.getHits() == hits + 1);
+
+    //a full cache starts over
+    U8g2TextRuns bounded(2);
+    for (const char *other : strings) {
+        std::u16string o = toUtf16(other);
+        EXPECT(bounded.measure(&u8g2, cache, text(o), o.size()) == u8g2_GetStrWidth(&u8g2, other));
+    }
+    std::u16string o = toUtf16(strings[0]);
+    EXPECT(bounded.measure(&u8g2, cache, text(o), o.size()) == u8g2_GetStrWidth(&u8g2, strings[0]));
+}
+
+/**
+ * Aligned runs are drawn where u8g2_DrawStr draws them after moving the anchor back along the font direction
+ */
+static void testAlignment() {
+    u8g2_t ref, drawn;
+    u8g2_Setup_ssd1306_128x64_noname_f(&ref, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_Setup_ssd1306_128x64_noname_f(&drawn, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    std::vector<uint8_t> refBuffer(bufferSize(&ref)), drawnBuffer(bufferSize(&drawn));
+    u8g2_SetBufferPtr(&ref, refBuffer.data());
+    u8g2_SetBufferPtr(&drawn, drawnBuffer.data());
+    U8g2GlyphCache cache;
+    U8g2TextRuns runs;
+    const char *str = "Align me";
+    std::u16string s = toUtf16(str);
+    const int x = 64, y = 32;
+
+    for (const uint8_t *font : fonts) {
+        for (uint8_t dir = 0; dir < 4; dir++) {
+            for (int align : {TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER, TEXT_ALIGN_RIGHT}) {
+                u8g2_ClearBuffer(&ref);
+                u8g2_ClearBuffer(&drawn);
+                for (u8g2_t *u8g2 : {&ref, &drawn}) {
+                    u8g2_SetFont(u8g2, font);
+                    u8g2_SetFontDirection(u8g2, dir);
+                }
+                int width = u8g2_GetStrWidth(&ref, str);
+                int offset = (align == TEXT_ALIGN_CENTER) ? width / 2 : (align == TEXT_ALIGN_RIGHT) ? width : 0;
+                int ax = x, ay = y;
+                switch (dir) {
+                    case 0: ax -= offset; break;
+                    case 1: ay -= offset; break;
+                    case 2: ax += offset; break;
+                    default: ay += offset; break;
+                }
+                u8g2_DrawStr(&ref, static_cast<u8g2_uint_t>(ax), static_cast<u8g2_uint_t>(ay), str);
+                ucgd_text_extent_t extent = runs.layout(&drawn, cache, text(s), s.size(), x, y, align);
+                EXPECT(refBuffer == drawnBuffer);
+
+                //the extent spans the run along the font direction
+                int height = u8g2_GetAscent(&ref) - u8g2_GetDescent(&ref);
+                switch (dir) {
+                    case 0:
+                        EXPECT(extent.x == ax && extent.y == ay - u8g2_GetAscent(&ref));
+                        EXPECT(extent.width == width && extent.height == height);
+                        break;
+                    case 1:
+                        EXPECT(extent.x == ax + u8g2_GetDescent(&ref) + 1 && extent.y == ay);
+                        EXPECT(extent.width == height && extent.height == width);
+                        break;
+                    case 2:
+                        EXPECT(extent.x == ax - width + 1 && extent.y == ay + u8g2_GetDescent(&ref) + 1);
+                        EXPECT(extent.width == width && extent.height == height);
+                        break;
+                    default:
+                        EXPECT(extent.x == ax - u8g2_GetAscent(&ref) && extent.y == ay - width + 1);
+                        EXPECT(extent.width == height && extent.height == width);
+                        break;
+                }
+
+                //measure only leaves the buffer untouched
+                u8g2_ClearBuffer(&drawn);
+                ucgd_text_extent_t measured = runs.layout(&drawn, cache, text(s), s.size(), x, y, align | TEXT_MEASURE_ONLY);
+                EXPECT(measured.x == extent.x && measured.y == extent.y && measured.width == extent.width);
+                EXPECT(std::all_of(drawnBuffer.begin(), drawnBuffer.end(), [](uint8_t b) { return b == 0; }));
+            }
+        }
+    }
+}
+
+int main() {
+    testWidths();
+    testFontChange();
+    testAlignment();
+    return testResult("text run");
+}
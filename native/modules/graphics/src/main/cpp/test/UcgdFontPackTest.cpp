@@ -0,0 +1,123 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <UcgdFontPack.h>
+#include "TestSupport.h"
+
+typedef std::vector<std::pair<std::string, std::vector<uint8_t>>> font_list_t;
+
+static std::vector<uint8_t> fontData(size_t size, int seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<uint8_t>((i * 31) + seed);
+    data[size - 1] = 0;
+    return data;
+}
+
+static std::vector<uint8_t> readFile(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string &path, const std::vector<uint8_t> &data) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+}
+
+static bool openFails(const std::string &path) {
+    try {
+        UcgdFontPack pack(path);
+    } catch (std::runtime_error &e) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    std::string path = "ucgd-test-fonts.pack";
+
+    //written unsorted, names sharing a prefix and a font larger than a page
+    font_list_t fonts = {
+            {"u8g2_font_helvB10_tf", fontData(2803, 1)},
+            {"u8g2_font_6x10_tf", fontData(1912, 2)},
+            {"u8x8_font_chroma48medium8_r", fontData(770, 3)},
+            {"u8g2_font_6x10_tr", fontData(1010, 4)},
+            {"u8g2_font_6x1", fontData(9, 5)},
+            {"u8g2_font_unifont_t_chinese3", fontData(65000, 6)},
+    };
+    UcgdFontPack::write(path, fonts);
+
+    {
+        UcgdFontPack pack(path);
+        EXPECT(pack.getCount() == fonts.size());
+        EXPECT(pack.getPath() == path);
+        for (size_t i = 1; i < pack.getCount(); i++)
+            EXPECT(pack.getName(i - 1) < pack.getName(i));
+        EXPECT(pack.getName(pack.getCount()).empty());
+        for (const auto &font : fonts) {
+            const uint8_t *data = pack.find(font.first);
+            EXPECT(data != nullptr);
+            if (data != nullptr)
+                EXPECT(std::memcmp(data, font.second.data(), font.second.size()) == 0);
+        }
+        const char *missing[] = {"", "u8g2_font_6x10", "u8g2_font_6x10_tfx", "u8g2_font_6x", "a", "zzz"};
+        for (const char *name : missing)
+            EXPECT(pack.find(name) == nullptr);
+    }
+
+    //duplicates are rejected
+    font_list_t duplicates = {{"u8g2_font_6x10_tf", fontData(10, 1)}, {"u8g2_font_6x10_tf", fontData(12, 2)}};
+    bool thrown = false;
+    try {
+        UcgdFontPack::write(path + ".dup", duplicates);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+
+    //an empty pack is valid
+    UcgdFontPack::write(path + ".empty", font_list_t());
+    {
+        UcgdFontPack empty(path + ".empty");
+        EXPECT(empty.getCount() == 0);
+        EXPECT(empty.find("u8g2_font_6x10_tf") == nullptr);
+    }
+
+    //damaged files
+    std::vector<uint8_t> valid = readFile(path);
+    std::string damaged = path + ".bad";
+    EXPECT(openFails(path + ".missing"));
+
+    std::vector<uint8_t> data = valid;
+    data[0] ^= 0xff;
+    writeFile(damaged, data);
+    EXPECT(openFails(damaged));
+
+    data = valid;
+    data[4] = FONT_PACK_VERSION + 1;
+    writeFile(damaged, data);
+    EXPECT(openFails(damaged));
+
+    data.assign(valid.begin(), valid.begin() + 40);
+    writeFile(damaged, data);
+    EXPECT(openFails(damaged));
+
+    data.assign(valid.begin(), valid.end() - 1);
+    writeFile(damaged, data);
+    EXPECT(openFails(damaged));
+
+    data.assign(valid.begin(), valid.begin() + 8);
+    writeFile(damaged, data);
+    EXPECT(openFails(damaged));
+
+    std::remove(path.c_str());
+    std::remove((path + ".empty").c_str());
+    std::remove(damaged.c_str());
+
+    return testResult("font pack");
+}
@@ -0,0 +1,113 @@
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <UcgdFrameScheduler.h>
+#include "TestSupport.h"
+
+static const uint64_t ms = 1000000;
+
+/**
+ * The interval follows the send time: stretched at once when the frames do not fit, restored in steps
+ */
+static void testAdapt() {
+    const uint64_t target = 20 * ms;
+    //fits: the target is kept
+    EXPECT(UcgdFrameScheduler::adapt(target, target, 10 * ms) == target);
+    EXPECT(UcgdFrameScheduler::adapt(target, target, 16 * ms) == target);
+    //does not fit with 25% headroom: stretched past the requirement
+    uint64_t slow = UcgdFrameScheduler::adapt(target, target, 24 * ms);
+    EXPECT(slow >= 30 * ms);
+    //a send time around the new interval does not re-arm the timer
+    EXPECT(UcgdFrameScheduler::adapt(slow, target, 24 * ms) == slow);
+    EXPECT(UcgdFrameScheduler::adapt(slow, target, 25 * ms) == slow);
+    //the bus recovers: back to the target in steps of 1/8
+    uint64_t interval = slow;
+    int steps = 0;
+    while (interval > target && steps < 100) {
+        uint64_t next = UcgdFrameScheduler::adapt(interval, target, 5 * ms);
+        EXPECT(next < interval && next >= interval - interval / 8);
+        interval = next;
+        steps++;
+    }
+    EXPECT(interval == target);
+    EXPECT(steps > 1);
+    //never slower than 1 fps
+    EXPECT(UcgdFrameScheduler::adapt(target, target, 5000 * ms) == SCHEDULER_MAX_INTERVAL);
+}
+
+static void testTicks() {
+    UcgdFrameScheduler scheduler(100, false);
+    EXPECT(scheduler.getInterval() == 10 * ms);
+
+    //paced at 10ms
+    auto start = std::chrono::steady_clock::now();
+    int ticks = 0;
+    for (int i = 0; i < 5; i++)
+        ticks += scheduler.wait(1000);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT(ticks >= 5);
+    EXPECT(elapsed >= std::chrono::milliseconds(35));
+
+    //a late frame: the ticks that passed are returned at once
+    scheduler.wait(1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(35));
+    EXPECT(scheduler.wait(1000) >= 3);
+
+    //timeout shorter than the interval
+    scheduler.wait(1000);
+    EXPECT(scheduler.wait(1) == SCHEDULER_TIMEOUT);
+
+    //not adaptive: the send time is measured but the interval is kept
+    scheduler.frameSent(50 * ms);
+    EXPECT(scheduler.getSendTime() == 50 * ms);
+    EXPECT(scheduler.getInterval() == 10 * ms);
+}
+
+static void testAdaptive() {
+    UcgdFrameScheduler scheduler(100, true);
+    for (int i = 0; i < 8; i++)
+        scheduler.frameSent(20 * ms);
+    EXPECT(scheduler.getInterval() >= 25 * ms);
+    //the timer is re-armed with the new interval
+    scheduler.wait(1000);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT(scheduler.wait(1000) == 1);
+    EXPECT(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+    for (int i = 0; i < 200; i++)
+        scheduler.frameSent(1 * ms);
+    EXPECT(scheduler.getInterval() == scheduler.getTargetInterval());
+}
+
+static void testStop() {
+    UcgdFrameScheduler scheduler(1, false);
+    int result = 0;
+    std::thread waiter([&]() {
+        result = scheduler.wait(-1);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    scheduler.stop();
+    waiter.join();
+    EXPECT(result == SCHEDULER_STOPPED);
+    EXPECT(scheduler.wait(-1) == SCHEDULER_STOPPED);
+
+    const int rates[] = {0, -1, SCHEDULER_MAX_FPS + 1};
+    for (int fps : rates) {
+        bool thrown = false;
+        try {
+            UcgdFrameScheduler invalid(fps, true);
+        } catch (std::runtime_error &e) {
+            thrown = true;
+        }
+        EXPECT(thrown);
+    }
+}
+
+int main() {
+    testAdapt();
+    testTicks();
+    testAdaptive();
+    testStop();
+
+    return testResult("frame scheduler");
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <UcgdFramePublisher.h>
+#include <UcgdFrameShm.h>
+#include "TestSupport.h"
+
+static std::string ringName(const char *test) {
+    return std::string("/ucgd-test-") + test + "-" + std::to_string(getpid());
+}
+
+static std::vector<uint8_t> pattern(size_t size, uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<uint8_t>(seed + i * 7);
+    return data;
+}
+
+static void testFullFrames() {
+    std::string name = ringName("full");
+    UcgdFramePublisher publisher(name, 128, 64, SHM_LAYOUT_VERTICAL, SHM_FORMAT_MONO | SHM_FORMAT_BGRA, 3);
+    UcgdFrameReader reader(name);
+    const ucgd_shm_header_t &header = reader.header();
+    EXPECT(header.width == 128);
+    EXPECT(header.height == 64);
+    EXPECT(header.slot_count == 3);
+    EXPECT(header.mono_size == 1024);
+    EXPECT(header.bgra_size == 128 * 64 * 4);
+    EXPECT(header.format == (SHM_FORMAT_MONO | SHM_FORMAT_BGRA));
+
+    std::vector<uint8_t> mono(header.mono_size), bgra(header.bgra_size);
+    EXPECT(reader.read(mono.data(), bgra.data()) == 0);
+
+    //publish more frames than slots, the reader gets the latest one
+    for (uint8_t i = 1; i <= 5; i++) {
+        auto m = pattern(1024, i);
+        auto b = pattern(header.bgra_size, static_cast<uint8_t>(i * 3));
+        EXPECT(publisher.writePage(0, 8, m.data(), b.data()));
+    }
+    uint64_t timestamp = 0;
+    EXPECT(reader.read(mono.data(), bgra.data(), &timestamp) == 5);
+    EXPECT(mono == pattern(1024, 5));
+    EXPECT(bgra == pattern(header.bgra_size, 15));
+    EXPECT(timestamp > 0 && timestamp <= ucgdMonotonicNanos());
+    EXPECT(publisher.getFrameCount() == 5);
+
+    //whole frame dirty unless the writer sets the area, the area only applies to the next frame
+    ucgd_shm_area_t dirty{};
+    EXPECT(reader.read(mono.data(), nullptr, nullptr, &dirty) == 5);
+    EXPECT(dirty.x == 0 && dirty.y == 0 && dirty.width == 16 && dirty.height == 8);
+    auto m = pattern(1024, 6);
+    publisher.setDirtyArea(2, 3, 4, 1);
+    EXPECT(publisher.writePage(0, 8, m.data(), nullptr));
+    EXPECT(reader.read(nullptr, nullptr, nullptr, &dirty) == 6);
+    EXPECT(dirty.x == 2 && dirty.y == 3 && dirty.width == 4 && dirty.height == 1);
+    EXPECT(publisher.writePage(0, 8, m.data(), nullptr));
+    EXPECT(reader.read(nullptr, nullptr, nullptr, &dirty) == 7);
+    EXPECT(dirty.width == 16 && dirty.height == 8);
+}
+
+static void testPages() {
+    std::string name = ringName("pages");
+    UcgdFramePublisher publisher(name, 128, 64, SHM_LAYOUT_VERTICAL, SHM_FORMAT_MONO, 4);
+    UcgdFrameReader reader(name);
+    EXPECT(reader.header().bgra_size == 0);
+    auto frame = pattern(1024, 9);
+
+    //a page loop entered in the middle is ignored
+    EXPECT(!publisher.writePage(2, 2, frame.data() + 256, nullptr));
+    EXPECT(reader.latest() == 0);
+
+    //two tile rows per page (u8g2 _2 setup procedures)
+    for (int row = 0; row < 8; row += 2) {
+        bool published = publisher.writePage(row, 2, frame.data() + row * 128, nullptr);
+        EXPECT(published == (row == 6));
+        if (row < 6)
+            EXPECT(reader.latest() == 0);
+    }
+    std::vector<uint8_t> mono(1024);
+    EXPECT(reader.read(mono.data(), nullptr) == 1);
+    EXPECT(mono == frame);
+
+    //the last page is clamped to the display height
+    frame = pattern(1024, 33);
+    for (int row = 0; row < 8; row += 3)
+        publisher.writePage(row, 3, frame.data() + row * 128, nullptr);
+    EXPECT(reader.read(mono.data(), nullptr) == 2);
+    EXPECT(mono == frame);
+}
+
+static void testWait() {
+    std::string name = ringName("wait");
+    UcgdFramePublisher publisher(name, 64, 32, SHM_LAYOUT_HORIZONTAL, SHM_FORMAT_MONO, 2);
+    UcgdFrameReader reader(name);
+    EXPECT(reader.wait(0, 20) == 0);
+
+    auto frame = pattern(256, 1);
+    std::thread writer([&]() {
+        usleep(20000);
+        publisher.writePage(0, 4, frame.data(), nullptr);
+    });
+    EXPECT(reader.wait(0, 5000) == 1);
+    writer.join();
+    EXPECT(reader.header().waiters.load() == 0);
+    EXPECT(reader.header().layout == SHM_LAYOUT_HORIZONTAL);
+    //already newer than last, no wait
+    EXPECT(reader.wait(0, 0) == 1);
+}
+
+static void testErrors() {
+    bool thrown = false;
+    try {
+        UcgdFrameReader reader(ringName("missing"));
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    thrown = false;
+    try {
+        UcgdFramePublisher publisher(ringName("size"), 100, 64, SHM_LAYOUT_VERTICAL, SHM_FORMAT_MONO, 2);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+
+    //the object is removed with the publisher
+    std::string name = ringName("unlink");
+    {
+        UcgdFramePublisher publisher(name.substr(1), 64, 32, SHM_LAYOUT_VERTICAL, SHM_FORMAT_MONO, 2);
+        EXPECT(publisher.getName() == name);
+    }
+    thrown = false;
+    try {
+        UcgdFrameReader reader(name);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+}
+
+int main() {
+    testFullFrames();
+    testPages();
+    testWait();
+    testErrors();
+
+    return testResult("shared memory frame");
+}
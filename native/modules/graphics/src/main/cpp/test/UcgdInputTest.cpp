@@ -0,0 +1,193 @@
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <UcgdInput.h>
+#include "TestSupport.h"
+
+static ucgd_input_event_t makeEvent(uint32_t n) {
+    ucgd_input_event_t event{};
+    event.timestamp = n;
+    event.source = 1;
+    event.type = INPUT_TYPE_KEY;
+    event.value = static_cast<int32_t>(n);
+    return event;
+}
+
+/**
+ * Events come out in order across the wrap, a full ring drops (and counts) the new events
+ */
+static void testRing() {
+    UcgdInputRing ring(5);
+    EXPECT(ring.getCapacity() == 8);
+    ucgd_input_event_t out[16];
+    uint32_t next = 0, expected = 0;
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < 5; i++)
+            EXPECT(ring.push(makeEvent(next++)));
+        size_t count = ring.pop(out, 16);
+        EXPECT(count == 5);
+        for (size_t i = 0; i < count; i++)
+            EXPECT(out[i].value == static_cast<int32_t>(expected++));
+    }
+    for (int i = 0; i < 8; i++)
+        EXPECT(ring.push(makeEvent(static_cast<uint32_t>(i))));
+    EXPECT(!ring.push(makeEvent(8)));
+    EXPECT(ring.getDropped() == 1);
+    EXPECT(ring.size() == 8);
+    EXPECT(ring.pop(out, 3) == 3);
+    EXPECT(out[0].value == 0 && out[2].value == 2);
+    EXPECT(ring.pop(out, 16) == 5);
+    EXPECT(out[4].value == 7);
+    EXPECT(ring.pop(out, 16) == 0);
+}
+
+/**
+ * One producer and one consumer thread, nothing lost or reordered
+ */
+static void testRingThreads() {
+    const uint32_t total = 200000;
+    UcgdInputRing ring(64);
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < total; i++) {
+            while (!ring.push(makeEvent(i)))
+                std::this_thread::yield();
+        }
+    });
+    ucgd_input_event_t out[32];
+    uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < total) {
+        size_t count = ring.pop(out, 32);
+        for (size_t i = 0; i < count; i++)
+            ordered = ordered && out[i].value == static_cast<int32_t>(expected++);
+    }
+    producer.join();
+    EXPECT(ordered);
+}
+
+static void testDebouncer() {
+    const uint64_t ms = 1000000;
+    UcgdDebouncer debouncer;
+    debouncer.reset(5 * ms, false);
+
+    //press with contact bounce: only the first edge is reported
+    EXPECT(debouncer.edge(true, 100 * ms));
+    EXPECT(debouncer.getLevel());
+    EXPECT(!debouncer.edge(false, 100 * ms + 200000));
+    EXPECT(!debouncer.edge(true, 100 * ms + 400000));
+    EXPECT(debouncer.getDeadline() == 105 * ms);
+    //settled on the reported level, nothing to report
+    EXPECT(!debouncer.expire(104 * ms));
+    EXPECT(!debouncer.expire(105 * ms));
+    EXPECT(debouncer.getDeadline() == 0);
+
+    //release
+    EXPECT(debouncer.edge(false, 200 * ms));
+    EXPECT(!debouncer.getLevel());
+    //a short tap inside the lockout: the final level differs and is reported at the deadline
+    EXPECT(!debouncer.edge(true, 201 * ms));
+    EXPECT(debouncer.getDeadline() == 205 * ms);
+    EXPECT(!debouncer.expire(204 * ms));
+    EXPECT(debouncer.expire(205 * ms));
+    EXPECT(debouncer.getLevel());
+    //the corrective report starts a new lockout
+    EXPECT(!debouncer.edge(false, 207 * ms));
+    EXPECT(debouncer.expire(210 * ms));
+    EXPECT(!debouncer.getLevel());
+
+    //repeated levels (missed edges) are not reported twice
+    EXPECT(!debouncer.edge(false, 300 * ms));
+
+    //no lockout: every change is reported
+    debouncer.reset(0, false);
+    EXPECT(debouncer.edge(true, 1));
+    EXPECT(debouncer.edge(false, 1));
+    EXPECT(debouncer.edge(true, 2));
+    EXPECT(debouncer.getDeadline() == 0);
+}
+
+//Feed a quadrature sequence (A, B levels) and return the detents reported
+static int turn(UcgdQuadrature &decoder, const std::vector<int> &states) {
+    int detents = 0;
+    for (int state : states)
+        detents += decoder.update((state & 2) != 0, (state & 1) != 0);
+    return detents;
+}
+
+static void testQuadrature() {
+    //A leads B clockwise: 00 -> 10 -> 11 -> 01 -> 00
+    const std::vector<int> clockwise = {2, 3, 1, 0};
+    const std::vector<int> counterClockwise = {1, 3, 2, 0};
+
+    UcgdQuadrature decoder;
+    decoder.reset(4, false, false);
+    EXPECT(turn(decoder, clockwise) == 1);
+    EXPECT(turn(decoder, clockwise) == 1);
+    EXPECT(turn(decoder, counterClockwise) == -1);
+
+    //a detent is only reported once all its steps are seen
+    decoder.reset(4, false, false);
+    EXPECT(turn(decoder, {2, 3, 1}) == 0);
+    EXPECT(turn(decoder, {0}) == 1);
+
+    //bounce on one line moves back and forth without reporting
+    decoder.reset(4, false, false);
+    EXPECT(turn(decoder, {2, 0, 2, 0, 2, 3, 2, 3, 1, 0}) == 1);
+
+    //both lines changed at once (a missed edge) is ignored
+    decoder.reset(4, false, false);
+    EXPECT(turn(decoder, {3, 0}) == 0);
+
+    //half and full step encoders
+    decoder.reset(2, false, false);
+    EXPECT(turn(decoder, clockwise) == 2);
+    decoder.reset(1, false, false);
+    EXPECT(turn(decoder, counterClockwise) == -4);
+    EXPECT(turn(decoder, {1, 0}) == 0);
+}
+
+static void testManager() {
+    UcgdInputManager manager(16);
+    ucgd_input_event_t out[4];
+    EXPECT(manager.read(out, 4, 0) == 0);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT(manager.read(out, 4, 20) == 0);
+    EXPECT(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(15));
+
+    bool thrown = false;
+    try {
+        manager.openEvdev("/nonexistent/event0", false);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    thrown = false;
+    try {
+        manager.openEncoder("gpiochip0", 3, 3, 4);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    EXPECT(thrown);
+    EXPECT(!manager.close(1));
+
+    //stop releases a reader waiting without a timeout
+    std::thread reader([&]() {
+        EXPECT(manager.read(out, 4, -1) == 0);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    manager.stop();
+    reader.join();
+}
+
+int main() {
+    testRing();
+    testRingThreads();
+    testDebouncer();
+    testQuadrature();
+    testManager();
+
+    return testResult("input");
+}
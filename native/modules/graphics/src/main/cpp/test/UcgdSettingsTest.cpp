@@ -0,0 +1,134 @@
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <UcgdSettings.h>
+#include "TestSupport.h"
+
+//Same layout as NativeUtils.encodeOptions
+class Encoder {
+public:
+    Encoder &add(const std::string &key, int value) {
+        entry(OPTION_TYPE_INT, key);
+        for (int i = 0; i < 4; i++)
+            m_Data.push_back(static_cast<uint8_t>(static_cast<uint32_t>(value) >> (i * 8)));
+        return *this;
+    }
+
+    Encoder &add(const std::string &key, bool value) {
+        entry(OPTION_TYPE_BOOL, key);
+        m_Data.push_back(value ? 1 : 0);
+        return *this;
+    }
+
+    Encoder &add(const std::string &key, const char *value) {
+        entry(OPTION_TYPE_STRING, key);
+        size_t length = std::strlen(value);
+        m_Data.push_back(static_cast<uint8_t>(length));
+        m_Data.push_back(static_cast<uint8_t>(length >> 8));
+        m_Data.insert(m_Data.end(), value, value + length);
+        return *this;
+    }
+
+    Encoder &addNull(const std::string &key) {
+        entry(OPTION_TYPE_NULL, key);
+        return *this;
+    }
+
+    [[nodiscard]] std::vector<uint8_t> data() const {
+        std::vector<uint8_t> data = {static_cast<uint8_t>(m_Count), static_cast<uint8_t>(m_Count >> 8)};
+        data.insert(data.end(), m_Data.begin(), m_Data.end());
+        return data;
+    }
+
+private:
+    void entry(uint8_t type, const std::string &key) {
+        m_Data.push_back(type);
+        m_Data.push_back(static_cast<uint8_t>(key.size()));
+        m_Data.insert(m_Data.end(), key.begin(), key.end());
+        m_Count++;
+    }
+
+    std::vector<uint8_t> m_Data;
+    int m_Count = 0;
+};
+
+static bool decodeFails(const std::vector<uint8_t> &data) {
+    try {
+        UcgdSettings_Decode(data.data(), data.size());
+    } catch (std::runtime_error &e) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    //defaults
+    ucgd_settings_t defaults = UcgdSettings_Decode(nullptr, 0);
+    EXPECT(defaults.provided == 0);
+    EXPECT(defaults.spi_bits_per_word == 8 && defaults.i2c_bus_number == 1);
+    EXPECT(defaults.default_provider.empty() && !defaults.rotate_at_send);
+
+    std::vector<uint8_t> data = Encoder()
+            .add(OPT_PROVIDER, "sim")
+            .add(OPT_BUS_SPEED, 8000000)
+            .add(OPT_SPI_BUS, 1)
+            .add(OPT_I2C_ADDRESS, 0x3c)
+            .add(OPT_SIM_LATENCY, -5)
+            .add(OPT_EXTRA_DEBUG_INFO, true)
+            .add(OPT_ROTATE_AT_SEND, 1)
+            .add(OPT_PARTIAL_UPDATE, false)
+            .add(OPT_SHM_NAME, "/ucgd-\xc3\xa9")
+            .add("buffer_size", 2)
+            .addNull(OPT_SPI_CHANNEL)
+            .data();
+    ucgd_settings_t settings = UcgdSettings_Decode(data.data(), data.size());
+    EXPECT(settings.default_provider == "sim");
+    EXPECT(settings.bus_speed == 8000000);
+    EXPECT(settings.spi_bus_number == 1);
+    EXPECT(settings.i2c_address == 0x3c);
+    EXPECT(settings.sim_latency == -5);
+    EXPECT(settings.extra_debug_info);
+    EXPECT(settings.rotate_at_send);
+    EXPECT(!settings.partial_update && settings.has(OPTION_PARTIAL_UPDATE));
+    EXPECT(settings.shm_name == "/ucgd-\xc3\xa9");
+    //null values and unknown keys leave the defaults
+    EXPECT(!settings.has(OPTION_SPI_CHANNEL) && settings.spi_channel == 0);
+    EXPECT(!settings.has(OPTION_GLYPH_CACHE_SIZE));
+
+    bool thrown = false;
+    try {
+        settings.require(OPTION_SPI_CHANNEL);
+    } catch (OptionNotFoundException &e) {
+        thrown = std::string(e.what()).find(OPT_SPI_CHANNEL) != std::string::npos;
+    }
+    EXPECT(thrown);
+    settings.require(OPTION_SPI_BUS);
+
+    for (int id = 0; id < OPTION_COUNT; id++)
+        EXPECT(std::strlen(UcgdSettings_GetName(static_cast<ucgd_option_id_t>(id))) > 0);
+    EXPECT(std::strcmp(UcgdSettings_GetName(OPTION_SPI_BUS), OPT_SPI_BUS) == 0);
+
+    //the last occurrence of a key wins
+    data = Encoder().add(OPT_SHM_SLOTS, 2).add(OPT_SHM_SLOTS, 6).data();
+    EXPECT(UcgdSettings_Decode(data.data(), data.size()).shm_slots == 6);
+
+    //type mismatches
+    EXPECT(decodeFails(Encoder().add(OPT_BUS_SPEED, "fast").data()));
+    EXPECT(decodeFails(Encoder().add(OPT_PROVIDER, 1).data()));
+    EXPECT(decodeFails(Encoder().add(OPT_FONT_PACK, true).data()));
+
+    //malformed buffers
+    std::vector<uint8_t> valid = Encoder().add(OPT_PROVIDER, "sim").add(OPT_BUS_SPEED, 1).data();
+    for (size_t length = 1; length < valid.size(); length++)
+        EXPECT(decodeFails(std::vector<uint8_t>(valid.begin(), valid.begin() + static_cast<long>(length))));
+    std::vector<uint8_t> trailing = valid;
+    trailing.push_back(0);
+    EXPECT(decodeFails(trailing));
+    std::vector<uint8_t> badType = Encoder().add(OPT_BUS_SPEED, 1).data();
+    badType[2] = 9;
+    EXPECT(decodeFails(badType));
+
+    return testResult("settings");
+}
@@ -0,0 +1,63 @@
+#include <dlfcn.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <UcgdSetupPlugin.h>
+#include "TestSupport.h"
+
+/**
+ * Open the plugin of a controller, its entries must belong to the controller and set up the same display as the
+ * procedure linked into the test
+ */
+static void checkPlugin(const std::string &dir, const std::string &controller, const char *setupName, ucgd_setup_proc_t setup) {
+    std::string path = dir + "/" + SETUP_PLUGIN_PREFIX + controller + SETUP_PLUGIN_SUFFIX;
+    void *handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        std::cerr << "Unable to open " << path << ": " << dlerror() << std::endl;
+        failures++;
+        return;
+    }
+    auto func = reinterpret_cast<ucgd_setup_plugin_func_t>(dlsym(handle, SETUP_PLUGIN_SYMBOL));
+    EXPECT(func != nullptr);
+    //the u8g2 objects linked into the plugin are not exported
+    EXPECT(dlsym(handle, setupName) == nullptr);
+    if (func == nullptr)
+        return;
+
+    const ucgd_setup_plugin_t *plugin = func();
+    EXPECT(plugin->abi == SETUP_PLUGIN_ABI);
+    EXPECT(controller == plugin->controller);
+
+    std::string prefix = std::string("u8g2_Setup_") + controller + "_";
+    ucgd_setup_proc_t found = nullptr;
+    int count = 0;
+    for (auto entry = plugin->entries; entry->name != nullptr; entry++, count++) {
+        EXPECT(std::strncmp(entry->name, prefix.c_str(), prefix.size()) == 0);
+        EXPECT(entry->proc != nullptr);
+        if (std::strcmp(entry->name, setupName) == 0)
+            found = entry->proc;
+    }
+    //page buffer (1 and 2 pages) and full buffer variants of every display
+    EXPECT(count > 0 && count % 3 == 0);
+    EXPECT(found != nullptr);
+    if (found == nullptr)
+        return;
+
+    u8g2_t expected, actual;
+    setup(&expected, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    found(&actual, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    EXPECT(u8g2_GetDisplayWidth(&actual) == u8g2_GetDisplayWidth(&expected));
+    EXPECT(u8g2_GetDisplayHeight(&actual) == u8g2_GetDisplayHeight(&expected));
+    EXPECT(u8g2_GetBufferTileHeight(&actual) == u8g2_GetBufferTileHeight(&expected));
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <plugin directory>" << std::endl;
+        return 1;
+    }
+    checkPlugin(argv[1], "ssd1306", "u8g2_Setup_ssd1306_128x64_noname_f", u8g2_Setup_ssd1306_128x64_noname_f);
+    checkPlugin(argv[1], "st7920", "u8g2_Setup_st7920_s_128x64_1", u8g2_Setup_st7920_s_128x64_1);
+
+    return testResult("setup plugin");
+}
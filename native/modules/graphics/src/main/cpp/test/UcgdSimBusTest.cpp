@@ -0,0 +1,143 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <UcgdSimBus.h>
+#include "TestSupport.h"
+
+void testDuration() {
+    UcgdSimBus bus;
+    ucgd_sim_timing_t timing;
+    //unlimited bus, no latency
+    EXPECT(bus.duration(timing, 8192) == 0);
+    //1 MHz: one microsecond per bit
+    timing.speed = 1000000;
+    EXPECT(bus.duration(timing, 8) == 8000);
+    EXPECT(bus.duration(timing, 1024 * 8) == 8192000);
+    timing.latency = 2500;
+    EXPECT(bus.duration(timing, 8) == 10500);
+}
+
+void testJitter() {
+    ucgd_sim_timing_t timing;
+    timing.latency = 1000;
+    timing.jitter = 500;
+    UcgdSimBus a;
+    UcgdSimBus b;
+    bool varies = false;
+    uint64_t first = 0;
+    for (int i = 0; i < 1000; i++) {
+        uint64_t da = a.duration(timing, 0);
+        uint64_t db = b.duration(timing, 0);
+        if (i == 0)
+            first = da;
+        //bounded by the configured jitter
+        EXPECT(da >= 1000 && da <= 1500);
+        //and reproducible between runs
+        EXPECT(da == db);
+        varies |= da != first;
+    }
+    EXPECT(varies);
+}
+
+void testTransferWaits() {
+    UcgdSimBus bus;
+    ucgd_sim_timing_t timing;
+    timing.speed = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    //short transfer (spun) followed by a long one (slept)
+    uint64_t nanos = bus.transfer(timing, 40);
+    nanos += bus.transfer(timing, 2000);
+    auto elapsed = (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    EXPECT(nanos == 2040000);
+    EXPECT(elapsed >= nanos);
+}
+
+void testCapture() {
+    UcgdSimBus bus;
+    auto out = std::make_shared<std::ostringstream>();
+    const uint8_t cmd[] = {0xae, 0xd5, 0x80};
+    const uint8_t data[] = {0x00, 0xff, 0x0f};
+
+    //nothing is recorded until a capture target is set
+    bus.captureSpi(0x1000, cmd, 3);
+    EXPECT(!bus.isCapturing());
+
+    bus.setCapture(out);
+    EXPECT(bus.isCapturing());
+    bus.captureGpio(25, 0);
+    bus.captureSpi(0x1000, cmd, 3);
+    bus.captureSpi(0x2000, data, 3);
+    bus.captureI2C(0x1000, 0x3c, data, 2);
+    bus.captureSpi(0x1000, data, 0);
+    bus.closeCapture();
+    EXPECT(!bus.isCapturing());
+    bus.captureGpio(25, 1);
+
+    //devices are numbered in order of appearance, not by address
+    std::string expected = "gpio 25 0\n"
+                           "spi 0 aed580\n"
+                           "spi 1 00ff0f\n"
+                           "i2c 0 3c 00ff\n"
+                           "spi 0 \n";
+    EXPECT(out->str() == expected);
+}
+
+void testConcurrentCapture() {
+    UcgdSimBus bus;
+    auto out = std::make_shared<std::ostringstream>();
+    bus.setCapture(out);
+    const uint8_t data[] = {0x12, 0x34};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&bus, &data, t]() {
+            for (int i = 0; i < 250; i++)
+                bus.captureSpi(0x1000 + t, data, 2);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    //every transaction lands on its own line
+    std::istringstream in(out->str());
+    std::string line;
+    int lines = 0;
+    while (std::getline(in, line)) {
+        EXPECT(line.size() == std::string("spi 0 1234").size());
+        lines++;
+    }
+    EXPECT(lines == 1000);
+}
+
+void testCaptureFlushed() {
+    //every record reaches the file right away, the capture may be cut short by a crash
+    std::string path = "/tmp/ucgd-simbus-test-" + std::to_string(getpid()) + ".cap";
+    UcgdSimBus bus;
+    const uint8_t data[] = {0x12, 0x34};
+    bus.openCapture(path);
+    bus.captureSpi(0x1000, data, 2);
+    bus.captureI2C(0x1000, 0x3c, data, 1);
+    bus.captureGpio(24, 1);
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    EXPECT(contents.str() == "spi 0 1234\ni2c 0 3c 12\ngpio 24 1\n");
+    bus.closeCapture();
+    std::remove(path.c_str());
+}
+
+int main() {
+    testDuration();
+    testJitter();
+    testTransferWaits();
+    testCapture();
+    testConcurrentCapture();
+    testCaptureFlushed();
+
+    return testResult("sim bus");
+}
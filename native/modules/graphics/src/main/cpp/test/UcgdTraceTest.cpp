@@ -0,0 +1,97 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <UcgdTrace.h>
+#include "TestSupport.h"
+
+static size_t countOf(const std::string &text, const std::string &pattern) {
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+        count++;
+    return count;
+}
+
+static std::string exportTrace(size_t &count) {
+    std::stringstream out;
+    count = UcgdTrace::exportJson(out);
+    return out.str();
+}
+
+static void drawFrame(int id) {
+    UCGD_TRACE_SCOPE_ARG("jni", "sendBuffer", "id", id);
+    {
+        UCGD_TRACE_SCOPE("hal", "byte_cb");
+        UCGD_TRACE_SCOPE_ARG("transport", "spi.write", "bytes", 128);
+    }
+}
+
+void testDisabled() {
+    UcgdTrace::clear();
+    UcgdTrace::setEnabled(false);
+    drawFrame(1);
+    size_t count = 0;
+    std::string json = exportTrace(count);
+    EXPECT(count == 0);
+    EXPECT(json.find("\"traceEvents\":[") != std::string::npos);
+}
+
+void testExport() {
+    UcgdTrace::clear();
+    UcgdTrace::setEnabled(true);
+    drawFrame(1);
+    std::thread second([]() { drawFrame(2); });
+    second.join();
+    UcgdTrace::setEnabled(false);
+
+    size_t count = 0;
+    std::string json = exportTrace(count);
+    EXPECT(count == 6);
+    EXPECT(countOf(json, "\"ph\":\"X\"") == 6);
+    EXPECT(countOf(json, "\"name\":\"thread_name\"") == 2);
+    EXPECT(countOf(json, "\"name\":\"sendBuffer\",\"cat\":\"jni\"") == 2);
+    EXPECT(json.find("\"args\":{\"id\":2}") != std::string::npos);
+    EXPECT(json.find("\"args\":{\"bytes\":128}") != std::string::npos);
+    EXPECT(json.front() == '{');
+    EXPECT(json.find("]}") != std::string::npos);
+}
+
+void testRingOverwrite() {
+    UcgdTrace::clear();
+    UcgdTrace::setEnabled(true);
+    std::thread writer([]() {
+        for (int i = 0; i < TRACE_BUFFER_EVENTS + 100; i++) {
+            UCGD_TRACE_SCOPE_ARG("hal", "delay_nano", "arg", i);
+        }
+    });
+    writer.join();
+    UcgdTrace::setEnabled(false);
+    size_t count = 0;
+    std::string json = exportTrace(count);
+    EXPECT(count == TRACE_BUFFER_EVENTS);
+    //the oldest events have been overwritten
+    EXPECT(json.find("\"args\":{\"arg\":99}") == std::string::npos);
+    EXPECT(json.find("\"args\":{\"arg\":100}") != std::string::npos);
+}
+
+void testClear() {
+    UcgdTrace::setEnabled(true);
+    drawFrame(3);
+    UcgdTrace::clear();
+    size_t count = 0;
+    exportTrace(count);
+    EXPECT(count == 0);
+    drawFrame(4);
+    exportTrace(count);
+    EXPECT(count == 3);
+    UcgdTrace::setEnabled(false);
+}
+
+int main() {
+    testDisabled();
+    testExport();
+    testRingOverwrite();
+    testClear();
+
+    return testResult("trace");
+}
@@ -0,0 +1,150 @@
+#include <cstring>
+#include <iostream>
+#include <UcgdTransport.h>
+
+extern "C" {
+#include <u8g2.h>
+}
+#include "TestSupport.h"
+
+//A bus failing the writes from the given index on, for the given number of attempts
+struct test_bus_t {
+    UcgdTransport transport;
+    int failFrom = -1;
+    int failCount = 0;
+    int attempts = 0;
+    int writes = 0;
+    int bytes = 0;
+
+    int write(int count) {
+        attempts++;
+        if (failFrom >= 0 && writes >= failFrom && failCount > 0) {
+            failCount--;
+            return transport.fail(TRANSPORT_ERR_WRITE, "write %d failed", writes);
+        }
+        writes++;
+        bytes += count;
+        return count;
+    }
+};
+
+static test_bus_t bus;
+
+//Same checks as the byte callback of a device: skip the rest of the frame once a write failed
+static uint8_t byteCallback(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    if (bus.transport.failed())
+        return 0;
+    if (msg == U8X8_MSG_BYTE_SEND && !bus.transport.run([&]() { return bus.write(arg_int); }))
+        return 0;
+    return 1;
+}
+
+static void testSticky() {
+    UcgdTransport transport;
+    EXPECT(!transport.failed());
+    EXPECT(transport.fail(TRANSPORT_ERR_NOT_OPEN, "device %s", "closed") == TRANSPORT_ERR_NOT_OPEN);
+    EXPECT(transport.failed());
+    //only the first error is kept
+    transport.fail(TRANSPORT_ERR_WRITE, "second");
+    transport.interrupt(2);
+    EXPECT(transport.getCode() == TRANSPORT_ERR_NOT_OPEN);
+    EXPECT(std::strcmp(transport.getMessage(), "device closed") == 0);
+    EXPECT(transport.getSignal() == 0);
+
+    //nothing is written once an error is recorded
+    int calls = 0;
+    EXPECT(!transport.run([&]() { calls++; return 1; }));
+    EXPECT(calls == 0);
+
+    transport.clear();
+    EXPECT(!transport.failed());
+    EXPECT(transport.getMessage()[0] == '\0');
+    transport.interrupt(15);
+    EXPECT(transport.getCode() == TRANSPORT_ERR_INTERRUPTED && transport.getSignal() == 15);
+
+    //long messages are truncated
+    transport.clear();
+    std::string reason(TRANSPORT_MESSAGE_SIZE * 2, 'x');
+    transport.fail(TRANSPORT_ERR_WRITE, "%s", reason.c_str());
+    EXPECT(std::strlen(transport.getMessage()) == TRANSPORT_MESSAGE_SIZE - 1);
+}
+
+static void testRetry() {
+    UcgdTransport transport;
+    transport.setRetryPolicy(3, 0);
+
+    //fails twice then succeeds
+    int calls = 0;
+    EXPECT(transport.run([&]() { return ++calls < 3 ? transport.fail(TRANSPORT_ERR_WRITE, "busy") : 4; }));
+    EXPECT(calls == 3);
+    EXPECT(!transport.failed());
+    EXPECT(transport.getRetryCount() == 2);
+
+    //gives up after the retries
+    calls = 0;
+    EXPECT(!transport.run([&]() { calls++; return transport.fail(TRANSPORT_ERR_WRITE, "attempt %d", calls); }));
+    EXPECT(calls == 4);
+    EXPECT(std::strcmp(transport.getMessage(), "attempt 4") == 0);
+    EXPECT(transport.getRetryCount() == 5);
+
+    //a device that is not open is not retried
+    transport.clear();
+    calls = 0;
+    EXPECT(!transport.run([&]() { calls++; return transport.fail(TRANSPORT_ERR_NOT_OPEN, "not open"); }));
+    EXPECT(calls == 1);
+
+    //a write failing without a description still records an error
+    transport.clear();
+    transport.setRetryPolicy(0, 0);
+    EXPECT(!transport.run([]() { return -1; }));
+    EXPECT(transport.getCode() == TRANSPORT_ERR_WRITE);
+    EXPECT(std::strstr(transport.getMessage(), "-1") != nullptr);
+}
+
+static void testFrameAbort() {
+    u8g2_t u8g2;
+    u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, byteCallback, u8x8_dummy_cb);
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_DrawBox(&u8g2, 10, 10, 50, 30);
+
+    //reference frame
+    u8g2_SendBuffer(&u8g2);
+    int frameWrites = bus.writes, frameBytes = bus.bytes;
+    EXPECT(!bus.transport.failed());
+    EXPECT(frameWrites > 8);
+
+    //a failed write aborts the rest of the frame
+    bus = {};
+    bus.failFrom = 3;
+    bus.failCount = 1;
+    u8g2_SendBuffer(&u8g2);
+    EXPECT(bus.transport.failed());
+    EXPECT(bus.writes == 3);
+    EXPECT(bus.attempts == 4);
+
+    //the next frame is sent once the error has been taken
+    bus.transport.clear();
+    bus.writes = 0;
+    bus.bytes = 0;
+    u8g2_SendBuffer(&u8g2);
+    EXPECT(!bus.transport.failed());
+    EXPECT(bus.writes == frameWrites && bus.bytes == frameBytes);
+
+    //retried writes complete the frame
+    bus = {};
+    bus.transport.setRetryPolicy(2, 0);
+    bus.failFrom = 5;
+    bus.failCount = 2;
+    u8g2_SendBuffer(&u8g2);
+    EXPECT(!bus.transport.failed());
+    EXPECT(bus.writes == frameWrites && bus.bytes == frameBytes);
+    EXPECT(bus.transport.getRetryCount() == 2);
+}
+
+int main() {
+    testSticky();
+    testRetry();
+    testFrameAbort();
+
+    return testResult("transport");
+}
@@ -1,4 +1,5 @@
 #include "codegen.h"
+#include <UcgdFontPack.h>
 #include <iterator>
 #include <utility>
 #include <regex>
@@ -28,10 +29,14 @@ static map<string, string> paths;
 #define FILE_CONTROLLERS "controllers.h"
 #define FILE_LOOKUP_SETUP "U8g2LookupSetup.cpp"
 #define FILE_LOOKUP_FONTS "U8g2LookupFonts.cpp"
+#define FILE_LOOKUP_SETUP_INDEX "U8g2LookupSetupIndex.cpp"
+#define FILE_SETUP_PLUGINS "U8g2SetupPlugins.cpp"
+#define FILE_SETUP_PLUGINS_CMAKE "U8g2SetupPlugins.cmake"
 #define FILE_JAVA_GLCDSIZE "GlcdSize.java"
 #define FILE_JAVA_GLCD "Glcd.java"
 #define FILE_JAVA_GLCDCONTROLLERTYPE "GlcdControllerType.java"
 #define FILE_JAVA_GLCDFONT "GlcdFont.java"
+#define FILE_FONT_PACK FONT_PACK_FILE
 
 static vector<string> excludeFonts = {"u8g2_font_siji_t"};
 static vector<string> win32_excluded_fonts = {
@@ -583,6 +588,9 @@ void buildCode_GlcdFont() {
  */
 void buildCode_updateCppLookupSetupFunctions() {
     set<string> setupfunctions;
+    //page buffer (1 and 2 pages) and full buffer variants
+    getSetupFunctions(setupfunctions, BUFFER_CODE_1);
+    getSetupFunctions(setupfunctions, BUFFER_CODE_2);
     getSetupFunctions(setupfunctions, BUFFER_CODE_FULL);
 
     stringstream code;
@@ -604,6 +612,80 @@ void buildCode_updateCppLookupSetupFunctions() {
     saveFileToOutputDir(FILE_LOOKUP_SETUP, data);
 }
 
+/**
+ * Group the setup functions by controller for the controller plugins (UCGD_SETUP_PLUGINS, see UcgdSetupPlugin.h).
+ * Generates the entries of every controller (each group guarded by UCGD_SETUP_<CONTROLLER>), the index of setup function
+ * names to controllers used by the library and the list of controllers used by cmake to create the plugin targets.
+ */
+void buildCode_updateCppSetupPlugins() {
+    map<string, set<string>> controllers;
+    const string bufferCodes[] = {BUFFER_CODE_1, BUFFER_CODE_2, BUFFER_CODE_FULL};
+    for (int i = 0; i < sizeof(controller_list) / sizeof(*controller_list); i++) {
+        string name = string(strlowercase(controller_list[i].name));
+        int id = 0;
+        while (controller_list[i].display_list[id].name != nullptr) {
+            for (const auto &bufferCode : bufferCodes)
+                controllers[name].insert(getSetupFunctionName(i, id, bufferCode));
+            id++;
+        }
+    }
+
+    //Setup entries, built into a plugin with UCGD_SETUP_PLUGIN="<controller>" or into the library for the embedded controllers
+    stringstream code;
+    appendAutogenMsg(code);
+
+    code << "#include \"UcgdSetupPlugin.h\"\n\n";
+    code << "static const ucgd_setup_entry_t setup_entries[] = {\n";
+    for (const auto &controller : controllers) {
+        string macro = controller.first;
+        transform(macro.begin(), macro.end(), macro.begin(), ::toupper);
+        code << "#if defined(UCGD_SETUP_" << macro << ")\n";
+        for (const auto &setup : controller.second)
+            code << "\t{\"" << setup << "\", " << setup << "},\n";
+        code << "#endif\n";
+    }
+    code << "\t{nullptr, nullptr}\n";
+    code << "};\n\n";
+
+    code << "#if defined(UCGD_SETUP_PLUGIN)\n";
+    code << "UCGD_SETUP_PLUGIN_EXPORT const ucgd_setup_plugin_t *ucgd_setup_plugin() {\n";
+    code << "\tstatic const ucgd_setup_plugin_t plugin = {SETUP_PLUGIN_ABI, UCGD_SETUP_PLUGIN, setup_entries};\n";
+    code << "\treturn &plugin;\n";
+    code << "}\n";
+    code << "#else\n";
+    code << "#include \"U8g2Hal.h\"\n\n";
+    code << "void U8g2hal_InitSetupFunctions(u8g2_setup_func_map_t &setup_map) {\n";
+    code << "\tsetup_map.clear();\n";
+    code << "\tfor (auto entry = setup_entries; entry->name != nullptr; entry++)\n";
+    code << "\t\tsetup_map[entry->name] = entry->proc;\n";
+    code << "}\n";
+    code << "#endif";
+    saveFileToOutputDir(FILE_SETUP_PLUGINS, code.str());
+
+    //Index of the setup functions
+    stringstream index;
+    appendAutogenMsg(index);
+
+    index << "#include \"U8g2Hal.h\"\n\n";
+    index << "void U8g2hal_InitSetupIndex(u8g2_setup_index_map_t &index_map) {\n";
+    index << "\tindex_map.clear();\n";
+    for (const auto &controller : controllers) {
+        for (const auto &setup : controller.second)
+            index << "\tindex_map[\"" << setup << "\"] = \"" << controller.first << "\";" << endl;
+    }
+    index << "}";
+    saveFileToOutputDir(FILE_LOOKUP_SETUP_INDEX, index.str());
+
+    //Controller list for cmake
+    stringstream list;
+    list << "#\n# THIS IS AN AUTO-GENERATED CODE!! PLEASE DO NOT MODIFY (Last updated: " __DATE__ " " __TIME__ ")\n#\n\n";
+    list << "set(UCGD_SETUP_CONTROLLERS\n";
+    for (const auto &controller : controllers)
+        list << "        " << controller.first << "\n";
+    list << "        )\n";
+    saveFileToOutputDir(FILE_SETUP_PLUGINS_CMAKE, list.str());
+}
+
 void buildCode_updateCppLookupFonts() {
     string fontFileDir = U8G2_PROJECT_PATH + "/tools/font/build/single_font_files";
     vector<string> fontFiles = getAvailableFonts(fontFileDir);
@@ -650,6 +732,45 @@ void buildCode_updateCppLookupFonts() {
     saveFileToOutputDir(FILE_LOOKUP_FONTS, data);
 }
 
+/**
+ * Pack the fonts of the single font files into one indexed file that the library maps on demand (see UcgdFontPack.h).
+ * The fonts excluded from the lookup table on windows are packed as well, they are not compiled.
+ *
+ * @param fontFileDir The directory of the single font files
+ * @param outputFile The path of the font pack
+ * @return true if the pack was written
+ */
+bool buildCode_FontPack(const string &fontFileDir, const string &outputFile) {
+    vector<string> fontFiles = getAvailableFonts(fontFileDir);
+    if (fontFiles.empty())
+        return false;
+
+    vector<pair<string, vector<uint8_t>>> fonts;
+    size_t total = 0;
+    for (const auto &fontName : fontFiles) {
+        if (std::find(excludeFonts.begin(), excludeFonts.end(), fontName) != excludeFonts.end()) {
+            cout << "> Skipped: " << fontName << endl;
+            continue;
+        }
+        vector<uint8_t> data;
+        if (!readFontData(fontFileDir + "/" + fontName + ".c", data)) {
+            cerr << "> Unable to read font data: " << fontName << endl;
+            continue;
+        }
+        total += data.size();
+        fonts.emplace_back(fontName, std::move(data));
+    }
+
+    try {
+        UcgdFontPack::write(outputFile, fonts);
+    } catch (std::runtime_error &e) {
+        cerr << e.what() << endl;
+        return false;
+    }
+    cout << "> Packed " << fonts.size() << " fonts (" << total << " bytes) into " << outputFile << endl;
+    return true;
+}
+
 void buildCode_updateControllerDefinitions(const string &codeBuildSrcFilePath) {
     regex start_ctrl_regex(".*display_controller_list_start.*");
     regex end_ctrl_regex(".*display_controller_list_end.*");
@@ -759,6 +880,15 @@ int main(int argc, char *argv[]) {
         return -1;
     }
 
+    //Only build the font pack: ucgd-code --font-pack <single font files dir> <output file>
+    if (strcmp(argv[1], "--font-pack") == 0) {
+        if (argc < 4) {
+            cerr << "Usage: " << argv[0] << " --font-pack <font source dir> <output file>" << endl;
+            return -1;
+        }
+        return buildCode_FontPack(argv[2], argv[3]) ? 0 : -1;
+    }
+
     const char *basePathArg = argv[1];
     projectPath = string(basePathArg);
 
@@ -792,9 +922,17 @@ int main(int argc, char *argv[]) {
     //Update lookup map for u8g2 setup functions
     buildCode_updateCppLookupSetupFunctions();
 
+    //Update the controller plugins and their index
+    buildCode_updateCppSetupPlugins();
+
     //Update lookup map for u8g2 fonts
     buildCode_updateCppLookupFonts();
 
+    //Pack the fonts for builds that do not embed them
+    string outputDir = GetCurrentWorkingDir() + "/output";
+    if (initOutputDir(outputDir))
+        buildCode_FontPack(U8G2_FONT_PATH, outputDir + "/" + FILE_FONT_PACK);
+
     //Start generating java code
     buildCode_GlcdSize();
     buildCode_GlcdControllerType();
@@ -814,6 +952,9 @@ int main(int argc, char *argv[]) {
         //exportFile(FILE_CONTROLLERS, BASE_PROJECT_PATH_NATIVE_CPP + "/utils/" + FILE_CONTROLLERS);
         exportFile(FILE_LOOKUP_SETUP, BASE_PROJECT_PATH_NATIVE_CPP + "/" + FILE_LOOKUP_SETUP);
         exportFile(FILE_LOOKUP_FONTS, BASE_PROJECT_PATH_NATIVE_CPP + "/" + FILE_LOOKUP_FONTS);
+        exportFile(FILE_LOOKUP_SETUP_INDEX, BASE_PROJECT_PATH_NATIVE_CPP + "/" + FILE_LOOKUP_SETUP_INDEX);
+        exportFile(FILE_SETUP_PLUGINS, BASE_PROJECT_PATH_NATIVE_CPP + "/" + FILE_SETUP_PLUGINS);
+        exportFile(FILE_SETUP_PLUGINS_CMAKE, BASE_PROJECT_PATH_NATIVE_CPP + "/" + FILE_SETUP_PLUGINS_CMAKE);
         exportFile(FILE_JAVA_GLCDSIZE, enumDirPath + "/" + FILE_JAVA_GLCDSIZE);
         exportFile(FILE_JAVA_GLCDCONTROLLERTYPE, enumDirPath + "/" + FILE_JAVA_GLCDCONTROLLERTYPE);
         exportFile(FILE_JAVA_GLCD, baseGlcdPackageDirPath + "/" + FILE_JAVA_GLCD);
@@ -19,6 +19,7 @@
 #include <ctime>
 #include <iomanip>
 #include <dirent.h>
+#include <iterator>
 
 using namespace std;
 
@@ -89,7 +90,7 @@ struct controller {
     unsigned com;
     char *note;
     unsigned is_generate_u8g2_class;    /* currently not used, instead conrolled by COM_UART */
-    struct display display_list[10];    /* usually not used completly, but space does not matter much here */
+    struct display display_list[16];    /* usually not used completly, but space does not matter much here */
 };
 
 bool fileExists(const string &file) {
@@ -186,6 +187,69 @@ vector<string> getAvailableFonts(const string &dirPath) {
     return files;
 }
 
+/**
+ * Read the data of a single font file (tools/font/build/single_font_files) by decoding the string literals of its array initializer
+ *
+ * @param filePath The path of the font source file
+ * @param data Receives the font data including the terminating zero of the literal
+ * @return true if the initializer was found
+ */
+bool readFontData(const string &filePath, vector<uint8_t> &data) {
+    ifstream file(filePath);
+    if (!file)
+        return false;
+    string source((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    //the section attribute holds a string as well, the data follows the assignment
+    size_t pos = source.find('=');
+    size_t end = source.find(';', pos);
+    if (pos == string::npos || end == string::npos)
+        return false;
+    data.clear();
+    bool inLiteral = false;
+    for (size_t i = pos + 1; i < end; i++) {
+        char c = source[i];
+        if (!inLiteral) {
+            if (c == '"')
+                inLiteral = true;
+            continue;
+        }
+        if (c == '"') {
+            inLiteral = false;
+        } else if (c != '\\') {
+            data.push_back(static_cast<uint8_t>(c));
+        } else {
+            c = source[++i];
+            if (c >= '0' && c <= '7') {
+                int value = 0;
+                for (int n = 0; n < 3 && source[i] >= '0' && source[i] <= '7'; n++, i++)
+                    value = (value * 8) + (source[i] - '0');
+                i--;
+                data.push_back(static_cast<uint8_t>(value));
+            } else if (c == 'x') {
+                int value = 0;
+                while (isxdigit(static_cast<unsigned char>(source[i + 1])))
+                    value = (value * 16) + stoi(string(1, source[++i]), nullptr, 16);
+                data.push_back(static_cast<uint8_t>(value));
+            } else {
+                switch (c) {
+                    case 'n': data.push_back('\n'); break;
+                    case 'r': data.push_back('\r'); break;
+                    case 't': data.push_back('\t'); break;
+                    case 'a': data.push_back('\a'); break;
+                    case 'b': data.push_back('\b'); break;
+                    case 'f': data.push_back('\f'); break;
+                    case 'v': data.push_back('\v'); break;
+                    default: data.push_back(static_cast<uint8_t>(c)); break;
+                }
+            }
+        }
+    }
+    if (data.empty())
+        return false;
+    data.push_back(0);
+    return true;
+}
+
 vector<string> tokenizeString(const string &str, char delim) {
     std::istringstream ss(str);
     std::string token;
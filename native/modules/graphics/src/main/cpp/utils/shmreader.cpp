@@ -0,0 +1,69 @@
+/*
+ * Reference reader of the shared memory frame ring published by ucgdisp (shm_name option).
+ *
+ * Usage: ucgd-shm-reader <name> [frames] [output.pbm]
+ *
+ * Waits for the given number of frames (default 1), prints the frame number and the publish-to-read latency of each
+ * one and optionally writes the last 1bpp image as a portable bitmap.
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <UcgdFrameShm.h>
+
+static auto pixelAt(const ucgd_shm_header_t &header, const std::vector<uint8_t> &mono, uint32_t x, uint32_t y) -> bool {
+    if (header.layout == SHM_LAYOUT_VERTICAL)
+        return (mono[(y / 8) * header.width + x] >> (y % 8)) & 1;
+    return (mono[y * (header.width / 8) + (x / 8)] >> (7 - (x % 8))) & 1;
+}
+
+static void writePbm(const std::string &path, const ucgd_shm_header_t &header, const std::vector<uint8_t> &mono) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << "P4\n" << header.width << " " << header.height << "\n";
+    for (uint32_t y = 0; y < header.height; y++) {
+        for (uint32_t x = 0; x < header.width; x += 8) {
+            uint8_t value = 0;
+            for (uint32_t bit = 0; bit < 8; bit++) {
+                if (pixelAt(header, mono, x + bit, y))
+                    value |= 0x80 >> bit;
+            }
+            out.put(static_cast<char>(value));
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <name> [frames] [output.pbm]" << std::endl;
+        return 2;
+    }
+    try {
+        UcgdFrameReader reader(argv[1]);
+        const ucgd_shm_header_t &header = reader.header();
+        int frames = argc > 2 ? std::atoi(argv[2]) : 1;
+        std::cout << "ring: " << header.width << "x" << header.height << ", " << header.slot_count << " slots, format "
+                  << header.format << ", writer pid " << header.writer_pid << std::endl;
+
+        std::vector<uint8_t> mono(header.mono_size);
+        uint32_t last = 0;
+        for (int i = 0; i < frames; i++) {
+            if (reader.wait(last, 5000) == 0) {
+                std::cerr << "Timed out waiting for a frame" << std::endl;
+                return 1;
+            }
+            uint64_t timestamp = 0;
+            ucgd_shm_area_t dirty{};
+            last = reader.read(mono.data(), nullptr, &timestamp, &dirty);
+            std::cout << "frame " << last << " latency " << (ucgdMonotonicNanos() - timestamp) / 1000.0 << " us"
+                      << ", dirty tiles " << dirty.x << "," << dirty.y << " " << dirty.width << "x" << dirty.height << std::endl;
+        }
+        if (argc > 3 && header.mono_size > 0)
+            writePbm(argv[3], header, mono);
+    } catch (std::runtime_error &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*-
+ * ========================START=================================
+ * UCGDisplay :: Native :: Graphics
+ * %%
+ * Copyright (C) 2018 - 2021 Universal Character/Graphics display library
+ * %%
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Lesser Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Lesser Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/lgpl-3.0.html>.
+ * =========================END==================================
+ */
+package com.ibasco.ucgdisplay.core.input;
+
+import com.ibasco.ucgdisplay.core.u8g2.U8g2Graphics;
+
+import java.nio.ByteBuffer;
+
+/**
+ * <p>Native input subsystem. A single native thread waits on every opened device (evdev devices and gpio lines),
+ * debounces buttons, decodes rotary encoders and queues the events in a lock-free ring. The events are drained in
+ * batches with {@link #read(ByteBuffer, int)}, there is no upcall per event. Linux only.</p>
+ *
+ * <p>Each event is {@link #EVENT_SIZE} bytes, little endian:</p>
+ * <ul>
+ *     <li>0: timestamp (long, CLOCK_MONOTONIC in nanoseconds)</li>
+ *     <li>8: source (int, the handle returned when the device was opened)</li>
+ *     <li>12: type (short, one of the TYPE_* constants)</li>
+ *     <li>14: code (short, the evdev code, the line offset of a button or {@link #CODE_ENCODER})</li>
+ *     <li>16: value (int, 1/0 for pressed/released buttons, the number of detents turned for encoders)</li>
+ *     <li>20: reserved (int)</li>
+ * </ul>
+ *
+ * @author Rafael Ibasco
+ */
+@SuppressWarnings("WeakerAccess")
+public class InputDeviceManager {
+
+    /**
+     * Size of an event in bytes
+     */
+    public static final int EVENT_SIZE = 24;
+
+    /**
+     * Key or button event (EV_KEY)
+     */
+    public static final int TYPE_KEY = 0x01;
+
+    /**
+     * Relative axis event (EV_REL), reported by rotary encoders
+     */
+    public static final int TYPE_REL = 0x02;
+
+    /**
+     * Absolute axis event (EV_ABS)
+     */
+    public static final int TYPE_ABS = 0x03;
+
+    /**
+     * Switch event (EV_SW)
+     */
+    public static final int TYPE_SW = 0x05;
+
+    /**
+     * Code of the {@link #TYPE_REL} events of a gpio rotary encoder (REL_DIAL)
+     */
+    public static final int CODE_ENCODER = 0x07;
+
+    static {
+        U8g2Graphics.loadLibrary();
+    }
+
+    private InputDeviceManager() {
+    }
+
+    /**
+     * Open an evdev device
+     *
+     * @param path
+     *         Path of the device (e.g. /dev/input/event0)
+     * @param grab
+     *         Grab the device, other readers (e.g. the console) stop receiving its events
+     *
+     * @return The handle of the device (source of its events)
+     */
+    public static native int openEvdev(String path, boolean grab);
+
+    /**
+     * Open a button connected to a gpio line. Presses and releases are reported as {@link #TYPE_KEY} events with the
+     * line offset as code.
+     *
+     * @param chip
+     *         The gpio chip (e.g. gpiochip0 or /dev/gpiochip0)
+     * @param line
+     *         The line offset
+     * @param debounce
+     *         Time in microseconds during which edges following a reported edge are ignored (0 to disable)
+     * @param activeLow
+     *         The button pulls the line low when pressed (a pull-up is requested where the kernel supports it)
+     *
+     * @return The handle of the button (source of its events)
+     */
+    public static native int openButton(String chip, int line, int debounce, boolean activeLow);
+
+    /**
+     * Open a quadrature rotary encoder connected to two gpio lines. Each completed detent is reported as a
+     * {@link #TYPE_REL}/{@link #CODE_ENCODER} event, the value is negative when turned counter clockwise.
+     *
+     * @param chip
+     *         The gpio chip (e.g. gpiochip0 or /dev/gpiochip0)
+     * @param lineA
+     *         Line offset of channel A
+     * @param lineB
+     *         Line offset of channel B
+     * @param stepsPerDetent
+     *         Quadrature steps between two detents (1, 2 or 4)
+     *
+     * @return The handle of the encoder (source of its events)
+     */
+    public static native int openEncoder(String chip, int lineA, int lineB, int stepsPerDetent);
+
+    /**
+     * Close a device. Events of the device still in the queue are not removed.
+     *
+     * @param handle
+     *         The handle returned when the device was opened
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean close(int handle);
+
+    /**
+     * Move the pending events into a direct buffer. The position and limit of the buffer are not modified.
+     *
+     * @param buffer
+     *         A direct buffer, the number of events read is limited by its capacity ({@link #EVENT_SIZE} bytes per event)
+     * @param timeout
+     *         Time to wait for the first event in milliseconds (0 returns immediately, negative waits until an event arrives)
+     *
+     * @return The number of events written, starting at index 0 of the buffer
+     */
+    public static native int read(ByteBuffer buffer, int timeout);
+
+    /**
+     * @return The number of events dropped because the queue was full (events are not read fast enough)
+     */
+    public static native long getDroppedCount();
+}
@@ -22,6 +22,7 @@
 package com.ibasco.ucgdisplay.core.u8g2;
 
 import com.ibasco.ucgdisplay.common.exceptions.NativeLibraryLoaderException;
+import com.ibasco.ucgdisplay.core.u8g2.utils.NativeUtils;
 import org.scijava.nativelib.NativeLoader;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
@@ -167,6 +168,548 @@ public class U8g2Graphics {
     public static final int U8G2_DRAW_ALL = (U8G2_DRAW_UPPER_RIGHT | U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_RIGHT | U8G2_DRAW_LOWER_LEFT);
     //</editor-fold>
 
+    //<editor-fold desc="Text run options">
+
+    /**
+     * The anchor point is the start of the text run (default)
+     *
+     * @see #drawTextRuns(long, String[], int[])
+     */
+    public static final int TEXT_ALIGN_LEFT = 0x0;
+
+    /**
+     * The anchor point is the center of the text run
+     *
+     * @see #drawTextRuns(long, String[], int[])
+     */
+    public static final int TEXT_ALIGN_CENTER = 0x1;
+
+    /**
+     * The anchor point is the end of the text run
+     *
+     * @see #drawTextRuns(long, String[], int[])
+     */
+    public static final int TEXT_ALIGN_RIGHT = 0x2;
+
+    /**
+     * Only measure the text run, nothing is drawn
+     *
+     * @see #drawTextRuns(long, String[], int[])
+     */
+    public static final int TEXT_MEASURE_ONLY = 0x100;
+
+    /**
+     * Number of parameters (x, y, flags) per text run
+     */
+    public static final int TEXT_RUN_PARAM_SIZE = 3;
+
+    /**
+     * Number of values (x, y, width, height) returned per text run
+     */
+    public static final int TEXT_RUN_EXTENT_SIZE = 4;
+    //</editor-fold>
+
+    //<editor-fold desc="Blit modes">
+
+    /**
+     * Clear the pixels of the display where the source bit is set
+     *
+     * @see #blit(long, int, int, int, int, ByteBuffer, int)
+     */
+    public static final int BLIT_MODE_CLEAR = 0;
+
+    /**
+     * Set the pixels of the display where the source bit is set
+     *
+     * @see #blit(long, int, int, int, int, ByteBuffer, int)
+     */
+    public static final int BLIT_MODE_SET = 1;
+
+    /**
+     * Invert the pixels of the display where the source bit is set
+     *
+     * @see #blit(long, int, int, int, int, ByteBuffer, int)
+     */
+    public static final int BLIT_MODE_XOR = 2;
+
+    /**
+     * Replace the pixels of the display with the source (set and unset bits are both written)
+     *
+     * @see #blit(long, int, int, int, int, ByteBuffer, int)
+     */
+    public static final int BLIT_MODE_COPY = 3;
+    //</editor-fold>
+
+    //<editor-fold desc="Dither modes">
+
+    /**
+     * Any non-zero pixel is drawn using the current draw color, the rest are left untouched (Default)
+     *
+     * @see #setDitherMode(long, int, int)
+     */
+    public static final int DITHER_NONE = 0;
+
+    /**
+     * Pixels with a luma greater than the threshold are set, the rest are cleared
+     *
+     * @see #setDitherMode(long, int, int)
+     */
+    public static final int DITHER_THRESHOLD = 1;
+
+    /**
+     * Ordered dithering using a 4x4 bayer matrix
+     *
+     * @see #setDitherMode(long, int, int)
+     */
+    public static final int DITHER_BAYER4 = 2;
+
+    /**
+     * Ordered dithering using an 8x8 bayer matrix
+     *
+     * @see #setDitherMode(long, int, int)
+     */
+    public static final int DITHER_BAYER8 = 3;
+
+    /**
+     * Floyd-Steinberg error diffusion
+     *
+     * @see #setDitherMode(long, int, int)
+     */
+    public static final int DITHER_FLOYD_STEINBERG = 4;
+
+    /**
+     * Atkinson error diffusion
+     *
+     * @see #setDitherMode(long, int, int)
+     */
+    public static final int DITHER_ATKINSON = 5;
+
+    /**
+     * The default luma threshold (0 - 255)
+     */
+    public static final int DITHER_DEFAULT_THRESHOLD = 127;
+    //</editor-fold>
+
+    //<editor-fold desc="Sprite formats">
+
+    /**
+     * Rows are byte aligned, least significant bit first (same as {@link #drawXBM(long, int, int, int, int, byte[])})
+     *
+     * @see #uploadSprite(long, byte[], int, int, int)
+     */
+    public static final int SPRITE_FORMAT_XBM = 0;
+
+    /**
+     * Rows are byte aligned, most significant bit first (same as {@link #blit(long, int, int, int, int, ByteBuffer, int)})
+     *
+     * @see #uploadSprite(long, byte[], int, int, int)
+     */
+    public static final int SPRITE_FORMAT_1BPP = 1;
+    //</editor-fold>
+
+    //<editor-fold desc="Export formats">
+
+    /**
+     * 1bpp rows, most significant bit first, each row padded to a byte. A set bit is a set pixel.
+     *
+     * @see #exportBuffer(long, int, ByteBuffer)
+     */
+    public static final int EXPORT_FORMAT_RAW = 0;
+
+    /**
+     * Binary <a href="https://en.wikipedia.org/wiki/Netpbm_format">PBM</a> (P4). Set pixels are black.
+     *
+     * @see #exportBuffer(long, int, ByteBuffer)
+     */
+    public static final int EXPORT_FORMAT_PBM = 1;
+
+    /**
+     * <a href="https://en.wikipedia.org/wiki/X_BitMap">XBM</a> source text (US-ASCII)
+     *
+     * @see #exportBuffer(long, int, ByteBuffer)
+     */
+    public static final int EXPORT_FORMAT_XBM = 2;
+
+    /**
+     * 1-bit grayscale PNG (uncompressed). Set pixels are black.
+     *
+     * @see #exportBuffer(long, int, ByteBuffer)
+     */
+    public static final int EXPORT_FORMAT_PNG = 3;
+    //</editor-fold>
+
+    //<editor-fold desc="Recording info">
+
+    /**
+     * Index of the buffer width (in pixels)
+     *
+     * @see #getRecordingInfo(String)
+     */
+    public static final int RECORDING_INFO_WIDTH = 0;
+
+    /**
+     * Index of the buffer height (in pixels)
+     *
+     * @see #getRecordingInfo(String)
+     */
+    public static final int RECORDING_INFO_HEIGHT = 1;
+
+    /**
+     * Index of the buffer layout. 0 = tiles of 8 vertical pixels (least significant bit on top), 1 = rows of 8 horizontal
+     * pixels (most significant bit on the left). This is the same as the layout of {@link #getBuffer(long)}.
+     *
+     * @see #getRecordingInfo(String)
+     */
+    public static final int RECORDING_INFO_LAYOUT = 2;
+
+    /**
+     * Index of the size of a frame in bytes
+     *
+     * @see #getRecordingInfo(String)
+     */
+    public static final int RECORDING_INFO_FRAME_SIZE = 3;
+
+    /**
+     * Index of the number of frames retained in the recording
+     *
+     * @see #getRecordingInfo(String)
+     */
+    public static final int RECORDING_INFO_FRAME_COUNT = 4;
+    //</editor-fold>
+
+    //<editor-fold desc="Statistics">
+
+    /**
+     * Index of the number of frames sent via {@link #sendBuffer(long)}
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_FRAMES = 0;
+
+    /**
+     * Index of the number of bytes written to the transport
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BYTES = 1;
+
+    /**
+     * Index of the number of byte callback invocations (all messages)
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_TRANSPORT_CALLS = 2;
+
+    /**
+     * Index of the number of transport writes (one SPI/I2C transfer each)
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_TRANSPORT_WRITES = 3;
+
+    /**
+     * Index of the total time spent in the byte callback in nanoseconds (includes gpio calls and delays issued from it)
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BYTE_CB_TIME = 4;
+
+    /**
+     * Index of the number of gpio callback invocations (excluding delays)
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_GPIO_CALLS = 5;
+
+    /**
+     * Index of the total time spent in the gpio callback in nanoseconds (excluding delays)
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_GPIO_CB_TIME = 6;
+
+    /**
+     * Index of the number of delays requested by the display controller
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_DELAY_CALLS = 7;
+
+    /**
+     * Index of the total time spent in delays in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_DELAY_TIME = 8;
+
+    /**
+     * Index of the total time spent sending frames in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_SEND_TIME = 9;
+
+    /**
+     * Index of the median time to send a frame in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_SEND_P50 = 10;
+
+    /**
+     * Index of the 90th percentile of the time to send a frame in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_SEND_P90 = 11;
+
+    /**
+     * Index of the 99th percentile of the time to send a frame in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_SEND_P99 = 12;
+
+    /**
+     * Index of the longest time to send a frame in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_SEND_MAX = 13;
+
+    /**
+     * Index of the median number of bytes written per frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BYTES_PER_FRAME_P50 = 14;
+
+    /**
+     * Index of the 99th percentile of the number of bytes written per frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BYTES_PER_FRAME_P99 = 15;
+
+    /**
+     * Index of the largest number of bytes written for a frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BYTES_PER_FRAME_MAX = 16;
+
+    /**
+     * Index of the median number of byte callback invocations per frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_CALLS_PER_FRAME_P50 = 17;
+
+    /**
+     * Index of the 99th percentile of the number of byte callback invocations per frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_CALLS_PER_FRAME_P99 = 18;
+
+    /**
+     * Index of the largest number of byte callback invocations for a frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_CALLS_PER_FRAME_MAX = 19;
+
+    /**
+     * Index of the median number of transport writes per frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_WRITES_PER_FRAME_P50 = 20;
+
+    /**
+     * Index of the 99th percentile of the number of transport writes per frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_WRITES_PER_FRAME_P99 = 21;
+
+    /**
+     * Index of the largest number of transport writes for a frame
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_WRITES_PER_FRAME_MAX = 22;
+
+    /**
+     * Index of the number of BGRA buffer updates (virtual displays only)
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BGRA_CONVERSIONS = 23;
+
+    /**
+     * Index of the total time spent updating the BGRA buffer in nanoseconds
+     *
+     * @see #getStatistics(long, long[])
+     */
+    public static final int STATS_BGRA_TIME = 24;
+
+    /**
+     * Index of the number of frame scheduler ticks that passed without a frame (deadlines missed because a frame was late)
+     *
+     * @see #getStatistics(long, long[])
+     * @see #waitFrame(long, int)
+     */
+    public static final int STATS_MISSED_DEADLINES = 25;
+
+    /**
+     * Index of the current tick interval of the frame scheduler in nanoseconds (0 if no scheduler is running). Higher
+     * than the interval of the target frame rate while the adaptive pacing has lowered the rate.
+     *
+     * @see #getStatistics(long, long[])
+     * @see #startFrameScheduler(long, int, boolean)
+     */
+    public static final int STATS_FRAME_INTERVAL = 26;
+
+    /**
+     * The number of values returned by {@link #getStatistics(long, long[])}
+     */
+    public static final int STATS_COUNT = 27;
+    //</editor-fold>
+
+    //<editor-fold desc="Emulator statistics">
+
+    /**
+     * Index of the number of commands received by the emulated controller (excluding argument bytes)
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_COMMANDS = 0;
+
+    /**
+     * Index of the number of command argument bytes received by the emulated controller
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_ARGUMENTS = 1;
+
+    /**
+     * Index of the number of data bytes received by the emulated controller
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_DATA_BYTES = 2;
+
+    /**
+     * Index of the number of transfers (start of transfer messages) received by the emulated controller
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_TRANSFERS = 3;
+
+    /**
+     * Index of the number of commands not recognized by the emulated controller
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_UNKNOWN = 4;
+
+    /**
+     * Index of the number of ram address commands (column, page or graphic ram address)
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_ADDRESS_SETS = 5;
+
+    /**
+     * Index of the number of data bytes that could not be applied to the emulated ram (out of range address or text mode writes)
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_DROPPED = 6;
+
+    /**
+     * Index of the display on state (1 = on)
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_DISPLAY_ON = 7;
+
+    /**
+     * Index of the display inversion state (1 = inverted)
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_INVERTED = 8;
+
+    /**
+     * Index of the last contrast value set or -1 if never set (or not supported by the controller)
+     *
+     * @see #getEmulatorStatistics(long, long[])
+     */
+    public static final int EMU_STATS_CONTRAST = 9;
+
+    /**
+     * The number of values returned by {@link #getEmulatorStatistics(long, long[])}
+     */
+    public static final int EMU_STATS_COUNT = 10;
+    //</editor-fold>
+
+    //<editor-fold desc="Hardware scroll directions">
+
+    /**
+     * Continuous horizontal scroll to the right
+     *
+     * @see #startHardwareScroll(long, int, int, int, int, int)
+     */
+    public static final int SCROLL_RIGHT = 0;
+
+    /**
+     * Continuous horizontal scroll to the left
+     *
+     * @see #startHardwareScroll(long, int, int, int, int, int)
+     */
+    public static final int SCROLL_LEFT = 1;
+
+    /**
+     * Continuous vertical and horizontal scroll to the right
+     *
+     * @see #startHardwareScroll(long, int, int, int, int, int)
+     */
+    public static final int SCROLL_VERTICAL_RIGHT = 2;
+
+    /**
+     * Continuous vertical and horizontal scroll to the left
+     *
+     * @see #startHardwareScroll(long, int, int, int, int, int)
+     */
+    public static final int SCROLL_VERTICAL_LEFT = 3;
+    //</editor-fold>
+
+    //<editor-fold desc="Layer blend operations">
+
+    /**
+     * Sets the pixels of the layer
+     *
+     * @see #createLayer(long, int, int)
+     */
+    public static final int LAYER_OP_OR = 0;
+
+    /**
+     * Clears the pixels of the layer (AND-NOT mask)
+     *
+     * @see #createLayer(long, int, int)
+     */
+    public static final int LAYER_OP_MASK = 1;
+
+    /**
+     * Inverts the pixels of the layer
+     *
+     * @see #createLayer(long, int, int)
+     */
+    public static final int LAYER_OP_XOR = 2;
+    //</editor-fold>
+
     private static boolean loading;
 
     private static boolean loaded;
@@ -223,7 +766,7 @@ public class U8g2Graphics {
      */
     public static long setup(String setupProc, int busInterface, int busInterfaceType, int rotation, int[] pinConfig, ByteBuffer buffer, ByteBuffer bufferBgra, Map<String, Object> options, boolean virtual) {
         Package pkg = U8g2Graphics.class.getPackage();
-        return setup(setupProc, busInterface, busInterfaceType, rotation, pinConfig, buffer, bufferBgra, options, virtual, log, pkg.getImplementationVersion());
+        return setup(setupProc, busInterface, busInterfaceType, rotation, pinConfig, buffer, bufferBgra, NativeUtils.encodeOptions(options), virtual, log, pkg.getImplementationVersion());
     }
 
     /**
@@ -242,7 +785,7 @@ public class U8g2Graphics {
      * @param buffer
      *         The buffer that will be used and shared with the native library. All pixel data will be stored in this buffer.
      * @param options
-     *         Additional provider specific options
+     *         Additional provider specific options, encoded by {@link NativeUtils#encodeOptions(Map)}
      * @param virtual
      *         Set to <code>true</code> to enable virtual-mode. All display instructions will be re-routed to the {@link U8g2EventDispatcher}. The transportDevice and gpioDevice parameters will be
      *         ignored.
@@ -256,7 +799,7 @@ public class U8g2Graphics {
      * @throws com.ibasco.ucgdisplay.common.exceptions.NativeLibraryException
      *         on device state or validate errors
      */
-    private static native long setup(String setupProc, int busInterface, int busInterfaceType, int rotation, int[] pinConfig, ByteBuffer buffer, ByteBuffer bufferBgra, Map<String, Object> options, boolean virtual, Logger log, String version);
+    private static native long setup(String setupProc, int busInterface, int busInterfaceType, int rotation, int[] pinConfig, ByteBuffer buffer, ByteBuffer bufferBgra, byte[] options, boolean virtual, Logger log, String version);
 
     /**
      * <p>Draw a box (filled frame), starting at x/y position (upper left edge). The box has width w and height h.
@@ -658,6 +1201,41 @@ public class U8g2Graphics {
      */
     public static native int getUTF8Width(long id, String text);
 
+    /**
+     * <p>Measure and draw multiple text runs with the current font in a single call. The width of each run is computed natively
+     * (and cached per font), so a run can be aligned on its anchor point without calling {@link #getUTF8Width(long, String)} first.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param texts
+     *         The text of each run (null entries are skipped)
+     * @param params
+     *         {@link #TEXT_RUN_PARAM_SIZE} values per run: the x and y anchor point and the flags ({@link #TEXT_ALIGN_LEFT},
+     *         {@link #TEXT_ALIGN_CENTER}, {@link #TEXT_ALIGN_RIGHT}, optionally combined with {@link #TEXT_MEASURE_ONLY})
+     *
+     * @return {@link #TEXT_RUN_EXTENT_SIZE} values per run: the x, y, width and height of the bounding box of the run
+     *
+     * @apiNote This drawing function depends on the current font, font mode, font direction and drawing color.
+     * @see #drawTextRunsDirect(long, ByteBuffer, int)
+     */
+    public static native int[] drawTextRuns(long id, String[] texts, int[] params);
+
+    /**
+     * <p>Same as {@link #drawTextRuns(long, String[], int[])} but the runs are read from a direct buffer (native byte order).
+     * Each run is stored as four 32-bit integers (x, y, flags, number of characters) followed by the UTF-16 characters,
+     * padded to a multiple of 4 bytes.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param runs
+     *         A direct buffer containing the encoded text runs
+     * @param count
+     *         The number of runs stored in the buffer
+     *
+     * @return {@link #TEXT_RUN_EXTENT_SIZE} values per run: the x, y, width and height of the bounding box of the run
+     */
+    public static native int[] drawTextRunsDirect(long id, ByteBuffer runs, int count);
+
     /**
      * <p> Define a u8g2 font for the glyph and string drawing functions. Note: u8x8 font can NOT be used. Available
      * fonts are listed here here. The last two characters of the font name define the type and character set for the font:
@@ -1583,28 +2161,159 @@ public class U8g2Graphics {
     public static native String exportToPBM(long id);
 
     /**
-     * <p>Exports an <a href="https://en.wikipedia.org/wiki/X_BitMap">XBM</a> formatted ASCII string representati0on of the current display buffer.</p>
+     * <p>Exports an <a href="https://en.wikipedia.org/wiki/X_BitMap">XBM</a> formatted ASCII string representati0on of the current display buffer.</p>
+     *
+     * <p>Display controllers: SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0xx</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     *
+     * @return The XBM formatted ASCII representation of the display buffer
+     */
+    public static native String exportToXBM2(long id);
+
+    /**
+     * <p>Exports a <a href="https://en.wikipedia.org/wiki/Netpbm_format">PBM</a> formatted ASCII string representation of the current display buffer</p>
+     *
+     * <p>Display controllers: SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0xx</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     *
+     * @return The PBM formatted ASCII representation of the display buffer
+     */
+    public static native String exportToPBM2(long id);
+
+    /**
+     * Returns the number of bytes written by {@link #exportBuffer(long, int, ByteBuffer)} for the current display buffer
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param format
+     *         One of the EXPORT_FORMAT_* constants (e.g. {@link #EXPORT_FORMAT_PNG})
+     *
+     * @return The size of the encoded image in bytes
+     */
+    public static native int getExportSize(long id, int format);
+
+    /**
+     * <p>Encodes the current display buffer directly into a direct buffer. The image has the dimensions of the display
+     * buffer and is not rotated (same as {@link #exportToPBM(long)}). The position and limit of the buffer are not modified.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param format
+     *         One of the EXPORT_FORMAT_* constants (e.g. {@link #EXPORT_FORMAT_PNG})
+     * @param buffer
+     *         A direct buffer with a capacity of at least {@link #getExportSize(long, int)} bytes
+     *
+     * @return The number of bytes written, starting at index 0 of the buffer
+     */
+    public static native int exportBuffer(long id, int format, ByteBuffer buffer);
+
+    /**
+     * <p>Start recording the frames sent by {@link #sendBuffer(long)} to a memory mapped file. Each frame is stored as a
+     * compressed difference to the previous frame together with its timestamp. Once the file is full, the oldest frames
+     * are overwritten. An existing recording in progress is stopped and the file is overwritten.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param path
+     *         The path of the recording file
+     * @param capacity
+     *         The maximum size of the recorded frame data in bytes (the file is 4096 bytes larger)
+     * @param keyframeInterval
+     *         Store a complete frame every n frames. Smaller values use more space but make random access faster.
+     */
+    public static native void startRecording(long id, String path, int capacity, int keyframeInterval);
+
+    /**
+     * Stop recording and close the recording file
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void stopRecording(long id);
+
+    /**
+     * Reads the properties of a recording created by {@link #startRecording(long, String, int, int)}
+     *
+     * @param path
+     *         The path of the recording file
+     *
+     * @return An array indexed by the RECORDING_INFO_* constants
+     */
+    public static native int[] getRecordingInfo(String path);
+
+    /**
+     * Rebuilds consecutive frames of a recording created by {@link #startRecording(long, String, int, int)}. The frames
+     * are in the raw format of the display buffer, see {@link #RECORDING_INFO_LAYOUT}.
+     *
+     * @param path
+     *         The path of the recording file
+     * @param index
+     *         The index of the first frame (0 = oldest frame retained)
+     * @param count
+     *         The number of frames to read
+     * @param buffer
+     *         A direct buffer receiving the frames back to back (frame size * count bytes)
+     * @param timestamps
+     *         Receives the time each frame was sent (nanoseconds since the epoch), can be null
+     *
+     * @return The number of frames read (less than count if the end of the recording has been reached)
+     */
+    public static native int readRecording(String path, int index, int count, ByteBuffer buffer, long[] timestamps);
+
+    /**
+     * <p>Reads the transport and render counters of the display. The counters are updated without locking while frames
+     * are being sent, percentiles are approximated to within 1/8 of the actual value.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param stats
+     *         Receives the values indexed by the STATS_* constants (at most {@link #STATS_COUNT} values are written)
+     *
+     * @return The number of values written
+     */
+    public static native int getStatistics(long id, long[] stats);
+
+    /**
+     * Resets the counters returned by {@link #getStatistics(long, long[])}
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void resetStatistics(long id);
+
+    /**
+     * <p>Starts or stops recording trace events of the frame pipeline (JNI calls, sendBuffer, BGRA conversion, transport
+     * writes, delays and event upcalls) for all displays. Each thread keeps its most recent events.</p>
      *
-     * <p>Display controllers: SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0xx</p>
+     * <p>Only available if the native library has been built with the UCGD_TRACE option.</p>
      *
-     * @param id
-     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param enabled
+     *         {@code true} to start recording events
      *
-     * @return The XBM formatted ASCII representation of the display buffer
+     * @throws com.ibasco.ucgdisplay.common.exceptions.NativeLibraryException
+     *         If enabled and the native library has been built without trace support
      */
-    public static native String exportToXBM2(long id);
+    public static native void setTraceEnabled(boolean enabled);
 
     /**
-     * <p>Exports a <a href="https://en.wikipedia.org/wiki/Netpbm_format">PBM</a> formatted ASCII string representation of the current display buffer</p>
+     * Writes the recorded trace events to a file in the Chrome trace-event JSON format (can be opened in
+     * <a href="https://ui.perfetto.dev">Perfetto</a> or chrome://tracing).
      *
-     * <p>Display controllers: SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0xx</p>
+     * @param path
+     *         The path of the output file (overwritten)
+     * @param clear
+     *         {@code true} to drop the exported events afterwards
      *
-     * @param id
-     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @return The number of events written
      *
-     * @return The PBM formatted ASCII representation of the display buffer
+     * @throws com.ibasco.ucgdisplay.common.exceptions.NativeLibraryException
+     *         If the file cannot be written or the native library has been built without trace support
      */
-    public static native String exportToPBM2(long id);
+    public static native int exportTrace(String path, boolean clear);
 
     /**
      * <p>Send special commands to the display controller. These commands are specified in the datasheet of the display
@@ -1668,6 +2377,28 @@ public class U8g2Graphics {
      */
     public static native void drawPixels(long id, int x, int y, int width, int height, byte[] buffer);
 
+    /**
+     * <p>Write a 1bpp image directly into the display buffer. Each row starts on a byte boundary ((width + 7) / 8 bytes per row)
+     * and the most significant bit is the left-most pixel. The display rotation, the clip window and the current page are honoured.
+     * A full screen image in {@link #BLIT_MODE_COPY} mode is copied row by row into the buffer.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param x
+     *         The destination x-coordinate
+     * @param y
+     *         The destination y-coordinate
+     * @param width
+     *         The width of the image
+     * @param height
+     *         The height of the image
+     * @param buffer
+     *         A direct buffer containing the image
+     * @param mode
+     *         One of {@link #BLIT_MODE_CLEAR}, {@link #BLIT_MODE_SET}, {@link #BLIT_MODE_XOR} or {@link #BLIT_MODE_COPY}
+     */
+    public static native void blit(long id, int x, int y, int width, int height, ByteBuffer buffer, int mode);
+
     /**
      * <p>Draws pixels on the screen based on the provided pixel buffer. This buffer is using the BGRA format. The size of the buffer is determined by the following formulat: width * height * 4</p>
      *
@@ -1683,4 +2414,439 @@ public class U8g2Graphics {
      *         The height of the area to be drawn
      */
     public static native void drawPixelsBgra(long id, int x, int y, int width, int height, byte[] buffer);
+
+    /**
+     * <p>Draws a BGRA image stored in a direct buffer. The image is converted using the dither mode of the display (see {@link #setDitherMode(long, int, int)}).
+     * Except for {@link #DITHER_NONE}, the image is drawn opaque (unset pixels are cleared).</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param x
+     *         The destination x-coordinate
+     * @param y
+     *         The destination y-coordinate
+     * @param width
+     *         The width of the image
+     * @param height
+     *         The height of the image
+     * @param buffer
+     *         A direct buffer containing the image
+     * @param stride
+     *         The number of bytes between the start of two rows. Use 0 for tightly packed rows (width * 4).
+     */
+    public static native void drawPixelsBgraDirect(long id, int x, int y, int width, int height, ByteBuffer buffer, int stride);
+
+    /**
+     * Sets the method used to convert BGRA images to monochrome for {@link #drawPixelsBgra(long, int, int, int, int, byte[])} and {@link #drawPixelsBgraDirect(long, int, int, int, int, ByteBuffer, int)}
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param mode
+     *         One of the DITHER_* constants (e.g. {@link #DITHER_FLOYD_STEINBERG})
+     * @param threshold
+     *         The luma threshold (0 - 255) used by the threshold and error diffusion modes (e.g. {@link #DITHER_DEFAULT_THRESHOLD})
+     */
+    public static native void setDitherMode(long id, int mode, int threshold);
+
+    /**
+     * <p>Stores a copy of a monochrome image in the native sprite store of the display. The image is converted to the buffer
+     * layout of the display on first use, subsequent {@link #drawSprite(long, int, int, int)} calls do not transfer any data.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param data
+     *         The image data
+     * @param width
+     *         The width of the image
+     * @param height
+     *         The height of the image
+     * @param format
+     *         Either {@link #SPRITE_FORMAT_XBM} or {@link #SPRITE_FORMAT_1BPP}
+     *
+     * @return The handle of the sprite
+     *
+     * @throws com.ibasco.ucgdisplay.common.exceptions.NativeLibraryException
+     *         If the sprite does not fit within the sprite budget of the display
+     */
+    public static native int uploadSprite(long id, byte[] data, int width, int height, int format);
+
+    /**
+     * <p>Draws a sprite previously stored via {@link #uploadSprite(long, byte[], int, int, int)}. The sprite is drawn the same
+     * way as {@link #drawXBM(long, int, int, int, int, byte[])} (current draw color and bitmap mode).</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the sprite
+     * @param x
+     *         The x-coordinate of the upper left corner
+     * @param y
+     *         The y-coordinate of the upper left corner
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean drawSprite(long id, int handle, int x, int y);
+
+    /**
+     * Releases a sprite and the memory used by its converted copies
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the sprite
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean evictSprite(long id, int handle);
+
+    /**
+     * Releases all the sprites of the display
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void clearSprites(long id);
+
+    /**
+     * <p>Start recording a display list. Until {@link #endDisplayList(long)} is called, the draw functions are recorded instead
+     * of being drawn, while font, color, bitmap mode and clip window changes are applied immediately and recorded (text metrics
+     * keep working). The state of the display at this point is restored before the list is replayed. A previously recorded
+     * list is discarded.</p>
+     *
+     * <p>drawBitmap, drawTextRuns, drawPixels, blit, sendBuffer and the firstPage/nextPage functions are not supported while recording.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void beginDisplayList(long id);
+
+    /**
+     * Stop recording the display list
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     *
+     * @return The number of recorded operations
+     */
+    public static native int endDisplayList(long id);
+
+    /**
+     * <p>Draws the recorded display list and sends it to the display. For page buffer setup procedures (_1/_2), the list is
+     * replayed for each page of a native firstPage()/nextPage() loop. For full buffer setup procedures the list is drawn once,
+     * followed by {@link #sendBuffer(long)}. Each page is cleared first unless auto page clear has been disabled.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     *
+     * @return The number of pages sent to the display
+     */
+    public static native int renderDisplayList(long id);
+
+    /**
+     * <p>Reads the image of the emulated display controller of a virtual display. The emulator decodes the command and data
+     * bytes u8g2 sends to the controller and applies them to a simulated display ram, so the image can be compared with the
+     * display buffer to validate the wire protocol. Emulated controllers: SSD1305/SSD1306/SSD1309, SH1106, ST7565/ST7567,
+     * UC1701 and ST7920.</p>
+     *
+     * <p>The image has the same layout and size as the display buffer (vertical for page addressed controllers, horizontal
+     * for the ST7920).</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param image
+     *         Receives the image
+     * @param effects
+     *         If true, the display on/off, inversion, all pixels on and start line settings of the controller are applied, otherwise
+     *         the raw ram contents are returned
+     *
+     * @return The number of bytes written or -1 if the display is not virtual or its controller is not emulated
+     */
+    public static native int getEmulatorImage(long id, byte[] image, boolean effects);
+
+    /**
+     * Reads the command statistics and state of the emulated display controller of a virtual display
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param stats
+     *         Receives the values indexed by the EMU_STATS_* constants (at most {@link #EMU_STATS_COUNT} values are written)
+     *
+     * @return The number of values written or -1 if the display is not virtual or its controller is not emulated
+     */
+    public static native int getEmulatorStatistics(long id, long[] stats);
+
+    /**
+     * <p>Shifts the pixels of a region of the display buffer by dx, dy pixels. Pixels moved out of the region are discarded and
+     * the vacated pixels are set to the fill value, so a ticker or a strip chart only needs to draw the newly exposed column
+     * or row instead of redrawing the whole buffer. Whole byte moves are done with memmove, other moves with word wide bit
+     * shifts.</p>
+     *
+     * <p>The region is specified in user coordinates (the display rotation is honoured). For page buffer setup procedures
+     * (_1/_2) only the rows of the current page are shifted.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param x
+     *         X-coordinate of the region
+     * @param y
+     *         Y-coordinate of the region
+     * @param width
+     *         Width of the region
+     * @param height
+     *         Height of the region
+     * @param dx
+     *         Horizontal distance in pixels (positive = right)
+     * @param dy
+     *         Vertical distance in pixels (positive = down)
+     * @param fill
+     *         Value of the vacated pixels
+     */
+    public static native void scrollBuffer(long id, int x, int y, int width, int height, int dx, int dy, boolean fill);
+
+    /**
+     * <p>Configures and activates the continuous scroll of the display controller (SSD1306/SSD1309 only). Once started, the
+     * controller scrolls its ram on its own and no data has to be transmitted. The scroll has to be stopped with
+     * {@link #stopHardwareScroll(long)} before the buffer is sent again, and the buffer has to be sent after stopping it
+     * (the display ram is undefined after a scroll).</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param direction
+     *         One of {@link #SCROLL_RIGHT}, {@link #SCROLL_LEFT}, {@link #SCROLL_VERTICAL_RIGHT} or {@link #SCROLL_VERTICAL_LEFT}
+     * @param startPage
+     *         The first page (8 pixel row) to scroll
+     * @param endPage
+     *         The last page to scroll (must not be less than startPage)
+     * @param interval
+     *         The frame interval code of the controller (0 = 5 frames, 1 = 64, 2 = 128, 3 = 256, 4 = 3, 5 = 4, 6 = 25, 7 = 2)
+     * @param verticalOffset
+     *         The number of rows scrolled per step (0 to 63, only used by the vertical directions)
+     */
+    public static native void startHardwareScroll(long id, int direction, int startPage, int endPage, int interval, int verticalOffset);
+
+    /**
+     * Deactivates the continuous scroll of the display controller (SSD1306/SSD1309 only)
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void stopHardwareScroll(long id);
+
+    /**
+     * <p>Creates an offscreen monochrome layer the size of the display buffer. A layer keeps its content until it is drawn
+     * again, static parts of a screen (frames, labels, icons) are drawn into a layer once and only the changing values are
+     * drawn into the display buffer for each frame. The visible layers are composited into the display buffer (the bottom of
+     * the stack) in ascending z-order when it is sent, with word wide operations.</p>
+     *
+     * <p>After the buffer has been sent it holds the composited frame and must be cleared before the next frame is drawn.
+     * Layers require a full buffer setup procedure (_f). Their content is cleared if the size of the buffer changes and has
+     * to be redrawn after the rotation of the display is changed.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param z
+     *         The z-order of the layer (layers with the same z-order are composited in creation order)
+     * @param op
+     *         One of {@link #LAYER_OP_OR}, {@link #LAYER_OP_MASK} or {@link #LAYER_OP_XOR}
+     *
+     * @return The handle of the layer
+     *
+     * @throws com.ibasco.ucgdisplay.common.exceptions.NativeLibraryException
+     *         If the setup procedure of the display is a page buffer (_1/_2)
+     */
+    public static native int createLayer(long id, int z, int op);
+
+    /**
+     * Releases a layer
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the layer
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean removeLayer(long id, int handle);
+
+    /**
+     * Releases all layers of the display
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void clearLayers(long id);
+
+    /**
+     * Redirects all drawing operations to the layer until {@link #endLayer(long)} is called. The content of the layer is
+     * kept, call {@link #clearBuffer(long)} to start over. The buffer cannot be sent while a layer is being drawn.
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the layer
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean beginLayer(long id, int handle);
+
+    /**
+     * Draws into the display buffer again
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void endLayer(long id);
+
+    /**
+     * Shows or hides a layer
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the layer
+     * @param visible
+     *         {@code true} to composite the layer
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean setLayerVisible(long id, int handle, boolean visible);
+
+    /**
+     * Moves a layer by x, y pixels (the display rotation is honoured). Pixels moved out of the display are not composited.
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the layer
+     * @param x
+     *         The horizontal offset
+     * @param y
+     *         The vertical offset
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean setLayerOffset(long id, int handle, int x, int y);
+
+    /**
+     * Changes the z-order of a layer
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the layer
+     * @param z
+     *         The z-order (lower values are composited first)
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean setLayerZOrder(long id, int handle, int z);
+
+    /**
+     * Changes the blend operation of a layer
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param handle
+     *         The handle of the layer
+     * @param op
+     *         One of {@link #LAYER_OP_OR}, {@link #LAYER_OP_MASK} or {@link #LAYER_OP_XOR}
+     *
+     * @return {@code false} if the handle is unknown
+     */
+    public static native boolean setLayerOp(long id, int handle, int op);
+
+    /**
+     * <p>Returns the area of the last composited frame that differs from the frame before it, in tiles (8x8 pixels) of the
+     * display. Only tracked while the display has layers, otherwise the whole display is returned. The same area is stored
+     * with each frame published to shared memory, and only this area is transmitted when the partial_update option is set.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     *
+     * @return The area as {x, y, width, height}, the width and height are 0 if nothing changed
+     */
+    public static native int[] getDirtyArea(long id);
+
+    /**
+     * <p>Creates an offscreen canvas of the specified size. A canvas is not bound to a display controller or transport, the
+     * returned id is accepted by every drawing method of this class (the same way as a display id). Render a frame once into
+     * the canvas and copy it into the buffer of each display with {@link #blitCanvas(long, long, int, int, int, int, int, int)}
+     * to mirror it on identical panels or to span one large canvas across a grid of displays.</p>
+     *
+     * @param width
+     *         Width of the canvas in pixels (1 to 2040)
+     * @param height
+     *         Height of the canvas in pixels (1 to 2040)
+     *
+     * @return The canvas id
+     */
+    public static native long createCanvas(int width, int height);
+
+    /**
+     * Releases a canvas created by {@link #createCanvas(int, int)}. The id is no longer valid afterwards.
+     *
+     * @param canvasId
+     *         The canvas id
+     */
+    public static native void destroyCanvas(long canvasId);
+
+    /**
+     * <p>Copies an area of a canvas into the buffer of a display (set and unset pixels are both copied). The area is clipped
+     * to the canvas, the clip window and the current page of the display. The buffer still needs to be sent, e.g. with
+     * {@link #sendBuffer(long)}.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param canvasId
+     *         The canvas id retrieved via {@link #createCanvas(int, int)}
+     * @param srcX
+     *         X-coordinate of the area in the canvas
+     * @param srcY
+     *         Y-coordinate of the area in the canvas
+     * @param width
+     *         Width of the area
+     * @param height
+     *         Height of the area
+     * @param x
+     *         X-coordinate of the area on the display
+     * @param y
+     *         Y-coordinate of the area on the display
+     */
+    public static native void blitCanvas(long id, long canvasId, int srcX, int srcY, int width, int height, int x, int y);
+
+    /**
+     * <p>Starts pacing the frames of the display with a native timer. The render thread blocks in {@link #waitFrame(long, int)}
+     * until the next tick, draws and sends the frame. The time each frame takes to send is measured by
+     * {@link #sendBuffer(long)} and {@link #renderDisplayList(long)}, in adaptive mode the rate is lowered when the
+     * transport cannot keep up with the target rate and raised back once it can. A running scheduler is replaced. Linux only.</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param fps
+     *         The target frame rate (1 to 1000)
+     * @param adaptive
+     *         Lower the rate when the transport cannot keep up
+     */
+    public static native void startFrameScheduler(long id, int fps, boolean adaptive);
+
+    /**
+     * Stops the frame scheduler of the display, threads blocked in {@link #waitFrame(long, int)} return -1
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     */
+    public static native void stopFrameScheduler(long id);
+
+    /**
+     * <p>Blocks until the next tick of the frame scheduler. More than one tick is returned when the previous frame
+     * was late, the extra ticks are counted as missed deadlines (see {@link #STATS_MISSED_DEADLINES}).</p>
+     *
+     * @param id
+     *         The display instance id retrieved via {@link #setup(String, int, int, int, int[], ByteBuffer, ByteBuffer, Map, boolean)}
+     * @param timeout
+     *         Maximum time to wait in milliseconds (negative to wait until the next tick)
+     *
+     * @return The number of ticks since the previous call, 0 on timeout or -1 if no scheduler is running
+     */
+    public static native int waitFrame(long id, int timeout);
 }
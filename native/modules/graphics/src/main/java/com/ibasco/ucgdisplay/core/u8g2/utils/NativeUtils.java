@@ -21,6 +21,11 @@
  */
 package com.ibasco.ucgdisplay.core.u8g2.utils;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.util.Map;
+
 public class NativeUtils {
     public static int toInteger(Object obj) {
         if (obj instanceof Integer) {
@@ -28,4 +33,59 @@ public class NativeUtils {
         }
         return -1;
     }
+
+    private static final byte OPTION_TYPE_NULL = 0;
+
+    private static final byte OPTION_TYPE_INT = 1;
+
+    private static final byte OPTION_TYPE_BOOL = 2;
+
+    private static final byte OPTION_TYPE_STRING = 3;
+
+    /**
+     * Encode the display options into the flat buffer decoded by the native library at setup (see UcgdSettings.h for the layout)
+     *
+     * @param options
+     *         The options, values must be an {@link Integer}, {@link Boolean}, {@link String} or null
+     *
+     * @return The encoded options or null if the map is null
+     *
+     * @throws IllegalArgumentException
+     *         if a key or a value can not be encoded
+     */
+    public static byte[] encodeOptions(Map<String, Object> options) {
+        if (options == null)
+            return null;
+        if (options.size() > 0xffff)
+            throw new IllegalArgumentException("Too many options: " + options.size());
+        int size = 2;
+        for (Map.Entry<String, Object> entry : options.entrySet())
+            size += 2 + entry.getKey().getBytes(StandardCharsets.UTF_8).length + 2 + (entry.getValue() == null ? 0 : entry.getValue().toString().getBytes(StandardCharsets.UTF_8).length + 4);
+        ByteBuffer buffer = ByteBuffer.allocate(size).order(ByteOrder.LITTLE_ENDIAN);
+        buffer.putShort((short) options.size());
+        for (Map.Entry<String, Object> entry : options.entrySet()) {
+            byte[] key = entry.getKey().getBytes(StandardCharsets.UTF_8);
+            if (key.length > 0xff)
+                throw new IllegalArgumentException("Option key is too long: " + entry.getKey());
+            Object value = entry.getValue();
+            if (value == null) {
+                buffer.put(OPTION_TYPE_NULL).put((byte) key.length).put(key);
+            } else if (value instanceof Integer) {
+                buffer.put(OPTION_TYPE_INT).put((byte) key.length).put(key).putInt((Integer) value);
+            } else if (value instanceof Boolean) {
+                buffer.put(OPTION_TYPE_BOOL).put((byte) key.length).put(key).put((byte) ((Boolean) value ? 1 : 0));
+            } else if (value instanceof String) {
+                byte[] str = ((String) value).getBytes(StandardCharsets.UTF_8);
+                if (str.length > 0xffff)
+                    throw new IllegalArgumentException("Value of option '" + entry.getKey() + "' is too long");
+                buffer.put(OPTION_TYPE_STRING).put((byte) key.length).put(key).putShort((short) str.length).put(str);
+            } else {
+                throw new IllegalArgumentException("Unsupported value type for key: \"" + entry.getKey() + "\" (" + value.getClass().getSimpleName() + ")");
+            }
+        }
+        byte[] encoded = new byte[buffer.position()];
+        buffer.flip();
+        buffer.get(encoded);
+        return encoded;
+    }
 }
@@ -23,6 +23,7 @@ module ucgd.nativ.graphics {
     exports com.ibasco.ucgdisplay.core.u8g2;
     exports com.ibasco.ucgdisplay.core.u8g2.exceptions;
     exports com.ibasco.ucgdisplay.core.u8g2.utils;
+    exports com.ibasco.ucgdisplay.core.input;
 
     requires org.slf4j;
     requires ucgd.common;